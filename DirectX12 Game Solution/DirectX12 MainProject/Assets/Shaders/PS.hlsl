@@ -1,7 +1,24 @@
-Texture2D<float4> tex  : register(t0);
-Texture2D<float4> sph  : register(t1);
-Texture2D<float4> toon : register(t2);
-SamplerState      samp : register(s0);
+struct Material
+{
+	float4 diffuse;
+	float4 specular;
+	float3 ambient;
+	float  edgeSize;
+	float4 edgeColor;
+	uint   textureIndex;
+	uint   sphereIndex;
+	uint   toonIndex;
+	uint   flags;
+};
+
+Texture2D<float4>          textures[] : register(t0, space1);
+StructuredBuffer<Material> materials  : register(t4);
+Texture2DArray<float4>     toons      : register(t5);
+SamplerState               samp       : register(s0);
+SamplerState               toonSamp   : register(s1);
+
+//flags̏ʃrbg(MaterialRecord::TOON_TEXTURE)
+static const uint TOON_TEXTURE = 0x100;
 
 struct VSOUT {
 	float4 svpos : SV_POSITION;
@@ -12,15 +29,24 @@ struct VSOUT {
 
 };
 
-cbuffer Material : register(b1)
+cbuffer DrawConstants : register(b1)
 {
-	float4 diffuse;
-	float4 specular;
-	float3 ambient;
+	uint materialIndex;
+}
+
+//gD[(LgD[̓eNX`z̃XCXAfŗL̂̂͋ʃq[ṽeNX`)
+float4 SampleToon(Material material, float diffuseB)
+{
+	float2 toonUV = float2(0.0f, 0.5f - diffuseB * 0.5f);
+	if (material.flags & TOON_TEXTURE)
+		return textures[material.toonIndex].Sample(toonSamp, toonUV);
+	return toons.Sample(toonSamp, float3(toonUV, material.toonIndex));
 }
 
 float4 BasicPS(VSOUT vsout) : SV_TARGET
 {
+	Material material = materials[materialIndex];
+
 	float3 light = normalize(float3(1,-1,1));
 
 	float3 lightColor = float3(1, 1, 1);
@@ -31,15 +57,16 @@ float4 BasicPS(VSOUT vsout) : SV_TARGET
 	brightness = min(brightness + 0.25f, 1.0f);
 
 	float2 sphereMapUV = vsout.vnormal.xy;
-	float4 texColor = tex.Sample(samp, vsout.uv);
+	float4 texColor = textures[material.textureIndex].Sample(samp, vsout.uv);
 
 	float3 refLight = normalize(reflect(light, vsout.normal.xyz));
-	float  specularB = pow(saturate(dot(refLight, -vsout.ray)), specular.a);
+	float  specularB = pow(saturate(dot(refLight, -vsout.ray)), material.specular.a);
 
 
 	return	float4(brightness, brightness, brightness,1)
-			* diffuse
+			* material.diffuse
 			* texColor
-			* sph.Sample(samp, sphereMapUV)
+			* textures[material.sphereIndex].Sample(samp, sphereMapUV)
+			* SampleToon(material, diffuseB)
 			;
 }
\ No newline at end of file
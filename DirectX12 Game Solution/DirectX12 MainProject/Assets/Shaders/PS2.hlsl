@@ -1,5 +1,24 @@
-Texture2D<float4> tex  : register(t0);
-SamplerState      samp : register(s0);
+struct Material
+{
+	float4 diffuse;
+	float4 specular;
+	float3 ambient;
+	float  edgeSize;
+	float4 edgeColor;
+	uint   textureIndex;
+	uint   sphereIndex;
+	uint   toonIndex;
+	uint   flags;
+};
+
+Texture2D<float4>          textures[] : register(t0, space1);
+StructuredBuffer<Material> materials  : register(t4);
+Texture2DArray<float4>     toons      : register(t5);
+SamplerState               samp       : register(s0);
+SamplerState               toonSamp   : register(s1);
+
+//flags̏ʃrbg(MaterialRecord::TOON_TEXTURE)
+static const uint TOON_TEXTURE = 0x100;
 
 struct VSOUT {
 	float4 svpos : SV_POSITION;
@@ -9,19 +28,29 @@ struct VSOUT {
 
 };
 
-cbuffer Material : register(b1)
+cbuffer DrawConstants : register(b1)
 {
-	float4 diffuse;
-	float4 specular;
-	float3 ambient;
+	uint materialIndex;
+}
+
+//gD[(LgD[̓eNX`z̃XCXAfŗL̂̂͋ʃq[ṽeNX`)
+float4 SampleToon(Material material, float diffuseB)
+{
+	float2 toonUV = float2(0.0f, 0.5f - diffuseB * 0.5f);
+	if (material.flags & TOON_TEXTURE)
+		return textures[material.toonIndex].Sample(toonSamp, toonUV);
+	return toons.Sample(toonSamp, float3(toonUV, material.toonIndex));
 }
 
 float4 BasicPS(VSOUT vsout) : SV_TARGET
 {
+	Material material = materials[materialIndex];
 
 float3 light = normalize(float3(1,-1,1));
 	float brightness = max(dot(-light, vsout.normal), 0.0f);
 	brightness = min(brightness + 0.25f, 1.0f);
 
-	return float4(brightness, brightness, brightness, 1.0f) * tex.Sample(samp, vsout.uv);
+	return float4(brightness, brightness, brightness, 1.0f)
+			* textures[material.textureIndex].Sample(samp, vsout.uv)
+			* SampleToon(material, dot(-light, vsout.normal.xyz));
 }
\ No newline at end of file
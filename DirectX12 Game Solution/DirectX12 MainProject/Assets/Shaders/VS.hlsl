@@ -7,15 +7,29 @@ struct VSOUT
     float2 uv    : TEXCOORD;
 };
 
-cbuffer cbuff:register(b0) {
+cbuffer Camera:register(b0) {
 
-    matrix world;
     matrix view;
     matrix proj;
     float3 eye;
+}
+
+cbuffer World:register(b2) {
+    matrix world;
+}
+
+cbuffer Bone:register(b3) {
     matrix bones[512];
 }
 
+struct Instance
+{
+    matrix world;
+    uint   boneOffset;
+    uint3  padding;
+};
+StructuredBuffer<Instance> instances : register(t3);
+
 VSOUT BasicVS(
     float4 pos : POSITION,
     float4 normal : NORMAL,
@@ -24,11 +38,15 @@ VSOUT BasicVS(
    /* int boneno1 : BONENO1,
     int boneno2 : BONENO2,
     int boneno3 : BONENO3,
-    float  weight : WEIGHT*/)
+    float  weight : WEIGHT*/,
+    uint instanceID : SV_InstanceID)
 {
 
     VSOUT vsout;
-    //pos = mul(bones[boneno], pos);
+    //{[̓CX^X̃pbg̐擪琔(pbg̊O͓ǂ܂Ȃ)
+    //pos = mul(bones[min(instances[instanceID].boneOffset + boneno, 511)], pos);
+    pos = mul(instances[instanceID].world, pos);
+    normal.xyz = mul((float3x3)instances[instanceID].world, normal.xyz);
     vsout.svpos = mul(world, pos);
     vsout.svpos = mul(view, vsout.svpos);
     vsout.svpos = mul(proj, vsout.svpos);
@@ -40,6 +40,17 @@ namespace DX12 {
 		return descripterHeap->GetGpuHandle(index);
 	}
 
+	inline void CreateTextureSRV(
+		ID3D12Device* device, const wchar_t* szFileName,
+		DirectX::ResourceUploadBatch& resourceUpload,
+		const D3D12_CPU_DESCRIPTOR_HANDLE srvDescriptor,
+		_Outptr_ ID3D12Resource** texture
+	)
+	{
+		DX::ThrowIfFailed(DirectX::CreateWICTextureFromFile(device, resourceUpload, szFileName, texture));
+		DirectX::CreateShaderResourceView(device, *texture, srvDescriptor);
+	}
+
 	inline std::unique_ptr<DirectX::DescriptorHeap> CreateDescriptorHeap(
 		ID3D12Device* device, size_t count
 	)
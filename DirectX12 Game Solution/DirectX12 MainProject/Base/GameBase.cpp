@@ -5,6 +5,25 @@
 #include "pch.h"
 #include "dxtk.h"
 #include "SceneFactory.h"
+#include "tool/DescriptorAllocator.h"
+#include "tool/TextureStreamer.h"
+#include "tool/TextureResidency.h"
+#include "tool/UploadQueue.h"
+#include "tool/AssetFiles.h"
+#include "tool/FramePipeline.h"
+#include "tool/FramePacket.h"
+#include "tool/CommandListPool.h"
+#include "tool/JobSystem.h"
+#include "tool/Profiler.h"
+#include "tool/GpuTimer.h"
+#include "tool/FramePacer.h"
+#include "tool/DirtyRegion.h"
+#include "tool/TextureCache.h"
+#include "tool/ModelCache.h"
+#include "tool/PipelineLibrary.h"
+#include "tool/ToonTextureArray.h"
+
+#include <chrono>
 
 #pragma comment(lib, "d3d9.lib")
 
@@ -13,6 +32,40 @@ using namespace DirectX;
 
 dxtk* DXTK = nullptr;
 
+namespace
+{
+    // A command list with its own allocator, recycled by CommandListPool once its back buffer comes around again.
+    class D3D12RecordingList final : public RecordingList
+    {
+    public:
+        explicit D3D12RecordingList(ID3D12Device* device)
+        {
+            DX::ThrowIfFailed(device->CreateCommandAllocator(
+                D3D12_COMMAND_LIST_TYPE_DIRECT, IID_PPV_ARGS(m_allocator.ReleaseAndGetAddressOf())
+            ));
+            DX::ThrowIfFailed(device->CreateCommandList(
+                0, D3D12_COMMAND_LIST_TYPE_DIRECT, m_allocator.Get(), nullptr,
+                IID_PPV_ARGS(m_commandList.ReleaseAndGetAddressOf())
+            ));
+            DX::ThrowIfFailed(m_commandList->Close());
+        }
+
+        void Reset() override
+        {
+            DX::ThrowIfFailed(m_allocator->Reset());
+            DX::ThrowIfFailed(m_commandList->Reset(m_allocator.Get(), nullptr));
+        }
+
+        void Close() override { DX::ThrowIfFailed(m_commandList->Close()); }
+
+        ID3D12GraphicsCommandList* Get() const { return m_commandList.Get(); }
+
+    private:
+        ComPtr<ID3D12CommandAllocator>    m_allocator;
+        ComPtr<ID3D12GraphicsCommandList> m_commandList;
+    };
+}
+
 const D3D12_RESOURCE_STATES GameBase::m_resourceState[AdapterCount]
 { D3D12_RESOURCE_STATE_PRESENT, D3D12_RESOURCE_STATE_COMMON };
 
@@ -21,6 +74,7 @@ GameBase::GameBase() :
     m_outputWidth(static_cast<int>(screen::width)),
     m_outputHeight(static_cast<int>(screen::height)),
     m_adapterCount(0),
+    m_swapChainFlags(0),
     m_backBufferIndex(0),
 #if DXTK_MULTIGPU
     m_crossAdapterTextureSupport(FALSE),
@@ -31,19 +85,138 @@ GameBase::GameBase() :
     m_renderFenceValue(0),
 #endif
 #if DXTK_D3D9
-    m_d3d12UploadFenceValue(0),
+    m_d3d9ScratchWidth(0),
+    m_d3d9ScratchHeight(0),
+    m_d3d9StretchFromTexture(false),
     m_d3d12Footprint{},
+    m_d3d12UploadMapped{},
+    m_d3d12UploadFenceValues{},
+    m_d3d12UploadIndex(0),
+    m_d3d12UploadFenceValue(0),
+    m_d3d9ClearColor(0),
+    m_d3d9Statistics{},
 #endif
     m_retryAudio(false),
+#if DXTK_PACING
+    m_allowTearing(false),
+    m_framePresented(true),
+#endif
+    m_preloadNext(NextScene::Continue),
+    m_preloadRequest(NextScene::Continue),
+    m_transition{},
+    m_sceneStatistics{},
+    m_framePipeline(std::make_unique<FramePipeline>()),
+    m_nextScene(NextScene::Continue),
     m_dxtk(nullptr)
 {
     DX::ThrowIfFailed(DXGIDeclareAdapterRemovalSupport());
     SetCurrentDirectory(L"Assets");
+
+#if DXTK_PACING
+    // Sleep() rounds up to the system tick; a high-resolution timer wakes the limiter well inside its spin margin.
+    m_pacingTimer.Attach(CreateWaitableTimerExW(nullptr, nullptr, CREATE_WAITABLE_TIMER_HIGH_RESOLUTION, TIMER_ALL_ACCESS));
+    m_framePacer = std::make_unique<FramePacer>(FramePacer::Settings(), FramePacer::Now, [this](uint64_t ns)
+        {
+            LARGE_INTEGER dueTime;
+            dueTime.QuadPart = -static_cast<LONGLONG>(ns / 100);
+            if (ns == 0 || !m_pacingTimer.IsValid() ||
+                !SetWaitableTimerEx(m_pacingTimer.Get(), &dueTime, 0, nullptr, nullptr, nullptr, 0))
+            {
+                FramePacer::SleepFor(ns);
+                return;
+            }
+            WaitForSingleObjectEx(m_pacingTimer.Get(), INFINITE, FALSE);
+        });
+#endif
 }
 
 GameBase::~GameBase()
 {
+    // Let the simulation thread finish its frame before the scene is torn down.
+    m_framePipeline->Finish();
     m_scene->Terminate();
+    m_preloadScene.reset();
+
+    // Textures are only loaded once a material using them is seen; report how many never were.
+    const auto residency = TextureResidency::Get().GetStatistics();
+    char message[128];
+    sprintf_s(message, "TextureResidency: %zu of %zu textures were never needed\n", residency.neverNeeded, residency.registered);
+    OutputDebugStringA(message);
+
+    const auto files = AssetFiles::Get().GetStatistics();
+    sprintf_s(message, "AssetFiles: %zu opened from archives, %zu loose, %zu missing\n", files.archiveOpens, files.looseOpens, files.failures);
+    OutputDebugStringA(message);
+
+    // Overlap is the simulation time the main thread did not have to wait for.
+    const auto pipeline = m_framePipeline->GetStatistics();
+    if (pipeline.frames > 0)
+    {
+        const double frames = static_cast<double>(pipeline.frames);
+        sprintf_s(message, "FramePipeline: %llu frames, simulate %.2fms, record %.2fms, waited %.2fms per frame (overlap %.2fms)\n",
+            pipeline.frames, pipeline.simulateMs / frames, pipeline.renderMs / frames, pipeline.waitMs / frames,
+            (pipeline.simulateMs - pipeline.waitMs) / frames);
+        OutputDebugStringA(message);
+    }
+
+    // Helped counts jobs the waiting thread ran itself instead of blocking.
+    const auto jobs = JobSystem::Get().GetStatistics();
+    sprintf_s(message, "JobSystem: %u workers, %llu jobs (%llu background), %llu stolen, %llu helped, %llu threw\n",
+        JobSystem::Get().GetWorkerCount(), jobs.jobs, jobs.background, jobs.steals, jobs.helped, jobs.exceptions);
+    OutputDebugStringA(message);
+
+    // The first scene's load counts as a transition. Reused assets were taken over from the
+    // outgoing scene (or shared within one); loaded ones were read from disk.
+    if (m_sceneStatistics.transitions > 0)
+    {
+        const auto& scenes = m_sceneStatistics;
+        char line[256];
+        sprintf_s(line, "Scenes: %llu transitions (%llu preloaded), waited %.1fms on average, models %zu reused %zu loaded, textures %zu reused %zu loaded, released %zu models %zu textures\n",
+            scenes.transitions, scenes.preloaded, scenes.waitMs / static_cast<double>(scenes.transitions),
+            scenes.modelsReused, scenes.modelsLoaded, scenes.texturesReused, scenes.texturesLoaded, scenes.modelsReleased, scenes.texturesReleased);
+        OutputDebugStringA(line);
+    }
+
+#if DXTK_PACING
+    // Input to present is the latency the pacer controls; missed counts frames that overran the limiter.
+    const auto pacing = m_framePacer->GetStatistics();
+    if (pacing.frames > 0)
+    {
+        const double frames = static_cast<double>(pacing.frames);
+        sprintf_s(message, "FramePacer: %llu frames, input to present %.2fms, limiter slept %.2fms per frame, %llu missed\n",
+            pacing.frames, pacing.workNs / frames * 1e-6, pacing.sleptNs / frames * 1e-6, pacing.missed);
+        OutputDebugStringA(message);
+    }
+#endif
+
+#if DXTK_D3D9
+    // Skipped updates had nothing drawn to the Direct3D9 layer and read nothing back.
+    if (m_d3d9Statistics.updates > 0 || m_d3d9Statistics.skipped > 0)
+    {
+        const double updates = static_cast<double>(std::max<uint64_t>(m_d3d9Statistics.updates, 1));
+        sprintf_s(message, "D3D9: %llu updates, %.1fKB read back and %.1fKB copied per update, %llu skipped with nothing dirty\n",
+            m_d3d9Statistics.updates, m_d3d9Statistics.readBytes / updates / 1024.0,
+            m_d3d9Statistics.bytes / updates / 1024.0, m_d3d9Statistics.skipped);
+        OutputDebugStringA(message);
+    }
+    DX9::SetInvalidateCallback(nullptr, nullptr);
+#endif
+
+#if DXTK_PROFILE
+    // Started with /trace; open Trace.json in chrome://tracing or Perfetto.
+    if (Profiler::Get().IsCapturing())
+    {
+        const auto profile = Profiler::Get().GetStatistics();
+        const bool written = Profiler::Get().WriteChromeTrace("Trace.json");
+        sprintf_s(message, "Profiler: %llu zones on %zu threads, %llu dropped, %s Trace.json\n",
+            profile.captured, profile.threads, profile.dropped, written ? "wrote" : "failed to write");
+        OutputDebugStringA(message);
+    }
+
+    const auto gpu = GpuTimer::Get().GetStatistics();
+    sprintf_s(message, "GpuTimer: %llu frames, %llu zones, %llu over the per-frame limit, %llu unfinished\n",
+        gpu.frames, gpu.zones, gpu.overflowed, gpu.unfinished);
+    OutputDebugStringA(message);
+#endif
 
     if (m_audioEngine)
     {
@@ -61,6 +234,8 @@ void GameBase::Initialize(HWND window, int width, int height)
     m_outputWidth = std::max(width, 1);
     m_outputHeight = std::max(height, 1);
 
+    PROFILE_THREAD("Main");
+
     std::wstring window_title = GAME_TITLE;
 #if   !DXTK_D3D11 && !DXTK_DWRITE && !DXTK_D3D9
     window_title += L" (DX12)";
@@ -72,6 +247,11 @@ void GameBase::Initialize(HWND window, int width, int height)
     window_title += L" (DX12&9)";
 #endif
     SetWindowText(m_window, window_title.c_str());
+    m_windowTitle = window_title;
+
+    // Packed assets (see /pack) take precedence over loose files; without the archive everything is read loose.
+    if (AssetFiles::Get().Mount(AssetFiles::DEFAULT_ARCHIVE))
+        OutputDebugStringW(L"AssetFiles: mounted Assets.pak\n");
 
 #if DXTK_KEYBOARD
     m_keyboard = std::make_unique<Keyboard>();
@@ -133,6 +313,7 @@ void GameBase::Initialize(HWND window, int width, int height)
     DXTK = m_dxtk;
 
     // TODO: Set the first scene.
+    BeginTransition(false);
     m_scene = SceneFactory::CreateScene(NextScene::StartScene);
     m_scene->Start();
 }
@@ -140,6 +321,25 @@ void GameBase::Initialize(HWND window, int width, int height)
 // Executes the basic game loop.
 void GameBase::Tick()
 {
+#if DXTK_PACING
+    // Input is read right after this, just before the simulation.
+    if (m_framePresented)
+    {
+        m_framePresented = false;
+        WaitForFrame();
+    }
+#endif
+
+    // A packet still in flight is drawn even if the scene just stopped pipelining.
+    // IsPipelined is only asked while the simulation thread is idle.
+    if (m_framePipeline->IsPending() || m_scene->IsPipelined())
+    {
+        TickPipelined();
+        return;
+    }
+
+    UpdateTransition();
+
     m_timer.Tick([&]()
         {
             Update(m_timer);
@@ -148,8 +348,86 @@ void GameBase::Tick()
     Render();
 }
 
+// Draws the packet simulated last frame while the next one is simulated.
+void GameBase::TickPipelined()
+{
+    // The first pipelined frame has nothing to draw yet; simulate it in place.
+    if (!m_framePipeline->IsPending())
+    {
+        KickSimulation();
+    }
+
+    const FramePacket& packet = [&]() -> const FramePacket&
+        {
+            PROFILE_ZONE("FramePipeline::Wait");
+            return m_framePipeline->Wait();
+        }();
+    if (m_nextScene != NextScene::Continue)
+    {
+        // The packet belongs to the old scene. Nothing is presented this tick, so the next one does not wait for a frame.
+        ChangeScene(m_nextScene);
+        return;
+    }
+
+    // The simulation thread is idle until the next kick.
+    UpdateTransition();
+
+    if (m_scene->IsPipelined())
+    {
+        KickSimulation();
+    }
+
+    const auto start = std::chrono::steady_clock::now();
+    Render(&packet);
+    m_framePipeline->AddRenderTime(std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - start).count());
+}
+
+// Advances the timer and input on the main thread, then runs the scene's updates on the simulation thread.
+void GameBase::KickSimulation()
+{
+    m_simulationSteps.clear();
+    m_timer.Tick([&]()
+        {
+            // The scene sees every step at once, so read the devices once to keep key presses.
+            if (m_simulationSteps.empty())
+            {
+                UpdateDevices();
+            }
+            m_simulationSteps.push_back(float(m_timer.GetElapsedSeconds()));
+        });
+
+    m_framePipeline->Kick([this](FramePacket& packet)
+        {
+            PROFILE_THREAD("Simulation");
+            PROFILE_ZONE("Simulate");
+            for (const float elapsedTime : m_simulationSteps)
+            {
+                m_nextScene = m_scene->Update(elapsedTime);
+                if (m_nextScene != NextScene::Continue)
+                {
+                    return;
+                }
+            }
+            m_scene->Capture(packet);
+        });
+}
+
 // Updates the world.
 void GameBase::Update(DX::StepTimer const& timer)
+{
+    PROFILE_ZONE("Update");
+    UpdateDevices();
+
+    const float elapsedTime = float(timer.GetElapsedSeconds());
+    const NextScene nextScene = m_scene->Update(elapsedTime);
+    if (nextScene != NextScene::Continue)
+    {
+        ChangeScene(nextScene);
+    }
+}
+
+// Updates audio and input devices.
+void GameBase::UpdateDevices()
 {
     if (m_retryAudio)
     {
@@ -177,6 +455,17 @@ void GameBase::Update(DX::StepTimer const& timer)
         PostMessage(m_window, WM_CLOSE, 0, 0);
     }
     m_keys.Update(m_dxtk->m_keyState);
+#if DXTK_PROFILE
+    if (m_keys.pressed.F3)
+    {
+        m_profilerOverlay = !m_profilerOverlay;
+        m_profilerVersion = 0;
+        if (!m_profilerOverlay)
+        {
+            SetWindowText(m_window, m_windowTitle.c_str());
+        }
+    }
+#endif
 #endif
 
 #if DXTK_MOUSE
@@ -191,22 +480,153 @@ void GameBase::Update(DX::StepTimer const& timer)
         m_gamepadButtons[index].Update(m_dxtk->GamePadState[index]);
     }
 #endif
+}
 
-    const float elapsedTime = float(timer.GetElapsedSeconds());
-    const NextScene nextScene = m_scene->Update(elapsedTime);
-    if (nextScene != NextScene::Continue)
+void GameBase::ChangeScene(NextScene nextScene)
+{
+    m_nextScene = NextScene::Continue;
+
+    const bool preloaded = m_preloadScene && m_preloadNext == nextScene;
+    if (!preloaded)
+    {
+        m_preloadScene.reset();
+        BeginTransition(false);
+    }
+    m_transition.changed = std::chrono::steady_clock::now();
+
+    // The caches keep what the outgoing scene loaded until the incoming one has loaded.
+    m_scene.reset();
+    if (preloaded)
+    {
+        m_scene = std::move(m_preloadScene);
+    }
+    else
     {
-        m_scene.reset();
         m_scene = SceneFactory::CreateScene(nextScene);
         m_scene->Start();
     }
+    m_preloadNext = NextScene::Continue;
+}
+
+void GameBase::PreloadScene(NextScene nextScene)
+{
+    m_preloadRequest = nextScene;
+}
+
+// Starts a requested preload, advances it, and ends the transition once the incoming scene has loaded.
+void GameBase::UpdateTransition()
+{
+    if (m_preloadRequest != NextScene::Continue)
+    {
+        const NextScene request = m_preloadRequest;
+        m_preloadRequest = NextScene::Continue;
+        if (!m_preloadScene || m_preloadNext != request)
+        {
+            PROFILE_ZONE("Scene::Preload");
+            m_preloadScene.reset();
+            BeginTransition(true);
+            m_preloadScene = SceneFactory::CreateScene(request);
+            m_preloadScene->Start();
+            m_preloadNext = request;
+        }
+    }
+
+    if (m_preloadScene)
+    {
+        m_preloadScene->Preload();
+    }
+    else if (m_transition.active && m_scene->IsLoaded())
+    {
+        EndTransition();
+    }
+}
+
+void GameBase::BeginTransition(bool preloaded)
+{
+    const auto models   = ModelCache::Get().GetStatistics();
+    const auto textures = TextureCache::Get().GetStatistics();
+
+    m_transition.active        = true;
+    m_transition.preloaded     = preloaded;
+    m_transition.requested     = std::chrono::steady_clock::now();
+    m_transition.changed       = m_transition.requested;
+    m_transition.modelHits     = models.hits;
+    m_transition.modelMisses   = models.misses;
+    m_transition.textureHits   = textures.hits;
+    m_transition.textureMisses = textures.misses;
+}
+
+// Releases cached assets the incoming scene did not take over and reports the transition.
+void GameBase::EndTransition()
+{
+    m_transition.active = false;
+
+    const auto now = std::chrono::steady_clock::now();
+    const double loadMs = std::chrono::duration<double, std::milli>(now - m_transition.requested).count();
+    const double waitMs = std::chrono::duration<double, std::milli>(now - m_transition.changed).count();
+
+    const auto models   = ModelCache::Get().GetStatistics();
+    const auto textures = TextureCache::Get().GetStatistics();
+    const size_t modelsReused   = models.hits - m_transition.modelHits;
+    const size_t modelsLoaded   = models.misses - m_transition.modelMisses;
+    const size_t texturesReused = textures.hits - m_transition.textureHits;
+    const size_t texturesLoaded = textures.misses - m_transition.textureMisses;
+
+    // The outgoing scene's last frames may still read what is about to be released.
+    WaitForGpu();
+    const size_t modelsReleased   = ModelCache::Get().Trim();
+    const size_t texturesReleased = TextureCache::Get().Trim();
+
+    auto& scenes = m_sceneStatistics;
+    ++scenes.transitions;
+    scenes.preloaded        += m_transition.preloaded ? 1 : 0;
+    scenes.waitMs           += waitMs;
+    scenes.modelsReused     += modelsReused;
+    scenes.modelsLoaded     += modelsLoaded;
+    scenes.texturesReused   += texturesReused;
+    scenes.texturesLoaded   += texturesLoaded;
+    scenes.modelsReleased   += modelsReleased;
+    scenes.texturesReleased += texturesReleased;
+
+    char message[256];
+    sprintf_s(message, "SceneTransition: waited %.1fms, loaded over %.1fms%s, models %zu reused %zu loaded, textures %zu reused %zu loaded, released %zu models %zu textures\n",
+        waitMs, loadMs, m_transition.preloaded ? " (preloaded)" : "",
+        modelsReused, modelsLoaded, texturesReused, texturesLoaded, modelsReleased, texturesReleased);
+    OutputDebugStringA(message);
 }
 
 // Draws the scene.
-void GameBase::Render()
+void GameBase::Render(const FramePacket* packet)
 {
-    m_scene->Render();
-    Present();
+    // Closed before EndProfilerFrame so the frame's own zone is collected with it.
+    {
+        PROFILE_ZONE("Render");
+
+        // Recycle descriptors the GPU is done with and publish textures decoded in the background.
+        DescriptorAllocator::Get().BeginFrame();
+        TextureStreamer::Get().Update();
+        // Submit every copy recorded since last frame (model loads and textures) as one batch.
+        UploadQueue::Get().Flush();
+        // Pick the mip each texture should stream to from last frame's screen sizes.
+        TextureResidency::Get().Update();
+
+        {
+            PROFILE_ZONE("Scene::Render");
+            if (packet)
+            {
+                m_scene->Render(*packet);
+            }
+            else
+            {
+                m_scene->Render();
+            }
+        }
+        Present();
+    }
+
+#if DXTK_PROFILE
+    EndProfilerFrame();
+#endif
 }
 
 // Reset command list and allocator.
@@ -216,49 +636,237 @@ void GameBase::ResetCommand(const UINT adapter)
     DX::ThrowIfFailed(m_devices[adapter].CommandAllocators[m_backBufferIndex]->Reset());
     DX::ThrowIfFailed(m_devices[adapter].CommandList->Reset(m_devices[adapter].CommandAllocators[m_backBufferIndex].Get(), nullptr));
 
+    // The GPU finished this back buffer's previous frame, so its parallel lists can be reused too.
+    if (m_devices[adapter].ListPool)
+    {
+        m_devices[adapter].ListPool->BeginFrame(m_backBufferIndex);
+    }
+    m_devices[adapter].SubmitLists.clear();
+    SetActiveCommandList(adapter, m_devices[adapter].CommandList.Get());
+
     // Transition the render target into the correct state to allow for drawing into it.
     D3D12_RESOURCE_BARRIER barrier = CD3DX12_RESOURCE_BARRIER::Transition(
         m_devices[adapter].RenderTargets[m_backBufferIndex].Get(),
         m_resourceState[adapter], D3D12_RESOURCE_STATE_RENDER_TARGET
     );
     m_devices[adapter].CommandList->ResourceBarrier(1, &barrier);
+
+#if DXTK_PROFILE
+    // Results for this back buffer's previous frame are ready now that its fence has been waited on.
+    if (adapter == PrimaryAdapter)
+    {
+        GpuTimer::Get().BeginFrame(m_backBufferIndex);
+        m_gpuFrameZone = GpuTimer::Get().Begin(m_devices[adapter].CommandList.Get(), "GPU::Frame");
+    }
+#endif
 }
 
 // Helper method to prepare the command list for rendering and clear the back buffers.
 void GameBase::ClearRenderTarget(const UINT adapter, const DirectX::XMVECTORF32& color)
 {
+    auto commandList = m_devices[adapter].ActiveCommandList;
+    BindRenderTarget(adapter, commandList);
+
     // Clear the views.
     CD3DX12_CPU_DESCRIPTOR_HANDLE rtvDescriptor(
         m_devices[adapter].RTVDescriptorHeap->GetCPUDescriptorHandleForHeapStart(),
         static_cast<INT>(m_backBufferIndex), m_devices[adapter].RTVDescriptorSize
     );
     CD3DX12_CPU_DESCRIPTOR_HANDLE dsvDescriptor(m_dsvDescriptorHeap->GetCPUDescriptorHandleForHeapStart());
-    m_devices[adapter].CommandList->OMSetRenderTargets(1, &rtvDescriptor, FALSE, &dsvDescriptor);
-    m_devices[adapter].CommandList->ClearRenderTargetView(rtvDescriptor, color, 0, nullptr);
-    m_devices[adapter].CommandList->ClearDepthStencilView(dsvDescriptor, D3D12_CLEAR_FLAG_DEPTH, 1.0f, 0, 0, nullptr);
+    commandList->ClearRenderTargetView(rtvDescriptor, color, 0, nullptr);
+    commandList->ClearDepthStencilView(dsvDescriptor, D3D12_CLEAR_FLAG_DEPTH, 1.0f, 0, 0, nullptr);
+}
+
+// Sets the back buffer, viewport and scissor rect; every command list starts without them.
+void GameBase::BindRenderTarget(const UINT adapter, ID3D12GraphicsCommandList* commandList)
+{
+    CD3DX12_CPU_DESCRIPTOR_HANDLE rtvDescriptor(
+        m_devices[adapter].RTVDescriptorHeap->GetCPUDescriptorHandleForHeapStart(),
+        static_cast<INT>(m_backBufferIndex), m_devices[adapter].RTVDescriptorSize
+    );
+    CD3DX12_CPU_DESCRIPTOR_HANDLE dsvDescriptor(m_dsvDescriptorHeap->GetCPUDescriptorHandleForHeapStart());
+    commandList->OMSetRenderTargets(1, &rtvDescriptor, FALSE, &dsvDescriptor);
 
     // Set the viewport and scissor rect.
     static const D3D12_VIEWPORT viewport = { 0.0f, 0.0f, static_cast<float>(m_outputWidth), static_cast<float>(m_outputHeight), D3D12_MIN_DEPTH, D3D12_MAX_DEPTH };
     static const D3D12_RECT  scissorRect = { 0, 0, static_cast<LONG>(m_outputWidth), static_cast<LONG>(m_outputHeight) };
-    m_devices[adapter].CommandList->RSSetViewports(1, &viewport);
-    m_devices[adapter].CommandList->RSSetScissorRects(1, &scissorRect);
+    commandList->RSSetViewports(1, &viewport);
+    commandList->RSSetScissorRects(1, &scissorRect);
+}
+
+// Records count items on worker threads, each chunk into its own pooled command list.
+// The chunks run after everything recorded so far and before anything recorded afterwards.
+void GameBase::RecordCommandLists(const UINT adapter, size_t count, size_t minPerChunk,
+                                  const std::function<void(ID3D12GraphicsCommandList*, size_t, size_t)>& record)
+{
+    auto& device = m_devices[adapter];
+    if (count == 0)
+    {
+        return;
+    }
+
+#if DXTK_PROFILE
+    const uint32_t parallelZone = adapter == PrimaryAdapter ?
+        GpuTimer::Get().Begin(device.ActiveCommandList, "GPU::RecordCommandLists") : GpuTimeline::INVALID_QUERY;
+#endif
+    DX::ThrowIfFailed(device.ActiveCommandList->Close());
+    device.SubmitLists.push_back(device.ActiveCommandList);
+
+    const auto lists = device.ListPool->Record(count, minPerChunk, [&](RecordingList& list, size_t begin, size_t end)
+        {
+            auto commandList = static_cast<D3D12RecordingList&>(list).Get();
+            BindRenderTarget(adapter, commandList);
+            record(commandList, begin, end);
+            list.Close();
+        });
+    for (auto list : lists)
+    {
+        device.SubmitLists.push_back(static_cast<D3D12RecordingList*>(list)->Get());
+    }
+
+    // Drawing after this point continues in a fresh list so the submission order matches the recording order.
+    auto commandList = static_cast<D3D12RecordingList&>(device.ListPool->Acquire()).Get();
+    BindRenderTarget(adapter, commandList);
+    SetActiveCommandList(adapter, commandList);
+#if DXTK_PROFILE
+    if (adapter == PrimaryAdapter)
+    {
+        GpuTimer::Get().End(commandList, parallelZone);
+    }
+#endif
+}
+
+// Points single-threaded drawing (and DXTK->CommandList) at the list currently being recorded.
+void GameBase::SetActiveCommandList(const UINT adapter, ID3D12GraphicsCommandList* commandList)
+{
+    m_devices[adapter].ActiveCommandList = commandList;
+    if (!m_dxtk)
+    {
+        return;
+    }
+
+#if DXTK_MULTIGPU
+    if (adapter == PrimaryAdapter)
+        m_dxtk->PrimaryCommandList = commandList;
+    else
+        m_dxtk->SecondaryCommandList = commandList;
+#else
+    if (adapter == PrimaryAdapter)
+        m_dxtk->CommandList = commandList;
+#endif
+}
+
+// Fills a rectangle of the current back buffer; enough for a loading bar without a pipeline.
+void GameBase::ClearRect(const UINT adapter, const DirectX::XMVECTORF32& color, const RECT& rect)
+{
+    CD3DX12_CPU_DESCRIPTOR_HANDLE rtvDescriptor(
+        m_devices[adapter].RTVDescriptorHeap->GetCPUDescriptorHandleForHeapStart(),
+        static_cast<INT>(m_backBufferIndex), m_devices[adapter].RTVDescriptorSize
+    );
+    m_devices[adapter].ActiveCommandList->ClearRenderTargetView(rtvDescriptor, color, 1, &rect);
 }
 
-// Submits the command list to the GPU
+#if DXTK_PROFILE
+// Collects this frame's zones; the title bar shows the slowest ones while the overlay is on.
+void GameBase::EndProfilerFrame()
+{
+    auto& profiler = Profiler::Get();
+    profiler.EndFrame();
+    if (!m_profilerOverlay || profiler.GetSummaryVersion() == m_profilerVersion)
+    {
+        return;
+    }
+    m_profilerVersion = profiler.GetSummaryVersion();
+
+    std::wstring title = m_windowTitle;
+    for (const auto& zone : profiler.GetTopZones(5))
+    {
+        wchar_t text[96];
+        swprintf_s(text, L"  |  %hs %.2fms", zone.name, zone.ms);
+        title += text;
+    }
+#if DXTK_D3D9
+    wchar_t d3d9[48];
+    swprintf_s(d3d9, L"  |  D3D9 %.1fKB", m_d3d9Statistics.lastBytes / 1024.0);
+    title += d3d9;
+#endif
+    SetWindowText(m_window, title.c_str());
+}
+
+// One bar per zone, 40 pixels per millisecond, with a tick at the 60Hz budget.
+// Colors match the order in the title bar; there is no font to label them with.
+void GameBase::DrawProfilerOverlay(const UINT adapter)
+{
+    static const DirectX::XMVECTORF32 colors[] = {
+        DirectX::Colors::OrangeRed, DirectX::Colors::Gold, DirectX::Colors::LimeGreen,
+        DirectX::Colors::DeepSkyBlue, DirectX::Colors::Violet
+    };
+    constexpr LONG left = 8, top = 8, barHeight = 10, pitch = 14, pixelsPerMs = 40;
+    const auto zones = Profiler::Get().GetTopZones(_countof(colors));
+    if (zones.empty())
+    {
+        return;
+    }
+
+    const LONG right = std::max<LONG>(m_outputWidth - left, left + 1);
+    const LONG bottom = top + static_cast<LONG>(zones.size()) * pitch;
+    ClearRect(adapter, DirectX::Colors::Black, RECT{ left - 4, top - 4, right + 4, bottom });
+    for (size_t i = 0; i < zones.size(); ++i)
+    {
+        const LONG y = top + static_cast<LONG>(i) * pitch;
+        const LONG width = std::min(static_cast<LONG>(zones[i].ms * pixelsPerMs) + 1, right - left);
+        ClearRect(adapter, colors[i], RECT{ left, y, left + width, y + barHeight });
+    }
+
+    const LONG budget = left + static_cast<LONG>(1000.0 / 60.0 * pixelsPerMs);
+    if (budget < right)
+    {
+        ClearRect(adapter, DirectX::Colors::White, RECT{ budget, top - 4, budget + 1, bottom });
+    }
+}
+#endif
+
+// Submits the command list (and any recorded in parallel before it, in order) to the GPU
 void GameBase::ExecuteCommandList(const UINT adapter)
 {
+#if DXTK_PROFILE
+    if (adapter == PrimaryAdapter)
+    {
+        if (m_profilerOverlay)
+        {
+            DrawProfilerOverlay(adapter);
+        }
+        GpuTimer::Get().End(m_devices[adapter].ActiveCommandList, m_gpuFrameZone);
+        GpuTimer::Get().EndFrame(m_devices[adapter].ActiveCommandList);
+        m_gpuFrameZone = GpuTimeline::INVALID_QUERY;
+    }
+#endif
+
+    auto commandList = m_devices[adapter].ActiveCommandList;
+
     // Transition the render target to the state that allows it to be presented to the display.
     D3D12_RESOURCE_BARRIER barrier = CD3DX12_RESOURCE_BARRIER::Transition(
         m_devices[adapter].RenderTargets[m_backBufferIndex].Get(),
         D3D12_RESOURCE_STATE_RENDER_TARGET, m_resourceState[adapter]
     );
-    m_devices[adapter].CommandList->ResourceBarrier(1, &barrier);
+    commandList->ResourceBarrier(1, &barrier);
 
-    // Send the command list off to the GPU for processing.
-    DX::ThrowIfFailed(m_devices[adapter].CommandList->Close());
+#if DXTK_D3D9
+    // The Direct3D9 layer was copied at EndScene; the frame samples it only after that copy on the GPU.
+    if (adapter == PrimaryAdapter)
+    {
+        D3D9WaitUpdate();
+    }
+#endif
+
+    // Send the command lists off to the GPU for processing.
+    DX::ThrowIfFailed(commandList->Close());
+    auto& submitLists = m_devices[adapter].SubmitLists;
+    submitLists.push_back(commandList);
     m_devices[adapter].CommandQueue.Get()->ExecuteCommandLists(
-        1, CommandListCast(m_devices[adapter].CommandList.GetAddressOf())
+        static_cast<UINT>(submitLists.size()), submitLists.data()
     );
+    submitLists.clear();
 }
 
 // Submits the command lists to the GPU
@@ -372,7 +980,24 @@ void GameBase::Present()
     // The first argument instructs DXGI to block until VSync, putting the application
     // to sleep until the next VSync. This ensures we don't waste any cycles rendering
     // frames that will never be displayed to the screen.
-    HRESULT hr = m_swapChain->Present(1, 0);
+    HRESULT hr;
+#if DXTK_PACING
+    {
+        PROFILE_ZONE("FramePacer::Limit");
+        m_framePacer->WaitForPresent();
+    }
+    {
+        PROFILE_ZONE("Present");
+        hr = m_swapChain->Present(m_framePacer->GetSyncInterval(), m_allowTearing ? DXGI_PRESENT_ALLOW_TEARING : 0);
+    }
+    m_framePacer->OnPresent();
+    m_framePresented = true;
+#else
+    {
+        PROFILE_ZONE("Present");
+        hr = m_swapChain->Present(1, 0);
+    }
+#endif
 
     // If the device was reset we must completely reinitialize the renderer.
     if (hr == DXGI_ERROR_DEVICE_REMOVED || hr == DXGI_ERROR_DEVICE_RESET)
@@ -394,6 +1019,21 @@ void GameBase::Present()
 #endif
 }
 
+#if DXTK_PACING
+// Blocks until the swap chain can queue another frame, then until the pacer wants input read.
+void GameBase::WaitForFrame()
+{
+    if (m_frameLatencyWaitable.IsValid())
+    {
+        PROFILE_ZONE("FrameLatency::Wait");
+        WaitForSingleObjectEx(m_frameLatencyWaitable.Get(), 1000, TRUE);
+    }
+
+    PROFILE_ZONE("FramePacer::Sleep");
+    m_framePacer->WaitForSample();
+}
+#endif
+
 // Message handlers
 void GameBase::OnActivated()
 {
@@ -420,6 +1060,7 @@ void GameBase::OnDeactivated()
 void GameBase::OnSuspending()
 {
     // TODO: Game is being power-suspended (or minimized).
+    m_framePipeline->Finish();
     m_audioEngine->Suspend();
 }
 
@@ -610,6 +1251,13 @@ void GameBase::CreateDevice()
             IID_PPV_ARGS(m_devices[adapter].CommandList.ReleaseAndGetAddressOf())
         ));
         DX::ThrowIfFailed(m_devices[adapter].CommandList->Close());
+
+        // Extra lists for parallel recording, created on demand per back buffer.
+        ID3D12Device* device = m_devices[adapter].Device.Get();
+        m_devices[adapter].ListPool = std::make_unique<CommandListPool>(c_swapBufferCount, [device]()
+            {
+                return std::make_unique<D3D12RecordingList>(device);
+            });
     }
 
     // Create a fence for tracking GPU execution progress.
@@ -650,6 +1298,13 @@ void GameBase::CreateDevice()
         ));
         DX::ThrowIfFailed(m_devices[adapter].CommandList->Close());
 
+        // Extra lists for parallel recording, created on demand per back buffer.
+        ID3D12Device* device = m_devices[adapter].Device.Get();
+        m_devices[adapter].ListPool = std::make_unique<CommandListPool>(c_swapBufferCount, [device]()
+            {
+                return std::make_unique<D3D12RecordingList>(device);
+            });
+
 
         // Fence used by the secondary adapter to signal its copy queue that it has completed rendering.
         // When this is signaled, the secondary adapter's copy queue can begin copying to the cross-adapter shared resource.
@@ -752,7 +1407,7 @@ void GameBase::CreateResources()
     // If the swap chain already exists, resize it, otherwise create one.
     if (m_swapChain)
     {
-        HRESULT hr = m_swapChain->ResizeBuffers(c_swapBufferCount, backBufferWidth, backBufferHeight, backBufferFormat, 0);
+        HRESULT hr = m_swapChain->ResizeBuffers(c_swapBufferCount, backBufferWidth, backBufferHeight, backBufferFormat, m_swapChainFlags);
 
         if (hr == DXGI_ERROR_DEVICE_REMOVED || hr == DXGI_ERROR_DEVICE_RESET)
         {
@@ -783,6 +1438,26 @@ void GameBase::CreateResources()
         swapChainDesc.SwapEffect = DXGI_SWAP_EFFECT_FLIP_DISCARD;
         swapChainDesc.AlphaMode = DXGI_ALPHA_MODE_IGNORE;
 
+#if DXTK_PACING
+        // The latency object lets a frame start only when the swap chain can take it; tearing lets VRR displays
+        // follow the frame rate instead of the refresh rate.
+        m_swapChainFlags = DXGI_SWAP_CHAIN_FLAG_FRAME_LATENCY_WAITABLE_OBJECT;
+        m_allowTearing = false;
+        if (m_framePacer->WantsTearing())
+        {
+            ComPtr<IDXGIFactory5> factory5;
+            BOOL allowTearing = FALSE;
+            if (SUCCEEDED(m_dxgiFactory.As(&factory5)) &&
+                SUCCEEDED(factory5->CheckFeatureSupport(DXGI_FEATURE_PRESENT_ALLOW_TEARING, &allowTearing, sizeof(allowTearing))) &&
+                allowTearing)
+            {
+                m_allowTearing = true;
+                m_swapChainFlags |= DXGI_SWAP_CHAIN_FLAG_ALLOW_TEARING;
+            }
+        }
+#endif
+        swapChainDesc.Flags = m_swapChainFlags;
+
         DXGI_SWAP_CHAIN_FULLSCREEN_DESC fsSwapChainDesc = {};
         fsSwapChainDesc.Windowed = TRUE;
 
@@ -799,6 +1474,13 @@ void GameBase::CreateResources()
 
         DX::ThrowIfFailed(swapChain.As(&m_swapChain));
 
+#if DXTK_PACING
+        // More queued frames than back buffers would never be used.
+        const UINT maxFrameLatency = std::min(m_framePacer->GetSettings().maxFrameLatency, static_cast<UINT>(c_swapBufferCount));
+        DX::ThrowIfFailed(m_swapChain->SetMaximumFrameLatency(maxFrameLatency));
+        m_frameLatencyWaitable.Attach(m_swapChain->GetFrameLatencyWaitableObject());
+#endif
+
         // This template does not support exclusive fullscreen mode and prevents DXGI from responding to the ALT+ENTER shortcut
         DX::ThrowIfFailed(m_dxgiFactory->MakeWindowAssociation(m_window, DXGI_MWA_NO_ALT_ENTER));
     }
@@ -1160,6 +1842,15 @@ void GameBase::D3D9CreateDevice()
         m_d3d9CopySurface.ReleaseAndGetAddressOf(), nullptr
     ));
 
+    // Partial readback stretches from the render texture; without that only whole reads are possible.
+    D3DCAPS9 caps{};
+    DX::ThrowIfFailed(m_d3d9Device->GetDeviceCaps(&caps));
+    m_d3d9StretchFromTexture = (caps.DevCaps2 & D3DDEVCAPS2_CAN_STRETCHRECT_FROM_TEXTURES) != 0;
+    m_d3d9ScratchTarget.Reset();
+    m_d3d9ScratchCopy.Reset();
+    m_d3d9ScratchWidth  = 0;
+    m_d3d9ScratchHeight = 0;
+
     m_d3d9Device->Clear(
         0, nullptr, D3DCLEAR_TARGET | D3DCLEAR_ZBUFFER | D3DCLEAR_STENCIL,
         D3DCOLOR_RGBA(0, 0, 0, 0), 1.0f, 0
@@ -1194,14 +1885,21 @@ void GameBase::D3D9CreateDevice()
     up_desc.SampleDesc.Count = 1;
     up_desc.Layout           = D3D12_TEXTURE_LAYOUT_ROW_MAJOR;
     heapProperties           = CD3DX12_HEAP_PROPERTIES(D3D12_HEAP_TYPE_UPLOAD);
-    DX::ThrowIfFailed(m_devices[PrimaryAdapter].Device->CreateCommittedResource(
-        &heapProperties,
-        D3D12_HEAP_FLAG_NONE,
-        &up_desc,
-        D3D12_RESOURCE_STATE_GENERIC_READ,
-        nullptr,
-        IID_GRAPHICS_PPV_ARGS(m_d3d12UploadResource.ReleaseAndGetAddressOf()
-    )));
+    for (UINT index = 0; index < c_d3d9UploadCount; ++index)
+    {
+        DX::ThrowIfFailed(m_devices[PrimaryAdapter].Device->CreateCommittedResource(
+            &heapProperties,
+            D3D12_HEAP_FLAG_NONE,
+            &up_desc,
+            D3D12_RESOURCE_STATE_GENERIC_READ,
+            nullptr,
+            IID_GRAPHICS_PPV_ARGS(m_d3d12UploadResources[index].ReleaseAndGetAddressOf()
+        )));
+
+        // Upload heaps stay mapped for their lifetime; the CPU never reads them.
+        const CD3DX12_RANGE readRange(0, 0);
+        DX::ThrowIfFailed(m_d3d12UploadResources[index]->Map(0, &readRange, reinterpret_cast<void**>(&m_d3d12UploadMapped[index])));
+    }
 
     D3D12_COMMAND_QUEUE_DESC queueDesc{};
     queueDesc.Flags = D3D12_COMMAND_QUEUE_FLAG_NONE;
@@ -1211,14 +1909,17 @@ void GameBase::D3D9CreateDevice()
         IID_PPV_ARGS(m_d3d12UploadCommandQueue.ReleaseAndGetAddressOf())
     ));
 
-    DX::ThrowIfFailed(m_devices[PrimaryAdapter].Device->CreateCommandAllocator(
-        D3D12_COMMAND_LIST_TYPE_COPY,
-        IID_PPV_ARGS(m_d3d12UploadCommandAllocator.ReleaseAndGetAddressOf())
-    ));
+    for (UINT index = 0; index < c_d3d9UploadCount; ++index)
+    {
+        DX::ThrowIfFailed(m_devices[PrimaryAdapter].Device->CreateCommandAllocator(
+            D3D12_COMMAND_LIST_TYPE_COPY,
+            IID_PPV_ARGS(m_d3d12UploadCommandAllocators[index].ReleaseAndGetAddressOf())
+        ));
+    }
 
     DX::ThrowIfFailed(m_devices[PrimaryAdapter].Device->CreateCommandList(
         0, D3D12_COMMAND_LIST_TYPE_COPY,
-        m_d3d12UploadCommandAllocator.Get(), nullptr,
+        m_d3d12UploadCommandAllocators[0].Get(), nullptr,
         IID_PPV_ARGS(m_d3d12UploadCommandList.ReleaseAndGetAddressOf())
     ));
     DX::ThrowIfFailed(m_d3d12UploadCommandList->Close());
@@ -1228,6 +1929,36 @@ void GameBase::D3D9CreateDevice()
         D3D12_FENCE_FLAG_NONE,
         IID_PPV_ARGS(m_d3d12UploadFence.ReleaseAndGetAddressOf())
     ));
+    for (UINT index = 0; index < c_d3d9UploadCount; ++index)
+    {
+        m_d3d12UploadFenceValues[index] = m_d3d12UploadFenceValue;
+    }
+
+    if (!m_d3d12UploadEvent.IsValid())
+    {
+        m_d3d12UploadEvent.Attach(CreateEventEx(nullptr, nullptr, 0, EVENT_MODIFY_STATE | SYNCHRONIZE));
+        if (!m_d3d12UploadEvent.IsValid())
+        {
+            throw std::exception("CreateEvent");
+        }
+    }
+
+    // The new texture has none of the old contents. The render target was just cleared, so nothing is drawn on it.
+    if (m_d3d9Dirty)
+    {
+        m_d3d9Dirty->Resize(m_outputWidth, m_outputHeight);
+        m_d3d9Content->Resize(m_outputWidth, m_outputHeight);
+    }
+    else
+    {
+        m_d3d9Dirty   = std::make_unique<DirtyRegion>(m_outputWidth, m_outputHeight);
+        m_d3d9Content = std::make_unique<DirtyRegion>(m_outputWidth, m_outputHeight);
+    }
+    m_d3d9Content->Clear();
+    m_d3d9ClearColor = D3DCOLOR_RGBA(0, 0, 0, 0);
+
+    // The DirectXTK9 draw calls report what they draw.
+    DX9::SetInvalidateCallback(&GameBase::D3D9InvalidateCallback, this);
 
     //m_d3d9Device->GetRenderTargetData(m_d3d9RenderSurface.Get(), m_d3d9CopySurface.Get());
 
@@ -1265,75 +1996,204 @@ void GameBase::D3D9CreateShaderResourceView(const D3D12_CPU_DESCRIPTOR_HANDLE sr
 
 void GameBase::D3D9UpdateResource()
 {
-    //auto resource = m_d3d12RenderResource.Get();
+    if (m_d3d9Dirty->IsEmpty())
+    {
+        ++m_d3d9Statistics.skipped;
+        m_d3d9Statistics.lastBytes = 0;
+        return;
+    }
+    PROFILE_ZONE("D3D9::UpdateResource");
 
-    m_d3d9Device->GetRenderTargetData(m_d3d9RenderSurface.Get(), m_d3d9CopySurface.Get());
+    // The buffer and allocator were last used two updates ago; usually that copy is long done.
+    const UINT index = m_d3d12UploadIndex;
+    m_d3d12UploadIndex = (m_d3d12UploadIndex + 1) % c_d3d9UploadCount;
+    if (m_d3d12UploadFence->GetCompletedValue() < m_d3d12UploadFenceValues[index])
+    {
+        PROFILE_ZONE("D3D9::WaitUpload");
+        DX::ThrowIfFailed(m_d3d12UploadFence->SetEventOnCompletion(m_d3d12UploadFenceValues[index], m_d3d12UploadEvent.Get()));
+        WaitForSingleObjectEx(m_d3d12UploadEvent.Get(), INFINITE, FALSE);
+    }
 
-    void* upload_res;
-    m_d3d12UploadResource->Map(0, nullptr, &upload_res);
-    D3DLOCKED_RECT lock;
-    m_d3d9CopySurface->LockRect(&lock, nullptr, D3DLOCK_READONLY);
-    CopyMemory(upload_res, lock.pBits, lock.Pitch * m_outputHeight);
-    m_d3d9CopySurface->UnlockRect();
-    m_d3d12UploadResource->Unmap(0, nullptr);
+    // The dirty rectangles are read back, each to the place D3D9ReadBack returns for it.
+    std::vector<POINT> places;
+    IDirect3DSurface9* readback = D3D9ReadBack(places);
 
-    m_d3d12UploadCommandAllocator->Reset();
-    m_d3d12UploadCommandList->Reset(m_d3d12UploadCommandAllocator.Get(), nullptr);
+    DX::ThrowIfFailed(m_d3d12UploadCommandAllocators[index]->Reset());
+    DX::ThrowIfFailed(m_d3d12UploadCommandList->Reset(m_d3d12UploadCommandAllocators[index].Get(), nullptr));
 
-    static D3D12_TEXTURE_COPY_LOCATION tex_dst{};
-    tex_dst.pResource        = m_d3d12RenderResource.Get();
-    tex_dst.Type             = D3D12_TEXTURE_COPY_TYPE_SUBRESOURCE_INDEX;
+    const CD3DX12_TEXTURE_COPY_LOCATION tex_dst(m_d3d12RenderResource.Get(), 0);
+    const CD3DX12_TEXTURE_COPY_LOCATION tex_src(m_d3d12UploadResources[index].Get(), m_d3d12Footprint);
+    const UINT rowPitch = m_d3d12Footprint.Footprint.RowPitch;
 
-    static D3D12_TEXTURE_COPY_LOCATION tex_src;
-    tex_src.pResource        = m_d3d12UploadResource.Get();
-    tex_src.Type             = D3D12_TEXTURE_COPY_TYPE_PLACED_FOOTPRINT;
-    tex_src.SubresourceIndex = 0;
-    tex_src.PlacedFootprint  = m_d3d12Footprint;
-    m_d3d12UploadCommandList->CopyTextureRegion(&tex_dst, 0, 0, 0, &tex_src, nullptr);
+    uint64_t bytes = 0;
+    const auto& rects = m_d3d9Dirty->GetRects();
+    for (size_t i = 0; i < rects.size(); ++i)
+    {
+        // Each rectangle goes to the same place in the footprint and is copied from there.
+        const RECT rect   = { rects[i].left, rects[i].top, rects[i].right, rects[i].bottom };
+        const LONG width  = rect.right  - rect.left;
+        const LONG height = rect.bottom - rect.top;
+        RECT source = { places[i].x, places[i].y, places[i].x + width, places[i].y + height };
+        D3DLOCKED_RECT lock;
+        DX::ThrowIfFailed(readback->LockRect(&lock, &source, D3DLOCK_READONLY));
+
+        const size_t rowBytes = static_cast<size_t>(width) * sizeof(uint32_t);
+        auto src = static_cast<const uint8_t*>(lock.pBits);
+        auto dst = m_d3d12UploadMapped[index] + m_d3d12Footprint.Offset
+                 + static_cast<size_t>(rect.top) * rowPitch + static_cast<size_t>(rect.left) * sizeof(uint32_t);
+        for (LONG y = 0; y < height; ++y)
+        {
+            memcpy(dst, src, rowBytes);
+            src += lock.Pitch;
+            dst += rowPitch;
+        }
+        readback->UnlockRect();
+        bytes += rowBytes * static_cast<size_t>(height);
+
+        const D3D12_BOX box = {
+            static_cast<UINT>(rect.left),  static_cast<UINT>(rect.top),    0,
+            static_cast<UINT>(rect.right), static_cast<UINT>(rect.bottom), 1
+        };
+        m_d3d12UploadCommandList->CopyTextureRegion(&tex_dst, box.left, box.top, 0, &tex_src, &box);
+    }
+    m_d3d9Dirty->Clear();
+
+    DX::ThrowIfFailed(m_d3d12UploadCommandList->Close());
 
-    m_d3d12UploadCommandList->Close();
+    // Frames already submitted may still be sampling the texture; the copy queue waits for them on the GPU.
+    DX::ThrowIfFailed(m_d3d12UploadCommandQueue->Wait(m_fence.Get(), m_fenceValues[m_backBufferIndex] - 1));
     m_d3d12UploadCommandQueue->ExecuteCommandLists(
         1, CommandListCast(m_d3d12UploadCommandList.GetAddressOf())
     );
 
     ++m_d3d12UploadFenceValue;
-    m_d3d12UploadCommandQueue->Signal(m_d3d12UploadFence.Get(), m_d3d12UploadFenceValue);
+    DX::ThrowIfFailed(m_d3d12UploadCommandQueue->Signal(m_d3d12UploadFence.Get(), m_d3d12UploadFenceValue));
+    m_d3d12UploadFenceValues[index] = m_d3d12UploadFenceValue;
 
-    //D3DLOCKED_RECT lock;
-    //m_d3d9CopySurface->LockRect(&lock, nullptr, D3DLOCK_READONLY);
+    ++m_d3d9Statistics.updates;
+    m_d3d9Statistics.bytes += bytes;
+    m_d3d9Statistics.lastBytes = bytes;
+}
 
-    //ResourceUploadBatch resourceUploadBatch(m_d3d12UploadDevice.Get());
-    //resourceUploadBatch.Begin();
+// Reads the dirty rectangles back into system memory and returns the surface holding them.
+// GetRenderTargetData copies whole surfaces, so small updates first stretch the rectangles into a
+// scratch render target, either where they are inside their bounding box or stacked one below another.
+IDirect3DSurface9* GameBase::D3D9ReadBack(std::vector<POINT>& places)
+{
+    const auto& rects = m_d3d9Dirty->GetRects();
+    places.resize(rects.size());
 
-    //D3D12_SUBRESOURCE_DATA subresource{};
-    //subresource.pData      = lock.pBits;
-    //subresource.RowPitch   = lock.Pitch;
-    //subresource.SlicePitch = lock.Pitch * m_outputHeight;
+    RECT bounds = { rects[0].left, rects[0].top, rects[0].right, rects[0].bottom };
+    LONG stackWidth = 0, stackHeight = 0;
+    for (const auto& rect : rects)
+    {
+        bounds.left   = std::min<LONG>(bounds.left,   rect.left);
+        bounds.top    = std::min<LONG>(bounds.top,    rect.top);
+        bounds.right  = std::max<LONG>(bounds.right,  rect.right);
+        bounds.bottom = std::max<LONG>(bounds.bottom, rect.bottom);
+        stackWidth    = std::max<LONG>(stackWidth, rect.right - rect.left);
+        stackHeight  += rect.bottom - rect.top;
+    }
+    const uint64_t fullArea   = static_cast<uint64_t>(m_outputWidth) * m_outputHeight;
+    const uint64_t boundsArea = static_cast<uint64_t>(bounds.right - bounds.left) * (bounds.bottom - bounds.top);
+    const uint64_t stackArea  = static_cast<uint64_t>(stackWidth) * stackHeight;
+    const bool     stacked    = stackHeight <= m_outputHeight && stackArea < boundsArea;
 
-    //resourceUploadBatch.Upload    (resource, 0, &subresource, 1);
-    //resourceUploadBatch.Transition(
-    //    resource, 
-    //    D3D12_RESOURCE_STATE_COPY_DEST,
-    //    D3D12_RESOURCE_STATE_COMMON
-    //);
+    // Past half the surface the extra stretch costs more than reading the rest.
+    if (!m_d3d9StretchFromTexture || std::min(boundsArea, stackArea) * 2 > fullArea)
+    {
+        DX::ThrowIfFailed(m_d3d9Device->GetRenderTargetData(m_d3d9RenderSurface.Get(), m_d3d9CopySurface.Get()));
+        for (size_t i = 0; i < rects.size(); ++i)
+        {
+            places[i] = { rects[i].left, rects[i].top };
+        }
+        m_d3d9Statistics.readBytes += fullArea * sizeof(uint32_t);
+        return m_d3d9CopySurface.Get();
+    }
 
-    //auto uploadResourcesFinished = resourceUploadBatch.End(m_d3d12UploadCommandQueue.Get());
-    //uploadResourcesFinished.wait();
+    // Rounded up so that small changes in size reuse the surfaces; shrunk once they are four times too large.
+    const LONG needWidth  = stacked ? stackWidth  : bounds.right  - bounds.left;
+    const LONG needHeight = stacked ? stackHeight : bounds.bottom - bounds.top;
+    const UINT width      = std::min<UINT>((static_cast<UINT>(needWidth)  + 63) & ~63u, static_cast<UINT>(m_outputWidth));
+    const UINT height     = std::min<UINT>((static_cast<UINT>(needHeight) + 63) & ~63u, static_cast<UINT>(m_outputHeight));
+    const bool fits       = m_d3d9ScratchTarget && width <= m_d3d9ScratchWidth && height <= m_d3d9ScratchHeight;
+    const bool tooLarge   = static_cast<uint64_t>(m_d3d9ScratchWidth) * m_d3d9ScratchHeight > 4ull * width * height;
+    if (!fits || tooLarge)
+    {
+        DX::ThrowIfFailed(m_d3d9Device->CreateRenderTarget(
+            width, height, D3DFMT_A8R8G8B8, D3DMULTISAMPLE_NONE, 0, FALSE,
+            m_d3d9ScratchTarget.ReleaseAndGetAddressOf(), nullptr
+        ));
+        DX::ThrowIfFailed(m_d3d9Device->CreateOffscreenPlainSurface(
+            width, height, D3DFMT_A8R8G8B8, D3DPOOL_SYSTEMMEM,
+            m_d3d9ScratchCopy.ReleaseAndGetAddressOf(), nullptr
+        ));
+        m_d3d9ScratchWidth  = width;
+        m_d3d9ScratchHeight = height;
+    }
 
-    //m_d3d9CopySurface->UnlockRect();
+    LONG y = 0;
+    for (size_t i = 0; i < rects.size(); ++i)
+    {
+        const RECT source = { rects[i].left, rects[i].top, rects[i].right, rects[i].bottom };
+        const POINT place = stacked ? POINT{ 0, y } : POINT{ source.left - bounds.left, source.top - bounds.top };
+        const RECT  dest  = { place.x, place.y, place.x + source.right - source.left, place.y + source.bottom - source.top };
+        DX::ThrowIfFailed(m_d3d9Device->StretchRect(
+            m_d3d9RenderSurface.Get(), &source, m_d3d9ScratchTarget.Get(), &dest, D3DTEXF_NONE
+        ));
+        places[i] = place;
+        y += source.bottom - source.top;
+    }
+    DX::ThrowIfFailed(m_d3d9Device->GetRenderTargetData(m_d3d9ScratchTarget.Get(), m_d3d9ScratchCopy.Get()));
+    m_d3d9Statistics.readBytes += static_cast<uint64_t>(m_d3d9ScratchWidth) * m_d3d9ScratchHeight * sizeof(uint32_t);
+    return m_d3d9ScratchCopy.Get();
 }
 
+// Makes the primary queue wait for the last copy on the GPU instead of blocking the CPU.
 void GameBase::D3D9WaitUpdate()
 {
-    if (m_d3d12UploadFence->GetCompletedValue() >= m_d3d12UploadFenceValue)
+    if (!m_d3d12UploadFence || m_d3d12UploadFence->GetCompletedValue() >= m_d3d12UploadFenceValue)
         return;
 
-    HANDLE fenceEvent = CreateEvent(nullptr, FALSE, FALSE, nullptr);
-    if (!fenceEvent)
-        return;
-    m_d3d12UploadFence->SetEventOnCompletion(m_d3d12UploadFenceValue, fenceEvent);
-    WaitForSingleObject(fenceEvent, INFINITE);
-    CloseHandle(fenceEvent);
+    DX::ThrowIfFailed(m_devices[PrimaryAdapter].CommandQueue->Wait(m_d3d12UploadFence.Get(), m_d3d12UploadFenceValue));
+}
+
+void GameBase::D3D9InvalidateRect(const RECT* rect)
+{
+    if (rect)
+    {
+        const DirtyRegion::Rect dirty = { rect->left, rect->top, rect->right, rect->bottom };
+        m_d3d9Dirty->Add(dirty);
+        m_d3d9Content->Add(dirty);
+    }
+    else
+    {
+        m_d3d9Dirty->AddAll();
+        m_d3d9Content->AddAll();
+    }
+}
+
+// Clearing to another color changes every pixel; clearing to the same color only erases what was drawn.
+void GameBase::D3D9InvalidateClear(const D3DCOLOR color)
+{
+    if (color != m_d3d9ClearColor)
+    {
+        m_d3d9Dirty->AddAll();
+        m_d3d9ClearColor = color;
+    }
+    else
+    {
+        for (const auto& rect : m_d3d9Content->GetRects())
+        {
+            m_d3d9Dirty->Add(rect);
+        }
+    }
+    m_d3d9Content->Clear();
+}
+
+void GameBase::D3D9InvalidateCallback(void* context, const RECT* rect)
+{
+    static_cast<GameBase*>(context)->D3D9InvalidateRect(rect);
 }
 
 void GameBase::WaitForGpu() noexcept
@@ -1373,6 +2233,7 @@ void GameBase::MoveToNextFrame()
     // If the next frame is not ready to be rendered yet, wait until it is ready.
     if (m_fence->GetCompletedValue() < m_fenceValues[m_backBufferIndex])
     {
+        PROFILE_ZONE("MoveToNextFrame::Wait");
         DX::ThrowIfFailed(m_fence->SetEventOnCompletion(m_fenceValues[m_backBufferIndex], m_devices[PrimaryAdapter].FenceEvent.Get()));
         WaitForSingleObjectEx(m_devices[PrimaryAdapter].FenceEvent.Get(), INFINITE, FALSE);
     }
@@ -1383,11 +2244,31 @@ void GameBase::MoveToNextFrame()
 
 void GameBase::OnDeviceLost()
 {
+    // The simulation thread may still be updating the scene; the packet is kept and drawn after recovery.
+    m_framePipeline->Finish();
+
     // TODO: Perform Direct3D resource cleanup.
     m_scene->OnDeviceLost();
+    if (m_preloadScene)
+    {
+        m_preloadScene->OnDeviceLost();
+    }
+    // Cached geometry belongs to the lost device.
+    ModelCache::Get().Clear();
+
+    // The shared singletons let go of their device objects; users first, the descriptor heap last.
+    TextureStreamer::OnDeviceLost();
+    ToonTextureArray::OnDeviceLost();
+    TextureCache::OnDeviceLost();
+    PipelineLibrary::OnDeviceLost();
+    GpuTimer::OnDeviceLost();
+    UploadQueue::OnDeviceLost();
+    DescriptorAllocator::OnDeviceLost();
 
 #if DXTK_D3D9
     m_d3d12RenderResource.Reset();
+    m_d3d9ScratchCopy.Reset();
+    m_d3d9ScratchTarget.Reset();
     m_d3d9CopySurface.Reset();
     m_d3d9RenderSurface.Reset();
     m_d3d9RenderTexture.Reset();
@@ -1441,6 +2322,9 @@ void GameBase::OnDeviceLost()
     m_fence.Reset();
     m_dsvDescriptorHeap.Reset();
     m_depthStencil.Reset();
+#if DXTK_PACING
+    m_frameLatencyWaitable.Close();
+#endif
     m_swapChain.Reset();
 
     for (UINT adapter = 0; adapter < m_adapterCount; ++adapter)
@@ -1454,6 +2338,9 @@ void GameBase::OnDeviceLost()
             m_devices[adapter].CommandAllocators[frame].Reset();
         }
 
+        m_devices[adapter].SubmitLists.clear();
+        m_devices[adapter].ListPool.reset();
+        SetActiveCommandList(adapter, nullptr);
         m_devices[adapter].CommandList.Reset();
         m_devices[adapter].CommandQueue.Reset();
 
@@ -1464,6 +2351,28 @@ void GameBase::OnDeviceLost()
 
     CreateDevice();
     CreateResources();
+#if DXTK_D3D11 || DXTK_DWRITE
+    D3D11CreateDevice();
+#endif
+#if DXTK_D3D9
+    D3D9CreateDevice();
+#endif
+
+    // DXTK hands out the device and queues; the singletons are re-created before the scenes reload.
+    m_dxtk->Attach(this);
+    ID3D12Device*       device = m_devices[PrimaryAdapter].Device.Get();
+    ID3D12CommandQueue* queue  = m_devices[PrimaryAdapter].CommandQueue.Get();
+    DescriptorAllocator::OnDeviceRestored(device);
+    UploadQueue::OnDeviceRestored(device);
+    GpuTimer::OnDeviceRestored(device, queue);
+    PipelineLibrary::OnDeviceRestored(device);
+    TextureCache::OnDeviceRestored(device);
+    ToonTextureArray::OnDeviceRestored(device, queue);
+    TextureStreamer::OnDeviceRestored(device, queue);
 
     m_scene->LoadAssets();
+    if (m_preloadScene)
+    {
+        m_preloadScene->LoadAssets();
+    }
 }
@@ -18,6 +18,9 @@
 #define DXTK_D3D9       1   // 1...use Direct3D9
 #define DXTK_DSHOW      1   // 1...use DirectShow
 
+#define DXTK_PROFILE    1   // 1...use CPU Profiler (F3 overlay, /trace)
+#define DXTK_PACING     1   // 1...use Frame Pacer (waitable swap chain, /uncapped /vrr /fps:N /latency:N)
+
 enum class screen : int {
     width = 1280,
     height = 720
@@ -25,6 +28,8 @@ enum class screen : int {
 
 #include "StepTimer.h"
 
+#include <chrono>
+
 #if DXTK_D3D11 || DXTK_DWRITE
     #include <d3d11on12.h>
 #endif
@@ -45,6 +50,12 @@ enum class screen : int {
 
 struct DirectX::XMVECTORF32;
 class Scene;
+enum class NextScene : int;
+class FramePipeline;
+struct FramePacket;
+class CommandListPool;
+class FramePacer;
+class DirtyRegion;
 
 enum {
     PrimaryAdapter = 0,
@@ -81,17 +92,39 @@ public:
 
     // Properties
     void GetDefaultSize(int& width, int& height) const noexcept;
+#if DXTK_PACING
+    // Set before Initialize; the swap chain is created for the chosen mode.
+    FramePacer& GetFramePacer() noexcept { return *m_framePacer; }
+#endif
 
 private:
     friend class dxtk;
 
     void Update(DX::StepTimer const& timer);
-    void Render();
+    void UpdateDevices();
+    void ChangeScene(NextScene nextScene);
+
+    // Scene streaming: PreloadScene only records the request (the scene may call it from the
+    // simulation thread); UpdateTransition acts on it while the simulation thread is idle.
+    void PreloadScene(NextScene nextScene);
+    void UpdateTransition();
+    void BeginTransition(bool preloaded);
+    void EndTransition();
+    void Render(const FramePacket* packet = nullptr);
+
+    // Frame pipelining: the scene updates frame N+1 on the simulation thread while frame N is recorded.
+    void TickPipelined();
+    void KickSimulation();
 
     void ResetCommand(const UINT adapter);
     void ClearRenderTarget(const UINT adapter, const DirectX::XMVECTORF32& color);
+    void ClearRect(const UINT adapter, const DirectX::XMVECTORF32& color, const RECT& rect);
 
     void ExecuteCommandList(const UINT adapter);
+    void RecordCommandLists(const UINT adapter, size_t count, size_t minPerChunk,
+                            const std::function<void(ID3D12GraphicsCommandList*, size_t, size_t)>& record);
+    void BindRenderTarget(const UINT adapter, ID3D12GraphicsCommandList* commandList);
+    void SetActiveCommandList(const UINT adapter, ID3D12GraphicsCommandList* commandList);
     void ExecuteCommandLists(const UINT adapter, UINT NumCommandLists,
                              ID3D12GraphicsCommandList* const* ppCommandLists);
 #if DXTK_MULTIGPU
@@ -132,6 +165,9 @@ private:
 #endif
 
     void Present();
+#if DXTK_PACING
+    void WaitForFrame();
+#endif
 
     void CreateDevice();
     void CreateResources();
@@ -143,15 +179,25 @@ private:
     void D3D9CreateShaderResourceView(const D3D12_CPU_DESCRIPTOR_HANDLE srvDescriptor);
     void D3D9UpdateResource();
     void D3D9WaitUpdate();
+    void D3D9InvalidateRect(const RECT* rect);
+    void D3D9InvalidateClear(const D3DCOLOR color);
+    static void D3D9InvalidateCallback(void* context, const RECT* rect);
+    IDirect3DSurface9* D3D9ReadBack(std::vector<POINT>& places);
 #endif
 
     void WaitForGpu() noexcept;
     void MoveToNextFrame();
 
+#if DXTK_PROFILE
+    void EndProfilerFrame();
+    void DrawProfilerOverlay(const UINT adapter);
+#endif
+
     void OnDeviceLost();
 
     // Application state
     HWND                                              m_window;
+    std::wstring                                      m_windowTitle;
     int                                               m_outputWidth;
     int                                               m_outputHeight;
 
@@ -177,6 +223,12 @@ private:
 
         std::unique_ptr<DirectX::GraphicsMemory>          GraphicsMemory;
 
+        // Parallel recording: extra lists with their own allocators per back buffer.
+        // ActiveCommandList is where single-threaded drawing goes; SubmitLists is this frame's submission order.
+        std::unique_ptr<CommandListPool>                  ListPool;
+        ID3D12GraphicsCommandList*                        ActiveCommandList = nullptr;
+        std::vector<ID3D12CommandList*>                   SubmitLists;
+
 #if DXTK_MULTIGPU
         Microsoft::WRL::ComPtr<ID3D12Heap>                CrossAdapterResourceHeap;
         Microsoft::WRL::ComPtr<ID3D12Resource>            CrossAdapterResources[c_swapBufferCount];
@@ -206,6 +258,7 @@ private:
 
     // Rendering resources
     Microsoft::WRL::ComPtr<IDXGISwapChain3>           m_swapChain;
+    UINT                                              m_swapChainFlags;
     Microsoft::WRL::ComPtr<ID3D12Resource>            m_depthStencil;
     Microsoft::WRL::ComPtr<ID3D12DescriptorHeap>      m_dsvDescriptorHeap;
     UINT                                              m_backBufferIndex;
@@ -236,15 +289,44 @@ private:
     Microsoft::WRL::ComPtr<IDirect3DSurface9>         m_d3d9RenderSurface;
     Microsoft::WRL::ComPtr<IDirect3DSurface9>         m_d3d9CopySurface;
 
+    // Partial readback: the dirty rectangles are stretched into a small render target and only that is read back.
+    Microsoft::WRL::ComPtr<IDirect3DSurface9>         m_d3d9ScratchTarget;
+    Microsoft::WRL::ComPtr<IDirect3DSurface9>         m_d3d9ScratchCopy;
+    UINT                                              m_d3d9ScratchWidth;
+    UINT                                              m_d3d9ScratchHeight;
+    bool                                              m_d3d9StretchFromTexture;
+
     Microsoft::WRL::ComPtr<ID3D12Resource>            m_d3d12RenderResource;
-    Microsoft::WRL::ComPtr<ID3D12Resource>            m_d3d12UploadResource;
     D3D12_PLACED_SUBRESOURCE_FOOTPRINT                m_d3d12Footprint;
 
+    // Upload buffers and allocators are used alternately, so one update is recorded while the last one copies.
+    static const UINT                                 c_d3d9UploadCount = 2;
+    Microsoft::WRL::ComPtr<ID3D12Resource>            m_d3d12UploadResources[c_d3d9UploadCount];
+    uint8_t*                                          m_d3d12UploadMapped[c_d3d9UploadCount];
+    Microsoft::WRL::ComPtr<ID3D12CommandAllocator>    m_d3d12UploadCommandAllocators[c_d3d9UploadCount];
+    UINT64                                            m_d3d12UploadFenceValues[c_d3d9UploadCount];
+    UINT                                              m_d3d12UploadIndex;
+
     Microsoft::WRL::ComPtr<ID3D12CommandQueue>        m_d3d12UploadCommandQueue;
-    Microsoft::WRL::ComPtr<ID3D12CommandAllocator>    m_d3d12UploadCommandAllocator;
     Microsoft::WRL::ComPtr<ID3D12GraphicsCommandList> m_d3d12UploadCommandList;
     Microsoft::WRL::ComPtr<ID3D12Fence>               m_d3d12UploadFence;
     UINT64                                            m_d3d12UploadFenceValue;
+    Microsoft::WRL::Wrappers::Event                   m_d3d12UploadEvent;
+
+    // Only what was drawn since the last update is read back and copied. The DirectXTK9 draw calls
+    // report what they draw; code drawing through Device9 directly reports it with dxtk::InvalidateD3D9.
+    std::unique_ptr<DirtyRegion>                      m_d3d9Dirty;
+    // What holds something other than the clear color; a clear with the same color only dirties this.
+    std::unique_ptr<DirtyRegion>                      m_d3d9Content;
+    D3DCOLOR                                          m_d3d9ClearColor;
+    struct D3D9STATISTICS {
+        uint64_t updates;       // Updates that copied something.
+        uint64_t skipped;       // Updates with nothing dirty.
+        uint64_t bytes;         // Bytes copied into the upload buffers.
+        uint64_t lastBytes;     // Bytes copied by the latest update.
+        uint64_t readBytes;     // Bytes read back from the Direct3D9 render target.
+    };
+    D3D9STATISTICS                                    m_d3d9Statistics;
 #endif
 
     // Audio
@@ -254,6 +336,16 @@ private:
     // Game state
     DX::StepTimer                                     m_timer;
 
+#if DXTK_PACING
+    // Frame pacing: the swap chain's latency object gates the start of a frame, the pacer decides when to read input and present.
+    std::unique_ptr<FramePacer>                       m_framePacer;
+    Microsoft::WRL::Wrappers::Event                   m_frameLatencyWaitable;
+    Microsoft::WRL::Wrappers::Event                   m_pacingTimer;
+    bool                                              m_allowTearing;
+    // The latency object is only signaled by a Present; a tick that switched scenes without one must not wait on it.
+    bool                                              m_framePresented;
+#endif
+
 #if DXTK_KEYBOARD
     std::unique_ptr<DirectX::Keyboard>                m_keyboard;
     DirectX::Keyboard::KeyboardStateTracker           m_keys;
@@ -275,5 +367,48 @@ private:
 #endif
 
     std::unique_ptr<Scene>                            m_scene;
+
+    // The next scene, loading in the background until the current scene changes to it.
+    std::unique_ptr<Scene>                            m_preloadScene;
+    NextScene                                         m_preloadNext;
+    NextScene                                         m_preloadRequest;
+    // From the preload (or change) request until the incoming scene has loaded. Cached models
+    // and textures are only trimmed then, so what both scenes use is handed over, not reloaded.
+    struct SCENETRANSITION {
+        bool                                  active;
+        bool                                  preloaded;
+        std::chrono::steady_clock::time_point requested;
+        std::chrono::steady_clock::time_point changed;
+        size_t                                modelHits;      // Cache counters at the request.
+        size_t                                modelMisses;
+        size_t                                textureHits;
+        size_t                                textureMisses;
+    };
+    SCENETRANSITION                                   m_transition;
+    struct SCENESTATISTICS {
+        uint64_t transitions;
+        uint64_t preloaded;
+        double   waitMs;            // From the change until the incoming scene had loaded.
+        size_t   modelsReused;
+        size_t   modelsLoaded;
+        size_t   texturesReused;
+        size_t   texturesLoaded;
+        size_t   modelsReleased;
+        size_t   texturesReleased;
+    };
+    SCENESTATISTICS                                   m_sceneStatistics;
+
+    // Declared after the scene so the simulation thread stops before the scene is destroyed.
+    std::unique_ptr<FramePipeline>                    m_framePipeline;
+    std::vector<float>                                m_simulationSteps;
+    NextScene                                         m_nextScene;
     dxtk*                                             m_dxtk;
+
+#if DXTK_PROFILE
+    // Top zones as bars in the corner and as text in the title bar (F3).
+    bool                                              m_profilerOverlay = false;
+    uint64_t                                          m_profilerVersion = 0;
+    // Timestamp pair around everything recorded for the primary adapter this frame.
+    uint32_t                                          m_gpuFrameZone = UINT32_MAX;
+#endif
 };
@@ -4,6 +4,11 @@
 
 #include "pch.h"
 #include "GameBase.h"
+#include "tool/ShaderCache.h"
+#include "tool/TextureBaker.h"
+#include "tool/AssetFiles.h"
+#include "tool/Profiler.h"
+#include "tool/FramePacer.h"
 
 using namespace DirectX;
 
@@ -25,7 +30,6 @@ LRESULT CALLBACK WndProc(HWND, UINT, WPARAM, LPARAM);
 int WINAPI wWinMain(_In_ HINSTANCE hInstance, _In_opt_ HINSTANCE hPrevInstance, _In_ LPWSTR lpCmdLine, _In_ int nCmdShow)
 {
     UNREFERENCED_PARAMETER(hPrevInstance);
-    UNREFERENCED_PARAMETER(lpCmdLine);
 
     if (!XMVerifyCPUSupport())
         return 1;
@@ -34,8 +38,31 @@ int WINAPI wWinMain(_In_ HINSTANCE hInstance, _In_opt_ HINSTANCE hPrevInstance,
     if (FAILED(initialize))
         return 1;
 
+    // Offline build step: compile every shader permutation into the disk cache and exit.
+    if (wcsstr(lpCmdLine, L"/shaders"))
+        return ShaderCache::Get().Precompile() ? 0 : 1;
+
+    // Offline build step: bake every PMX texture into block-compressed DDS and exit.
+    if (wcsstr(lpCmdLine, L"/bake"))
+        return TextureBaker().BakeAll() ? 0 : 1;
+
+    // Offline build step: pack models, motions and baked textures into one archive and exit (run after /bake).
+    if (wcsstr(lpCmdLine, L"/pack"))
+        return ArchiveWriter::Pack(AssetFiles::DEFAULT_ARCHIVE, L".", { L"Model", L"Motion", L"Baked" }) ? 0 : 1;
+
+#if DXTK_PROFILE
+    // Keep every zone from startup on and write Assets/Trace.json on exit.
+    if (wcsstr(lpCmdLine, L"/trace"))
+        Profiler::Get().StartCapture();
+#endif
+
     g_game = std::make_unique<GameBase>();
 
+#if DXTK_PACING
+    // Frame pacing: /uncapped or /vrr (tearing where supported), /fps:N for a CPU frame limiter, /latency:N queued frames.
+    g_game->GetFramePacer().SetSettings(FramePacer::ParseCommandLine(lpCmdLine));
+#endif
+
     // Register class and create window
     {
         // Register class
@@ -6,37 +6,83 @@
 
 #include <cmath>
 #include <cstdint>
-#include <exception>
+#include <functional>
+#include <stdexcept>
+#include <utility>
+
+#if !defined(_WIN32)
+    #include <time.h>
+#endif
 
 namespace DX
 {
+    // Source of raw time: a monotonic counter and how many counts make a second.
+    // Tests pass a fake counter they advance by hand.
+    struct StepClock
+    {
+        std::function<uint64_t()> counter;
+        uint64_t frequency;
+
+        // QueryPerformanceCounter on Windows, clock_gettime(CLOCK_MONOTONIC) elsewhere.
+        static StepClock System() noexcept(false)
+        {
+#if defined(_WIN32)
+            LARGE_INTEGER frequency;
+            if (!QueryPerformanceFrequency(&frequency))
+            {
+                throw std::runtime_error("QueryPerformanceFrequency");
+            }
+
+            return StepClock{ []()
+                {
+                    LARGE_INTEGER counter;
+                    if (!QueryPerformanceCounter(&counter))
+                    {
+                        throw std::runtime_error("QueryPerformanceCounter");
+                    }
+                    return static_cast<uint64_t>(counter.QuadPart);
+                }, static_cast<uint64_t>(frequency.QuadPart) };
+#else
+            return StepClock{ []()
+                {
+                    timespec now;
+                    if (clock_gettime(CLOCK_MONOTONIC, &now) != 0)
+                    {
+                        throw std::runtime_error("clock_gettime");
+                    }
+                    return static_cast<uint64_t>(now.tv_sec) * 1000000000ULL + static_cast<uint64_t>(now.tv_nsec);
+                }, 1000000000ULL };
+#endif
+        }
+    };
+
     // Helper class for animation and simulation timing.
     class StepTimer
     {
     public:
-        StepTimer() noexcept(false) :
+        explicit StepTimer(StepClock clock = StepClock::System()) noexcept(false) :
+            m_clock(std::move(clock)),
             m_elapsedTicks(0),
             m_totalTicks(0),
             m_leftOverTicks(0),
+            m_droppedTicks(0),
             m_frameCount(0),
             m_framesPerSecond(0),
             m_framesThisSecond(0),
-            m_qpcSecondCounter(0),
+            m_secondCounter(0),
             m_isFixedTimeStep(false),
-            m_targetElapsedTicks(TicksPerSecond / 60)
+            m_targetElapsedTicks(TicksPerSecond / 60),
+            m_maxUpdatesPerTick(0)
         {
-            if (!QueryPerformanceFrequency(&m_qpcFrequency))
+            if (!m_clock.counter || m_clock.frequency == 0)
             {
-                throw std::exception( "QueryPerformanceFrequency" );
+                throw std::invalid_argument("StepClock");
             }
 
-            if (!QueryPerformanceCounter(&m_qpcLastTime))
-            {
-                throw std::exception( "QueryPerformanceCounter" );
-            }
+            m_lastTime = m_clock.counter();
 
             // Initialize max delta to 1/10 of a second.
-            m_qpcMaxDelta = static_cast<uint64_t>(m_qpcFrequency.QuadPart / 10);
+            m_maxDelta = m_clock.frequency / 10;
         }
 
         // Get elapsed time since the previous Update call.
@@ -60,6 +106,25 @@ namespace DX
         void SetTargetElapsedTicks(uint64_t targetElapsed) noexcept { m_targetElapsedTicks = targetElapsed; }
         void SetTargetElapsedSeconds(double targetElapsed) noexcept { m_targetElapsedTicks = SecondsToTicks(targetElapsed); }
 
+        // Cap the fixed timestep updates run by one Tick (0 = no cap). When updates cost more than
+        // they simulate, the time that does not fit is dropped so the game slows down instead of
+        // falling further behind every frame.
+        void SetMaxUpdatesPerTick(uint32_t maxUpdates) noexcept { m_maxUpdatesPerTick = maxUpdates; }
+
+        // How far rendering is between the last fixed update and the next one, in [0, 1).
+        // Variable timestep mode always renders the latest state (1).
+        double GetInterpolationAlpha() const noexcept
+        {
+            if (!m_isFixedTimeStep || m_targetElapsedTicks == 0)
+            {
+                return 1.0;
+            }
+            return static_cast<double>(m_leftOverTicks) / static_cast<double>(m_targetElapsedTicks);
+        }
+
+        // Get total time dropped by the update cap.
+        uint64_t GetDroppedTicks() const noexcept           { return m_droppedTicks; }
+
         // Integer format represents time using 10,000,000 ticks per second.
         static const uint64_t TicksPerSecond = 10000000;
 
@@ -72,15 +137,12 @@ namespace DX
 
         void ResetElapsedTime()
         {
-            if (!QueryPerformanceCounter(&m_qpcLastTime))
-            {
-                throw std::exception("QueryPerformanceCounter");
-            }
+            m_lastTime = m_clock.counter();
 
             m_leftOverTicks = 0;
             m_framesPerSecond = 0;
             m_framesThisSecond = 0;
-            m_qpcSecondCounter = 0;
+            m_secondCounter = 0;
         }
 
         // Update timer state, calling the specified Update function the appropriate number of times.
@@ -88,30 +150,47 @@ namespace DX
         void Tick(const TUpdate& update)
         {
             // Query the current time.
-            LARGE_INTEGER currentTime;
-
-            if (!QueryPerformanceCounter(&currentTime))
-            {
-                throw std::exception( "QueryPerformanceCounter" );
-            }
+            const uint64_t currentTime = m_clock.counter();
 
-            uint64_t timeDelta = static_cast<uint64_t>(currentTime.QuadPart - m_qpcLastTime.QuadPart);
+            uint64_t timeDelta = currentTime - m_lastTime;
 
-            m_qpcLastTime = currentTime;
-            m_qpcSecondCounter += timeDelta;
+            m_lastTime = currentTime;
+            m_secondCounter += timeDelta;
 
             // Clamp excessively large time deltas (e.g. after paused in the debugger).
-            if (timeDelta > m_qpcMaxDelta)
+            if (timeDelta > m_maxDelta)
             {
-                timeDelta = m_qpcMaxDelta;
+                timeDelta = m_maxDelta;
             }
 
-            // Convert QPC units into a canonical tick format. This cannot overflow due to the previous clamp.
+            // Convert clock units into a canonical tick format. This cannot overflow due to the previous clamp.
             timeDelta *= TicksPerSecond;
-            timeDelta /= static_cast<uint64_t>(m_qpcFrequency.QuadPart);
+            timeDelta /= m_clock.frequency;
 
             uint32_t lastFrameCount = m_frameCount;
 
+            Advance(timeDelta, update);
+
+            // Track the current framerate.
+            if (m_frameCount != lastFrameCount)
+            {
+                m_framesThisSecond++;
+            }
+
+            if (m_secondCounter >= m_clock.frequency)
+            {
+                m_framesPerSecond = m_framesThisSecond;
+                m_framesThisSecond = 0;
+                m_secondCounter %= m_clock.frequency;
+            }
+        }
+
+        // Advance by a time delta measured elsewhere (canonical ticks), calling the specified
+        // Update function the appropriate number of times. Lets a subsystem step at its own
+        // fixed rate from the frame's delta, e.g. motion sampled at 30/60/120 Hz.
+        template<typename TUpdate>
+        void Advance(uint64_t timeDelta, const TUpdate& update)
+        {
             if (m_isFixedTimeStep)
             {
                 // Fixed timestep update logic
@@ -130,12 +209,23 @@ namespace DX
 
                 m_leftOverTicks += timeDelta;
 
+                uint32_t updates = 0;
                 while (m_leftOverTicks >= m_targetElapsedTicks)
                 {
+                    if (m_maxUpdatesPerTick != 0 && updates == m_maxUpdatesPerTick)
+                    {
+                        // Spiral of death: keep the fraction for interpolation, drop whole steps.
+                        const uint64_t fraction = m_leftOverTicks % m_targetElapsedTicks;
+                        m_droppedTicks += m_leftOverTicks - fraction;
+                        m_leftOverTicks = fraction;
+                        break;
+                    }
+
                     m_elapsedTicks = m_targetElapsedTicks;
                     m_totalTicks += m_targetElapsedTicks;
                     m_leftOverTicks -= m_targetElapsedTicks;
                     m_frameCount++;
+                    updates++;
 
                     update();
                 }
@@ -150,40 +240,29 @@ namespace DX
 
                 update();
             }
-
-            // Track the current framerate.
-            if (m_frameCount != lastFrameCount)
-            {
-                m_framesThisSecond++;
-            }
-
-            if (m_qpcSecondCounter >= static_cast<uint64_t>(m_qpcFrequency.QuadPart))
-            {
-                m_framesPerSecond = m_framesThisSecond;
-                m_framesThisSecond = 0;
-                m_qpcSecondCounter %= static_cast<uint64_t>(m_qpcFrequency.QuadPart);
-            }
         }
 
     private:
-        // Source timing data uses QPC units.
-        LARGE_INTEGER m_qpcFrequency;
-        LARGE_INTEGER m_qpcLastTime;
-        uint64_t m_qpcMaxDelta;
+        // Source timing data uses clock units.
+        StepClock m_clock;
+        uint64_t m_lastTime;
+        uint64_t m_maxDelta;
 
         // Derived timing data uses a canonical tick format.
         uint64_t m_elapsedTicks;
         uint64_t m_totalTicks;
         uint64_t m_leftOverTicks;
+        uint64_t m_droppedTicks;
 
         // Members for tracking the framerate.
         uint32_t m_frameCount;
         uint32_t m_framesPerSecond;
         uint32_t m_framesThisSecond;
-        uint64_t m_qpcSecondCounter;
+        uint64_t m_secondCounter;
 
         // Members for configuring fixed timestep mode.
         bool m_isFixedTimeStep;
         uint64_t m_targetElapsedTicks;
+        uint32_t m_maxUpdatesPerTick;
     };
 }
@@ -25,25 +25,40 @@ public:
 
 	inline UINT GetBackBufferIndex() const { return m_gameBase->m_backBufferIndex; }
 
-	inline void SetFixedFrameRate(const UINT fps)
+	// Update runs at fps while Render runs every frame; a frame runs at most maxUpdates
+	// (0 = no cap) and the rest is dropped so a slow Update cannot fall further behind.
+	inline void SetFixedFrameRate(const UINT fps, const UINT maxUpdates = 4)
 	{
 		m_gameBase->m_timer.SetFixedTimeStep(true);
 		m_gameBase->m_timer.SetTargetElapsedSeconds(1.0 / fps);
+		m_gameBase->m_timer.SetMaxUpdatesPerTick(maxUpdates);
 	}
 
 	inline void SetVariableFrameRate() { m_gameBase->m_timer.SetFixedTimeStep(false); }
+	// Where Render is between the last two fixed updates [0, 1). Pipelined scenes draw the captured packet as is.
+	inline float GetInterpolationAlpha() const { return float(m_gameBase->m_timer.GetInterpolationAlpha()); }
 	inline void WaitForGpu() const { m_gameBase->WaitForGpu(); }
 
+	// Starts loading the next scene in the background; returning it from Update later switches without a reload.
+	inline void PreloadScene(const NextScene nextScene) { m_gameBase->PreloadScene(nextScene); }
+
 #if DXTK_MULTIGPU
 	inline void Clear(const UINT adapter, const DirectX::XMVECTORF32& color)
 	{ m_gameBase->Clear(adapter, color); }
 
+	inline void ClearRect(const UINT adapter, const DirectX::XMVECTORF32& color, const RECT& rect)
+	{ m_gameBase->ClearRect(adapter, color, rect); }
+
 	inline void ExecuteCommandList(const UINT adapter) const
 	{ m_gameBase->ExecuteCommandList(adapter); }
 
 	inline void ExecuteCommandLists(const UINT adapter, UINT NumCommandLists, ID3D12GraphicsCommandList* const* ppCommandList) const
 	{ m_gameBase->ExecuteCommandLists(adapter, NumCommandLists, ppCommandList); }
 
+	inline void RecordCommandLists(const UINT adapter, size_t count, size_t minPerChunk,
+		const std::function<void(ID3D12GraphicsCommandList*, size_t, size_t)>& record) const
+	{ m_gameBase->RecordCommandLists(adapter, count, minPerChunk, record); }
+
 	inline ID3D12Resource* PopulateCopyCommandList() { return m_gameBase->PopulateCopyCommandList(); }
 	inline void ExecuteCopyCommandList() { m_gameBase->ExecuteCopyCommandList(); }
 
@@ -81,6 +96,11 @@ public:
 		m_gameBase->ClearRenderTarget(PrimaryAdapter, color);
 	}
 
+	inline void ClearRect(const DirectX::XMVECTORF32& color, const RECT& rect) const
+	{
+		m_gameBase->ClearRect(PrimaryAdapter, color, rect);
+	}
+
 	inline void ExecuteCommandList() const
 	{
 		m_gameBase->ExecuteCommandList(PrimaryAdapter);
@@ -91,6 +111,14 @@ public:
 		m_gameBase->ExecuteCommandLists(PrimaryAdapter, NumCommandLists, ppCommandList);
 	}
 
+	// Splits count items into chunks recorded on worker threads, each into its own command list
+	// (render target and viewport already set). ExecuteCommandList submits them in order.
+	inline void RecordCommandLists(size_t count, size_t minPerChunk,
+		const std::function<void(ID3D12GraphicsCommandList*, size_t, size_t)>& record) const
+	{
+		m_gameBase->RecordCommandLists(PrimaryAdapter, count, minPerChunk, record);
+	}
+
 	inline void CreateCommandAllocator(ID3D12CommandAllocator** commandAllocator)
 	{
 		DX::ThrowIfFailed(m_gameBase->m_devices[PrimaryAdapter].Device->CreateCommandAllocator(
@@ -136,6 +164,9 @@ public:
 
 #if DXTK_D3D9
 	inline void CreateD3D9Device() const { m_gameBase->D3D9CreateDevice();  }
+	// Report what was drawn through Device9 directly (nullptr = everything); DirectXTK9 draws report themselves.
+	// Only what was reported is copied to Direct3D12 at EndScene.
+	inline void InvalidateD3D9(const RECT* rect = nullptr) const { m_gameBase->D3D9InvalidateRect(rect); }
 #endif
 
 	inline void ResetAudioEngine()
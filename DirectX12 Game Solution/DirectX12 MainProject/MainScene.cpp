@@ -9,7 +9,7 @@
 #pragma comment(lib,"d3dcompiler.lib")
 
 // Initialize member variables.
-MainScene::MainScene()
+MainScene::MainScene() : loaded(false)
 {
 
 }
@@ -35,19 +35,19 @@ void MainScene::Initialize()
 void MainScene::LoadAssets()
 {
 
-	bgm = DX9::MediaRenderer::CreateFromFile(DXTK->Device9, L"conqurer.mp3");
-	bgm->Play();
+	// Everything loads in the background; Update and Render show a loading bar until it is done.
+	loader.LoadAudio(bgm, L"conqurer.mp3");
 
-	reimu.PmxRead("Model/ɂ񎮗얲/reimu.pmx");
 	pos = Vector3(0, 3, 0);
 	reimu.SetPosition(pos);
 	reimu.SetRotation(Vector3(0, 0, 0));
 	reimu.SetCamera(mainCamera);
+	loader.LoadModel(reimu, "Model/ɂ񎮗얲/reimu.pmx", mainCamera);
 
 	back.SetShader(L"Shaders/VS2.hlsl", L"Shaders/PS2.hlsl");
-	back.PmxRead("Model/Stage_ST43/ST43.pmx");
 	back.SetScale(Vector3(0.5f, 0.5f, 0.5f));
 	back.SetCamera(mainCamera);
+	loader.LoadModel(back, "Model/Stage_ST43/ST43.pmx", mainCamera);
 
 }
 
@@ -56,6 +56,9 @@ void MainScene::Terminate()
 {
 	//constantBuffer->Unmap(0, nullptr);
 
+	// Stop loading before the models and audio are torn down.
+	loader.Cancel();
+
 	DXTK->ResetAudioEngine();
 	DXTK->WaitForGpu();
 
@@ -78,8 +81,20 @@ void MainScene::OnRestartSound()
 // Updates the scene.
 NextScene MainScene::Update(const float deltaTime)
 {
+	if (!loaded)
+	{
+		loader.Update();
+		if (!loader.IsDone())
+			return NextScene::Continue;
+
+		loaded = true;
+		loader.ReportTimings();
+		if (bgm)
+			bgm->Play();
+	}
+
+	// Constants are written when the captured frame is rendered; Update must not touch the GPU.
 	//reimu.Animetion(deltaTime);
-	reimu.Update();
 	if (DXTK->KeyState->A)
 		rote.y += 1.0f;
 	if (DXTK->KeyState->D)
@@ -109,9 +124,47 @@ void MainScene::Render()
 	DXTK->ResetCommand();
 	DXTK->ClearRenderTarget(Colors::White);
 
+	if (!loaded)
+	{
+		// Loading screen: a progress bar across the lower middle of the screen.
+		const auto progress = loader.GetProgress();
+		const Rect frame(DXTK->ScreenWidth / 4, DXTK->ScreenHeight * 3 / 4, DXTK->ScreenWidth * 3 / 4, DXTK->ScreenHeight * 3 / 4 + 16);
+		const LONG filled = static_cast<LONG>((frame.right - frame.left) * progress.fraction);
+		DXTK->ClearRect(Colors::LightGray, frame);
+		if (filled > 0)
+			DXTK->ClearRect(Colors::DimGray, Rect(frame.left, frame.top, frame.left + filled, frame.bottom));
+
+		DXTK->ExecuteCommandList();
+		return;
+	}
+
 	reimu.Render();
 	back.Render();
 
 	DXTK->ExecuteCommandList();
 }
 
+// Copies what the frame needs after Update (simulation thread).
+void MainScene::Capture(FramePacket& packet)
+{
+	reimu.Capture(packet.Add());
+	back.Capture(packet.Add());
+}
+
+// Draws the frame captured one Update earlier.
+void MainScene::Render(const FramePacket& packet)
+{
+	DXTK->ResetCommand();
+	DXTK->ClearRenderTarget(Colors::White);
+
+	// Constants and textures are prepared here; the draws are recorded in parallel, one list per chunk of models.
+	for (const auto& frame : packet)
+		frame.model->Prepare(frame);
+
+	DXTK->RecordCommandLists(packet.Count(), 1, [&](ID3D12GraphicsCommandList* commandList, size_t begin, size_t end) {
+		for (size_t i = begin; i < end; ++i)
+			packet[i].model->Record(commandList, packet[i]);
+	});
+
+	DXTK->ExecuteCommandList();
+}
@@ -7,6 +7,7 @@
 #include "Scene.h"
 #include "tool/PmxLoader.h"
 #include "tool/VMDLoader.h"
+#include "tool/AssetLoader.h"
 
 
 using Microsoft::WRL::ComPtr;
@@ -37,6 +38,15 @@ public:
 	NextScene Update(const float deltaTime) override;
 	void Render() override;
 
+	// Once loaded, Update runs a frame ahead of Render on the simulation thread.
+	bool IsPipelined() const override { return loaded; }
+	void Capture(FramePacket& packet) override;
+	void Render(const FramePacket& packet) override;
+
+	// Loads in the background while the previous scene runs.
+	void Preload() override { loader.Update(); }
+	bool IsLoaded() const override { return loader.IsDone(); }
+
 private:
 
 	float leftArmAngle;
@@ -54,4 +64,8 @@ private:
 	DX9::MEDIARENDERER bgm;
 	Vector3 rote;
 	Vector3 pos;
+
+	// Declared last so it is destroyed (and its workers stopped) before the models it loads into.
+	AssetLoader loader;
+	bool loaded;
 };
\ No newline at end of file
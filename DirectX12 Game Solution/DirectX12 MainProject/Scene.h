@@ -10,6 +10,8 @@ enum class NextScene : int {
 	StartScene = MainScene
 };
 
+struct FramePacket;
+
 class Scene {
 public:
 	Scene() = default;
@@ -37,4 +39,19 @@ public:
 
 	virtual NextScene Update(const float deltaTime) = 0;
 	virtual void Render() = 0;
+
+	// Frame pipelining (opt-in). While IsPipelined() returns true, Update runs on the
+	// simulation thread one frame ahead of Render, so it must not record commands or
+	// allocate GPU memory. Capture then copies what the frame needs into the packet,
+	// and Render(packet) draws the previous frame's packet on the main thread.
+	virtual bool IsPipelined() const { return false; }
+	virtual void Capture(FramePacket& packet) {}
+	virtual void Render(const FramePacket& packet) { Render(); }
+
+	// Scene streaming. A scene requested with DXTK->PreloadScene is started while the current
+	// scene still runs, and Preload is called once a frame on the main thread until the game
+	// changes to it. It must not start sounds before its first Update. IsLoaded ends the
+	// transition; cached assets the incoming scene did not take over are released then.
+	virtual void Preload() {}
+	virtual bool IsLoaded() const { return true; }
 };
\ No newline at end of file
@@ -0,0 +1,321 @@
+/**
+ * @file Archive.cpp
+ * @brief AZbg̃pbP[W(1t@Cɂ܂Ƃ߁AnbVňڎ)
+ * @author hoshi hirofumi
+ * @date 2026/10/19
+ */
+
+#include "Archive.h"
+#include "Hash.h"
+
+#include <algorithm>
+#include <cstring>
+
+namespace {
+	//! u8strinǧ^C++17C++20ňႤ̂std::stringɂ낦
+	std::string ToUtf8(const std::filesystem::path& path)
+	{
+		const auto text = path.u8string();
+		return std::string(text.begin(), text.end());
+	}
+
+	bool EntryLess(const Archive::Entry& a, const Archive::Entry& b)
+	{
+		return a.hash < b.hash;
+	}
+}
+
+/**
+	@brief	A[JCuJ
+	@note	ڎ̓Rs[ĎAf[^̓}bv܂܃r[œn
+*/
+bool Archive::Open(const std::filesystem::path& path)
+{
+	auto file = std::make_shared<MappedFile>();
+	if (!file->Open(path) || file->Size() < sizeof(Header))
+		return false;
+
+	Header header;
+	memcpy(&header, file->Data(), sizeof(header));
+	if (header.magic != MAGIC || header.version != VERSION)
+		return false;
+
+	const uint64_t size = file->Size();
+	if (header.tocOffset > size || header.entryCount > (size - header.tocOffset) / sizeof(Entry) ||
+		header.namesOffset > size || header.namesSize > size - header.namesOffset)
+		return false;
+
+	std::vector<Entry> entries(static_cast<size_t>(header.entryCount));
+	if (!entries.empty())
+		memcpy(entries.data(), file->Data() + header.tocOffset, entries.size() * sizeof(Entry));
+
+	//ꂽErŐ؂ꂽA[JCuŃ}bv̊Owr[nȂ
+	for (const auto& entry : entries) {
+		if (entry.offset > size || entry.size > size - entry.offset ||
+			static_cast<uint64_t>(entry.nameOffset) + entry.nameLength > header.namesSize)
+			return false;
+	}
+	if (!std::is_sorted(entries.begin(), entries.end(), EntryLess))
+		return false;
+
+	m_file      = std::move(file);
+	m_entries   = std::move(entries);
+	m_names     = reinterpret_cast<const char*>(m_file->Data() + header.namesOffset);
+	m_namesSize = static_cast<size_t>(header.namesSize);
+	return true;
+}
+
+FileView Archive::OpenFile(const std::filesystem::path& key) const
+{
+	const Entry* entry = Find(key);
+	if (entry == nullptr)
+		return FileView();
+	return OpenEntry(entry - m_entries.data());
+}
+
+bool Archive::Contains(const std::filesystem::path& key) const
+{
+	return Find(key) != nullptr;
+}
+
+std::string Archive::GetName(size_t index) const
+{
+	const Entry& entry = m_entries[index];
+	return std::string(m_names + entry.nameOffset, entry.nameLength);
+}
+
+FileView Archive::OpenEntry(size_t index) const
+{
+	const Entry& entry = m_entries[index];
+	return FileView(m_file, m_file->Data() + entry.offset, static_cast<size_t>(entry.size));
+}
+
+/**
+	@brief	L[̐K
+	@note	"./Model\\Miku.PMX"  "model/miku.pmx"
+*/
+std::string Archive::NormalizeKey(const std::filesystem::path& path)
+{
+	std::string text = ToUtf8(path);
+	std::replace(text.begin(), text.end(), '\\', '/');
+
+	std::vector<std::string> parts;
+	size_t begin = 0;
+	while (begin <= text.size()) {
+		size_t end = text.find('/', begin);
+		if (end == std::string::npos)
+			end = text.size();
+
+		const std::string part = text.substr(begin, end - begin);
+		if (part == "..") {
+			if (!parts.empty() && parts.back() != "..")
+				parts.pop_back();
+			else
+				parts.push_back(part);
+		}
+		else if (!part.empty() && part != ".") {
+			parts.push_back(part);
+		}
+		begin = end + 1;
+	}
+
+	std::string key;
+	for (const auto& part : parts) {
+		if (!key.empty())
+			key += '/';
+		key += part;
+	}
+
+	//}`oCg͕̕ςȂ(ASCII)
+	for (auto& c : key) {
+		if (c >= 'A' && c <= 'Z')
+			c = static_cast<char>(c - 'A' + 'a');
+	}
+	return key;
+}
+
+uint64_t Archive::HashKey(const std::string& key)
+{
+	return Hasher().Add(key.data(), key.size()).Value();
+}
+
+/**
+	@brief	ڎ̓񕪒T(nbVՓ˂Ƃ͖OŊm߂)
+*/
+const Archive::Entry* Archive::Find(const std::filesystem::path& key) const
+{
+	const std::string normalized = NormalizeKey(key);
+
+	Entry probe{};
+	probe.hash = HashKey(normalized);
+
+	auto it = std::lower_bound(m_entries.begin(), m_entries.end(), probe, EntryLess);
+	for (; it != m_entries.end() && it->hash == probe.hash; ++it) {
+		if (it->nameLength == normalized.size() &&
+			memcmp(m_names + it->nameOffset, normalized.data(), normalized.size()) == 0)
+			return &*it;
+	}
+	return nullptr;
+}
+
+ArchiveWriter::ArchiveWriter() : m_file(nullptr), m_offset(0)
+{
+}
+
+ArchiveWriter::~ArchiveWriter()
+{
+	if (m_file != nullptr)
+		fclose(m_file);
+}
+
+/**
+	@brief	݊Jn(wb_[͉̂̂ĂAFinishŏ)
+*/
+bool ArchiveWriter::Create(const std::filesystem::path& path)
+{
+#ifdef _WIN32
+	if (_wfopen_s(&m_file, path.c_str(), L"wb") != 0)
+		m_file = nullptr;
+#else
+	m_file = fopen(path.c_str(), "wb");
+#endif
+	if (m_file == nullptr)
+		return false;
+
+	m_offset = 0;
+	m_entries.clear();
+	m_names.clear();
+
+	const Archive::Header header{};
+	return Write(&header, sizeof(header));
+}
+
+bool ArchiveWriter::Add(const std::filesystem::path& key, const void* data, size_t size)
+{
+	if (m_file == nullptr)
+		return false;
+
+	const std::string normalized = Archive::NormalizeKey(key);
+	if (normalized.empty() || normalized.size() > UINT16_MAX)
+		return false;
+
+	Archive::Entry entry{};
+	entry.hash = Archive::HashKey(normalized);
+	for (const auto& other : m_entries) {
+		if (other.hash == entry.hash && m_names.compare(other.nameOffset, other.nameLength, normalized) == 0)
+			return false;
+	}
+
+	if (!Pad(size >= LARGE_FILE_SIZE ? PAGE_ALIGNMENT : SMALL_ALIGNMENT))
+		return false;
+
+	entry.offset     = m_offset;
+	entry.size       = size;
+	entry.nameOffset = static_cast<uint32_t>(m_names.size());
+	entry.nameLength = static_cast<uint16_t>(normalized.size());
+
+	if (size > 0 && !Write(data, size))
+		return false;
+
+	m_names += normalized;
+	m_entries.push_back(entry);
+	return true;
+}
+
+bool ArchiveWriter::AddFile(const std::filesystem::path& key, const std::filesystem::path& path)
+{
+	MappedFile file;
+	if (!file.Open(path))
+		return false;
+	return Add(key, file.Data(), file.Size());
+}
+
+/**
+	@return	ǉł
+*/
+size_t ArchiveWriter::AddDirectory(const std::filesystem::path& root, const std::filesystem::path& directory)
+{
+	std::error_code error;
+	if (!std::filesystem::is_directory(directory, error))
+		return 0;
+
+	//яŒ肵āA͂瓯A[JCu
+	std::vector<std::filesystem::path> files;
+	for (const auto& item : std::filesystem::recursive_directory_iterator(directory, error)) {
+		if (item.is_regular_file())
+			files.push_back(item.path());
+	}
+	std::sort(files.begin(), files.end());
+
+	size_t added = 0;
+	for (const auto& file : files) {
+		if (AddFile(file.lexically_relative(root), file))
+			++added;
+	}
+	return added;
+}
+
+bool ArchiveWriter::Finish()
+{
+	if (m_file == nullptr)
+		return false;
+
+	std::sort(m_entries.begin(), m_entries.end(), EntryLess);
+
+	Archive::Header header{};
+	header.magic      = Archive::MAGIC;
+	header.version    = Archive::VERSION;
+	header.entryCount = m_entries.size();
+
+	bool succeeded = Pad(SMALL_ALIGNMENT);
+	header.tocOffset = m_offset;
+	if (succeeded && !m_entries.empty())
+		succeeded = Write(m_entries.data(), m_entries.size() * sizeof(Archive::Entry));
+
+	header.namesOffset = m_offset;
+	header.namesSize   = m_names.size();
+	if (succeeded && !m_names.empty())
+		succeeded = Write(m_names.data(), m_names.size());
+
+	succeeded = succeeded && fseek(m_file, 0, SEEK_SET) == 0 && fwrite(&header, sizeof(header), 1, m_file) == 1;
+	succeeded = fclose(m_file) == 0 && succeeded;
+	m_file = nullptr;
+	return succeeded;
+}
+
+/**
+	@note	oɎsƂ͓r܂ł̃t@C
+*/
+bool ArchiveWriter::Pack(const std::filesystem::path& output, const std::filesystem::path& root,
+	const std::vector<std::filesystem::path>& directories)
+{
+	ArchiveWriter writer;
+	if (!writer.Create(output))
+		return false;
+
+	for (const auto& directory : directories)
+		writer.AddDirectory(root, root / directory);
+
+	if (!writer.Finish()) {
+		std::error_code error;
+		std::filesystem::remove(output, error);
+		return false;
+	}
+	return true;
+}
+
+bool ArchiveWriter::Write(const void* data, size_t size)
+{
+	if (fwrite(data, size, 1, m_file) != 1)
+		return false;
+	m_offset += size;
+	return true;
+}
+
+bool ArchiveWriter::Pad(uint64_t alignment)
+{
+	static const uint8_t ZERO[PAGE_ALIGNMENT] = {};
+
+	const uint64_t padding = (alignment - m_offset % alignment) % alignment;
+	return padding == 0 || Write(ZERO, static_cast<size_t>(padding));
+}
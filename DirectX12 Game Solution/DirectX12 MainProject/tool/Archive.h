@@ -0,0 +1,138 @@
+/**
+ * @file Archive.h
+ * @brief AZbg̃pbP[W(1t@Cɂ܂Ƃ߁AnbVňڎ)
+ * @author hoshi hirofumi
+ * @date 2026/10/19
+ * @note `: Header | Gg̃f[^(ς) | ڎ(nbV) | O
+ *       pbJ[CIœ߁AWindowsɈˑȂ
+ */
+
+#pragma once
+
+/*
+-------------------------------------------------------------------------------------
+	CN[h
+-------------------------------------------------------------------------------------
+*/
+#include "MappedFile.h"
+
+#include <cstdint>
+#include <cstdio>
+#include <filesystem>
+#include <memory>
+#include <string>
+#include <vector>
+
+/*
+-------------------------------------------------------------------------------------
+	ArchiveNX@錾
+-------------------------------------------------------------------------------------
+*/
+class Archive {
+public:
+	static constexpr uint32_t MAGIC   = 0x4b415041;	//"APAK"
+	//! 2: gĂȂk̗O(f[^͂̂܂܊i[)
+	static constexpr uint32_t VERSION = 2;
+
+	struct Header {
+		uint32_t magic;
+		uint32_t version;
+		uint64_t entryCount;
+		uint64_t tocOffset;
+		uint64_t namesOffset;
+		uint64_t namesSize;
+	};
+
+	struct Entry {
+		uint64_t    hash;			//NormalizeKeypXFNV-1a
+		uint64_t    offset;			//A[JCu̐擪
+		uint64_t    size;
+		uint32_t    nameOffset;		//Ö̗̐擪
+		uint16_t    nameLength;
+		uint16_t    reserved;
+	};
+	static_assert(sizeof(Header) == 40, "archive header layout");
+	static_assert(sizeof(Entry) == 32, "archive entry layout");
+
+	Archive() {}
+	virtual ~Archive() {}
+
+	Archive(Archive&&) = delete;
+	Archive& operator= (Archive&&) = delete;
+
+	Archive(Archive const&) = delete;
+	Archive& operator= (Archive const&) = delete;
+
+	bool Open(const std::filesystem::path& path);
+
+	//ȂƂ͋̃r[
+	FileView OpenFile(const std::filesystem::path& key) const;
+	bool Contains(const std::filesystem::path& key) const;
+
+	size_t GetEntryCount() const { return m_entries.size(); }
+	std::string GetName(size_t index) const;
+	const Entry& GetEntry(size_t index) const { return m_entries[index]; }
+	FileView OpenEntry(size_t index) const;
+
+	//؂'/'ɁA啶ɂA"./"E"../"
+	static std::string NormalizeKey(const std::filesystem::path& path);
+	static uint64_t HashKey(const std::string& key);
+
+private:
+	const Entry* Find(const std::filesystem::path& key) const;
+
+	std::shared_ptr<MappedFile> m_file;
+	std::vector<Entry>          m_entries;	//nbV
+	const char*                 m_names = nullptr;
+	size_t                      m_namesSize = 0;
+};
+
+/*
+-------------------------------------------------------------------------------------
+	ArchiveWriterNX@錾
+-------------------------------------------------------------------------------------
+*/
+class ArchiveWriter {
+public:
+	//! 傫t@C̓y[WPʂɑ(}bvr[̂܂܃Abv[hɎg悤)
+	static constexpr uint64_t PAGE_ALIGNMENT  = 4096;
+	static constexpr uint64_t SMALL_ALIGNMENT = 16;
+	static constexpr uint64_t LARGE_FILE_SIZE = 64 * 1024;
+
+	ArchiveWriter();
+	virtual ~ArchiveWriter();
+
+	ArchiveWriter(ArchiveWriter&&) = delete;
+	ArchiveWriter& operator= (ArchiveWriter&&) = delete;
+
+	ArchiveWriter(ArchiveWriter const&) = delete;
+	ArchiveWriter& operator= (ArchiveWriter const&) = delete;
+
+	bool Create(const std::filesystem::path& path);
+
+	//keyNormalizeKeyĂo^(L[͌ォǉ̂ŏ㏑s)
+	bool Add(const std::filesystem::path& key, const void* data, size_t size);
+	bool AddFile(const std::filesystem::path& key, const std::filesystem::path& path);
+
+	//root̉̃t@Croot̑΃pXL[ɂđSǉ
+	size_t AddDirectory(const std::filesystem::path& root, const std::filesystem::path& directory);
+
+	//ڎăwb_[
+	bool Finish();
+
+	size_t GetEntryCount() const { return m_entries.size(); }
+	uint64_t GetDataSize() const { return m_offset; }
+
+	//root̉directories܂Ƃ߂1̃A[JCuɂ(/packArchivePackŎg)
+	static bool Pack(const std::filesystem::path& output, const std::filesystem::path& root,
+		const std::vector<std::filesystem::path>& directories);
+
+private:
+	bool Write(const void* data, size_t size);
+	bool Pad(uint64_t alignment);
+
+	FILE*                      m_file;
+	uint64_t                   m_offset;
+	std::vector<Archive::Entry> m_entries;
+	std::string                m_names;
+};
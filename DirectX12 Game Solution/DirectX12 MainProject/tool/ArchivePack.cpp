@@ -0,0 +1,122 @@
+/**
+ * @file ArchivePack.cpp
+ * @brief A[JCũpbJ[(R}hCAQ[{̂̃vWFNgɂ͊܂߂Ȃ)
+ * @author hoshi hirofumi
+ * @date 2026/10/19
+ * @note CIł̃rh: g++ -std=c++17 -O2 ArchivePack.cpp Archive.cpp MappedFile.cpp -o ArchivePack
+ *       ArchivePack pack   <output.pak> <root> [directory...]  (ȗModel Motion Baked)
+ *       ArchivePack list   <archive.pak>
+ *       ArchivePack verify <archive.pak> <root>                (ʂ̃t@Cƒgׂ)
+ */
+
+#include "Archive.h"
+
+#include <cstring>
+
+namespace {
+	int Usage()
+	{
+		fprintf(stderr,
+			"usage: ArchivePack pack <output.pak> <root> [directory...]\n"
+			"       ArchivePack list <archive.pak>\n"
+			"       ArchivePack verify <archive.pak> <root>\n");
+		return 2;
+	}
+
+	int Pack(int argc, char* argv[])
+	{
+		std::vector<std::filesystem::path> directories;
+		for (int i = 4; i < argc; ++i)
+			directories.emplace_back(argv[i]);
+		if (directories.empty())
+			directories = { "Model", "Motion", "Baked" };
+
+		if (!ArchiveWriter::Pack(argv[2], argv[3], directories)) {
+			fprintf(stderr, "failed to write %s\n", argv[2]);
+			return 1;
+		}
+
+		Archive archive;
+		if (!archive.Open(argv[2])) {
+			fprintf(stderr, "failed to reopen %s\n", argv[2]);
+			return 1;
+		}
+		printf("%s: %zu entries\n", argv[2], archive.GetEntryCount());
+		return 0;
+	}
+
+	int List(const char* path)
+	{
+		Archive archive;
+		if (!archive.Open(path)) {
+			fprintf(stderr, "failed to open %s\n", path);
+			return 1;
+		}
+
+		for (size_t i = 0; i < archive.GetEntryCount(); ++i) {
+			const auto& entry = archive.GetEntry(i);
+			printf("%016llx %10llu %10llu %s\n",
+				static_cast<unsigned long long>(entry.hash),
+				static_cast<unsigned long long>(entry.offset),
+				static_cast<unsigned long long>(entry.size),
+				archive.GetName(i).c_str());
+		}
+		return 0;
+	}
+
+	/**
+		@brief	root̉̃t@C𖼑OňAgƐm߂(A[JCuɂ̂)
+		@note	O͏ɂĊi[Ă̂ŁAA[JCu猳̃t@C͊JȂ
+	*/
+	int Verify(const char* path, const char* root)
+	{
+		Archive archive;
+		if (!archive.Open(path)) {
+			fprintf(stderr, "failed to open %s\n", path);
+			return 1;
+		}
+
+		std::vector<std::filesystem::path> files;
+		std::error_code error;
+		for (const auto& item : std::filesystem::recursive_directory_iterator(root, error)) {
+			if (item.is_regular_file())
+				files.push_back(item.path());
+		}
+
+		size_t found = 0;
+		size_t mismatches = 0;
+		for (const auto& file : files) {
+			const auto key = file.lexically_relative(root);
+			if (!archive.Contains(key))
+				continue;
+			++found;
+
+			const FileView view = archive.OpenFile(key);
+			MappedFile loose;
+			const bool same = view && loose.Open(file) && loose.Size() == view.Size() &&
+				memcmp(loose.Data(), view.Data(), view.Size()) == 0;
+			const bool aligned = view.Size() < ArchiveWriter::LARGE_FILE_SIZE ||
+				reinterpret_cast<uintptr_t>(view.Data()) % ArchiveWriter::PAGE_ALIGNMENT == 0;
+
+			if (!same || !aligned) {
+				fprintf(stderr, "mismatch: %s\n", key.generic_string().c_str());
+				++mismatches;
+			}
+		}
+		mismatches += archive.GetEntryCount() - found;
+
+		printf("%s: %zu entries, %zu mismatches\n", path, archive.GetEntryCount(), mismatches);
+		return mismatches == 0 ? 0 : 1;
+	}
+}
+
+int main(int argc, char* argv[])
+{
+	if (argc >= 4 && strcmp(argv[1], "pack") == 0)
+		return Pack(argc, argv);
+	if (argc == 3 && strcmp(argv[1], "list") == 0)
+		return List(argv[2]);
+	if (argc == 4 && strcmp(argv[1], "verify") == 0)
+		return Verify(argv[2], argv[3]);
+	return Usage();
+}
@@ -0,0 +1,94 @@
+/**
+ * @file AssetFiles.cpp
+ * @brief AZbg̃t@CJ(}EgA[JCuɒTAΌʂ̃t@C)
+ * @author hoshi hirofumi
+ * @date 2026/10/19
+ */
+
+#include "AssetFiles.h"
+
+AssetFiles::AssetFiles() : m_statistics{}
+{
+}
+
+/**
+	@brief	A[JCũ}Eg
+	@return	JȂƂfalse(ʂ̃t@Cœ)
+*/
+bool AssetFiles::Mount(const std::filesystem::path& archive)
+{
+	auto mounted = std::make_unique<Archive>();
+	if (!mounted->Open(archive))
+		return false;
+
+	std::lock_guard<std::mutex> lock(m_mutex);
+	m_archives.push_back(std::move(mounted));
+	m_statistics.archives = m_archives.size();
+	return true;
+}
+
+/**
+	@note	JĂr[̓}bvLĂ̂ŁAA}EgĂǂݑ
+*/
+void AssetFiles::UnmountAll()
+{
+	std::lock_guard<std::mutex> lock(m_mutex);
+	m_archives.clear();
+	m_statistics.archives = 0;
+}
+
+FileView AssetFiles::Open(const std::filesystem::path& path)
+{
+	{
+		std::lock_guard<std::mutex> lock(m_mutex);
+		for (auto it = m_archives.rbegin(); it != m_archives.rend(); ++it) {
+			auto view = (*it)->OpenFile(path);
+			if (view) {
+				++m_statistics.archiveOpens;
+				return view;
+			}
+		}
+	}
+
+	auto file = std::make_shared<MappedFile>();
+	const bool opened = file->Open(path);
+
+	std::lock_guard<std::mutex> lock(m_mutex);
+	if (!opened) {
+		++m_statistics.failures;
+		return FileView();
+	}
+	++m_statistics.looseOpens;
+	return FileView(file, file->Data(), file->Size());
+}
+
+bool AssetFiles::Exists(const std::filesystem::path& path) const
+{
+	if (IsInArchive(path))
+		return true;
+
+	std::error_code error;
+	return std::filesystem::is_regular_file(path, error);
+}
+
+bool AssetFiles::IsInArchive(const std::filesystem::path& path) const
+{
+	std::lock_guard<std::mutex> lock(m_mutex);
+	for (const auto& archive : m_archives) {
+		if (archive->Contains(path))
+			return true;
+	}
+	return false;
+}
+
+AssetFiles::Statistics AssetFiles::GetStatistics() const
+{
+	std::lock_guard<std::mutex> lock(m_mutex);
+	return m_statistics;
+}
+
+AssetFiles& AssetFiles::Get()
+{
+	static AssetFiles instance;
+	return instance;
+}
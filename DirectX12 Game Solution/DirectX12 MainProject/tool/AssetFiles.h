@@ -0,0 +1,65 @@
+/**
+ * @file AssetFiles.h
+ * @brief AZbg̃t@CJ(}EgA[JCuɒTAΌʂ̃t@C)
+ * @author hoshi hirofumi
+ * @date 2026/10/19
+ * @note ǂ}bvŊJAǂݍݑFileView璼ډ͂
+ */
+
+#pragma once
+
+/*
+-------------------------------------------------------------------------------------
+	CN[h
+-------------------------------------------------------------------------------------
+*/
+#include "Archive.h"
+
+#include <mutex>
+
+/*
+-------------------------------------------------------------------------------------
+	AssetFilesNX@錾
+-------------------------------------------------------------------------------------
+*/
+class AssetFiles {
+public:
+	//! NɃ}EgA[JCu(Assets̑΃pX)
+	static constexpr const wchar_t* DEFAULT_ARCHIVE = L"Assets.pak";
+
+	struct Statistics {
+		size_t archives;		//}EgA[JCu̐
+		size_t archiveOpens;	//A[JCuJ
+		size_t looseOpens;		//ʂ̃t@CJ
+		size_t failures;		//ǂɂ
+	};
+
+	AssetFiles();
+	virtual ~AssetFiles() {}
+
+	AssetFiles(AssetFiles&&) = delete;
+	AssetFiles& operator= (AssetFiles&&) = delete;
+
+	AssetFiles(AssetFiles const&) = delete;
+	AssetFiles& operator= (AssetFiles const&) = delete;
+
+	//ォ}EĝɒT
+	bool Mount(const std::filesystem::path& archive);
+	void UnmountAll();
+
+	//pXAssets̑΃pX(A[JCũL[Ɠ)
+	FileView Open(const std::filesystem::path& path);
+	bool Exists(const std::filesystem::path& path) const;
+	bool IsInArchive(const std::filesystem::path& path) const;
+
+	Statistics GetStatistics() const;
+
+	//VOg
+	static AssetFiles& Get();
+
+private:
+	std::vector<std::unique_ptr<Archive>> m_archives;
+	Statistics                            m_statistics;
+
+	mutable std::mutex m_mutex;
+};
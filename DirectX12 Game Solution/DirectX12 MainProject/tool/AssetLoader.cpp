@@ -0,0 +1,352 @@
+/**
+ * @file AssetLoader.cpp
+ * @brief V[̃AZbg̔񓯊ǂݍ(iKƂɃ[J[XbhƃCXbhŐi߂)
+ * @author hoshi hirofumi
+ * @date 2026/10/19
+ */
+
+#include "AssetLoader.h"
+
+#include <algorithm>
+#include <filesystem>
+
+namespace {
+	uint64_t FileSize(const std::filesystem::path& path)
+	{
+		std::error_code error;
+		const auto size = std::filesystem::file_size(path, error);
+		return error ? 0 : static_cast<uint64_t>(size);
+	}
+}
+
+AssetLoader::AssetLoader()
+	: m_cancelled(false), m_start(std::chrono::steady_clock::now())
+{
+	JobSystem::Get();
+}
+
+AssetLoader::~AssetLoader()
+{
+	Cancel();
+}
+
+/**
+	@brief	AZbg̓o^
+	@param	name         OEvp̖O
+	@param	bytes        ǐvZp(t@CTCY)
+	@param	stages       ɎsiK
+	@param	dependencies 炪SDoneɂȂĂn߂
+*/
+AssetLoader::Id AssetLoader::Enqueue(const std::wstring& name, uint64_t bytes, std::vector<Stage> stages, const std::vector<Id>& dependencies)
+{
+	auto asset = make_unique<Asset>();
+	asset->name         = name;
+	asset->bytes        = bytes;
+	asset->stages       = std::move(stages);
+	asset->dependencies = dependencies;
+	asset->next         = 0;
+	asset->state        = asset->stages.empty() ? State::Done : State::Waiting;
+	asset->stageStarted = false;
+
+	std::lock_guard<std::mutex> lock(m_mutex);
+	if (m_assets.empty())
+		m_start = std::chrono::steady_clock::now();
+	if (m_cancelled)
+		asset->state = State::Cancelled;
+
+	m_assets.push_back(std::move(asset));
+	return m_assets.size() - 1;
+}
+
+/**
+	@brief	f̓ǂݍ
+	@param	camera ŏɌeNX`߂J
+	@note	fUpdateERender͓ǂݍ݂I܂ŌĂ΂Ȃ
+*/
+AssetLoader::Id AssetLoader::LoadModel(PmxLoader& model, const std::string& fileName, const DX12::CAMERA& camera, const std::vector<Id>& dependencies)
+{
+	PmxLoader* target = &model;
+	std::vector<Stage> stages = {
+		{ "read",     Thread::Worker, [target, fileName]() { return target->ReadFile(fileName.c_str()) ? Result::Done : Result::Failed; } },
+		{ "shaders",  Thread::Worker, [target]() { target->InitShader(); return Result::Done; } },
+		{ "setup",    Thread::Main,   [target]() { target->SetUp(); return Result::Done; } },
+		{ "textures", Thread::Main,   [target, camera]() { return target->Prefetch(camera) ? Result::Done : Result::Retry; } },
+		{ "pipeline", Thread::Main,   [target]() { return target->IsReady() ? Result::Done : Result::Retry; } },
+	};
+	return Enqueue(std::filesystem::path(fileName).filename().wstring(), FileSize(fileName), std::move(stages), dependencies);
+}
+
+/**
+	@brief	[V̓ǂݍ
+	@param	modelId LoadModel̖߂l({[̏ĝŃf̌)
+*/
+AssetLoader::Id AssetLoader::LoadMotion(PmxLoader& model, const std::string& fileName, Id modelId)
+{
+	PmxLoader* target = &model;
+	std::vector<Stage> stages = {
+		{ "read", Thread::Worker, [target, fileName]() { target->LoadMotion(fileName.c_str()); return Result::Done; } },
+	};
+	return Enqueue(std::filesystem::path(fileName).filename().wstring(), FileSize(fileName), std::move(stages), { modelId });
+}
+
+AssetLoader::Id AssetLoader::LoadTexture(const std::wstring& fileName, std::shared_ptr<StreamedTexture>& texture, const std::vector<Id>& dependencies)
+{
+	auto* target = &texture;
+	std::vector<Stage> stages = {
+		{ "request", Thread::Main, [target, fileName]() { *target = TextureStreamer::Get().Request(fileName); return Result::Done; } },
+		{ "stream",  Thread::Main, [target]() {
+			if (!(*target)->IsDone())
+				return Result::Retry;
+			return (*target)->IsReady() ? Result::Done : Result::Failed;
+		} },
+	};
+	return Enqueue(std::filesystem::path(fileName).filename().wstring(), FileSize(fileName), std::move(stages), dependencies);
+}
+
+/**
+	@brief	BGMȂǂ̓ǂݍ
+	@note	DirectShow̃OtD3D9̃foCXƓCXbhō
+*/
+AssetLoader::Id AssetLoader::LoadAudio(DX9::MEDIARENDERER& media, const std::wstring& fileName, const std::vector<Id>& dependencies)
+{
+	auto* target = &media;
+	std::vector<Stage> stages = {
+		{ "open", Thread::Main, [target, fileName]() {
+			*target = DX9::MediaRenderer::CreateFromFile(DXTK->Device9, fileName.c_str());
+			return Result::Done;
+		} },
+	};
+	return Enqueue(std::filesystem::path(fileName).filename().wstring(), FileSize(fileName), std::move(stages), dependencies);
+}
+
+/**
+	@brief	Ԃ̗AZbgi߂
+	@note	[J[̒iK̓WuɂACXbh̒iK͂1AZbgɂ1iKs
+*/
+void AssetLoader::Update()
+{
+	std::vector<Asset*> mainStages;
+	std::vector<Asset*> workerStages;
+	{
+		std::lock_guard<std::mutex> lock(m_mutex);
+		if (m_cancelled)
+			return;
+
+		for (auto& asset : m_assets) {
+			if (asset->state != State::Waiting)
+				continue;
+
+			bool ready = true;
+			for (const Id dependency : asset->dependencies) {
+				const State state = m_assets[dependency]->state;
+				if (state == State::Failed || state == State::Cancelled) {
+					OutputDebugStringW((L"AssetLoader: " + asset->name + L" skipped (dependency " + m_assets[dependency]->name + L" failed)\n").c_str());
+					asset->state = State::Failed;
+					break;
+				}
+				if (state != State::Done)
+					ready = false;
+			}
+			if (!ready || asset->state != State::Waiting)
+				continue;
+
+			if (asset->stages[asset->next].thread == Thread::Worker) {
+				asset->state = State::Running;
+				workerStages.push_back(asset.get());
+			}
+			else {
+				mainStages.push_back(asset.get());
+			}
+		}
+	}
+
+	for (auto asset : workerStages)
+		JobSystem::Get().Run([this, asset]() { RunWorkerStages(*asset); }, &m_running, JobSystem::Priority::Background);
+
+	for (auto asset : mainStages) {
+		const Result result = RunStage(*asset);
+		std::lock_guard<std::mutex> lock(m_mutex);
+		FinishStage(*asset, result);
+	}
+}
+
+/**
+	@brief	ǂݍ݂̒~
+	@note	s̒iK͓rŎ~߂Ȃ̂ŁAI܂ő҂Ă߂(n܂ĂȂWu͉ɏI)
+*/
+void AssetLoader::Cancel()
+{
+	{
+		std::lock_guard<std::mutex> lock(m_mutex);
+		m_cancelled = true;
+	}
+	JobSystem::Get().Wait(m_running);
+
+	std::lock_guard<std::mutex> lock(m_mutex);
+	//n܂Ȃ́Eԑ҂̂
+	for (auto& asset : m_assets) {
+		if (asset->state == State::Waiting || asset->state == State::Running)
+			asset->state = State::Cancelled;
+	}
+}
+
+bool AssetLoader::IsDone() const
+{
+	std::lock_guard<std::mutex> lock(m_mutex);
+	for (const auto& asset : m_assets) {
+		if (asset->state == State::Waiting || asset->state == State::Running)
+			return false;
+	}
+	return true;
+}
+
+bool AssetLoader::IsCancelled() const
+{
+	std::lock_guard<std::mutex> lock(m_mutex);
+	return m_cancelled;
+}
+
+AssetLoader::State AssetLoader::GetState(Id id) const
+{
+	std::lock_guard<std::mutex> lock(m_mutex);
+	return m_assets[id]->state;
+}
+
+/**
+	@brief	i
+	@note	sELZAZbg͎c̒iKÎƂĐ(o[~܂Ȃ悤)
+*/
+AssetLoader::Progress AssetLoader::GetProgress() const
+{
+	std::lock_guard<std::mutex> lock(m_mutex);
+
+	Progress progress{};
+	for (const auto& asset : m_assets) {
+		++progress.assets;
+		progress.stages += asset->stages.size();
+		progress.bytes  += asset->bytes;
+
+		switch (asset->state) {
+		case State::Done:
+			++progress.assetsDone;
+			progress.stagesDone += asset->stages.size();
+			progress.bytesDone  += asset->bytes;
+			break;
+		case State::Failed:
+		case State::Cancelled:
+			++progress.assetsFailed;
+			progress.stagesDone += asset->stages.size();
+			break;
+		default:
+			progress.stagesDone += asset->next;
+			break;
+		}
+	}
+	progress.fraction = progress.stages == 0 ? 1.0f : static_cast<float>(progress.stagesDone) / progress.stages;
+	return progress;
+}
+
+std::vector<AssetLoader::Timing> AssetLoader::GetTimings() const
+{
+	std::lock_guard<std::mutex> lock(m_mutex);
+	return m_timings;
+}
+
+void AssetLoader::ReportTimings() const
+{
+	const auto timings = GetTimings();
+	const auto progress = GetProgress();
+
+	for (const auto& timing : timings) {
+		wchar_t message[256];
+		swprintf_s(message, L"AssetLoader: %-24s %-8S start %8.1fms  %8.1fms\n",
+			timing.asset.c_str(), timing.stage, timing.startMs, timing.ms);
+		OutputDebugStringW(message);
+	}
+
+	double totalMs = 0.0;
+	for (const auto& timing : timings)
+		totalMs = std::max(totalMs, timing.startMs + timing.ms);
+
+	wchar_t message[256];
+	swprintf_s(message, L"AssetLoader: %zu/%zu assets (%zu failed), %llu bytes, %.1fms\n",
+		progress.assetsDone, progress.assets, progress.assetsFailed, progress.bytesDone, totalMs);
+	OutputDebugStringW(message);
+}
+
+/**
+	@brief	[J[̒iKԂ͂̃WuŐi߂
+*/
+void AssetLoader::RunWorkerStages(Asset& asset)
+{
+	for (;;) {
+		{
+			std::lock_guard<std::mutex> lock(m_mutex);
+			if (m_cancelled)
+				return;
+		}
+
+		const Result result = RunStage(asset);
+
+		std::lock_guard<std::mutex> lock(m_mutex);
+		FinishStage(asset, result);
+		if (result == Result::Retry)
+			asset.state = State::Waiting;
+
+		if (asset.state != State::Waiting || result == Result::Retry ||
+			asset.stages[asset.next].thread != Thread::Worker)
+			return;
+		asset.state = State::Running;
+	}
+}
+
+/**
+	@brief	̒iK̎s(bN̊OŌĂ)
+*/
+AssetLoader::Result AssetLoader::RunStage(Asset& asset)
+{
+	if (!asset.stageStarted) {
+		asset.stageStarted = true;
+		asset.stageStart   = std::chrono::steady_clock::now();
+	}
+
+	const auto& stage = asset.stages[asset.next];
+	try {
+		return stage.run();
+	}
+	catch (const std::exception&) {
+		OutputDebugStringW((L"AssetLoader: " + asset.name + L" failed\n").c_str());
+		return Result::Failed;
+	}
+}
+
+/**
+	@brief	iǨʂ̔f(bN̒ŌĂ)
+*/
+void AssetLoader::FinishStage(Asset& asset, Result result)
+{
+	if (result == Result::Retry)
+		return;
+
+	const auto& stage = asset.stages[asset.next];
+	const double ms = std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - asset.stageStart).count();
+	m_timings.push_back({ asset.name, stage.name, Milliseconds(asset.stageStart), ms });
+	asset.stageStarted = false;
+
+	if (result == Result::Failed) {
+		asset.state = State::Failed;
+		return;
+	}
+
+	if (++asset.next == asset.stages.size())
+		asset.state = State::Done;
+	else if (m_cancelled)
+		asset.state = State::Cancelled;
+	else
+		asset.state = State::Waiting;
+}
+
+double AssetLoader::Milliseconds(std::chrono::steady_clock::time_point time) const
+{
+	return std::chrono::duration<double, std::milli>(time - m_start).count();
+}
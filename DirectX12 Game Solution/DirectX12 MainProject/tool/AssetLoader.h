@@ -0,0 +1,148 @@
+/**
+ * @file AssetLoader.h
+ * @brief V[̃AZbg̔񓯊ǂݍ(iKƂɃ[J[XbhƃCXbhŐi߂)
+ * @author hoshi hirofumi
+ * @date 2026/10/19
+ */
+
+#pragma once
+
+/*
+-------------------------------------------------------------------------------------
+	CN[h
+-------------------------------------------------------------------------------------
+*/
+#include "Base/pch.h"
+#include "Base/dxtk.h"
+#include "PmxLoader.h"
+#include "TextureStreamer.h"
+#include "JobSystem.h"
+
+#include <chrono>
+#include <functional>
+#include <mutex>
+
+/*
+-------------------------------------------------------------------------------------
+	using
+-------------------------------------------------------------------------------------
+*/
+using Microsoft::WRL::ComPtr;
+using std::unique_ptr;
+using std::make_unique;
+using namespace DirectX;
+
+/*
+-------------------------------------------------------------------------------------
+	AssetLoaderNX@錾
+-------------------------------------------------------------------------------------
+*/
+class AssetLoader {
+public:
+	typedef size_t Id;
+	static constexpr Id INVALID_ID = static_cast<Id>(-1);
+
+	//! iKsXbh
+	enum class Thread {
+		Worker,		//t@C̓ǂݍ݁ÉEVF[_[̃RpC(JobSystemBackground)
+		Main		//GPŨ\[X쐬E҂
+	};
+
+	//! iǨ(Retry͎UpdatełxĂԁAGPŮ҂Ȃ)
+	enum class Result { Done, Retry, Failed };
+
+	struct Stage {
+		const char*             name;
+		Thread                  thread;
+		std::function<Result()> run;
+	};
+
+	enum class State {
+		Waiting,	//ˑAZbgE̒iK̏ԑ҂
+		Running,	//[J[XbhŎs
+		Done,
+		Failed,
+		Cancelled
+	};
+
+	struct Progress {
+		size_t   assets;
+		size_t   assetsDone;
+		size_t   assetsFailed;	//sELZ(ˑ̎s܂)
+		size_t   stages;
+		size_t   stagesDone;
+		uint64_t bytes;			//t@CTCY̍v
+		uint64_t bytesDone;		//ǂݍ݂IAZbg̕
+		float    fraction;		//stagesDone / stages
+	};
+
+	//! iKƂ̎(~bAstartMs͍ŏEnqueue)
+	struct Timing {
+		std::wstring asset;
+		const char*  stage;
+		double       startMs;
+		double       ms;		//Retryő҂܂
+	};
+
+	AssetLoader();
+	virtual ~AssetLoader();
+
+	AssetLoader(AssetLoader&&) = delete;
+	AssetLoader& operator= (AssetLoader&&) = delete;
+
+	AssetLoader(AssetLoader const&) = delete;
+	AssetLoader& operator= (AssetLoader const&) = delete;
+
+	//dependenciesSDoneɂȂĂŏ̒iKn߂
+	Id Enqueue(const std::wstring& name, uint64_t bytes, std::vector<Stage> stages, const std::vector<Id>& dependencies = {});
+
+	//f(ǂݍ  VF[_[  GPU\[X  eNX`  pCvC)
+	Id LoadModel(PmxLoader& model, const std::string& fileName, const DX12::CAMERA& camera, const std::vector<Id>& dependencies = {});
+	//[V(f̓ǂݍ݂̌)
+	Id LoadMotion(PmxLoader& model, const std::string& fileName, Id modelId);
+	//eNX`P(TextureStreamerœǂ݁A͂܂ő҂)
+	Id LoadTexture(const std::wstring& fileName, std::shared_ptr<StreamedTexture>& texture, const std::vector<Id>& dependencies = {});
+	//BGMȂ
+	Id LoadAudio(DX9::MEDIARENDERER& media, const std::wstring& fileName, const std::vector<Id>& dependencies = {});
+
+	//t[CXbhĂ(CXbh̒iK͂Ŏs)
+	void Update();
+
+	//s̒iK̂āAs̒iKI܂ő҂(V[̐؂ւ)
+	void Cancel();
+
+	bool IsDone() const;
+	bool IsCancelled() const;
+	State GetState(Id id) const;
+	Progress GetProgress() const;
+	std::vector<Timing> GetTimings() const;
+
+	//iKƂ̎Ԃo̓EBhEɏo
+	void ReportTimings() const;
+
+private:
+	struct Asset {
+		std::wstring          name;
+		uint64_t              bytes;
+		std::vector<Stage>    stages;
+		std::vector<Id>       dependencies;
+		size_t                next;			//ɎsiK
+		State                 state;
+		bool                  stageStarted;	//Retry(JnL^ς)
+		std::chrono::steady_clock::time_point stageStart;
+	};
+
+	void RunWorkerStages(Asset& asset);
+	Result RunStage(Asset& asset);
+	void FinishStage(Asset& asset, Result result);
+	double Milliseconds(std::chrono::steady_clock::time_point time) const;
+
+	std::vector<unique_ptr<Asset>> m_assets;
+	JobCounter                     m_running;		//[J[Ŏs̃Wu
+	bool                           m_cancelled;
+
+	std::vector<Timing>                   m_timings;
+	std::chrono::steady_clock::time_point m_start;
+
+	mutable std::mutex m_mutex;
+};
@@ -0,0 +1,466 @@
+/**
+ * @file BlockCompressor.cpp
+ * @brief BC1/BC3CPUGR[_[DDS̏o
+ * @author hoshi hirofumi
+ * @date 2026/10/19
+ */
+
+#include "BlockCompressor.h"
+
+#include <algorithm>
+#include <cmath>
+#include <cstring>
+#include <fstream>
+#include <limits>
+
+namespace {
+	uint16_t Pack565(const float color[3])
+	{
+		const auto quantize = [](float value, int max) {
+			const float clamped = std::min(255.0f, std::max(0.0f, value));
+			return static_cast<int>(clamped * max / 255.0f + 0.5f);
+		};
+		return static_cast<uint16_t>((quantize(color[0], 31) << 11) | (quantize(color[1], 63) << 5) | quantize(color[2], 31));
+	}
+
+	void Unpack565(uint16_t packed, int color[3])
+	{
+		const int r = (packed >> 11) & 31;
+		const int g = (packed >> 5) & 63;
+		const int b = packed & 31;
+		color[0] = (r << 3) | (r >> 2);
+		color[1] = (g << 2) | (g >> 4);
+		color[2] = (b << 3) | (b >> 2);
+	}
+
+	//! 4Fpbg(c0 > c1̂ƂABC3͏ɂ)
+	void ColorPalette(uint16_t c0, uint16_t c1, bool fourColor, int palette[4][4])
+	{
+		Unpack565(c0, palette[0]);
+		Unpack565(c1, palette[1]);
+		palette[0][3] = palette[1][3] = 255;
+		for (int c = 0; c < 3; ++c) {
+			if (fourColor) {
+				palette[2][c] = (2 * palette[0][c] + palette[1][c]) / 3;
+				palette[3][c] = (palette[0][c] + 2 * palette[1][c]) / 3;
+			}
+			else {
+				palette[2][c] = (palette[0][c] + palette[1][c]) / 2;
+				palette[3][c] = 0;
+			}
+		}
+		palette[2][3] = 255;
+		palette[3][3] = fourColor ? 255 : 0;
+	}
+
+	int ColorDistance(const uint8_t* a, const int* b)
+	{
+		const int dr = a[0] - b[0], dg = a[1] - b[1], db = a[2] - b[2];
+		return dr * dr + dg * dg + db * db;
+	}
+
+	//! pbgɓĂ͂߂Ƃ̌덷Ɣԍ
+	int FitIndices(const uint8_t block[16][4], const int palette[4][4], uint32_t& indices)
+	{
+		int error = 0;
+		indices = 0;
+		for (int i = 0; i < 16; ++i) {
+			int best = 0, bestDistance = ColorDistance(block[i], palette[0]);
+			for (int p = 1; p < 4; ++p) {
+				const int distance = ColorDistance(block[i], palette[p]);
+				if (distance < bestDistance) {
+					best = p;
+					bestDistance = distance;
+				}
+			}
+			indices |= static_cast<uint32_t>(best) << (i * 2);
+			error += bestDistance;
+		}
+		return error;
+	}
+
+	//! [_565Ɋۂ߂ăubN(덷Ԃ)
+	int EncodeEndpoints(const uint8_t block[16][4], const float e0[3], const float e1[3], uint8_t* out)
+	{
+		uint16_t c0 = Pack565(e0);
+		uint16_t c1 = Pack565(e1);
+		if (c0 < c1)
+			std::swap(c0, c1);
+
+		uint32_t indices = 0;
+		int error;
+		if (c0 == c1) {
+			//PFubN(ԍ͑S0)
+			int palette[4][4];
+			ColorPalette(c0, c1, true, palette);
+			error = 0;
+			for (int i = 0; i < 16; ++i)
+				error += ColorDistance(block[i], palette[0]);
+		}
+		else {
+			int palette[4][4];
+			ColorPalette(c0, c1, true, palette);
+			error = FitIndices(block, palette, indices);
+		}
+
+		out[0] = static_cast<uint8_t>(c0);
+		out[1] = static_cast<uint8_t>(c0 >> 8);
+		out[2] = static_cast<uint8_t>(c1);
+		out[3] = static_cast<uint8_t>(c1 >> 8);
+		memcpy(out + 4, &indices, 4);
+		return error;
+	}
+
+	//! 摜4x4ubNo([͂͂ݏoJԂ)
+	void ExtractBlock(const ImageLevel& level, uint32_t bx, uint32_t by, uint8_t block[16][4])
+	{
+		for (uint32_t y = 0; y < 4; ++y) {
+			const uint32_t sy = std::min(by * 4 + y, level.height - 1);
+			for (uint32_t x = 0; x < 4; ++x) {
+				const uint32_t sx = std::min(bx * 4 + x, level.width - 1);
+				memcpy(block[y * 4 + x], &level.pixels[(static_cast<size_t>(sy) * level.width + sx) * 4], 4);
+			}
+		}
+	}
+
+	size_t BlockSize(CompressedImage::Format format)
+	{
+		return format == CompressedImage::Format::BC1 ? 8 : 16;
+	}
+
+	uint32_t MakeFourCC(char a, char b, char c, char d)
+	{
+		return static_cast<uint32_t>(a) | (static_cast<uint32_t>(b) << 8) | (static_cast<uint32_t>(c) << 16) | (static_cast<uint32_t>(d) << 24);
+	}
+}
+
+size_t CompressedImage::SizeInBytes() const
+{
+	size_t size = 0;
+	for (const auto& level : levels)
+		size += level.size();
+	return size;
+}
+
+/**
+	@brief	`̑I
+*/
+CompressedImage::Format BlockCompressor::ChooseFormat(const ImageLevel& level)
+{
+	for (size_t i = 3; i < level.pixels.size(); i += 4) {
+		if (level.pixels[i] != 255)
+			return CompressedImage::Format::BC3;
+	}
+	return CompressedImage::Format::BC1;
+}
+
+/**
+	@brief	S~bvk
+	@param	image      fR[hς݂̉摜(~bv)
+	@param	format     k`
+	@param	compressed k
+*/
+void BlockCompressor::Compress(const DecodedImage& image, CompressedImage::Format format, CompressedImage& compressed)
+{
+	compressed.format = format;
+	compressed.width  = image.Width();
+	compressed.height = image.Height();
+	compressed.levels.clear();
+
+	const size_t blockSize = BlockSize(format);
+	for (const auto& level : image.levels) {
+		const uint32_t blocksX = (level.width + 3) / 4;
+		const uint32_t blocksY = (level.height + 3) / 4;
+
+		std::vector<uint8_t> data(static_cast<size_t>(blocksX) * blocksY * blockSize);
+		uint8_t* out = data.data();
+		for (uint32_t by = 0; by < blocksY; ++by) {
+			for (uint32_t bx = 0; bx < blocksX; ++bx, out += blockSize) {
+				uint8_t block[16][4];
+				ExtractBlock(level, bx, by, block);
+				if (format == CompressedImage::Format::BC3) {
+					CompressAlphaBlock(block, out);
+					CompressColorBlock(block, out + 8);
+				}
+				else {
+					CompressColorBlock(block, out);
+				}
+			}
+		}
+		compressed.levels.push_back(std::move(data));
+	}
+}
+
+/**
+	@brief	1xWJ(PSNR̊mFp)
+*/
+void BlockCompressor::Decompress(const CompressedImage& compressed, size_t levelIndex, ImageLevel& level)
+{
+	level.width  = std::max(1u, compressed.width >> levelIndex);
+	level.height = std::max(1u, compressed.height >> levelIndex);
+	level.pixels.assign(static_cast<size_t>(level.width) * level.height * 4, 0);
+
+	const size_t blockSize = BlockSize(compressed.format);
+	const uint32_t blocksX = (level.width + 3) / 4;
+	const uint32_t blocksY = (level.height + 3) / 4;
+	const uint8_t* in = compressed.levels[levelIndex].data();
+
+	for (uint32_t by = 0; by < blocksY; ++by) {
+		for (uint32_t bx = 0; bx < blocksX; ++bx, in += blockSize) {
+			uint8_t block[16][4];
+			if (compressed.format == CompressedImage::Format::BC3) {
+				DecompressColorBlock(in + 8, block);
+				DecompressAlphaBlock(in, block);
+			}
+			else {
+				DecompressColorBlock(in, block);
+			}
+
+			for (uint32_t y = 0; y < 4 && by * 4 + y < level.height; ++y) {
+				for (uint32_t x = 0; x < 4 && bx * 4 + x < level.width; ++x) {
+					const size_t offset = (static_cast<size_t>(by * 4 + y) * level.width + bx * 4 + x) * 4;
+					memcpy(&level.pixels[offset], block[y * 4 + x], 4);
+				}
+			}
+		}
+	}
+}
+
+/**
+	@brief	PSNR(Ȃ疳)
+*/
+double BlockCompressor::Psnr(const ImageLevel& original, const ImageLevel& decoded)
+{
+	if (original.pixels.size() != decoded.pixels.size() || original.pixels.empty())
+		return 0.0;
+
+	double sum = 0.0;
+	for (size_t i = 0; i < original.pixels.size(); ++i) {
+		const double diff = static_cast<double>(original.pixels[i]) - decoded.pixels[i];
+		sum += diff * diff;
+	}
+	if (sum == 0.0)
+		return std::numeric_limits<double>::infinity();
+
+	const double mse = sum / static_cast<double>(original.pixels.size());
+	return 10.0 * std::log10(255.0 * 255.0 / mse);
+}
+
+/**
+	@brief	DDS(DX9`̃wb_[ADXT1/DXT5)ŏo
+	@note	DDSTextureLoader̂܂ܓǂ߂
+*/
+bool BlockCompressor::WriteDds(const std::filesystem::path& path, const CompressedImage& compressed)
+{
+	enum : uint32_t {
+		DDSD_CAPS        = 0x1,
+		DDSD_HEIGHT      = 0x2,
+		DDSD_WIDTH       = 0x4,
+		DDSD_PIXELFORMAT = 0x1000,
+		DDSD_MIPMAPCOUNT = 0x20000,
+		DDSD_LINEARSIZE  = 0x80000,
+		DDPF_FOURCC      = 0x4,
+		DDSCAPS_COMPLEX  = 0x8,
+		DDSCAPS_TEXTURE  = 0x1000,
+		DDSCAPS_MIPMAP   = 0x400000,
+	};
+
+	uint32_t header[32] = {};
+	header[0]  = MakeFourCC('D', 'D', 'S', ' ');
+	header[1]  = 124;
+	header[2]  = DDSD_CAPS | DDSD_HEIGHT | DDSD_WIDTH | DDSD_PIXELFORMAT | DDSD_MIPMAPCOUNT | DDSD_LINEARSIZE;
+	header[3]  = compressed.height;
+	header[4]  = compressed.width;
+	header[5]  = static_cast<uint32_t>(compressed.levels.empty() ? 0 : compressed.levels[0].size());
+	header[7]  = static_cast<uint32_t>(compressed.levels.size());
+	//sNZtH[}bg(header[19]32oCg)
+	header[19] = 32;
+	header[20] = DDPF_FOURCC;
+	header[21] = compressed.format == CompressedImage::Format::BC1 ? MakeFourCC('D', 'X', 'T', '1') : MakeFourCC('D', 'X', 'T', '5');
+	header[27] = DDSCAPS_TEXTURE | (compressed.levels.size() > 1 ? DDSCAPS_COMPLEX | DDSCAPS_MIPMAP : 0);
+
+	std::error_code error;
+	std::filesystem::create_directories(path.parent_path(), error);
+
+	std::ofstream file(path, std::ios::binary | std::ios::trunc);
+	if (!file)
+		return false;
+
+	//wb_[̓gGfBAŏ
+	for (auto value : header) {
+		const uint8_t bytes[4] = {
+			static_cast<uint8_t>(value), static_cast<uint8_t>(value >> 8),
+			static_cast<uint8_t>(value >> 16), static_cast<uint8_t>(value >> 24)
+		};
+		file.write(reinterpret_cast<const char*>(bytes), 4);
+	}
+	for (const auto& level : compressed.levels)
+		file.write(reinterpret_cast<const char*>(level.data()), static_cast<std::streamsize>(level.size()));
+
+	return file.good();
+}
+
+/**
+	@brief	FubN(听̕ɒ[_Aŏ1l߂)
+*/
+void BlockCompressor::CompressColorBlock(const uint8_t block[16][4], uint8_t* out)
+{
+	float mean[3] = {};
+	for (int i = 0; i < 16; ++i)
+		for (int c = 0; c < 3; ++c)
+			mean[c] += block[i][c] / 16.0f;
+
+	//Us
+	float cov[6] = {};
+	for (int i = 0; i < 16; ++i) {
+		const float r = block[i][0] - mean[0], g = block[i][1] - mean[1], b = block[i][2] - mean[2];
+		cov[0] += r * r; cov[1] += r * g; cov[2] += r * b;
+		cov[3] += g * g; cov[4] += g * b; cov[5] += b * b;
+	}
+
+	//ׂ@Ŏ听̕
+	float axis[3] = { 1.0f, 1.0f, 1.0f };
+	for (int iteration = 0; iteration < 8; ++iteration) {
+		const float x = cov[0] * axis[0] + cov[1] * axis[1] + cov[2] * axis[2];
+		const float y = cov[1] * axis[0] + cov[3] * axis[1] + cov[4] * axis[2];
+		const float z = cov[2] * axis[0] + cov[4] * axis[1] + cov[5] * axis[2];
+		const float length = std::max(std::max(std::fabs(x), std::fabs(y)), std::fabs(z));
+		if (length < 1e-6f)
+			break;
+		axis[0] = x / length;
+		axis[1] = y / length;
+		axis[2] = z / length;
+	}
+	const float axisLength = axis[0] * axis[0] + axis[1] * axis[1] + axis[2] * axis[2];
+
+	float minT = 0.0f, maxT = 0.0f;
+	for (int i = 0; i < 16; ++i) {
+		const float t = ((block[i][0] - mean[0]) * axis[0] + (block[i][1] - mean[1]) * axis[1] + (block[i][2] - mean[2]) * axis[2]) / axisLength;
+		minT = std::min(minT, t);
+		maxT = std::max(maxT, t);
+	}
+
+	float e0[3], e1[3];
+	for (int c = 0; c < 3; ++c) {
+		e0[c] = mean[c] + axis[c] * maxT;
+		e1[c] = mean[c] + axis[c] * minT;
+	}
+
+	uint8_t best[8];
+	int bestError = EncodeEndpoints(block, e0, e1, best);
+
+	//̔ԍɑ΂ŏ̒[_
+	if (bestError > 0) {
+		const uint16_t c0 = static_cast<uint16_t>(best[0] | (best[1] << 8));
+		const uint16_t c1 = static_cast<uint16_t>(best[2] | (best[3] << 8));
+		uint32_t indices;
+		memcpy(&indices, best + 4, 4);
+
+		//ԍ0,1,2,3  e0ɑ΂d 1, 0, 2/3, 1/3
+		static const float WEIGHT[4] = { 1.0f, 0.0f, 2.0f / 3.0f, 1.0f / 3.0f };
+		float aa = 0.0f, ab = 0.0f, bb = 0.0f;
+		float ax[3] = {}, bx[3] = {};
+		for (int i = 0; i < 16; ++i) {
+			const float a = WEIGHT[(indices >> (i * 2)) & 3];
+			const float b = 1.0f - a;
+			aa += a * a; ab += a * b; bb += b * b;
+			for (int c = 0; c < 3; ++c) {
+				ax[c] += a * block[i][c];
+				bx[c] += b * block[i][c];
+			}
+		}
+
+		const float det = aa * bb - ab * ab;
+		if (c0 != c1 && std::fabs(det) > 1e-6f) {
+			float r0[3], r1[3];
+			for (int c = 0; c < 3; ++c) {
+				r0[c] = (ax[c] * bb - bx[c] * ab) / det;
+				r1[c] = (bx[c] * aa - ax[c] * ab) / det;
+			}
+
+			uint8_t refined[8];
+			const int error = EncodeEndpoints(block, r0, r1, refined);
+			if (error < bestError) {
+				bestError = error;
+				memcpy(best, refined, 8);
+			}
+		}
+	}
+
+	memcpy(out, best, 8);
+}
+
+/**
+	@brief	At@ubN(őEŏ[_ɂ8iK)
+*/
+void BlockCompressor::CompressAlphaBlock(const uint8_t block[16][4], uint8_t* out)
+{
+	int a0 = 0, a1 = 255;
+	for (int i = 0; i < 16; ++i) {
+		a0 = std::max(a0, static_cast<int>(block[i][3]));
+		a1 = std::min(a1, static_cast<int>(block[i][3]));
+	}
+
+	out[0] = static_cast<uint8_t>(a0);
+	out[1] = static_cast<uint8_t>(a1);
+
+	uint64_t indices = 0;
+	if (a0 != a1) {
+		int palette[8] = { a0, a1 };
+		for (int i = 1; i < 7; ++i)
+			palette[i + 1] = ((7 - i) * a0 + i * a1) / 7;
+
+		for (int i = 0; i < 16; ++i) {
+			int best = 0, bestDistance = 256;
+			for (int p = 0; p < 8; ++p) {
+				const int distance = std::abs(block[i][3] - palette[p]);
+				if (distance < bestDistance) {
+					best = p;
+					bestDistance = distance;
+				}
+			}
+			indices |= static_cast<uint64_t>(best) << (i * 3);
+		}
+	}
+
+	for (int i = 0; i < 6; ++i)
+		out[2 + i] = static_cast<uint8_t>(indices >> (i * 8));
+}
+
+void BlockCompressor::DecompressColorBlock(const uint8_t* in, uint8_t block[16][4])
+{
+	const uint16_t c0 = static_cast<uint16_t>(in[0] | (in[1] << 8));
+	const uint16_t c1 = static_cast<uint16_t>(in[2] | (in[3] << 8));
+	uint32_t indices;
+	memcpy(&indices, in + 4, 4);
+
+	int palette[4][4];
+	ColorPalette(c0, c1, c0 > c1, palette);
+	for (int i = 0; i < 16; ++i) {
+		const int* color = palette[(indices >> (i * 2)) & 3];
+		for (int c = 0; c < 4; ++c)
+			block[i][c] = static_cast<uint8_t>(color[c]);
+	}
+}
+
+void BlockCompressor::DecompressAlphaBlock(const uint8_t* in, uint8_t block[16][4])
+{
+	const int a0 = in[0], a1 = in[1];
+	int palette[8] = { a0, a1 };
+	if (a0 > a1) {
+		for (int i = 1; i < 7; ++i)
+			palette[i + 1] = ((7 - i) * a0 + i * a1) / 7;
+	}
+	else {
+		for (int i = 1; i < 5; ++i)
+			palette[i + 1] = ((5 - i) * a0 + i * a1) / 5;
+		palette[6] = 0;
+		palette[7] = 255;
+	}
+
+	uint64_t indices = 0;
+	for (int i = 0; i < 6; ++i)
+		indices |= static_cast<uint64_t>(in[2 + i]) << (i * 8);
+	for (int i = 0; i < 16; ++i)
+		block[i][3] = static_cast<uint8_t>(palette[(indices >> (i * 3)) & 7]);
+}
@@ -0,0 +1,61 @@
+/**
+ * @file BlockCompressor.h
+ * @brief BC1/BC3CPUGR[_[DDS̏o
+ * @author hoshi hirofumi
+ * @date 2026/10/19
+ * @note ImageDecoderƓWindows̃wb_[ɈˑȂ
+ */
+
+#pragma once
+
+/*
+-------------------------------------------------------------------------------------
+	CN[h
+-------------------------------------------------------------------------------------
+*/
+#include "ImageDecoder.h"
+
+/*
+-------------------------------------------------------------------------------------
+	\
+-------------------------------------------------------------------------------------
+*/
+// kς݂̃~bv`F[
+struct CompressedImage {
+	enum class Format {
+		BC1,	//RGB(At@) 8oCg/ubN
+		BC3		//RGBA 16oCg/ubN
+	};
+
+	Format                            format;
+	uint32_t                          width;
+	uint32_t                          height;
+	std::vector<std::vector<uint8_t>> levels;
+
+	size_t SizeInBytes() const;
+};
+
+/*
+-------------------------------------------------------------------------------------
+	BlockCompressorNX@錾
+-------------------------------------------------------------------------------------
+*/
+class BlockCompressor {
+public:
+	//At@S255ȂBC1AȊOBC3
+	static CompressedImage::Format ChooseFormat(const ImageLevel& level);
+
+	static void Compress(const DecodedImage& image, CompressedImage::Format format, CompressedImage& compressed);
+	static void Decompress(const CompressedImage& compressed, size_t levelIndex, ImageLevel& level);
+
+	//摜ƈk̉摜PSNR(dBARGBȂS`l)
+	static double Psnr(const ImageLevel& original, const ImageLevel& decoded);
+
+	static bool WriteDds(const std::filesystem::path& path, const CompressedImage& compressed);
+
+private:
+	static void CompressColorBlock(const uint8_t block[16][4], uint8_t* out);
+	static void CompressAlphaBlock(const uint8_t block[16][4], uint8_t* out);
+	static void DecompressColorBlock(const uint8_t* in, uint8_t block[16][4]);
+	static void DecompressAlphaBlock(const uint8_t* in, uint8_t block[16][4]);
+};
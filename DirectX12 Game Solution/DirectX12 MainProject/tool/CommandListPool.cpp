@@ -0,0 +1,130 @@
+/**
+ * @file CommandListPool.cpp
+ * @brief t[̃R}hXg̎g񂵂ƁA`̕L^
+ * @author hoshi hirofumi
+ * @date 2026/10/19
+ */
+
+#include "CommandListPool.h"
+#include "JobSystem.h"
+
+#include <algorithm>
+#include <exception>
+
+CommandListPool::CommandListPool(unsigned int frameCount, Factory factory)
+	: m_factory(std::move(factory)), m_frames(std::max(frameCount, 1u)), m_current(0), m_statistics{}
+{
+	//WuVXẽ[J[ƁA҂ĂԂɎ`Ăяo
+	m_workers = std::min<size_t>(JobSystem::Get().GetWorkerCount() + 1, MAX_WORKERS);
+}
+
+/**
+	@brief	t[̐؂ւ
+	@note	Oɂ̑ggt[̃Xg͑SMς݂ŁAGPUǂݏIĂ
+*/
+void CommandListPool::BeginFrame(unsigned int frame)
+{
+	std::lock_guard<std::mutex> lock(m_mutex);
+	m_current = frame % m_frames.size();
+	m_frames[m_current].used = 0;
+}
+
+/**
+	@note	Xg̍쐬EZbg̓bN̊O(D3D12̃Xg̍쐬EXgƂ̃Zbg͕ʃXbh瓯ɌĂׂ)
+			ȂƂ̓bN̒ŘgmۂAXgォ
+*/
+RecordingList& CommandListPool::Acquire()
+{
+	RecordingList* list  = nullptr;
+	unsigned int   owner = 0;
+	size_t         index = 0;
+	{
+		std::lock_guard<std::mutex> lock(m_mutex);
+		auto& frame = m_frames[m_current];
+		if (frame.used < frame.lists.size())
+			list = frame.lists[frame.used].get();
+		else
+			frame.lists.emplace_back();
+
+		owner = m_current;
+		index = frame.used++;
+		++m_statistics.acquired;
+		m_statistics.peak = std::max(m_statistics.peak, frame.used);
+	}
+
+	if (list == nullptr) {
+		//Xg͕ԂŕԂĂ
+		auto created = m_factory();
+		list = created.get();
+
+		std::lock_guard<std::mutex> lock(m_mutex);
+		m_frames[owner].lists[index] = std::move(created);
+		++m_statistics.created;
+	}
+	list->Reset();
+	return *list;
+}
+
+/**
+	@brief	L^
+	@note	ŏ̃`N͌ĂяoXbhŋL^Ac҂Ԃ`@ǂꂩO𓊂S҂Ă瓊
+*/
+std::vector<RecordingList*> CommandListPool::Record(size_t count, size_t minPerChunk, const RecordFunction& record)
+{
+	const auto chunks = Split(count, m_workers, minPerChunk);
+
+	std::vector<RecordingList*> lists(chunks.size());
+	for (auto& list : lists)
+		list = &Acquire();
+
+	std::vector<std::exception_ptr> errors(chunks.size());
+	const auto recordChunk = [&](size_t i) {
+		try {
+			record(*lists[i], chunks[i].begin, chunks[i].end);
+		}
+		catch (...) {
+			errors[i] = std::current_exception();
+		}
+	};
+
+	auto& jobSystem = JobSystem::Get();
+	JobCounter counter;
+	for (size_t i = 1; i < chunks.size(); ++i)
+		jobSystem.Run([&recordChunk, i]() { recordChunk(i); }, &counter);
+	if (!chunks.empty())
+		recordChunk(0);
+	jobSystem.Wait(counter);
+
+	for (const auto& error : errors) {
+		if (error)
+			std::rethrow_exception(error);
+	}
+
+	return lists;
+}
+
+std::vector<CommandListPool::Chunk> CommandListPool::Split(size_t count, size_t maxChunks, size_t minPerChunk)
+{
+	std::vector<Chunk> chunks;
+	if (count == 0)
+		return chunks;
+
+	minPerChunk = std::max<size_t>(minPerChunk, 1);
+	const size_t chunkCount = std::max<size_t>(std::min(maxChunks, count / minPerChunk), 1);
+	const size_t base       = count / chunkCount;
+	const size_t extra      = count % chunkCount;
+
+	size_t begin = 0;
+	for (size_t i = 0; i < chunkCount; ++i) {
+		const size_t size = base + (i < extra ? 1 : 0);
+		chunks.push_back({ begin, begin + size });
+		begin += size;
+	}
+	return chunks;
+}
+
+CommandListPool::Statistics CommandListPool::GetStatistics() const
+{
+	std::lock_guard<std::mutex> lock(m_mutex);
+	return m_statistics;
+}
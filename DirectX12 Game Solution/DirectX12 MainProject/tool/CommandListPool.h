@@ -0,0 +1,99 @@
+/**
+ * @file CommandListPool.h
+ * @brief t[̃R}hXg̎g񂵂ƁA`̕L^
+ * @author hoshi hirofumi
+ * @date 2026/10/19
+ * @note XgRecordingListʂĈ̂D3D12ɂ͈ˑȂ(CPUŋŨXggĊm߂)
+ */
+
+#pragma once
+
+/*
+-------------------------------------------------------------------------------------
+	CN[h
+-------------------------------------------------------------------------------------
+*/
+#include <cstddef>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <vector>
+
+/*
+-------------------------------------------------------------------------------------
+	RecordingList@L^̃R}hXg(D3D12ł̓AP[^[ƃXg̑g)
+-------------------------------------------------------------------------------------
+*/
+class RecordingList {
+public:
+	virtual ~RecordingList() {}
+
+	//AP[^[ƋL^nߒ(GPŨXggIĂ)
+	virtual void Reset() = 0;
+	virtual void Close() = 0;
+};
+
+/*
+-------------------------------------------------------------------------------------
+	CommandListPoolNX@錾
+-------------------------------------------------------------------------------------
+*/
+class CommandListPool {
+public:
+	typedef std::function<std::unique_ptr<RecordingList>()> Factory;
+	//! [begin, end)L^([J[XbhĂ΂)
+	typedef std::function<void(RecordingList& list, size_t begin, size_t end)> RecordFunction;
+
+	//! ɋL^`N̏(ĂяoXbh܂ށAWuVXeŎs)
+	static constexpr size_t MAX_WORKERS = 8;
+
+	struct Chunk {
+		size_t begin;
+		size_t end;
+	};
+
+	struct Statistics {
+		size_t created;		//Xg̐(t[̑gׂ)
+		size_t acquired;	//Acquire񐔂̍v
+		size_t peak;		//1t[Ŏgő吔
+	};
+
+	//frameCount̓Xbv`F[̃obt@[(̐t[GPUɂ)
+	CommandListPool(unsigned int frameCount, Factory factory);
+	virtual ~CommandListPool() {}
+
+	CommandListPool(CommandListPool&&) = delete;
+	CommandListPool& operator= (CommandListPool&&) = delete;
+
+	CommandListPool(CommandListPool const&) = delete;
+	CommandListPool& operator= (CommandListPool const&) = delete;
+
+	//frameԖڂ̑gg(̃t[GPŮ҂ĂAResetCommandŌĂ)
+	void BeginFrame(unsigned int frame);
+
+	//Zbgς݂̃Xg(̃XbhĂׂAɓt[Ă܂ŗL)
+	RecordingList& Acquire();
+
+	//count`NɕĕɋL^A`ÑXgԂ(ĂȂ)
+	std::vector<RecordingList*> Record(size_t count, size_t minPerChunk, const RecordFunction& record);
+
+	//countmaxChunksȉE1minPerChunkȏɕ(Õ`Nق1)
+	static std::vector<Chunk> Split(size_t count, size_t maxChunks, size_t minPerChunk);
+
+	size_t GetWorkerCount() const { return m_workers; }
+	Statistics GetStatistics() const;
+
+private:
+	struct Frame {
+		std::vector<std::unique_ptr<RecordingList>> lists;
+		size_t                                      used = 0;
+	};
+
+	Factory            m_factory;
+	std::vector<Frame> m_frames;
+	unsigned int       m_current;
+	size_t             m_workers;
+	Statistics         m_statistics;
+
+	mutable std::mutex m_mutex;
+};
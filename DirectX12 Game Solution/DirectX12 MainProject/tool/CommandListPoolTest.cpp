@@ -0,0 +1,195 @@
+/**
+ * @file CommandListPoolTest.cpp
+ * @brief CommandListPool̊mF(R}hCAQ[{̂̃vWFNgɂ͊܂߂Ȃ)
+ * @author hoshi hirofumi
+ * @date 2026/10/19
+ * @note ŨXgŃ`N̕Et[Ƃ̎g񂵁EAcquireRecordm߂
+ */
+
+#include "CommandListPool.h"
+#include "JobSystem.h"
+#include "TestCheck.h"
+
+#include <algorithm>
+#include <atomic>
+#include <cstdio>
+#include <set>
+#include <stdexcept>
+#include <thread>
+#include <vector>
+
+namespace {
+	using TestCheck::Check;
+
+	//! ŨXg(L^ԍ)
+	class MockList : public RecordingList {
+	public:
+		void Reset() override { ++resets; items.clear(); closed = false; }
+		void Close() override { closed = true; }
+
+		int                 resets = 0;
+		bool                closed = true;
+		std::vector<size_t> items;
+	};
+
+	struct MockFactory {
+		std::atomic<int> created{ 0 };
+
+		CommandListPool::Factory Get()
+		{
+			return [this]() {
+				++created;
+				return std::unique_ptr<RecordingList>(new MockList);
+			};
+		}
+	};
+
+	//AĘRȂA傫̍1܂ŁEÕ`NقǑ傫
+	void Split()
+	{
+		bool valid = true;
+		for (size_t count = 0; count < 200; ++count) {
+			for (size_t maxChunks = 1; maxChunks <= 9; ++maxChunks) {
+				for (size_t minPerChunk = 0; minPerChunk <= 40; minPerChunk += 7) {
+					const auto chunks = CommandListPool::Split(count, maxChunks, minPerChunk);
+					if (count == 0) {
+						valid &= chunks.empty();
+						continue;
+					}
+					valid &= !chunks.empty() && chunks.size() <= maxChunks;
+					valid &= chunks.front().begin == 0 && chunks.back().end == count;
+					for (size_t i = 0; i < chunks.size(); ++i) {
+						const size_t size = chunks[i].end - chunks[i].begin;
+						valid &= size >= 1 && size + 1 >= chunks.front().end - chunks.front().begin;
+						if (chunks.size() > 1)
+							valid &= size >= std::max<size_t>(minPerChunk, 1);
+						if (i > 0)
+							valid &= chunks[i].begin == chunks[i - 1].end && size <= chunks[i - 1].end - chunks[i - 1].begin;
+					}
+				}
+			}
+		}
+		Check(valid, "split covers every item in balanced contiguous chunks");
+		Check(CommandListPool::Split(10, 8, 4).size() == 2, "split respects the minimum per chunk");
+		Check(CommandListPool::Split(3, 8, 100).size() == 1, "small counts record in one chunk");
+	}
+
+	//t[̑gGPUgIŎg񂵁ȂgƂ͍Ȃ
+	void Recycle()
+	{
+		MockFactory factory;
+		CommandListPool pool(2, factory.Get());
+
+		pool.BeginFrame(0);
+		std::set<RecordingList*> frame0;
+		for (int i = 0; i < 3; ++i)
+			frame0.insert(&pool.Acquire());
+		pool.BeginFrame(1);
+		std::set<RecordingList*> frame1;
+		for (int i = 0; i < 2; ++i)
+			frame1.insert(&pool.Acquire());
+		Check(frame0.size() == 3 && frame1.size() == 2 && factory.created == 5, "each acquire gets its own list");
+
+		bool disjoint = true;
+		for (auto* list : frame1)
+			disjoint &= frame0.count(list) == 0;
+		Check(disjoint, "frames in flight do not share lists");
+
+		pool.BeginFrame(2);
+		std::set<RecordingList*> again;
+		for (int i = 0; i < 4; ++i)
+			again.insert(&pool.Acquire());
+		size_t reused = 0;
+		for (auto* list : again)
+			reused += frame0.count(list);
+		Check(reused == 3 && factory.created == 6, "the same frame reuses its lists and only creates the extra one");
+		Check(static_cast<MockList*>(*frame0.begin())->resets == 2, "reused lists are reset on every acquire");
+
+		const auto statistics = pool.GetStatistics();
+		Check(statistics.created == 6 && statistics.acquired == 9 && statistics.peak == 4, "statistics");
+	}
+
+	//[J[瓯AcquireĂAXg2nȂ(쐬bN̊OœɋN)
+	void ConcurrentAcquire()
+	{
+		MockFactory factory;
+		CommandListPool pool(3, factory.Get());
+
+		for (unsigned int frame = 0; frame < 30; ++frame) {
+			pool.BeginFrame(frame);
+			std::vector<RecordingList*> lists(8 * 4);
+			std::vector<std::thread> threads;
+			for (int t = 0; t < 8; ++t)
+				threads.emplace_back([&, t]() {
+					for (int i = 0; i < 4; ++i)
+						lists[t * 4 + i] = &pool.Acquire();
+				});
+			for (auto& thread : threads)
+				thread.join();
+
+			const std::set<RecordingList*> unique(lists.begin(), lists.end());
+			if (unique.size() != lists.size() || unique.count(nullptr) != 0) {
+				Check(false, "concurrent acquires get distinct lists");
+				return;
+			}
+		}
+		Check(factory.created == 3 * 32, "each frame's set grows once and is then reused");
+	}
+
+	//Record͑S̔ԍ傤1L^A`ÑXgԂ
+	void Record()
+	{
+		MockFactory factory;
+		CommandListPool pool(2, factory.Get());
+
+		for (unsigned int frame = 0; frame < 20; ++frame) {
+			pool.BeginFrame(frame);
+			const size_t count = 1000 + frame * 37;
+			const auto lists = pool.Record(count, 16, [](RecordingList& list, size_t begin, size_t end) {
+				auto& mock = static_cast<MockList&>(list);
+				for (size_t i = begin; i < end; ++i)
+					mock.items.push_back(i);
+			});
+
+			std::vector<size_t> all;
+			for (auto* list : lists) {
+				const auto& mock = *static_cast<MockList*>(list);
+				all.insert(all.end(), mock.items.begin(), mock.items.end());
+			}
+			bool ordered = lists.size() <= pool.GetWorkerCount() && all.size() == count;
+			for (size_t i = 0; ordered && i < count; ++i)
+				ordered = all[i] == i;
+			if (!ordered) {
+				Check(false, "record covers every item once in chunk order");
+				return;
+			}
+		}
+
+		//ǂꂩ̃`NASIĂ瓊
+		pool.BeginFrame(20);
+		std::atomic<size_t> recorded(0);
+		bool thrown = false;
+		try {
+			pool.Record(800, 16, [&](RecordingList&, size_t begin, size_t end) {
+				recorded += end - begin;
+				if (begin != 0)
+					throw std::runtime_error("chunk failed");
+			});
+		}
+		catch (const std::runtime_error&) {
+			thrown = true;
+		}
+		Check(thrown == (pool.GetWorkerCount() > 1), "a failing chunk rethrows on the caller");
+		Check(recorded == 800, "every chunk finishes before the rethrow");
+	}
+}
+
+int main()
+{
+	Split();
+	Recycle();
+	ConcurrentAcquire();
+	Record();
+
+	return TestCheck::Finish("CommandListPoolTest");
+}
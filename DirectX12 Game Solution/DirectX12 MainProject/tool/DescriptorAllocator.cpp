@@ -0,0 +1,214 @@
+/**
+ * @file DescriptorAllocator.cpp
+ * @brief Sfʂ̃VF[_[fXNv^[q[v
+ * @author hoshi hirofumi
+ * @date 2026/10/19
+ */
+
+#include "DescriptorAllocator.h"
+
+namespace {
+	//! GetōCX^X
+	DescriptorAllocator* g_instance = nullptr;
+}
+
+/*
+-------------------------------------------------------------------------------------
+	DescriptorRange
+-------------------------------------------------------------------------------------
+*/
+DescriptorRange::DescriptorRange(DescriptorRange&& other) noexcept
+	: m_allocator(other.m_allocator), m_index(other.m_index), m_count(other.m_count)
+{
+	other.m_allocator = nullptr;
+	other.m_index     = INVALID_INDEX;
+	other.m_count     = 0;
+}
+
+DescriptorRange& DescriptorRange::operator= (DescriptorRange&& other) noexcept
+{
+	if (this != &other) {
+		Reset();
+		m_allocator = other.m_allocator;
+		m_index     = other.m_index;
+		m_count     = other.m_count;
+		other.m_allocator = nullptr;
+		other.m_index     = INVALID_INDEX;
+		other.m_count     = 0;
+	}
+	return *this;
+}
+
+/**
+	@brief	mۂĂXbgԋp
+*/
+void DescriptorRange::Reset() noexcept
+{
+	if (m_allocator && IsValid())
+		m_allocator->Free(m_index, m_count);
+
+	m_allocator = nullptr;
+	m_index     = INVALID_INDEX;
+	m_count     = 0;
+}
+
+D3D12_CPU_DESCRIPTOR_HANDLE DescriptorRange::GetCpuHandle(size_t offset) const
+{
+	return m_allocator->GetCpuHandle(m_index + offset);
+}
+
+D3D12_GPU_DESCRIPTOR_HANDLE DescriptorRange::GetGpuHandle(size_t offset) const
+{
+	return m_allocator->GetGpuHandle(m_index + offset);
+}
+
+/*
+-------------------------------------------------------------------------------------
+	DescriptorAllocator
+-------------------------------------------------------------------------------------
+*/
+DescriptorAllocator::DescriptorAllocator(ID3D12Device* device, size_t count)
+	: m_freeList(count), m_frame(0), m_allocated(0), m_peakAllocated(0), m_allocations(0), m_failedAllocations(0)
+{
+	m_heap = make_unique<DescriptorHeap>(device, count);
+	g_instance = this;
+}
+
+DescriptorAllocator::~DescriptorAllocator()
+{
+	m_deferred.clear();
+	g_instance = nullptr;
+}
+
+/**
+	@brief	AXbgmۂ
+	@param	count KvȃXbg
+	@return mۂ͈
+*/
+DescriptorRange DescriptorAllocator::Allocate(size_t count)
+{
+	std::lock_guard<std::mutex> lock(m_mutex);
+
+	if (count == 0)
+		return DescriptorRange();
+
+	const size_t index = m_freeList.Allocate(count);
+	if (index == DescriptorFreeList::INVALID_INDEX) {
+		++m_failedAllocations;
+		OutputDebugString(TEXT("DescriptorAllocator: out of descriptors.\n"));
+		DX::ThrowIfFailed(E_OUTOFMEMORY);
+	}
+
+	m_allocated += count;
+	m_peakAllocated = std::max(m_peakAllocated, m_allocated);
+	++m_allocations;
+
+	return DescriptorRange(this, index, count);
+}
+
+/**
+	@brief	Xbgԋp
+	@param	index 擪
+	@param	count Xbg
+*/
+void DescriptorAllocator::Free(size_t index, size_t count)
+{
+	std::lock_guard<std::mutex> lock(m_mutex);
+
+	m_allocated -= count;
+	m_freeList.Free(index, count);
+}
+
+/**
+	@brief	GPUgIĂXbgԋp
+	@param	range ԋp͈
+*/
+void DescriptorAllocator::DeferredFree(DescriptorRange&& range)
+{
+	if (!range.IsValid())
+		return;
+
+	std::lock_guard<std::mutex> lock(m_mutex);
+	m_deferred.emplace_back(m_frame, std::move(range));
+}
+
+/**
+	@brief	t[̊Jn(FRAME_LATENCYt[Oɕԋp˗ꂽ͈͂ԋp)
+*/
+void DescriptorAllocator::BeginFrame()
+{
+	std::vector<DescriptorRange> released;
+	{
+		std::lock_guard<std::mutex> lock(m_mutex);
+		++m_frame;
+		while (!m_deferred.empty() && m_frame - m_deferred.front().first >= FRAME_LATENCY) {
+			released.push_back(std::move(m_deferred.front().second));
+			m_deferred.pop_front();
+		}
+	}
+	//FreebN̂ŁAbN̊OŔj
+}
+
+/**
+	@brief	gp󋵂̎擾
+	@return v
+*/
+DescriptorAllocator::Statistics DescriptorAllocator::GetStatistics() const
+{
+	std::lock_guard<std::mutex> lock(m_mutex);
+
+	Statistics stats{};
+	stats.capacity          = m_freeList.Capacity();
+	stats.allocated         = m_allocated;
+	stats.peakAllocated     = m_peakAllocated;
+	stats.allocations       = m_allocations;
+	stats.failedAllocations = m_failedAllocations;
+	stats.freeBlocks        = m_freeList.FreeBlocks();
+	stats.largestFreeBlock  = m_freeList.LargestFreeBlock();
+
+	const size_t freeTotal = stats.capacity - stats.allocated;
+	if (freeTotal > 0)
+		stats.fragmentation = 1.0f - static_cast<float>(stats.largestFreeBlock) / static_cast<float>(freeTotal);
+
+	return stats;
+}
+
+/**
+	@brief	foCX̏(q[v)
+	@note	mۍς݂͈̔͂̔ԍ͂̂܂(傪Ƃɋ󂫂֖߂)Aԋp҂GPU҂ɕԂ
+*/
+void DescriptorAllocator::OnDeviceLost()
+{
+	if (g_instance == nullptr)
+		return;
+
+	std::deque<std::pair<unsigned long long, DescriptorRange>> released;
+	{
+		std::lock_guard<std::mutex> lock(g_instance->m_mutex);
+		released.swap(g_instance->m_deferred);
+		g_instance->m_heap.reset();
+	}
+	//FreebN̂ŁAbN̊OŔj
+}
+
+/**
+	@brief	VfoCXŃq[v蒼(傫Ag͎g蒼)
+*/
+void DescriptorAllocator::OnDeviceRestored(ID3D12Device* device)
+{
+	if (g_instance == nullptr)
+		return;
+
+	std::lock_guard<std::mutex> lock(g_instance->m_mutex);
+	g_instance->m_heap = make_unique<DescriptorHeap>(device, g_instance->m_freeList.Capacity());
+}
+
+/**
+	@brief	Sfʂ̃CX^X
+	@param	device 񂾂Kv
+*/
+DescriptorAllocator& DescriptorAllocator::Get(ID3D12Device* device)
+{
+	static DescriptorAllocator instance(device ? device : DXTK->Device);
+	return instance;
+}
@@ -0,0 +1,136 @@
+/**
+ * @file DescriptorAllocator.h
+ * @brief Sfʂ̃VF[_[fXNv^[q[v
+ * @author hoshi hirofumi
+ * @date 2026/10/19
+ */
+
+#pragma once
+
+/*
+-------------------------------------------------------------------------------------
+	CN[h
+-------------------------------------------------------------------------------------
+*/
+#include "Base/pch.h"
+#include "Base/dxtk.h"
+#include "DescriptorFreeList.h"
+
+#include <deque>
+#include <mutex>
+
+/*
+-------------------------------------------------------------------------------------
+	using
+-------------------------------------------------------------------------------------
+*/
+using Microsoft::WRL::ComPtr;
+using std::unique_ptr;
+using std::make_unique;
+using namespace DirectX;
+
+class DescriptorAllocator;
+
+/*
+-------------------------------------------------------------------------------------
+	DescriptorRange@mۂXbg͈̔(jɕԋp)
+-------------------------------------------------------------------------------------
+*/
+class DescriptorRange {
+public:
+	static constexpr size_t INVALID_INDEX = static_cast<size_t>(-1);
+
+	DescriptorRange() noexcept : m_allocator(nullptr), m_index(INVALID_INDEX), m_count(0) {}
+	DescriptorRange(DescriptorAllocator* allocator, size_t index, size_t count) noexcept
+		: m_allocator(allocator), m_index(index), m_count(count) {}
+	virtual ~DescriptorRange() { Reset(); }
+
+	DescriptorRange(DescriptorRange&& other) noexcept;
+	DescriptorRange& operator= (DescriptorRange&& other) noexcept;
+
+	DescriptorRange(DescriptorRange const&) = delete;
+	DescriptorRange& operator= (DescriptorRange const&) = delete;
+
+	void Reset() noexcept;
+
+	size_t Index() const noexcept { return m_index; }
+	size_t Count() const noexcept { return m_count; }
+	bool   IsValid() const noexcept { return m_index != INVALID_INDEX; }
+
+	D3D12_CPU_DESCRIPTOR_HANDLE GetCpuHandle(size_t offset) const;
+	D3D12_GPU_DESCRIPTOR_HANDLE GetGpuHandle(size_t offset) const;
+
+private:
+	DescriptorAllocator* m_allocator;
+	size_t               m_index;
+	size_t               m_count;
+};
+
+/*
+-------------------------------------------------------------------------------------
+	DescriptorAllocatorNX@錾
+-------------------------------------------------------------------------------------
+*/
+class DescriptorAllocator {
+public:
+	static constexpr size_t DESCRIPTOR_COUNT = 4096;
+	//! ԋpx点t[(GameBasẽXbv`F[)
+	static constexpr unsigned long long FRAME_LATENCY = 3;
+
+	//! fЉ̊mFp
+	struct Statistics {
+		size_t capacity;			//q[vŜ̃Xbg
+		size_t allocated;			//gp̃Xbg
+		size_t peakAllocated;		//gpXbg̍ő
+		size_t freeBlocks;			//󂫗̈̐
+		size_t largestFreeBlock;	//ԑ傫󂫗̈
+		size_t allocations;			//mۉ
+		size_t failedAllocations;	//󂫗̈悪肸s
+		float  fragmentation;		//0...󂫂ꑱ 1...א؂
+	};
+
+	DescriptorAllocator(ID3D12Device* device, size_t count = DESCRIPTOR_COUNT);
+	virtual ~DescriptorAllocator();
+
+	DescriptorAllocator(DescriptorAllocator&&) = delete;
+	DescriptorAllocator& operator= (DescriptorAllocator&&) = delete;
+
+	DescriptorAllocator(DescriptorAllocator const&) = delete;
+	DescriptorAllocator& operator= (DescriptorAllocator const&) = delete;
+
+	DescriptorRange Allocate(size_t count);
+	void Free(size_t index, size_t count);
+
+	//GPUQƂI܂ŕԋpx点(`撆̃Xbg̍ւp)
+	void DeferredFree(DescriptorRange&& range);
+	void BeginFrame();
+
+	ID3D12DescriptorHeap* Heap() const { return m_heap->Heap(); }
+	D3D12_CPU_DESCRIPTOR_HANDLE GetCpuHandle(size_t index) const { return m_heap->GetCpuHandle(index); }
+	D3D12_GPU_DESCRIPTOR_HANDLE GetGpuHandle(size_t index) const { return m_heap->GetGpuHandle(index); }
+	D3D12_GPU_DESCRIPTOR_HANDLE GetGpuHandleStart() const { return m_heap->GetFirstGpuHandle(); }
+
+	Statistics GetStatistics() const;
+
+	//foCX̏ƍč쐬(GameBase::OnDeviceLostAGet̑OȂ牽Ȃ)
+	static void OnDeviceLost();
+	static void OnDeviceRestored(ID3D12Device* device);
+
+	//VOg
+	static DescriptorAllocator& Get(ID3D12Device* device = nullptr);
+
+private:
+	unique_ptr<DescriptorHeap> m_heap;
+	DescriptorFreeList         m_freeList;
+
+	//! ԋp҂(ԋp˗t[, ͈)
+	std::deque<std::pair<unsigned long long, DescriptorRange>> m_deferred;
+	unsigned long long m_frame;
+
+	size_t m_allocated;
+	size_t m_peakAllocated;
+	size_t m_allocations;
+	size_t m_failedAllocations;
+
+	mutable std::mutex m_mutex;
+};
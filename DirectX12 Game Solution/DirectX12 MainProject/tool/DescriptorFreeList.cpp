@@ -0,0 +1,119 @@
+/**
+ * @file DescriptorFreeList.cpp
+ * @brief fXNv^[q[v̋󂫃Xbg̊Ǘ(擪ŏɎ܂󂫗̈g)
+ * @author hoshi hirofumi
+ * @date 2026/10/19
+ */
+
+#include "DescriptorFreeList.h"
+
+#include <algorithm>
+#include <iterator>
+
+DescriptorFreeList::DescriptorFreeList(size_t capacity)
+	: m_capacity(capacity)
+{
+	if (capacity > 0)
+		m_freeBlocks.emplace(0, capacity);
+}
+
+/**
+	@brief	AXbgmۂ
+	@param	count KvȃXbg
+	@return 擪̃Xbgԍ
+	@note	1Xbg͕ԋpɎg@܂̈悪Εԋpꂽ1XbgĂT
+*/
+size_t DescriptorFreeList::Allocate(size_t count)
+{
+	if (count == 0)
+		return INVALID_INDEX;
+
+	if (count == 1 && !m_freeSingles.empty()) {
+		const size_t index = m_freeSingles.back();
+		m_freeSingles.pop_back();
+		return index;
+	}
+
+	size_t index = FirstFit(count);
+	if (index == INVALID_INDEX && !m_freeSingles.empty()) {
+		MergeSingles();
+		index = FirstFit(count);
+	}
+	return index;
+}
+
+/**
+	@brief	Xbgԋp
+	@param	index 擪
+	@param	count Xbg
+*/
+void DescriptorFreeList::Free(size_t index, size_t count)
+{
+	if (count == 0)
+		return;
+
+	if (count == 1) {
+		m_freeSingles.push_back(index);
+		return;
+	}
+	Insert(index, count);
+}
+
+/**
+	@brief	ԑ傫󂫗̈(ĂȂ1Xbg1ƂĐ)
+*/
+size_t DescriptorFreeList::LargestFreeBlock() const
+{
+	size_t largest = m_freeSingles.empty() ? 0 : 1;
+	for (const auto& block : m_freeBlocks)
+		largest = std::max(largest, block.second);
+	return largest;
+}
+
+size_t DescriptorFreeList::FirstFit(size_t count)
+{
+	for (auto it = m_freeBlocks.begin(); it != m_freeBlocks.end(); ++it) {
+		if (it->second < count)
+			continue;
+
+		const size_t index = it->first;
+		const size_t rest  = it->second - count;
+		m_freeBlocks.erase(it);
+		if (rest > 0)
+			m_freeBlocks.emplace(index + count, rest);
+		return index;
+	}
+	return INVALID_INDEX;
+}
+
+/**
+	@brief	󂫗̈ɉAŐ󂫗̈ƌ
+*/
+void DescriptorFreeList::Insert(size_t index, size_t count)
+{
+	auto next = m_freeBlocks.lower_bound(index);
+	if (next != m_freeBlocks.end() && index + count == next->first) {
+		count += next->second;
+		next = m_freeBlocks.erase(next);
+	}
+	if (next != m_freeBlocks.begin()) {
+		auto prev = std::prev(next);
+		if (prev->first + prev->second == index) {
+			prev->second += count;
+			return;
+		}
+	}
+	m_freeBlocks.emplace_hint(next, index, count);
+}
+
+/**
+	@brief	ԋpꂽ1XbgSm_freeBlocks֌
+	@note	ԍɓƁA1Xbgm1̗̈ɂȂ
+*/
+void DescriptorFreeList::MergeSingles()
+{
+	std::sort(m_freeSingles.begin(), m_freeSingles.end());
+	for (size_t index : m_freeSingles)
+		Insert(index, 1);
+	m_freeSingles.clear();
+}
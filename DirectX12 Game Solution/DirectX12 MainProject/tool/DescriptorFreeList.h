@@ -0,0 +1,51 @@
+/**
+ * @file DescriptorFreeList.h
+ * @brief fXNv^[q[v̋󂫃Xbg̊Ǘ(擪ŏɎ܂󂫗̈g)
+ * @author hoshi hirofumi
+ * @date 2026/10/19
+ * @note Xbgԍ̌vZȂ̂D3D12ɂ͈ˑȂ(ۂ̃q[vDescriptorAllocator)
+ */
+
+#pragma once
+
+/*
+-------------------------------------------------------------------------------------
+	CN[h
+-------------------------------------------------------------------------------------
+*/
+#include <cstddef>
+#include <map>
+#include <vector>
+
+/*
+-------------------------------------------------------------------------------------
+	DescriptorFreeListNX@錾
+-------------------------------------------------------------------------------------
+*/
+class DescriptorFreeList {
+public:
+	static constexpr size_t INVALID_INDEX = static_cast<size_t>(-1);
+
+	explicit DescriptorFreeList(size_t capacity);
+	virtual ~DescriptorFreeList() {}
+
+	//󂫂INVALID_INDEX
+	size_t Allocate(size_t count);
+	void Free(size_t index, size_t count);
+
+	size_t Capacity() const { return m_capacity; }
+	size_t FreeBlocks() const { return m_freeBlocks.size() + m_freeSingles.size(); }
+	size_t LargestFreeBlock() const;
+
+private:
+	size_t FirstFit(size_t count);
+	void   Insert(size_t index, size_t count);
+	void   MergeSingles();
+
+	size_t m_capacity;
+
+	//! 󂫗̈(擪, )@אڂ͕̈ԋpɌ
+	std::map<size_t, size_t> m_freeBlocks;
+	//! 1Xbg̕ԋp(eNX`̍ւŕpɂɎg)@܂̈悪Ƃm_freeBlocks֌
+	std::vector<size_t>      m_freeSingles;
+};
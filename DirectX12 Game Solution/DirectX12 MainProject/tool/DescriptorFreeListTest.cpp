@@ -0,0 +1,126 @@
+/**
+ * @file DescriptorFreeListTest.cpp
+ * @brief DescriptorFreeList̊mF(R}hCAQ[{̂̃vWFNgɂ͊܂߂Ȃ)
+ * @author hoshi hirofumi
+ * @date 2026/10/19
+ * @note ǑE1Xbg̕ԋp̌ƁAeNX`̍ւ^_ȊmہEԋpm߂
+ */
+
+#include "DescriptorFreeList.h"
+#include "TestCheck.h"
+
+#include <algorithm>
+#include <cstdio>
+#include <random>
+#include <utility>
+#include <vector>
+
+namespace {
+	using TestCheck::Check;
+
+	//ԋp̈͑OƌASԂΈꑱɖ߂
+	void Coalesce()
+	{
+		DescriptorFreeList list(64);
+		const size_t a = list.Allocate(8), b = list.Allocate(8), c = list.Allocate(8);
+		Check(a == 0 && b == 8 && c == 16, "first fit allocates from the front");
+
+		list.Free(b, 8);
+		Check(list.FreeBlocks() == 2, "a hole in the middle is a separate block");
+		list.Free(a, 8);
+		list.Free(c, 8);
+		Check(list.FreeBlocks() == 1 && list.LargestFreeBlock() == 64, "freeing neighbours merges back to one block");
+		Check(list.Allocate(65) == DescriptorFreeList::INVALID_INDEX && list.Allocate(64) == 0, "the whole heap fits again");
+		Check(list.Allocate(1) == DescriptorFreeList::INVALID_INDEX, "a full heap has no slot");
+	}
+
+	//1Xbg̕ԋp1Xbg̊mۂɎg񂵁A傫ȊmۂȂƂ͌
+	void Singles()
+	{
+		DescriptorFreeList list(32);
+		std::vector<size_t> slots;
+		for (int i = 0; i < 32; ++i)
+			slots.push_back(list.Allocate(1));
+		Check(slots.back() == 31, "single slots fill the heap");
+
+		//8..151XbgԂ
+		for (size_t i = 8; i < 16; ++i)
+			list.Free(slots[i], 1);
+		Check(list.FreeBlocks() == 8 && list.LargestFreeBlock() == 1, "freed singles are kept apart until needed");
+
+		const size_t reused = list.Allocate(1);
+		Check(reused == 15, "a single allocation reuses the last freed single");
+		list.Free(reused, 1);
+
+		//1XbgԂ8т8Xbg(ȂƓȂ)
+		Check(list.Allocate(8) == 8, "singles are merged when no block fits");
+		Check(list.FreeBlocks() == 0, "the merged singles are used up");
+
+		//ꂽ1Xbg͌ĂȂ
+		list.Free(0, 1);
+		list.Free(2, 1);
+		Check(list.Allocate(2) == DescriptorFreeList::INVALID_INDEX, "separate singles do not make a block");
+		Check(list.FreeBlocks() == 2 && list.Allocate(1) != DescriptorFreeList::INVALID_INDEX, "merged singles can still be allocated");
+	}
+
+	//eNX`̍ւ(1Xbg)ƃf̓ǂݍ݁Ej(Ä)
+	void Random()
+	{
+		const size_t capacity = 4096;
+		DescriptorFreeList list(capacity);
+		std::vector<std::pair<size_t, size_t>> live;
+		std::vector<int> owner(capacity, 0);
+		std::mt19937 random(1);
+		bool disjoint = true, bounded = true;
+		size_t rangeFailures = 0, fitFailures = 0;
+
+		for (int step = 0; step < 200000; ++step) {
+			const bool allocate = live.empty() || random() % 100 < 52;
+			if (allocate) {
+				const size_t count = random() % 4 != 0 ? 1 : 2 + random() % 64;
+				const size_t index = list.Allocate(count);
+				if (index == DescriptorFreeList::INVALID_INDEX) {
+					++rangeFailures;
+					//ۂɂ͈ꑱ̋󂫂̂ɎsԈႢ(1Xbg̕ԋpYĂ)
+					size_t run = 0, longest = 0;
+					for (size_t i = 0; i < capacity; ++i) {
+						run = owner[i] == 0 ? run + 1 : 0;
+						longest = std::max(longest, run);
+					}
+					fitFailures += longest >= count;
+					continue;
+				}
+				bounded &= index + count <= capacity;
+				for (size_t i = index; i < index + count && i < capacity; ++i)
+					disjoint &= owner[i]++ == 0;
+				live.emplace_back(index, count);
+			}
+			else {
+				const size_t pick = random() % live.size();
+				const auto range = live[pick];
+				live[pick] = live.back();
+				live.pop_back();
+				for (size_t i = range.first; i < range.first + range.second; ++i)
+					--owner[i];
+				list.Free(range.first, range.second);
+			}
+		}
+
+		//SԂΈꑱɖ߂(1Xbg̕ԋp)
+		for (const auto& range : live)
+			list.Free(range.first, range.second);
+		Check(disjoint && bounded, "live ranges never overlap and stay inside the heap");
+		Check(fitFailures == 0, "allocations only fail when no contiguous space exists");
+		Check(list.Allocate(capacity) == 0, "freeing everything restores one block");
+		printf("random: %zu allocations failed with no contiguous space\n", rangeFailures);
+	}
+}
+
+int main()
+{
+	Coalesce();
+	Singles();
+	Random();
+
+	return TestCheck::Finish("DescriptorFreeListTest");
+}
@@ -0,0 +1,107 @@
+/**
+ * @file DirtyRegion.cpp
+ * @brief `̏W܂(D3D9̑wςD3D12֎ʂ)
+ * @author hoshi hirofumi
+ * @date 2026/10/19
+ */
+
+#include "DirtyRegion.h"
+
+#include <algorithm>
+
+DirtyRegion::DirtyRegion(int32_t width, int32_t height)
+	: m_width(0), m_height(0)
+{
+	m_rects.reserve(MAX_RECTS + 1);
+	Resize(width, height);
+}
+
+void DirtyRegion::Resize(int32_t width, int32_t height)
+{
+	m_width  = std::max(width, 0);
+	m_height = std::max(height, 0);
+	AddAll();
+}
+
+void DirtyRegion::AddAll()
+{
+	m_rects.clear();
+	if (m_width > 0 && m_height > 0)
+		m_rects.push_back({ 0, 0, m_width, m_height });
+}
+
+/**
+	@note	܂Ƃ߂`ʂ̋`ɓ͂Ƃ̂ŁA܂Ƃ߂ȂȂ܂ŌJԂ
+*/
+void DirtyRegion::Add(const Rect& rect)
+{
+	Rect added = {
+		std::max(rect.left, 0),         std::max(rect.top, 0),
+		std::min(rect.right, m_width),  std::min(rect.bottom, m_height)
+	};
+	if (added.left >= added.right || added.top >= added.bottom)
+		return;
+
+	for (size_t i = 0; i < m_rects.size();) {
+		if (ShouldMerge(m_rects[i], added)) {
+			added = Union(m_rects[i], added);
+			m_rects[i] = m_rects.back();
+			m_rects.pop_back();
+			i = 0;
+		}
+		else {
+			++i;
+		}
+	}
+	m_rects.push_back(added);
+
+	//𒴂A܂Ƃ߂ĂʐςԑȂg܂Ƃ߂
+	while (m_rects.size() > MAX_RECTS) {
+		size_t   bestA = 0, bestB = 1;
+		uint64_t bestGrowth = UINT64_MAX;
+		for (size_t a = 0; a < m_rects.size(); ++a) {
+			for (size_t b = a + 1; b < m_rects.size(); ++b) {
+				const uint64_t growth = Area(Union(m_rects[a], m_rects[b])) - Area(m_rects[a]) - Area(m_rects[b]);
+				if (growth < bestGrowth) {
+					bestGrowth = growth;
+					bestA = a;
+					bestB = b;
+				}
+			}
+		}
+		const Rect merged = Union(m_rects[bestA], m_rects[bestB]);
+		m_rects[bestB] = m_rects.back();
+		m_rects.pop_back();
+		m_rects[bestA] = m_rects.back();
+		m_rects.pop_back();
+		Add(merged);
+	}
+}
+
+uint64_t DirtyRegion::GetArea() const
+{
+	uint64_t area = 0;
+	for (const auto& rect : m_rects)
+		area += Area(rect);
+	return area;
+}
+
+uint64_t DirtyRegion::Area(const Rect& rect)
+{
+	return static_cast<uint64_t>(rect.right - rect.left) * static_cast<uint64_t>(rect.bottom - rect.top);
+}
+
+DirtyRegion::Rect DirtyRegion::Union(const Rect& a, const Rect& b)
+{
+	return {
+		std::min(a.left, b.left),   std::min(a.top, b.top),
+		std::max(a.right, b.right), std::max(a.bottom, b.bottom)
+	};
+}
+
+bool DirtyRegion::ShouldMerge(const Rect& a, const Rect& b)
+{
+	if (a.left > b.right || b.left > a.right || a.top > b.bottom || b.top > a.bottom)
+		return false;
+	return Area(Union(a, b)) <= Area(a) + Area(b);
+}
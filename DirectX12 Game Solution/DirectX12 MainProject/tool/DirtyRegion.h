@@ -0,0 +1,74 @@
+/**
+ * @file DirtyRegion.h
+ * @brief `̏W܂(D3D9̑wςD3D12֎ʂ)
+ * @author hoshi hirofumi
+ * @date 2026/10/19
+ * @note ܂Ƃ߂ĂʁXɎʂʐςȂg(܂ށEdȂ肪傫EŐڂ)͂܂Ƃ߂
+ *       𒴂ʐς̑ԏȂg܂Ƃ߂
+ *       WindowsɈˑȂ
+ */
+
+#pragma once
+
+/*
+-------------------------------------------------------------------------------------
+	CN[h
+-------------------------------------------------------------------------------------
+*/
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+/*
+-------------------------------------------------------------------------------------
+	DirtyRegionNX@錾
+-------------------------------------------------------------------------------------
+*/
+class DirtyRegion {
+public:
+	//! RECTƓ(rightEbottom͊܂܂Ȃ)
+	struct Rect {
+		int32_t left;
+		int32_t top;
+		int32_t right;
+		int32_t bottom;
+	};
+
+	//! ێ`̏(ʂ񐔂Ȃ悤)
+	static constexpr size_t MAX_RECTS = 8;
+
+	DirtyRegion(int32_t width, int32_t height);
+	virtual ~DirtyRegion() {}
+
+	DirtyRegion(DirtyRegion&&) = default;
+	DirtyRegion& operator= (DirtyRegion&&) = default;
+
+	DirtyRegion(DirtyRegion const&) = delete;
+	DirtyRegion& operator= (DirtyRegion const&) = delete;
+
+	//傫ςđŜƂɂ
+	void Resize(int32_t width, int32_t height);
+
+	//`𑫂(ʂ̊O͐؂AȂ牽Ȃ)
+	void Add(const Rect& rect);
+	//S
+	void AddAll();
+	void Clear() { m_rects.clear(); }
+
+	bool IsEmpty() const { return m_rects.empty(); }
+	const std::vector<Rect>& GetRects() const { return m_rects; }
+	//`̖ʐς̍v(sNZ)
+	uint64_t GetArea() const;
+
+	int32_t GetWidth() const { return m_width; }
+	int32_t GetHeight() const { return m_height; }
+
+private:
+	static uint64_t Area(const Rect& rect);
+	static Rect Union(const Rect& a, const Rect& b);
+	static bool ShouldMerge(const Rect& a, const Rect& b);
+
+	int32_t           m_width;
+	int32_t           m_height;
+	std::vector<Rect> m_rects;	//ǂ̑gShouldMergeł͂Ȃ
+};
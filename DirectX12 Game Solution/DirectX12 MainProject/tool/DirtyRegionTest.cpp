@@ -0,0 +1,194 @@
+/**
+ * @file DirtyRegionTest.cpp
+ * @brief DirtyRegion̊mF(R}hCAQ[{̂̃vWFNgɂ͊܂߂Ȃ)
+ * @author hoshi hirofumi
+ * @date 2026/10/19
+ * @note ܂Ƃ߂EʊO̐؂E8̏ƁA_ɑ`RȂ邩m߂
+ */
+
+#include "DirtyRegion.h"
+#include "TestCheck.h"
+
+#include <algorithm>
+#include <cstdio>
+#include <random>
+#include <vector>
+
+namespace {
+	using TestCheck::Check;
+
+	typedef DirtyRegion::Rect Rect;
+
+	uint64_t Area(const Rect& rect)
+	{
+		return static_cast<uint64_t>(rect.right - rect.left) * static_cast<uint64_t>(rect.bottom - rect.top);
+	}
+
+	bool Contains(const Rect& rect, int32_t x, int32_t y)
+	{
+		return x >= rect.left && x < rect.right && y >= rect.top && y < rect.bottom;
+	}
+
+	bool Touches(const Rect& a, const Rect& b)
+	{
+		return !(a.left > b.right || b.left > a.right || a.top > b.bottom || b.top > a.bottom);
+	}
+
+	//ǂ̑g܂Ƃ߂𖞂Ȃ(܂Ƃ߂ʐςȂȂA܂Ƃ܂Ă͂)
+	bool NoMergeablePair(const DirtyRegion& region)
+	{
+		const auto& rects = region.GetRects();
+		for (size_t a = 0; a < rects.size(); ++a)
+			for (size_t b = a + 1; b < rects.size(); ++b) {
+				const Rect u = {
+					std::min(rects[a].left, rects[b].left),   std::min(rects[a].top, rects[b].top),
+					std::max(rects[a].right, rects[b].right), std::max(rects[a].bottom, rects[b].bottom)
+				};
+				if (Touches(rects[a], rects[b]) && Area(u) <= Area(rects[a]) + Area(rects[b]))
+					return false;
+			}
+		return true;
+	}
+
+	bool Inside(const DirtyRegion& region)
+	{
+		for (const auto& rect : region.GetRects())
+			if (rect.left < 0 || rect.top < 0 || rect.right > region.GetWidth() || rect.bottom > region.GetHeight() ||
+				rect.left >= rect.right || rect.top >= rect.bottom)
+				return false;
+		return true;
+	}
+
+	//܂Ƃ߂: ܂ށE()ŐڂEdȂ肪傫̂͂܂Ƃ߁Apڂ͕̂
+	void MergeRules()
+	{
+		DirtyRegion region(1280, 720);
+		Check(region.GetRects().size() == 1 && region.GetArea() == 1280ull * 720, "a new region is fully dirty");
+		region.Clear();
+		Check(region.IsEmpty(), "clear empties the region");
+
+		region.Add({ 10, 10, 50, 50 });
+		region.Add({ 20, 20, 30, 30 });
+		Check(region.GetRects().size() == 1 && region.GetArea() == 1600, "a contained rect is absorbed");
+
+		region.Add({ 50, 10, 90, 50 });
+		Check(region.GetRects().size() == 1 && region.GetArea() == 3200, "a rect of the same height touching the side merges");
+
+		region.Add({ 10, 50, 90, 60 });
+		Check(region.GetRects().size() == 1 && region.GetArea() == 4000, "a rect of the same width touching the bottom merges");
+
+		region.Add({ 90, 60, 100, 70 });
+		Check(region.GetRects().size() == 2 && region.GetArea() == 4100, "a rect touching only a corner stays separate");
+
+		region.Clear();
+		region.Add({ 0, 0, 100, 100 });
+		region.Add({ 10, 0, 110, 100 });
+		Check(region.GetRects().size() == 1 && region.GetArea() == 11000, "a mostly overlapping rect merges");
+
+		region.Clear();
+		region.Add({ 0, 0, 100, 10 });
+		region.Add({ 0, 0, 10, 100 });
+		Check(region.GetRects().size() == 2, "an L shape stays two rects (the union would copy more)");
+
+		//܂Ƃ߂ʂʂ̋`ɓ͂A܂Ƃ߂
+		region.Clear();
+		region.Add({ 0, 0, 10, 10 });
+		region.Add({ 20, 0, 30, 10 });
+		region.Add({ 10, 0, 20, 10 });
+		Check(region.GetRects().size() == 1 && region.GetArea() == 300, "merging cascades into a neighbour");
+	}
+
+	//ʂ̊O͐؂A̋`͑Ȃ
+	void Clipping()
+	{
+		DirtyRegion region(640, 480);
+		region.Clear();
+		region.Add({ -10, -10, 5, 5 });
+		Check(region.GetRects().size() == 1 && region.GetArea() == 25, "rects are clipped to the screen");
+		region.Add({ 700, 0, 800, 10 });
+		region.Add({ 0, 500, 10, 600 });
+		region.Add({ 20, 20, 20, 40 });
+		region.Add({ 30, 30, 10, 10 });
+		Check(region.GetRects().size() == 1, "offscreen and empty rects are ignored");
+
+		region.Resize(320, 200);
+		Check(region.GetRects().size() == 1 && region.GetArea() == 320ull * 200, "resize marks the new size dirty");
+		region.Resize(0, 200);
+		Check(region.IsEmpty() && (region.Add({ 0, 0, 10, 10 }), region.IsEmpty()), "a zero-sized region stays empty");
+	}
+
+	//: ꂽ`9Ă8܂ŁAʐςԑȂg܂Ƃ߂
+	void Cap()
+	{
+		DirtyRegion region(1000, 1000);
+		region.Clear();
+		for (int i = 0; i < 8; ++i)
+			region.Add({ i * 100, 0, i * 100 + 10, 10 });
+		Check(region.GetRects().size() == DirtyRegion::MAX_RECTS, "eight separate rects are kept");
+
+		//1ڂ̋߂(2)ɑƁA2܂Ƃ܂
+		region.Add({ 12, 0, 22, 10 });
+		Check(region.GetRects().size() == DirtyRegion::MAX_RECTS, "the ninth rect does not exceed the cap");
+		Check(region.GetArea() == 8 * 100 + 120, "the cheapest pair is merged");
+		Check(NoMergeablePair(region), "the cap merge leaves no mergeable pair");
+	}
+
+	//_: sNZ͑SAEʁE܂Ƃ߂
+	void Random()
+	{
+		std::mt19937 random(1);
+		bool bounded = true, covered = true, settled = true;
+		uint64_t worstOverdraw = 0;
+
+		for (int round = 0; round < 200; ++round) {
+			const int32_t width = 32 + random() % 97, height = 32 + random() % 97;
+			DirtyRegion region(width, height);
+			region.Clear();
+			std::vector<unsigned char> dirty(width * height, 0);
+			uint64_t dirtyArea = 0;
+
+			const int adds = 1 + random() % 60;
+			for (int i = 0; i < adds; ++i) {
+				const int32_t x = static_cast<int32_t>(random() % (width + 16)) - 8;
+				const int32_t y = static_cast<int32_t>(random() % (height + 16)) - 8;
+				const Rect rect = { x, y, x + 1 + static_cast<int32_t>(random() % 24), y + 1 + static_cast<int32_t>(random() % 24) };
+				region.Add(rect);
+				for (int32_t yy = std::max(rect.top, 0); yy < std::min(rect.bottom, height); ++yy)
+					for (int32_t xx = std::max(rect.left, 0); xx < std::min(rect.right, width); ++xx)
+						if (!dirty[yy * width + xx]) {
+							dirty[yy * width + xx] = 1;
+							++dirtyArea;
+						}
+				bounded &= region.GetRects().size() <= DirtyRegion::MAX_RECTS && Inside(region);
+				settled &= NoMergeablePair(region);
+			}
+
+			for (int32_t y = 0; y < height; ++y)
+				for (int32_t x = 0; x < width; ++x) {
+					if (!dirty[y * width + x])
+						continue;
+					bool inside = false;
+					for (const auto& rect : region.GetRects())
+						inside |= Contains(rect, x, y);
+					covered &= inside;
+				}
+
+			if (dirtyArea != 0)
+				worstOverdraw = std::max(worstOverdraw, region.GetArea() * 100 / dirtyArea);
+		}
+		Check(bounded, "random rects stay within the cap and the screen");
+		Check(settled, "random rects leave no mergeable pair");
+		Check(covered, "every dirty pixel is covered");
+		printf("random: worst copied area %llu%% of the dirty pixels\n", static_cast<unsigned long long>(worstOverdraw));
+	}
+}
+
+int main()
+{
+	MergeRules();
+	Clipping();
+	Cap();
+	Random();
+
+	return TestCheck::Finish("DirtyRegionTest");
+}
@@ -0,0 +1,153 @@
+/**
+ * @file FramePacer.cpp
+ * @brief t[̊Ԋǔߕ(邩A͂ǂނAPresent̓)
+ * @author hoshi hirofumi
+ * @date 2026/10/19
+ */
+
+#include "FramePacer.h"
+
+#include <algorithm>
+#include <chrono>
+#include <cwchar>
+#include <thread>
+
+namespace {
+	//! ͂ǂނ̂ς肱ꂾ߂(ƌς̗h̕)
+	constexpr uint64_t SAFETY_NS = 500000;
+}
+
+FramePacer::FramePacer() : FramePacer(Settings())
+{
+}
+
+FramePacer::FramePacer(const Settings& settings, Clock clock, Sleep sleep)
+	: m_clock(clock), m_sleep(sleep), m_period(0), m_deadline(0), m_sampled(0), m_presenting(0),
+	  m_work{}, m_workCount(0), m_workNext(0), m_statistics{}
+{
+	SetSettings(settings);
+}
+
+void FramePacer::SetSettings(const Settings& settings)
+{
+	m_settings = settings;
+	m_settings.maxFrameLatency = std::min(std::max(settings.maxFrameLatency, 1u), MAX_FRAME_LATENCY);
+	m_settings.targetFps       = std::max(settings.targetFps, 0.0);
+
+	m_period   = m_settings.targetFps > 0.0 ? static_cast<uint64_t>(1e9 / m_settings.targetFps) : 0;
+	m_deadline = 0;
+}
+
+FramePacer::Settings FramePacer::ParseCommandLine(const wchar_t* commandLine)
+{
+	Settings settings;
+	if (commandLine == nullptr)
+		return settings;
+
+	if (wcsstr(commandLine, L"/uncapped"))
+		settings.mode = Mode::Uncapped;
+	if (wcsstr(commandLine, L"/vrr"))
+		settings.mode = Mode::VariableRefresh;
+	if (wcsstr(commandLine, L"/nojit"))
+		settings.justInTime = false;
+	if (const wchar_t* fps = wcsstr(commandLine, L"/fps:"))
+		settings.targetFps = wcstod(fps + 5, nullptr);
+	if (const wchar_t* latency = wcsstr(commandLine, L"/latency:"))
+		settings.maxFrameLatency = static_cast<unsigned int>(wcstoul(latency + 9, nullptr, 10));
+	return settings;
+}
+
+uint64_t FramePacer::GetWorkEstimate() const
+{
+	uint64_t estimate = 0;
+	for (size_t i = 0; i < m_workCount; ++i)
+		estimate = std::max(estimate, m_work[i]);
+	return estimate;
+}
+
+/**
+	@note	ߐ؂肪܂Ȃ(ŏ̃t[Eݒ̒)A~b^[ȂΑ҂Ȃ
+*/
+uint64_t FramePacer::GetSampleTime() const
+{
+	if (m_period == 0 || m_deadline == 0 || !m_settings.justInTime)
+		return 0;
+
+	const uint64_t lead = GetWorkEstimate() + SAFETY_NS;
+	return m_deadline > lead ? m_deadline - lead : 0;
+}
+
+uint64_t FramePacer::GetPresentTime() const
+{
+	return m_period == 0 ? 0 : m_deadline;
+}
+
+void FramePacer::WaitForSample()
+{
+	SleepUntil(GetSampleTime());
+	m_sampled = m_clock();
+}
+
+void FramePacer::WaitForPresent()
+{
+	m_presenting = m_clock();
+	SleepUntil(GetPresentTime());
+}
+
+/**
+	@note	ŏ̃t[͒ߐ؂߂邾
+			̒ߐ؂߂قǒxꂽƂ͍1t[ɂ
+			(x߂ƂĊԂ󂯂PresentȂ)
+*/
+void FramePacer::OnPresent()
+{
+	const uint64_t work = m_presenting > m_sampled ? m_presenting - m_sampled : 0;
+	m_work[m_workNext] = work;
+	m_workNext  = (m_workNext + 1) % WORK_HISTORY;
+	m_workCount = std::min(m_workCount + 1, WORK_HISTORY);
+
+	++m_statistics.frames;
+	m_statistics.workNs += work;
+
+	if (m_period == 0)
+		return;
+
+	const uint64_t now = m_clock();
+	if (m_deadline == 0) {
+		m_deadline = now + m_period;
+		return;
+	}
+
+	if (m_presenting > m_deadline)
+		++m_statistics.missed;
+	const uint64_t next = m_deadline + m_period;
+	m_deadline = now > next ? now + m_period : next;
+}
+
+void FramePacer::SleepUntil(uint64_t time)
+{
+	uint64_t now = m_clock();
+	if (time <= now)
+		return;
+
+	const uint64_t start = now;
+	if (time - now > SPIN_NS)
+		m_sleep(time - now - SPIN_NS);
+	while ((now = m_clock()) < time)
+		m_sleep(0);
+	m_statistics.sleptNs += now - start;
+}
+
+uint64_t FramePacer::Now()
+{
+	return static_cast<uint64_t>(std::chrono::duration_cast<std::chrono::nanoseconds>(
+		std::chrono::steady_clock::now().time_since_epoch()).count());
+}
+
+void FramePacer::SleepFor(uint64_t ns)
+{
+	if (ns == 0)
+		std::this_thread::yield();
+	else
+		std::this_thread::sleep_for(std::chrono::nanoseconds(ns));
+}
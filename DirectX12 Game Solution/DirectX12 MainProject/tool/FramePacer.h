@@ -0,0 +1,122 @@
+/**
+ * @file FramePacer.h
+ * @brief t[̊Ԋǔߕ(邩A͂ǂނAPresent̓)
+ * @author hoshi hirofumi
+ * @date 2026/10/19
+ * @note vƖ͍ւ̂ŁAU̎vŌ܂ʂm߂(WindowsɈˑȂ)
+ *       Xbv`F[̑҂킹(őt[x)PresentGameBasesǍ͎vZ
+ */
+
+#pragma once
+
+/*
+-------------------------------------------------------------------------------------
+	CN[h
+-------------------------------------------------------------------------------------
+*/
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+
+/*
+-------------------------------------------------------------------------------------
+	FramePacerNX@錾
+-------------------------------------------------------------------------------------
+*/
+class FramePacer {
+public:
+	//! Present̓
+	enum class Mode {
+		VSync,				//҂
+		VariableRefresh,	//҂Ȃ(ΉĂ΃eBAOG-SYNC/FreeSyncɔC)
+		Uncapped			//҂Ȃ
+	};
+
+	struct Settings {
+		Mode         mode            = Mode::VSync;
+		unsigned int maxFrameLatency = 1;		//GPUɐςłt[̐(1ԒxȂ)
+		double       targetFps       = 0.0;		//CPŨt[~b^[(0Ȃ琧Ȃ)
+		bool         justInTime      = true;	//~b^[̑҂͂̑Oɒu(͂Present܂łk߂)
+	};
+
+	//! v(imb)
+	struct Statistics {
+		uint64_t frames;
+		uint64_t missed;		//~b^[̒ߐ؂ɊԂɍȂt[
+		uint64_t sleptNs;		//~b^[ő҂
+		uint64_t workNs;		//͂ǂłPresent܂
+	};
+
+	//! ̎(imbAP)
+	typedef std::function<uint64_t()> Clock;
+	//! ȂƂns(ȂĂ悢A0Ȃ瑼̃Xbhɏ邾)
+	typedef std::function<void(uint64_t)> Sleep;
+
+	//! OS̖͒ߐ؂̂ꂾO܂łɂāAc͉đ҂(Sleep̗x傫)
+	static constexpr uint64_t SPIN_NS = 1500000;
+	//! ͂Present܂ł̌ςɎgt[̐(ő)
+	static constexpr size_t WORK_HISTORY = 16;
+	//! őt[x̏(DXGIƓ)
+	static constexpr unsigned int MAX_FRAME_LATENCY = 16;
+
+	FramePacer();
+	FramePacer(const Settings& settings, Clock clock = Now, Sleep sleep = SleepFor);
+	virtual ~FramePacer() {}
+
+	FramePacer(FramePacer&&) = delete;
+	FramePacer& operator= (FramePacer&&) = delete;
+
+	FramePacer(FramePacer const&) = delete;
+	FramePacer& operator= (FramePacer const&) = delete;
+
+	//Xbv`F[Oɐݒ肷(l͊ۂ߂)
+	void SetSettings(const Settings& settings);
+	const Settings& GetSettings() const { return m_settings; }
+
+	//"/uncapped" "/vrr" "/fps:N" "/latency:N" "/nojit" ǂ(Ȃ̂͊̂܂)
+	static Settings ParseCommandLine(const wchar_t* commandLine);
+
+	//Present̓ԊuƃeBAO
+	unsigned int GetSyncInterval() const { return m_settings.mode == Mode::VSync ? 1 : 0; }
+	bool WantsTearing() const { return m_settings.mode == Mode::VariableRefresh; }
+	//~b^[1t[(imbA0Ȃ琧Ȃ)
+	uint64_t GetPeriod() const { return m_period; }
+
+	//͂ǂގ(0Ȃ獡)@ߐ؂肩́`Presenťς
+	uint64_t GetSampleTime() const;
+	//Present鎞(0Ȃ獡)
+	uint64_t GetPresentTime() const;
+	//́`Presenťς(ŋ߂̃t[̍ő)
+	uint64_t GetWorkEstimate() const;
+
+	//͂ǂޒO(Xbv`F[̑҂킹̌)
+	void WaitForSample();
+	//Present̒O
+	void WaitForPresent();
+	//Presenť(̒ߐ؂֐i)
+	void OnPresent();
+
+	Statistics GetStatistics() const { return m_statistics; }
+
+	//̎vƖ(steady_clockAsleep_for/yield)
+	static uint64_t Now();
+	static void SleepFor(uint64_t ns);
+
+private:
+	void SleepUntil(uint64_t time);
+
+	Settings m_settings;
+	Clock    m_clock;
+	Sleep    m_sleep;
+	uint64_t m_period;
+
+	uint64_t m_deadline;	//̃t[Present̒ߐ؂(0Ȃ܂Ȃ)
+	uint64_t m_sampled;		//͂ǂ񂾎
+	uint64_t m_presenting;	//WaitForPresentɓ
+
+	uint64_t m_work[WORK_HISTORY];
+	size_t   m_workCount;
+	size_t   m_workNext;
+
+	Statistics m_statistics;
+};
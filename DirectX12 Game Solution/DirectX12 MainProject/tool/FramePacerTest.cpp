@@ -0,0 +1,174 @@
+/**
+ * @file FramePacerTest.cpp
+ * @brief FramePacer̊mF(R}hCAQ[{̂̃vWFNgɂ͊܂߂Ȃ)
+ * @author hoshi hirofumi
+ * @date 2026/10/19
+ * @note U̎vŃ~b^[E͂̎ExꂽƂ̒ߐ؂ER}hCm߂
+ */
+
+#include "FramePacer.h"
+#include "TestCheck.h"
+
+#include <cstdio>
+#include <vector>
+
+namespace {
+	using TestCheck::Check;
+
+	constexpr uint64_t MS = 1000000;
+
+	//! U̎v(0.3msQ߂Ađ҂120usi)
+	struct FakeClock {
+		uint64_t now = 1000 * MS;
+
+		FramePacer::Clock Clock() { return [this]() { return now; }; }
+		FramePacer::Sleep Sleep() { return [this](uint64_t ns) { now += ns != 0 ? ns + 300000 : 20000; }; }
+	};
+
+	//! 1t[(͂ǂłworkĕ`APresent)
+	uint64_t Frame(FramePacer& pacer, FakeClock& clock, uint64_t work, uint64_t* sampled = nullptr)
+	{
+		pacer.WaitForSample();
+		if (sampled)
+			*sampled = clock.now;
+		clock.now += work;
+		pacer.WaitForPresent();
+		const uint64_t presented = clock.now;
+		pacer.OnPresent();
+		return presented;
+	}
+
+	FramePacer::Settings Limited(double fps, bool justInTime = true)
+	{
+		FramePacer::Settings settings;
+		settings.targetFps  = fps;
+		settings.justInTime = justInTime;
+		return settings;
+	}
+
+	//100fps5ms̎d: Present̊Ԋu10msA͂Present̎d+]TO
+	void Limiter()
+	{
+		FakeClock clock;
+		FramePacer pacer(Limited(100.0), clock.Clock(), clock.Sleep());
+
+		std::vector<uint64_t> presents, samples;
+		for (int i = 0; i < 50; ++i) {
+			uint64_t sampled = 0;
+			presents.push_back(Frame(pacer, clock, 5 * MS, &sampled));
+			samples.push_back(sampled);
+		}
+		bool steady = true, late = true;
+		for (size_t i = 2; i < presents.size(); ++i) {
+			const uint64_t interval = presents[i] - presents[i - 1];
+			steady &= interval >= 10 * MS && interval < 10 * MS + 40000;
+			late   &= presents[i] - samples[i] <= 5 * MS + 540000;
+		}
+		Check(steady, "limiter presents every 10ms");
+		Check(late, "input is read just before the work estimate");
+		Check(pacer.GetStatistics().missed == 0, "limiter misses nothing when the work fits");
+	}
+
+	//dt[𒴂: ҂AԂl߂PresentȂ
+	void Overrun()
+	{
+		FakeClock clock;
+		FramePacer pacer(Limited(100.0), clock.Clock(), clock.Sleep());
+
+		uint64_t last = 0;
+		bool spaced = true;
+		for (int i = 0; i < 20; ++i) {
+			const uint64_t presented = Frame(pacer, clock, 15 * MS);
+			if (last != 0)
+				spaced &= presented - last >= 15 * MS;
+			last = presented;
+		}
+		Check(spaced, "overrunning frames are not bunched");
+		Check(pacer.GetStatistics().missed >= 18, "overrunning frames count as missed");
+		Check(pacer.GetStatistics().sleptNs == 0, "overrunning frames never sleep");
+	}
+
+	//1񂾂~܂: ̃t[1󂯂Present(ďoȂ)
+	void Hitch()
+	{
+		FakeClock clock;
+		FramePacer pacer(Limited(100.0, false), clock.Clock(), clock.Sleep());
+
+		for (int i = 0; i < 5; ++i)
+			Frame(pacer, clock, 2 * MS);
+		const uint64_t hitch = Frame(pacer, clock, 35 * MS);
+		const uint64_t after = Frame(pacer, clock, 2 * MS);
+		const uint64_t next  = Frame(pacer, clock, 2 * MS);
+		Check(after - hitch >= 10 * MS, "the frame after a long hitch waits a whole period");
+		Check(next - after >= 10 * MS && next - after < 10 * MS + 40000, "the limiter is back on period after a hitch");
+
+		//1̒x͎̒ߐ؂̂܂(ς̊Ԋuۂ)
+		const uint64_t small = Frame(pacer, clock, 13 * MS);
+		const uint64_t catchUp = Frame(pacer, clock, 2 * MS);
+		Check(catchUp - small < 10 * MS, "a small miss keeps the original schedule");
+	}
+
+	//justInTimeȂ: ͂͂ǂ݁APresent̑Oő҂
+	void NoJustInTime()
+	{
+		FakeClock clock;
+		FramePacer pacer(Limited(50.0, false), clock.Clock(), clock.Sleep());
+
+		uint64_t last = 0;
+		bool immediate = true, steady = true;
+		for (int i = 0; i < 10; ++i) {
+			const uint64_t before = clock.now;
+			uint64_t sampled = 0;
+			const uint64_t presented = Frame(pacer, clock, 2 * MS, &sampled);
+			immediate &= sampled == before;
+			if (last != 0)
+				steady &= presented - last >= 20 * MS && presented - last < 20 * MS + 40000;
+			last = presented;
+		}
+		Check(immediate, "without just-in-time input is read immediately");
+		Check(steady, "without just-in-time the limiter still holds 20ms");
+	}
+
+	//Ȃ: Ȃ
+	void Uncapped()
+	{
+		FakeClock clock;
+		FramePacer::Settings settings;
+		settings.mode = FramePacer::Mode::Uncapped;
+		FramePacer pacer(settings, clock.Clock(), clock.Sleep());
+
+		bool awake = true;
+		for (int i = 0; i < 10; ++i) {
+			const uint64_t before = clock.now;
+			awake &= Frame(pacer, clock, 0) == before;
+		}
+		Check(awake, "uncapped never sleeps");
+		Check(pacer.GetSyncInterval() == 0 && !pacer.WantsTearing(), "uncapped presents without vsync or tearing");
+	}
+
+	void CommandLine()
+	{
+		const auto settings = FramePacer::ParseCommandLine(L"/vrr /fps:144 /latency:0");
+		Check(settings.mode == FramePacer::Mode::VariableRefresh && settings.targetFps == 144.0, "command line is parsed");
+
+		FakeClock clock;
+		FramePacer pacer(settings, clock.Clock(), clock.Sleep());
+		Check(pacer.GetSettings().maxFrameLatency == 1, "frame latency is clamped to 1");
+		Check(pacer.WantsTearing() && pacer.GetPeriod() == 6944444, "vrr tears and 144fps is 6.94ms");
+
+		const auto defaults = FramePacer::ParseCommandLine(L"");
+		Check(defaults.mode == FramePacer::Mode::VSync && defaults.targetFps == 0.0 && defaults.maxFrameLatency == 1, "defaults");
+	}
+}
+
+int main()
+{
+	Limiter();
+	Overrun();
+	Hitch();
+	NoJustInTime();
+	Uncapped();
+	CommandLine();
+
+	return TestCheck::Finish("FramePacerTest");
+}
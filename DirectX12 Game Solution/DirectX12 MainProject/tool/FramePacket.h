@@ -0,0 +1,67 @@
+/**
+ * @file FramePacket.h
+ * @brief V~[V`֓n1t[̃f[^
+ * @author hoshi hirofumi
+ * @date 2026/10/19
+ * @note V~[ṼXbhA`̃Xbh͓ǂނ(FramePipeline2݂Ɏg)
+ */
+
+#pragma once
+
+/*
+-------------------------------------------------------------------------------------
+	CN[h
+-------------------------------------------------------------------------------------
+*/
+#include "PmxStructList.h"
+
+#include <vector>
+
+/*
+-------------------------------------------------------------------------------------
+	using
+-------------------------------------------------------------------------------------
+*/
+using namespace DirectX::SimpleMath;
+
+class PmxLoader;
+
+/*
+-------------------------------------------------------------------------------------
+	\
+-------------------------------------------------------------------------------------
+*/
+//! f1(PmxLoader::CaptureŏAPmxLoader::Renderŕ`)
+struct ModelFrame {
+	PmxLoader*                model;
+	unsigned int              dirtyFlags;		//KvȒ萔(PmxLoaderDirtyFlags)
+	DX12::CAMERA              camera;
+	Matrix                    world;
+	std::vector<Matrix>       bones;			//dirtyFlagsɃ{[Ƃ
+	std::vector<InstanceData> instances;		//dirtyFlagsɃCX^XƂ
+	unsigned int              instanceCount;
+	std::vector<float>        materialSizes;	//}eẢʏ̑傫(sNZA͌ĂȂ)
+};
+
+//! 1t[
+struct FramePacket {
+	uint64_t frame = 0;		//Ԗڂ̃V~[V
+
+	//Õt[Ŏg̈g(t[mۂȂ)
+	ModelFrame& Add()
+	{
+		if (m_count == m_models.size())
+			m_models.emplace_back();
+		return m_models[m_count++];
+	}
+	void Clear() { m_count = 0; }
+
+	size_t Count() const { return m_count; }
+	const ModelFrame& operator[](size_t index) const { return m_models[index]; }
+	const ModelFrame* begin() const { return m_models.data(); }
+	const ModelFrame* end() const { return m_models.data() + m_count; }
+
+private:
+	std::vector<ModelFrame> m_models;
+	size_t                  m_count = 0;
+};
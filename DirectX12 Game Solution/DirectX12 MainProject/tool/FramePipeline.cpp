@@ -0,0 +1,134 @@
+/**
+ * @file FramePipeline.cpp
+ * @brief V[Update(̃t[)ƃR}h̋L^(̃t[)d˂
+ * @author hoshi hirofumi
+ * @date 2026/10/19
+ */
+
+#include "FramePipeline.h"
+#include "FramePacket.h"
+
+#include <chrono>
+
+FramePipeline::FramePipeline()
+	: m_next(0), m_frame(0), m_pending(false), m_running(false), m_quit(false), m_statistics{}
+{
+	m_packets[0] = std::make_unique<FramePacket>();
+	m_packets[1] = std::make_unique<FramePacket>();
+	m_thread = std::thread(&FramePipeline::ThreadMain, this);
+}
+
+FramePipeline::~FramePipeline()
+{
+	{
+		std::unique_lock<std::mutex> lock(m_mutex);
+		m_done.wait(lock, [this]() { return !m_running; });
+		m_quit = true;
+	}
+	m_kick.notify_all();
+	m_thread.join();
+}
+
+/**
+	@brief	̃pPbgn߂
+	@note	󂯎ĂȂpPbgƂ͉Ȃ(Ăr̃pPbg͏㏑Ȃ)
+*/
+void FramePipeline::Kick(Job job)
+{
+	{
+		std::lock_guard<std::mutex> lock(m_mutex);
+		if (m_pending)
+			return;
+
+		m_job     = std::move(job);
+		m_pending = true;
+		m_running = true;
+	}
+	m_kick.notify_one();
+}
+
+bool FramePipeline::IsPending() const
+{
+	std::lock_guard<std::mutex> lock(m_mutex);
+	return m_pending;
+}
+
+/**
+	@brief	IpPbg󂯎
+	@note	҂ԂV~[Vƕ`̏dȂ肫Ȃ
+*/
+FramePacket& FramePipeline::Wait()
+{
+	const auto start = std::chrono::steady_clock::now();
+
+	std::unique_lock<std::mutex> lock(m_mutex);
+	m_done.wait(lock, [this]() { return !m_running; });
+	m_statistics.waitMs += std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - start).count();
+
+	FramePacket& packet = *m_packets[m_next];
+	m_next    = 1 - m_next;
+	m_pending = false;
+	++m_statistics.frames;
+
+	if (m_error) {
+		auto error = m_error;
+		m_error = nullptr;
+		std::rethrow_exception(error);
+	}
+	return packet;
+}
+
+void FramePipeline::Finish()
+{
+	std::unique_lock<std::mutex> lock(m_mutex);
+	m_done.wait(lock, [this]() { return !m_running; });
+}
+
+void FramePipeline::AddRenderTime(double ms)
+{
+	std::lock_guard<std::mutex> lock(m_mutex);
+	m_statistics.renderMs += ms;
+}
+
+FramePipeline::Statistics FramePipeline::GetStatistics() const
+{
+	std::lock_guard<std::mutex> lock(m_mutex);
+	return m_statistics;
+}
+
+void FramePipeline::ThreadMain()
+{
+	for (;;) {
+		Job job;
+		FramePacket* packet;
+		{
+			std::unique_lock<std::mutex> lock(m_mutex);
+			m_kick.wait(lock, [this]() { return m_quit || m_running; });
+			if (m_quit)
+				return;
+			job    = std::move(m_job);
+			packet = m_packets[m_next].get();
+		}
+
+		//ĂԂ̓CXbh̃pPbgɐGȂ(WaitŎ󂯎܂)
+		const auto start = std::chrono::steady_clock::now();
+		std::exception_ptr error;
+		try {
+			packet->Clear();
+			packet->frame = ++m_frame;
+			job(*packet);
+		}
+		catch (...) {
+			error = std::current_exception();
+		}
+		const double ms = std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - start).count();
+
+		{
+			std::lock_guard<std::mutex> lock(m_mutex);
+			m_statistics.simulateMs += ms;
+			m_error   = error;
+			m_running = false;
+		}
+		m_done.notify_all();
+	}
+}
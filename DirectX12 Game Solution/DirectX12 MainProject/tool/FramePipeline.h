@@ -0,0 +1,84 @@
+/**
+ * @file FramePipeline.h
+ * @brief V[Update(̃t[)ƃR}h̋L^(̃t[)d˂
+ * @author hoshi hirofumi
+ * @date 2026/10/19
+ * @note V~[ṼXbhFramePacketACXbh1Õt[̃pPbg`
+ *       pPbg2(Ăƕ`Ă)Ȃ̂ŁAx1t[܂
+ */
+
+#pragma once
+
+/*
+-------------------------------------------------------------------------------------
+	CN[h
+-------------------------------------------------------------------------------------
+*/
+#include <condition_variable>
+#include <cstdint>
+#include <exception>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <thread>
+
+struct FramePacket;
+
+/*
+-------------------------------------------------------------------------------------
+	FramePipelineNX@錾
+-------------------------------------------------------------------------------------
+*/
+class FramePipeline {
+public:
+	//! V~[ṼXbhŎs(Updatei߂ăpPbg)
+	typedef std::function<void(FramePacket&)> Job;
+
+	//! iKƂCPU(~b̍vAoverlap = simulateMs - waitMs)
+	struct Statistics {
+		uint64_t frames;
+		double   simulateMs;	//V~[ṼXbh
+		double   waitMs;		//CXbhV~[V҂
+		double   renderMs;		//CXbh̃R}h̋L^Present
+	};
+
+	FramePipeline();
+	virtual ~FramePipeline();
+
+	FramePipeline(FramePipeline&&) = delete;
+	FramePipeline& operator= (FramePipeline&&) = delete;
+
+	FramePipeline(FramePipeline const&) = delete;
+	FramePipeline& operator= (FramePipeline const&) = delete;
+
+	//̃pPbgn߂(ÕpPbgWaitŎ󂯎ĂĂ)
+	void Kick(Job job);
+	//KickĂ܂󂯎ĂȂpPbg邩
+	bool IsPending() const;
+	//I܂ő҂Ď󂯎(Kick܂ŗLAJob̗O͂œ)
+	FramePacket& Wait();
+	//I܂ő҂(pPbg͎󂯎炸ɎcAfoCXXgEIOɌĂ)
+	void Finish();
+
+	void AddRenderTime(double ms);
+	Statistics GetStatistics() const;
+
+private:
+	void ThreadMain();
+
+	std::unique_ptr<FramePacket> m_packets[2];
+	unsigned int                 m_next;		//ɏpPbg
+	uint64_t                     m_frame;
+
+	Job                m_job;
+	bool               m_pending;		//KickĂ܂󂯎ĂȂ
+	bool               m_running;		//Ăr
+	bool               m_quit;
+	std::exception_ptr m_error;
+	Statistics         m_statistics;
+
+	mutable std::mutex      m_mutex;
+	std::condition_variable m_kick;
+	std::condition_variable m_done;
+	std::thread             m_thread;	//Ōɏ
+};
@@ -0,0 +1,122 @@
+/**
+ * @file GpuTimeline.cpp
+ * @brief GPŨ^CX^v̋Ԃ̊Ǘ(NG̊蓖āAt[x̓ǂݖ߂ACPU̎ւ̊Z)
+ * @author hoshi hirofumi
+ * @date 2026/10/19
+ */
+
+#include "GpuTimeline.h"
+
+#include <algorithm>
+
+GpuTimeline::GpuTimeline(unsigned int frameCount, uint32_t zonesPerFrame)
+	: m_frameCount(std::max(frameCount, 1u)), m_zonesPerFrame(std::max(zonesPerFrame, 1u)),
+	  m_frames(new Frame[std::max(frameCount, 1u)]), m_current(0), m_open(false), m_statistics{}
+{
+	for (unsigned int i = 0; i < m_frameCount; ++i) {
+		m_frames[i].zones.reset(new Zone[m_zonesPerFrame]);
+		m_frames[i].allocated = 0;
+		m_frames[i].recorded  = 0;
+	}
+}
+
+void GpuTimeline::BeginFrame(unsigned int frame)
+{
+	m_current = frame % m_frameCount;
+	m_open    = true;
+
+	auto& current = m_frames[m_current];
+	current.allocated.store(0, std::memory_order_relaxed);
+	current.recorded = 0;
+}
+
+/**
+	@note	ԍ𑫂Ȃ̂ŁAɋL^Ă`悩炻̂܂܌Ăׂ
+*/
+uint32_t GpuTimeline::BeginZone(const char* name)
+{
+	if (!m_open)
+		return INVALID_QUERY;
+
+	auto& current = m_frames[m_current];
+	const uint32_t index = current.allocated.fetch_add(1, std::memory_order_relaxed);
+	if (index >= m_zonesPerFrame)
+		return INVALID_QUERY;
+
+	auto& zone = current.zones[index];
+	zone.name = name;
+	zone.ended.store(false, std::memory_order_relaxed);
+	return (m_current * m_zonesPerFrame + index) * 2;
+}
+
+void GpuTimeline::EndZone(uint32_t query)
+{
+	if (query == INVALID_QUERY)
+		return;
+
+	const uint32_t zone = query / 2;
+	m_frames[zone / m_zonesPerFrame].zones[zone % m_zonesPerFrame].ended.store(true, std::memory_order_release);
+}
+
+void GpuTimeline::Reset()
+{
+	for (unsigned int i = 0; i < m_frameCount; ++i) {
+		m_frames[i].allocated.store(0, std::memory_order_relaxed);
+		m_frames[i].recorded = 0;
+	}
+	m_open = false;
+}
+
+/**
+	@note	L^Xbh̏͏IĂ邱(̋L^Waiť)
+*/
+GpuTimeline::Range GpuTimeline::EndFrame()
+{
+	if (!m_open)
+		return Range{ 0, 0 };
+	m_open = false;
+
+	auto& current = m_frames[m_current];
+	const uint32_t allocated = current.allocated.load(std::memory_order_acquire);
+	current.recorded = std::min(allocated, m_zonesPerFrame);
+	m_statistics.overflowed += allocated - current.recorded;
+
+	return Range{ m_current * m_zonesPerFrame * 2, current.recorded * 2 };
+}
+
+/**
+	@note	EndȂԂ̓NGĂȂ̂Ŏ̂Ă
+*/
+size_t GpuTimeline::Resolve(unsigned int frame, const uint64_t* ticks, const Calibration& calibration, std::vector<Sample>& samples)
+{
+	auto& target = m_frames[frame % m_frameCount];
+	const uint32_t base = (frame % m_frameCount) * m_zonesPerFrame * 2;
+	const uint32_t count = target.recorded;
+	target.recorded = 0;
+	if (count == 0 || calibration.frequency == 0)
+		return 0;
+
+	size_t resolved = 0;
+	for (uint32_t i = 0; i < count; ++i) {
+		const auto& zone = target.zones[i];
+		const uint64_t begin = ticks[base + i * 2];
+		const uint64_t end   = ticks[base + i * 2 + 1];
+		if (!zone.ended.load(std::memory_order_acquire) || end < begin) {
+			++m_statistics.unfinished;
+			continue;
+		}
+		samples.push_back({ zone.name, ToCpuNs(begin, calibration), ToCpuNs(end, calibration) });
+		++resolved;
+	}
+
+	++m_statistics.frames;
+	m_statistics.zones += resolved;
+	return resolved;
+}
+
+uint64_t GpuTimeline::ToCpuNs(uint64_t ticks, const Calibration& calibration)
+{
+	//ǂݖ߂Ԃ͊rOȂ̂ō͕ɂȂ
+	const double delta = static_cast<double>(static_cast<int64_t>(ticks - calibration.gpuTicks));
+	return calibration.cpuNs + static_cast<int64_t>(delta * 1e9 / static_cast<double>(calibration.frequency));
+}
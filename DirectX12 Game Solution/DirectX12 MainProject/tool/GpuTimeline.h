@@ -0,0 +1,113 @@
+/**
+ * @file GpuTimeline.h
+ * @brief GPŨ^CX^v̋Ԃ̊Ǘ(NG̊蓖āAt[x̓ǂݖ߂ACPU̎ւ̊Z)
+ * @author hoshi hirofumi
+ * @date 2026/10/19
+ * @note NG̔ԍƃeBbN̂D3D12ɂ͈ˑȂ(GpuTimerNGq[vƓǂݖ߂obt@[)
+ *       t[̘g̓obNobt@[̐AgĂƂ(GPUgI)ɑǑʂǂ
+ */
+
+#pragma once
+
+/*
+-------------------------------------------------------------------------------------
+	CN[h
+-------------------------------------------------------------------------------------
+*/
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <vector>
+
+/*
+-------------------------------------------------------------------------------------
+	GpuTimelineNX@錾
+-------------------------------------------------------------------------------------
+*/
+class GpuTimeline {
+public:
+	//! gtŌvȂ
+	static constexpr uint32_t INVALID_QUERY = UINT32_MAX;
+
+	//! GPŨeBbNCPU̎(Profiler::Now̃imb)̑Ή
+	struct Calibration {
+		uint64_t gpuTicks;
+		uint64_t frequency;	//GPŨeBbN/b
+		uint64_t cpuNs;
+	};
+
+	//! ResolveQueryData͈(NG̔ԍAǂݖ߂obt@[łʒuɒu)
+	struct Range {
+		uint32_t first;
+		uint32_t count;
+	};
+
+	//! ǂݖ߂(CPŨimbɊZς)
+	struct Sample {
+		const char* name;
+		uint64_t    start;
+		uint64_t    end;
+	};
+
+	struct Statistics {
+		uint64_t frames;	//ǂݖ߂t[
+		uint64_t zones;		//ǂݖ߂
+		uint64_t overflowed;	//gtŌvȂ
+		uint64_t unfinished;	//EndȂEt]Ă
+	};
+
+	//frameCount̓obNobt@[̐AzonesPerFrame1t[ŌvԂ̐
+	GpuTimeline(unsigned int frameCount, uint32_t zonesPerFrame);
+	virtual ~GpuTimeline() {}
+
+	GpuTimeline(GpuTimeline&&) = delete;
+	GpuTimeline& operator= (GpuTimeline&&) = delete;
+
+	GpuTimeline(GpuTimeline const&) = delete;
+	GpuTimeline& operator= (GpuTimeline const&) = delete;
+
+	//NGq[vEǂݖ߂obt@[̑傫(NG̐)
+	uint32_t GetQueryCount() const { return m_frameCount * m_zonesPerFrame * 2; }
+
+	//frame̘gJ(̘g̑ǑʂResolveœǂł)
+	void BeginFrame(unsigned int frame);
+	//Ԃ̎n܂̃NGԍ(ǂ̃XbhłAI+1)@tȂINVALID_QUERY
+	uint32_t BeginZone(const char* name);
+	//Ԃ̏I(BeginZone̖߂ln)
+	void EndZone(uint32_t query);
+	//gāAResolveQueryData͈͂Ԃ(ԂȂcount0)
+	Range EndFrame();
+
+	//frame̘g̑ǑʂCPU̎ɊZsamplesɑ(ticks͓ǂݖ߂obt@[̐擪AGPUgIĂ)
+	size_t Resolve(unsigned int frame, const uint64_t* ticks, const Calibration& calibration, std::vector<Sample>& samples);
+
+	//ǂݖ߂ĂȂʂŜĂ(foCX̏œǂݖ߂obt@[蒼Ƃ)
+	void Reset();
+
+	//eBbNCPU̎ɊZ(calibrationÕeBbNł悢)
+	static uint64_t ToCpuNs(uint64_t ticks, const Calibration& calibration);
+
+	bool IsFrameOpen() const { return m_open; }
+	Statistics GetStatistics() const { return m_statistics; }
+
+private:
+	struct Zone {
+		const char*       name;
+		std::atomic<bool> ended;
+	};
+	struct Frame {
+		std::unique_ptr<Zone[]> zones;
+		std::atomic<uint32_t>   allocated;	//BeginZoneŊ蓖Ă(g𒴂邱Ƃ)
+		uint32_t                recorded;	//EndFrameŕƂ̐(ǂݖ߂)
+	};
+
+	unsigned int m_frameCount;
+	uint32_t     m_zonesPerFrame;
+
+	std::unique_ptr<Frame[]> m_frames;
+	unsigned int             m_current;
+	bool                     m_open;
+
+	Statistics m_statistics;
+};
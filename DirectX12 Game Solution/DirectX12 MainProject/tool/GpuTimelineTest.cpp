@@ -0,0 +1,210 @@
+/**
+ * @file GpuTimelineTest.cpp
+ * @brief GpuTimeline̊mF(R}hCAQ[{̂̃vWFNgɂ͊܂߂Ȃ)
+ * @author hoshi hirofumi
+ * @date 2026/10/19
+ * @note NG̊蓖āEg̈Et[x̓ǂݖ߂EeBbN̊ZfoCXȂŊm߂
+ */
+
+#include "GpuTimeline.h"
+#include "TestCheck.h"
+
+#include <cstdio>
+#include <cstring>
+#include <set>
+#include <thread>
+#include <vector>
+
+namespace {
+	using TestCheck::Check;
+
+	//! ǂݖ߂obt@[̑(ResolveQueryData͈͂ɃeBbN)
+	struct FakeGpu {
+		std::vector<uint64_t> ticks;
+		uint64_t              clock = 5000;
+
+		explicit FakeGpu(const GpuTimeline& timeline) : ticks(timeline.GetQueryCount(), 0) {}
+
+		//ԂƂ10eBbNĎn܂ƏI
+		void Execute(const GpuTimeline::Range& range)
+		{
+			for (uint32_t i = 0; i < range.count; i += 2) {
+				ticks[range.first + i]     = clock;
+				ticks[range.first + i + 1] = clock + 10;
+				clock += 20;
+			}
+		}
+	};
+
+	const GpuTimeline::Calibration IDENTITY = { 0, 1000000000, 0 };
+
+	//Ԃ̔ԍ͘gƂɏdȂ炸ANGq[vɎ܂
+	void Allocation()
+	{
+		GpuTimeline timeline(3, 4);
+		Check(timeline.GetQueryCount() == 24, "query count covers every frame's zones twice");
+		Check(timeline.BeginZone("closed") == GpuTimeline::INVALID_QUERY, "no zones outside a frame");
+
+		std::set<uint32_t> queries;
+		bool inRange = true;
+		for (unsigned int frame = 0; frame < 3; ++frame) {
+			timeline.BeginFrame(frame);
+			for (int i = 0; i < 4; ++i) {
+				const uint32_t query = timeline.BeginZone("zone");
+				inRange &= query != GpuTimeline::INVALID_QUERY && query + 1 < timeline.GetQueryCount() && query % 2 == 0;
+				queries.insert(query);
+				timeline.EndZone(query);
+			}
+			const auto range = timeline.EndFrame();
+			inRange &= range.first == frame * 8 && range.count == 8;
+		}
+		Check(inRange, "queries are even and inside each frame's range");
+		Check(queries.size() == 12, "queries are unique across frames in flight");
+		Check(!timeline.IsFrameOpen() && timeline.EndFrame().count == 0, "ending a closed frame records nothing");
+	}
+
+	//g𒴂ԂINVALID_QUERYŁAEndZoneɓnĂȂ
+	void Overflow()
+	{
+		GpuTimeline timeline(2, 3);
+		timeline.BeginFrame(0);
+		uint32_t queries[5];
+		for (auto& query : queries)
+			query = timeline.BeginZone("zone");
+		for (auto query : queries)
+			timeline.EndZone(query);
+		Check(queries[3] == GpuTimeline::INVALID_QUERY && queries[4] == GpuTimeline::INVALID_QUERY, "zones past the slots are invalid");
+		const auto range = timeline.EndFrame();
+		Check(range.count == 6, "only the slots are resolved");
+		Check(timeline.GetStatistics().overflowed == 2, "overflowed zones are counted");
+	}
+
+	//ʂ͓gĂƂɓǂ(܂ł͎̃t[ʂ̘gg)
+	void LatencyRing()
+	{
+		GpuTimeline timeline(3, 4);
+		FakeGpu gpu(timeline);
+		std::vector<GpuTimeline::Sample> samples;
+		static const char* const names[] = { "frame0", "frame1", "frame2", "frame3", "frame4", "frame5" };
+
+		bool delayed = true;
+		for (unsigned int frame = 0; frame < 6; ++frame) {
+			//̘g̑Ǒ(frame - 3)ǂłg
+			samples.clear();
+			const size_t resolved = timeline.Resolve(frame, gpu.ticks.data(), IDENTITY, samples);
+			if (frame < 3)
+				delayed &= resolved == 0;
+			else
+				delayed &= resolved == 2 && samples[0].name == names[frame - 3] && samples[1].name == names[frame - 3];
+
+			timeline.BeginFrame(frame);
+			const uint32_t outer = timeline.BeginZone(names[frame]);
+			const uint32_t inner = timeline.BeginZone(names[frame]);
+			timeline.EndZone(inner);
+			timeline.EndZone(outer);
+			gpu.Execute(timeline.EndFrame());
+		}
+		Check(delayed, "each frame is resolved when its slot comes around again");
+
+		samples.clear();
+		Check(timeline.Resolve(5, gpu.ticks.data(), IDENTITY, samples) == 2, "the last frame resolves");
+		Check(timeline.Resolve(5, gpu.ticks.data(), IDENTITY, samples) == 0, "a frame is resolved only once");
+		Check(samples.size() == 2 && samples[0].end - samples[0].start == 10, "samples carry the converted duration");
+
+		const auto statistics = timeline.GetStatistics();
+		Check(statistics.frames == 4 && statistics.zones == 8, "statistics count resolved frames and zones");
+	}
+
+	//EndȂԁEt]Ԃ͎̂Ă
+	void Unfinished()
+	{
+		GpuTimeline timeline(1, 4);
+		FakeGpu gpu(timeline);
+		timeline.BeginFrame(0);
+		const uint32_t done   = timeline.BeginZone("done");
+		timeline.BeginZone("forgotten");
+		const uint32_t broken = timeline.BeginZone("broken");
+		timeline.EndZone(done);
+		timeline.EndZone(broken);
+		gpu.Execute(timeline.EndFrame());
+		std::swap(gpu.ticks[broken], gpu.ticks[broken + 1]);
+
+		std::vector<GpuTimeline::Sample> samples;
+		Check(timeline.Resolve(0, gpu.ticks.data(), IDENTITY, samples) == 1 && strcmp(samples[0].name, "done") == 0, "only finished zones resolve");
+		Check(timeline.GetStatistics().unfinished == 2, "unfinished and reversed zones are counted");
+
+		//rłĂȂ(g0)Ƃ͓ǂ܂Ɏ̂Ă
+		timeline.BeginFrame(0);
+		timeline.EndZone(timeline.BeginZone("uncalibrated"));
+		timeline.EndFrame();
+		Check(timeline.Resolve(0, gpu.ticks.data(), GpuTimeline::Calibration{}, samples) == 0, "no calibration resolves nothing");
+
+		//Reseť͑ÕfoCXŋL^gǂ܂Ȃ
+		timeline.BeginFrame(0);
+		timeline.EndZone(timeline.BeginZone("lost"));
+		gpu.Execute(timeline.EndFrame());
+		timeline.BeginFrame(0);
+		timeline.BeginZone("open");
+		timeline.Reset();
+		samples.clear();
+		Check(!timeline.IsFrameOpen() && timeline.Resolve(0, gpu.ticks.data(), IDENTITY, samples) == 0, "reset drops recorded and open frames");
+		Check(timeline.BeginZone("closed") == GpuTimeline::INVALID_QUERY, "no zones after a reset until the next frame");
+	}
+
+	//ȓOǂ̃eBbNCPU̎ɊZł
+	void Conversion()
+	{
+		const GpuTimeline::Calibration calibration = { 1000000, 10000000, 5000000000ull };
+		Check(GpuTimeline::ToCpuNs(1000000, calibration) == 5000000000ull, "the calibration point maps to its CPU time");
+		Check(GpuTimeline::ToCpuNs(1010000, calibration) == 5001000000ull, "later ticks scale by the frequency");
+		Check(GpuTimeline::ToCpuNs(990000, calibration) == 4999000000ull, "earlier ticks convert backwards");
+
+		//24MHz(悭GPU̎g)1ԕĂ1usȓ
+		const GpuTimeline::Calibration gpu24 = { 100000000000ull, 24000000, 7200000000000ull };
+		const uint64_t hour = 3600ull * 24000000;
+		const uint64_t back = GpuTimeline::ToCpuNs(gpu24.gpuTicks - hour, gpu24);
+		Check(back + 1000 >= 3600000000000ull && back <= 3600000000000ull + 1000, "an hour before calibration stays within 1us");
+	}
+
+	//ɋL^Ă`悩瓯BeginZoneĂԍ͏dȂȂ
+	void Concurrent()
+	{
+		GpuTimeline timeline(2, 256);
+		bool unique = true;
+		for (unsigned int frame = 0; frame < 50; ++frame) {
+			timeline.BeginFrame(frame);
+			std::vector<uint32_t> queries(8 * 40);
+			std::vector<std::thread> threads;
+			for (int t = 0; t < 8; ++t)
+				threads.emplace_back([&, t]() {
+					for (int i = 0; i < 40; ++i) {
+						queries[t * 40 + i] = timeline.BeginZone("worker");
+						timeline.EndZone(queries[t * 40 + i]);
+					}
+				});
+			for (auto& thread : threads)
+				thread.join();
+			const auto range = timeline.EndFrame();
+
+			const std::set<uint32_t> distinct(queries.begin(), queries.end());
+			size_t invalid = 0;
+			for (auto query : queries)
+				invalid += query == GpuTimeline::INVALID_QUERY;
+			unique &= invalid == 320 - 256 && distinct.size() == 257 && range.count == 512;
+		}
+		Check(unique, "concurrent zones get distinct queries and overflow cleanly");
+		Check(timeline.GetStatistics().overflowed == 50 * 64, "concurrent overflow is counted");
+	}
+}
+
+int main()
+{
+	Allocation();
+	Overflow();
+	LatencyRing();
+	Unfinished();
+	Conversion();
+	Concurrent();
+
+	return TestCheck::Finish("GpuTimelineTest");
+}
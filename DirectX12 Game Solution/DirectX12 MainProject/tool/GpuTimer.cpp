@@ -0,0 +1,146 @@
+/**
+ * @file GpuTimer.cpp
+ * @brief GPŨ^CX^vŕ`̂܂Ƃ܂(pXEf)vAProfileŕuGPUv̗ɍڂ
+ * @author hoshi hirofumi
+ * @date 2026/10/19
+ */
+
+#include "GpuTimer.h"
+
+namespace {
+	//! GetōCX^X
+	GpuTimer* g_instance = nullptr;
+}
+
+GpuTimer::GpuTimer(ID3D12Device* device, ID3D12CommandQueue* queue, UINT frameCount)
+	: m_timeline(frameCount, ZONES_PER_FRAME)
+{
+	CreateDeviceObjects(device, queue);
+
+	QueryPerformanceFrequency(&m_cpuFrequency);
+	m_track = Profiler::Get().CreateTrack("GPU");
+	m_samples.reserve(ZONES_PER_FRAME);
+	g_instance = this;
+}
+
+GpuTimer::~GpuTimer()
+{
+	g_instance = nullptr;
+}
+
+void GpuTimer::CreateDeviceObjects(ID3D12Device* device, ID3D12CommandQueue* queue)
+{
+	m_queue = queue;
+
+	D3D12_QUERY_HEAP_DESC heapDesc = {};
+	heapDesc.Type  = D3D12_QUERY_HEAP_TYPE_TIMESTAMP;
+	heapDesc.Count = m_timeline.GetQueryCount();
+	DX::ThrowIfFailed(device->CreateQueryHeap(&heapDesc, IID_PPV_ARGS(m_heap.GetAddressOf())));
+	m_heap->SetName(L"GpuTimer queries");
+
+	const CD3DX12_HEAP_PROPERTIES heapProperties(D3D12_HEAP_TYPE_READBACK);
+	const auto desc = CD3DX12_RESOURCE_DESC::Buffer(sizeof(uint64_t) * heapDesc.Count);
+	DX::ThrowIfFailed(device->CreateCommittedResource(
+		&heapProperties,
+		D3D12_HEAP_FLAG_NONE,
+		&desc,
+		D3D12_RESOURCE_STATE_COPY_DEST,
+		nullptr,
+		IID_PPV_ARGS(m_readback.GetAddressOf())
+	));
+	m_readback->SetName(L"GpuTimer readback");
+}
+
+/**
+	@brief	foCX̏(L^rEǂݖ߂O̘ĝ͎Ă)
+*/
+void GpuTimer::OnDeviceLost()
+{
+	if (g_instance == nullptr)
+		return;
+
+	g_instance->m_timeline.Reset();
+	g_instance->m_readback.Reset();
+	g_instance->m_heap.Reset();
+	g_instance->m_queue.Reset();
+}
+
+void GpuTimer::OnDeviceRestored(ID3D12Device* device, ID3D12CommandQueue* queue)
+{
+	if (g_instance == nullptr)
+		return;
+
+	g_instance->CreateDeviceObjects(device, queue);
+}
+
+GpuTimer& GpuTimer::Get()
+{
+	static GpuTimer instance(DXTK->Device, DXTK->CommandQueue, DXTK->BackBufferCount);
+	return instance;
+}
+
+/**
+	@note	QueryPerformanceCounter̊Zsteady_clock(Profiler::Now)Ɠɂ
+*/
+GpuTimeline::Calibration GpuTimer::Calibrate() const
+{
+	GpuTimeline::Calibration calibration = {};
+	UINT64 cpuTicks = 0;
+	if (FAILED(m_queue->GetTimestampFrequency(&calibration.frequency)) ||
+		FAILED(m_queue->GetClockCalibration(&calibration.gpuTicks, &cpuTicks))) {
+		calibration.frequency = 0;
+		return calibration;
+	}
+
+	const uint64_t frequency = static_cast<uint64_t>(m_cpuFrequency.QuadPart);
+	calibration.cpuNs = (cpuTicks / frequency) * 1000000000ULL + (cpuTicks % frequency) * 1000000000ULL / frequency;
+	return calibration;
+}
+
+void GpuTimer::BeginFrame(UINT frameIndex)
+{
+	//̃obNobt@[̑O̕(tFX҂Ȃ̂ŏIĂ)
+	const SIZE_T size = sizeof(uint64_t) * m_timeline.GetQueryCount();
+	const CD3DX12_RANGE readRange(0, size);
+	void* ticks = nullptr;
+	if (SUCCEEDED(m_readback->Map(0, &readRange, &ticks))) {
+		m_samples.clear();
+		m_timeline.Resolve(frameIndex, static_cast<const uint64_t*>(ticks), Calibrate(), m_samples);
+
+		const CD3DX12_RANGE writeRange(0, 0);
+		m_readback->Unmap(0, &writeRange);
+
+		auto& profiler = Profiler::Get();
+		for (const auto& sample : m_samples)
+			profiler.Record(m_track, sample.name, sample.start, sample.end);
+	}
+
+	m_timeline.BeginFrame(frameIndex);
+}
+
+uint32_t GpuTimer::Begin(ID3D12GraphicsCommandList* commandList, const char* name)
+{
+	const uint32_t query = m_timeline.BeginZone(name);
+	if (query != GpuTimeline::INVALID_QUERY)
+		commandList->EndQuery(m_heap.Get(), D3D12_QUERY_TYPE_TIMESTAMP, query);
+	return query;
+}
+
+void GpuTimer::End(ID3D12GraphicsCommandList* commandList, uint32_t query)
+{
+	if (query == GpuTimeline::INVALID_QUERY)
+		return;
+
+	commandList->EndQuery(m_heap.Get(), D3D12_QUERY_TYPE_TIMESTAMP, query + 1);
+	m_timeline.EndZone(query);
+}
+
+void GpuTimer::EndFrame(ID3D12GraphicsCommandList* commandList)
+{
+	const auto range = m_timeline.EndFrame();
+	if (range.count == 0)
+		return;
+
+	commandList->ResolveQueryData(m_heap.Get(), D3D12_QUERY_TYPE_TIMESTAMP, range.first, range.count,
+		m_readback.Get(), sizeof(uint64_t) * range.first);
+}
@@ -0,0 +1,103 @@
+/**
+ * @file GpuTimer.h
+ * @brief GPŨ^CX^vŕ`̂܂Ƃ܂(pXEf)vAProfileŕuGPUv̗ɍڂ
+ * @author hoshi hirofumi
+ * @date 2026/10/19
+ * @note ʂ̓obNobt@[̐xēǂ(obNobt@[̃tFX҂Ȃ̂ŁAǂݖ߂Ŏ~܂Ȃ)
+ *       NG̊蓖ĂƊZGpuTimelines
+ */
+
+#pragma once
+
+/*
+-------------------------------------------------------------------------------------
+	CN[h
+-------------------------------------------------------------------------------------
+*/
+#include "Base/pch.h"
+#include "Base/dxtk.h"
+#include "GpuTimeline.h"
+#include "Profiler.h"
+
+/*
+-------------------------------------------------------------------------------------
+	using
+-------------------------------------------------------------------------------------
+*/
+using Microsoft::WRL::ComPtr;
+
+/*
+-------------------------------------------------------------------------------------
+	GpuTimerNX@錾
+-------------------------------------------------------------------------------------
+*/
+class GpuTimer {
+public:
+	//! 1t[ŌvԂ̐(͌vȂ)
+	static constexpr uint32_t ZONES_PER_FRAME = 256;
+
+	GpuTimer(ID3D12Device* device, ID3D12CommandQueue* queue, UINT frameCount);
+	virtual ~GpuTimer();
+
+	GpuTimer(GpuTimer&&) = delete;
+	GpuTimer& operator= (GpuTimer&&) = delete;
+
+	GpuTimer(GpuTimer const&) = delete;
+	GpuTimer& operator= (GpuTimer const&) = delete;
+
+	//frameIndex̃obNobt@[̑ǑʂProfilerɑA̘gJ(GPŨobNobt@[gIĂ)
+	void BeginFrame(UINT frameIndex);
+	//Ԃ̎n܂(ǂ̃XbhAǂ̃R}hXgɋL^Ă悢)
+	uint32_t Begin(ID3D12GraphicsCommandList* commandList, const char* name);
+	void End(ID3D12GraphicsCommandList* commandList, uint32_t query);
+	//gāAǂݖ߂obt@[։(̃t[ōŌɑM郊Xg)
+	void EndFrame(ID3D12GraphicsCommandList* commandList);
+
+	GpuTimeline::Statistics GetStatistics() const { return m_timeline.GetStatistics(); }
+
+	//foCX̏ƍč쐬(GameBase::OnDeviceLostAGet̑OȂ牽Ȃ)
+	static void OnDeviceLost();
+	static void OnDeviceRestored(ID3D12Device* device, ID3D12CommandQueue* queue);
+
+	//VOg
+	static GpuTimer& Get();
+
+private:
+	void CreateDeviceObjects(ID3D12Device* device, ID3D12CommandQueue* queue);
+	GpuTimeline::Calibration Calibrate() const;
+
+	ComPtr<ID3D12CommandQueue> m_queue;
+	ComPtr<ID3D12QueryHeap>    m_heap;
+	ComPtr<ID3D12Resource>     m_readback;	//NGƓ
+
+	GpuTimeline                      m_timeline;
+	std::vector<GpuTimeline::Sample> m_samples;
+	Profiler::Track                  m_track;
+	LARGE_INTEGER                    m_cpuFrequency;
+};
+
+/*
+-------------------------------------------------------------------------------------
+	GpuZone@XR[v̋(GPU_ZONEg)
+-------------------------------------------------------------------------------------
+*/
+class GpuZone {
+public:
+	//name͕񃊃eProfiler::Intern
+	GpuZone(ID3D12GraphicsCommandList* commandList, const char* name)
+		: m_commandList(commandList), m_query(GpuTimer::Get().Begin(commandList, name)) {}
+	~GpuZone() { GpuTimer::Get().End(m_commandList, m_query); }
+
+	GpuZone(GpuZone const&) = delete;
+	GpuZone& operator= (GpuZone const&) = delete;
+
+private:
+	ID3D12GraphicsCommandList* m_commandList;
+	uint32_t                   m_query;
+};
+
+#if DXTK_PROFILE
+	#define GPU_ZONE(commandList, name) GpuZone PROFILE_CONCAT(gpuZone, __LINE__)(commandList, name)
+#else
+	#define GPU_ZONE(commandList, name) ((void)0)
+#endif
@@ -0,0 +1,58 @@
+/**
+ * @file Hash.h
+ * @brief LbṼL[pnbV(FNV-1a 64bit)
+ * @author hoshi hirofumi
+ * @date 2026/10/19
+ */
+
+#pragma once
+
+/*
+-------------------------------------------------------------------------------------
+	CN[h
+-------------------------------------------------------------------------------------
+*/
+#include <cstring>
+#include <type_traits>
+
+/*
+-------------------------------------------------------------------------------------
+	HasherNX@錾
+-------------------------------------------------------------------------------------
+*/
+class Hasher {
+public:
+	static constexpr unsigned long long OFFSET_BASIS = 0xcbf29ce484222325ull;
+	static constexpr unsigned long long PRIME        = 0x100000001b3ull;
+
+	Hasher() noexcept : m_hash(OFFSET_BASIS) {}
+
+	Hasher& Add(const void* data, size_t size) noexcept
+	{
+		auto bytes = static_cast<const unsigned char*>(data);
+		for (size_t i = 0; i < size; ++i) {
+			m_hash ^= bytes[i];
+			m_hash *= PRIME;
+		}
+		return *this;
+	}
+
+	//! I[0܂߂āA"ab"+"c""a"+"bc"ʂ
+	Hasher& Add(const char* text) noexcept
+	{
+		return text ? Add(text, strlen(text) + 1) : Add("", 1);
+	}
+
+	//! \̂̓pfBÔŁAlƗ񋓌^ړn
+	template<class T>
+	Hasher& Add(const T& value) noexcept
+	{
+		static_assert(std::is_arithmetic_v<T> || std::is_enum_v<T>, "hash struct members one by one");
+		return Add(&value, sizeof(value));
+	}
+
+	unsigned long long Value() const noexcept { return m_hash; }
+
+private:
+	unsigned long long m_hash;
+};
@@ -0,0 +1,887 @@
+/**
+ * @file ImageDecoder.cpp
+ * @brief 摜t@C̃fR[h(BMP/PNG/TGA/SPA/SPH  RGBA8̃~bv`F[)
+ * @author hoshi hirofumi
+ * @date 2026/10/19
+ */
+
+#include "ImageDecoder.h"
+#include "AssetFiles.h"
+
+#include <algorithm>
+#include <cstdlib>
+#include <cstring>
+
+namespace {
+	uint16_t ReadLE16(const uint8_t* p) { return static_cast<uint16_t>(p[0] | (p[1] << 8)); }
+	uint32_t ReadLE32(const uint8_t* p) { return p[0] | (p[1] << 8) | (p[2] << 16) | (static_cast<uint32_t>(p[3]) << 24); }
+	uint32_t ReadBE32(const uint8_t* p) { return (static_cast<uint32_t>(p[0]) << 24) | (p[1] << 16) | (p[2] << 8) | p[3]; }
+
+	//! ȕEŃg؂Ȃ߂̏(D3D12̃eNX`Ɠ)
+	constexpr uint32_t MAX_DIMENSION = 16384;
+
+	bool ValidSize(uint32_t width, uint32_t height)
+	{
+		return width > 0 && height > 0 && width <= MAX_DIMENSION && height <= MAX_DIMENSION;
+	}
+
+	void Resize(ImageLevel& level, uint32_t width, uint32_t height)
+	{
+		level.width  = width;
+		level.height = height;
+		level.pixels.assign(static_cast<size_t>(width) * height * 4, 0);
+	}
+
+	/*
+	---------------------------------------------------------------------------------
+		Inflate(PNGIDATp)
+	---------------------------------------------------------------------------------
+	*/
+	class BitReader {
+	public:
+		BitReader(const uint8_t* data, size_t size) : m_data(data), m_size(size), m_pos(0), m_bits(0), m_count(0), m_error(false) {}
+
+		void Fill()
+		{
+			while (m_count <= 24 && m_pos < m_size) {
+				m_bits |= static_cast<uint32_t>(m_data[m_pos++]) << m_count;
+				m_count += 8;
+			}
+		}
+
+		uint32_t Peek() const { return m_bits; }
+
+		void Consume(int n)
+		{
+			if (n > m_count) {
+				m_error = true;
+				n = m_count;
+			}
+			m_bits = n < 32 ? m_bits >> n : 0;
+			m_count -= n;
+		}
+
+		uint32_t Bits(int n)
+		{
+			if (n == 0)
+				return 0;
+			if (m_count < n)
+				Fill();
+			const uint32_t value = m_bits & ((1u << n) - 1);
+			Consume(n);
+			return value;
+		}
+
+		//i[ubN̓oCgEn܂
+		void AlignByte() { Consume(m_count & 7); }
+
+		bool Error() const { return m_error; }
+
+	private:
+		const uint8_t* m_data;
+		size_t         m_size;
+		size_t         m_pos;
+		uint32_t       m_bits;
+		int            m_count;
+		bool           m_error;
+	};
+
+	class Huffman {
+	public:
+		static constexpr int FAST_BITS = 9;
+		static constexpr int MAX_BITS  = 15;
+
+		//! ̔z񂩂琳Knt}
+		bool Build(const uint8_t* lengths, int n)
+		{
+			std::fill(std::begin(m_count), std::end(m_count), static_cast<uint16_t>(0));
+			std::fill(std::begin(m_fast), std::end(m_fast), static_cast<uint16_t>(0));
+			for (int i = 0; i < n; ++i)
+				++m_count[lengths[i]];
+			m_count[0] = 0;
+
+			int left = 1;
+			for (int len = 1; len <= MAX_BITS; ++len) {
+				left = (left << 1) - m_count[len];
+				if (left < 0)
+					return false;	//
+			}
+
+			uint16_t offset[MAX_BITS + 2] = {};
+			uint16_t nextCode[MAX_BITS + 2] = {};
+			int code = 0;
+			for (int len = 1; len <= MAX_BITS; ++len) {
+				offset[len + 1] = offset[len] + m_count[len];
+				code = (code + m_count[len - 1]) << 1;
+				nextCode[len] = static_cast<uint16_t>(code);
+			}
+
+			for (int symbol = 0; symbol < n; ++symbol) {
+				const int len = lengths[symbol];
+				if (len == 0)
+					continue;
+				m_symbol[offset[len]++] = static_cast<uint16_t>(symbol);
+
+				//Z̓rbg]lŒڈ悤ɂ
+				if (len <= FAST_BITS) {
+					int reversed = 0;
+					for (int bit = 0, c = nextCode[len]; bit < len; ++bit, c >>= 1)
+						reversed = (reversed << 1) | (c & 1);
+					for (int j = reversed; j < (1 << FAST_BITS); j += 1 << len)
+						m_fast[j] = static_cast<uint16_t>((len << 12) | symbol);
+				}
+				++nextCode[len];
+			}
+			return true;
+		}
+
+		int Decode(BitReader& reader) const
+		{
+			reader.Fill();
+			const uint32_t peek = reader.Peek();
+
+			const uint16_t entry = m_fast[peek & ((1u << FAST_BITS) - 1)];
+			if (entry) {
+				reader.Consume(entry >> 12);
+				return entry & 0xfff;
+			}
+
+			//1rbgH
+			int code = 0, first = 0, index = 0;
+			for (int len = 1; len <= MAX_BITS; ++len) {
+				code |= (peek >> (len - 1)) & 1;
+				const int count = m_count[len];
+				if (code - count < first) {
+					reader.Consume(len);
+					return m_symbol[index + (code - first)];
+				}
+				index += count;
+				first = (first + count) << 1;
+				code <<= 1;
+			}
+			return -1;
+		}
+
+	private:
+		uint16_t m_count[MAX_BITS + 1];
+		uint16_t m_symbol[320];
+		uint16_t m_fast[1 << FAST_BITS];
+	};
+
+	const uint16_t LENGTH_BASE[29]  = { 3,4,5,6,7,8,9,10,11,13,15,17,19,23,27,31,35,43,51,59,67,83,99,115,131,163,195,227,258 };
+	const uint8_t  LENGTH_EXTRA[29] = { 0,0,0,0,0,0,0,0,1,1,1,1,2,2,2,2,3,3,3,3,4,4,4,4,5,5,5,5,0 };
+	const uint16_t DIST_BASE[30]    = { 1,2,3,4,5,7,9,13,17,25,33,49,65,97,129,193,257,385,513,769,1025,1537,2049,3073,4097,6145,8193,12289,16385,24577 };
+	const uint8_t  DIST_EXTRA[30]   = { 0,0,0,0,1,1,2,2,3,3,4,4,5,5,6,6,7,7,8,8,9,9,10,10,11,11,12,12,13,13 };
+
+	//outlimit𒴂f[^͉Ă(IDAT狐ȊmۂȂ)
+	bool InflateBlock(BitReader& reader, const Huffman& literal, const Huffman& distance, std::vector<uint8_t>& out, size_t limit)
+	{
+		for (;;) {
+			const int symbol = literal.Decode(reader);
+			if (symbol < 0 || reader.Error())
+				return false;
+			if (symbol < 256) {
+				if (out.size() >= limit)
+					return false;
+				out.push_back(static_cast<uint8_t>(symbol));
+				continue;
+			}
+			if (symbol == 256)
+				return true;
+
+			const int lengthCode = symbol - 257;
+			if (lengthCode >= 29)
+				return false;
+			const size_t length = LENGTH_BASE[lengthCode] + reader.Bits(LENGTH_EXTRA[lengthCode]);
+
+			const int distCode = distance.Decode(reader);
+			if (distCode < 0 || distCode >= 30)
+				return false;
+			const size_t dist = DIST_BASE[distCode] + reader.Bits(DIST_EXTRA[distCode]);
+			if (dist > out.size() || length > limit - out.size() || reader.Error())
+				return false;
+
+			//dȂRs[̂1oCg
+			const size_t from = out.size() - dist;
+			for (size_t i = 0; i < length; ++i)
+				out.push_back(out[from + i]);
+		}
+	}
+
+	bool Inflate(const uint8_t* data, size_t size, std::vector<uint8_t>& out, size_t limit)
+	{
+		//zlibwb_[(k8AvZbgȂ)
+		if (size < 2 || (data[0] & 0x0f) != 8 || ((data[0] << 8) | data[1]) % 31 != 0 || (data[1] & 0x20))
+			return false;
+
+		BitReader reader(data + 2, size - 2);
+		Huffman literal, distance;
+
+		bool last = false;
+		while (!last) {
+			last = reader.Bits(1) != 0;
+			const uint32_t type = reader.Bits(2);
+
+			if (type == 0) {
+				//k
+				reader.AlignByte();
+				const uint32_t length  = reader.Bits(16);
+				const uint32_t nlength = reader.Bits(16);
+				if ((length ^ 0xffff) != nlength || length > limit - out.size())
+					return false;
+				for (uint32_t i = 0; i < length; ++i)
+					out.push_back(static_cast<uint8_t>(reader.Bits(8)));
+			}
+			else if (type == 1) {
+				//Œnt}
+				uint8_t lengths[288 + 30];
+				std::fill(lengths,       lengths + 144, static_cast<uint8_t>(8));
+				std::fill(lengths + 144, lengths + 256, static_cast<uint8_t>(9));
+				std::fill(lengths + 256, lengths + 280, static_cast<uint8_t>(7));
+				std::fill(lengths + 280, lengths + 288, static_cast<uint8_t>(8));
+				std::fill(lengths + 288, lengths + 318, static_cast<uint8_t>(5));
+				literal.Build(lengths, 288);
+				distance.Build(lengths + 288, 30);
+				if (!InflateBlock(reader, literal, distance, out, limit))
+					return false;
+			}
+			else if (type == 2) {
+				//Int}
+				static const uint8_t ORDER[19] = { 16,17,18,0,8,7,9,6,10,5,11,4,12,3,13,2,14,1,15 };
+				const int numLiteral  = static_cast<int>(reader.Bits(5)) + 257;
+				const int numDistance = static_cast<int>(reader.Bits(5)) + 1;
+				const int numCode     = static_cast<int>(reader.Bits(4)) + 4;
+				if (numLiteral > 286 || numDistance > 30)
+					return false;
+
+				uint8_t codeLengths[19] = {};
+				for (int i = 0; i < numCode; ++i)
+					codeLengths[ORDER[i]] = static_cast<uint8_t>(reader.Bits(3));
+				Huffman code;
+				if (!code.Build(codeLengths, 19))
+					return false;
+
+				uint8_t lengths[286 + 30] = {};
+				int index = 0;
+				while (index < numLiteral + numDistance) {
+					const int symbol = code.Decode(reader);
+					if (symbol < 0 || reader.Error())
+						return false;
+					if (symbol < 16) {
+						lengths[index++] = static_cast<uint8_t>(symbol);
+						continue;
+					}
+
+					uint8_t value = 0;
+					int repeat = 0;
+					if (symbol == 16) {
+						if (index == 0)
+							return false;
+						value  = lengths[index - 1];
+						repeat = 3 + static_cast<int>(reader.Bits(2));
+					}
+					else if (symbol == 17) {
+						repeat = 3 + static_cast<int>(reader.Bits(3));
+					}
+					else {
+						repeat = 11 + static_cast<int>(reader.Bits(7));
+					}
+					if (index + repeat > numLiteral + numDistance)
+						return false;
+					while (repeat--)
+						lengths[index++] = value;
+				}
+
+				if (!literal.Build(lengths, numLiteral) || !distance.Build(lengths + numLiteral, numDistance))
+					return false;
+				if (!InflateBlock(reader, literal, distance, out, limit))
+					return false;
+			}
+			else {
+				return false;
+			}
+
+			if (reader.Error())
+				return false;
+		}
+		return true;
+	}
+
+	/*
+	---------------------------------------------------------------------------------
+		PNG⏕
+	---------------------------------------------------------------------------------
+	*/
+	uint8_t Paeth(int a, int b, int c)
+	{
+		const int p  = a + b - c;
+		const int pa = std::abs(p - a);
+		const int pb = std::abs(p - b);
+		const int pc = std::abs(p - c);
+		if (pa <= pb && pa <= pc)
+			return static_cast<uint8_t>(a);
+		return static_cast<uint8_t>(pb <= pc ? b : c);
+	}
+
+	//! s̒indexԖڂ̃Tv(rbg[x̂܂܂̒l)
+	uint32_t Sample(const uint8_t* row, uint32_t index, int depth)
+	{
+		switch (depth) {
+		case 8:  return row[index];
+		case 16: return (row[index * 2] << 8) | row[index * 2 + 1];
+		default: {
+			const uint32_t bit = index * depth;
+			const int shift = 8 - depth - static_cast<int>(bit & 7);
+			return (row[bit >> 3] >> shift) & ((1u << depth) - 1);
+		}
+		}
+	}
+
+	uint8_t ToByte(uint32_t value, int depth)
+	{
+		if (depth == 16)
+			return static_cast<uint8_t>(value >> 8);
+		if (depth == 8)
+			return static_cast<uint8_t>(value);
+		return static_cast<uint8_t>(value * 255 / ((1u << depth) - 1));
+	}
+
+	/*
+	---------------------------------------------------------------------------------
+		BMP⏕
+	---------------------------------------------------------------------------------
+	*/
+	struct BitMask {
+		uint32_t mask;
+		int      shift;
+		uint32_t max;
+
+		explicit BitMask(uint32_t m) : mask(m), shift(0), max(0)
+		{
+			if (mask == 0)
+				return;
+			while (!((mask >> shift) & 1))
+				++shift;
+			max = mask >> shift;
+		}
+
+		uint8_t Extract(uint32_t pixel, uint8_t fallback) const
+		{
+			if (max == 0)
+				return fallback;
+			return static_cast<uint8_t>(((pixel & mask) >> shift) * 255 / max);
+		}
+	};
+}
+
+/**
+	@brief	S~bv̍vTCY
+*/
+size_t DecodedImage::SizeInBytes() const
+{
+	size_t size = 0;
+	for (const auto& level : levels)
+		size += level.pixels.size();
+	return size;
+}
+
+/**
+	@brief	t@CfR[h
+	@param	path         t@CpX
+	@param	image        fR[h
+	@param	generateMips ~bv邩
+	@return 
+*/
+ImageDecoder::Result ImageDecoder::DecodeFile(const std::filesystem::path& path, DecodedImage& image, bool generateMips)
+{
+	//A[JCuEʂ̃t@CƂ}bv܂ܓǂ
+	const FileView file = AssetFiles::Get().Open(path);
+	if (!file)
+		return Result::NotFound;
+
+	return DecodeMemory(file.Data(), file.Size(), image, generateMips);
+}
+
+/**
+	@brief	̃t@CC[WfR[h
+*/
+ImageDecoder::Result ImageDecoder::DecodeMemory(const uint8_t* data, size_t size, DecodedImage& image, bool generateMips)
+{
+	image.levels.clear();
+	image.levels.resize(1);
+	auto& level = image.levels[0];
+
+	Result result;
+	if (size >= 8 && memcmp(data, "\x89PNG\r\n\x1a\n", 8) == 0)
+		result = DecodePng(data, size, level);
+	else if (size >= 2 && data[0] == 'B' && data[1] == 'M')
+		result = DecodeBmp(data, size, level);
+	else if (size >= 2 && data[0] == 0xff && data[1] == 0xd8)
+		result = Result::Unsupported;	//JPEG
+	else if (size >= 4 && memcmp(data, "DDS ", 4) == 0)
+		result = Result::Unsupported;
+	else
+		result = DecodeTga(data, size, level);	//TGAɂ͎ʎq
+
+	if (result != Result::Ok) {
+		image.levels.clear();
+		return result;
+	}
+
+	if (generateMips)
+		GenerateMips(image);
+	return Result::Ok;
+}
+
+/**
+	@brief	~bv`F[̐(2x2̕)
+*/
+void ImageDecoder::GenerateMips(DecodedImage& image)
+{
+	if (image.levels.empty())
+		return;
+	image.levels.resize(1);
+
+	while (image.levels.back().width > 1 || image.levels.back().height > 1) {
+		const auto& src = image.levels.back();
+		ImageLevel dst;
+		Resize(dst, std::max(1u, src.width / 2), std::max(1u, src.height / 2));
+
+		for (uint32_t y = 0; y < dst.height; ++y) {
+			const uint32_t y0 = std::min(y * 2,     src.height - 1);
+			const uint32_t y1 = std::min(y * 2 + 1, src.height - 1);
+			for (uint32_t x = 0; x < dst.width; ++x) {
+				const uint32_t x0 = std::min(x * 2,     src.width - 1);
+				const uint32_t x1 = std::min(x * 2 + 1, src.width - 1);
+
+				const uint8_t* p00 = &src.pixels[(static_cast<size_t>(y0) * src.width + x0) * 4];
+				const uint8_t* p01 = &src.pixels[(static_cast<size_t>(y0) * src.width + x1) * 4];
+				const uint8_t* p10 = &src.pixels[(static_cast<size_t>(y1) * src.width + x0) * 4];
+				const uint8_t* p11 = &src.pixels[(static_cast<size_t>(y1) * src.width + x1) * 4];
+				uint8_t* out = &dst.pixels[(static_cast<size_t>(y) * dst.width + x) * 4];
+				for (int c = 0; c < 4; ++c)
+					out[c] = static_cast<uint8_t>((p00[c] + p01[c] + p10[c] + p11[c] + 2) / 4);
+			}
+		}
+		image.levels.push_back(std::move(dst));
+	}
+}
+
+/**
+	@brief	BMP(k 1/4/8/16/24/32bitArbgtB[h)
+*/
+ImageDecoder::Result ImageDecoder::DecodeBmp(const uint8_t* data, size_t size, ImageLevel& level)
+{
+	if (size < 26)
+		return Result::Corrupt;
+
+	const uint32_t dataOffset = ReadLE32(data + 10);
+	const uint32_t headerSize = ReadLE32(data + 14);
+
+	int32_t  width, height;
+	uint32_t bitCount, compression = 0, colorsUsed = 0;
+	uint32_t paletteEntrySize = 4;
+	if (headerSize == 12) {
+		//OS/2`
+		width    = ReadLE16(data + 18);
+		height   = static_cast<int16_t>(ReadLE16(data + 20));
+		bitCount = ReadLE16(data + 24);
+		paletteEntrySize = 3;
+	}
+	else {
+		if (headerSize < 40 || size < 54)
+			return Result::Corrupt;
+		width       = static_cast<int32_t>(ReadLE32(data + 18));
+		height      = static_cast<int32_t>(ReadLE32(data + 22));
+		bitCount    = ReadLE16(data + 28);
+		compression = ReadLE32(data + 30);
+		colorsUsed  = ReadLE32(data + 46);
+	}
+
+	//BI_RGBBI_BITFIELDSȊO(RLEȂ)WICɔC
+	if (compression != 0 && compression != 3)
+		return Result::Unsupported;
+
+	const bool topDown = height < 0;
+	const uint32_t w = static_cast<uint32_t>(width);
+	const uint32_t h = static_cast<uint32_t>(topDown ? -height : height);
+	if (width <= 0 || !ValidSize(w, h))
+		return Result::Corrupt;
+
+	//rbgtB[h̃}XN(V3wb_[Ȃwb_[̒AV4ȍ~Ȃwb_[̓ʒu)
+	uint32_t masks[4] = {};
+	if (bitCount == 16)
+		masks[0] = 0x7c00, masks[1] = 0x03e0, masks[2] = 0x001f;
+	else
+		masks[0] = 0x00ff0000, masks[1] = 0x0000ff00, masks[2] = 0x000000ff;
+	if (compression == 3) {
+		if (size < 66)
+			return Result::Corrupt;
+		for (int i = 0; i < 3; ++i)
+			masks[i] = ReadLE32(data + 54 + i * 4);
+		if (headerSize >= 56)
+			masks[3] = ReadLE32(data + 66);
+	}
+	const BitMask red(masks[0]), green(masks[1]), blue(masks[2]), alpha(masks[3]);
+
+	//pbg
+	uint8_t palette[256][4] = {};
+	if (bitCount <= 8) {
+		const uint32_t maxColors = 1u << bitCount;
+		const uint32_t colors = (colorsUsed == 0 || colorsUsed > maxColors) ? maxColors : colorsUsed;
+		const size_t paletteOffset = 14 + headerSize;
+		if (paletteOffset + static_cast<size_t>(colors) * paletteEntrySize > size)
+			return Result::Corrupt;
+		for (uint32_t i = 0; i < colors; ++i) {
+			const uint8_t* entry = data + paletteOffset + i * paletteEntrySize;
+			palette[i][0] = entry[2];
+			palette[i][1] = entry[1];
+			palette[i][2] = entry[0];
+			palette[i][3] = 255;
+		}
+	}
+	else if (bitCount != 16 && bitCount != 24 && bitCount != 32) {
+		return Result::Unsupported;
+	}
+
+	const size_t stride = ((static_cast<size_t>(w) * bitCount + 31) / 32) * 4;
+	if (dataOffset > size || stride * h > size - dataOffset)
+		return Result::Corrupt;
+
+	Resize(level, w, h);
+	for (uint32_t y = 0; y < h; ++y) {
+		const uint8_t* row = data + dataOffset + stride * (topDown ? y : h - 1 - y);
+		uint8_t* out = &level.pixels[static_cast<size_t>(y) * w * 4];
+
+		for (uint32_t x = 0; x < w; ++x, out += 4) {
+			switch (bitCount) {
+			case 1:
+			case 4:
+			case 8: {
+				const uint32_t bit = x * bitCount;
+				const uint32_t index = (row[bit >> 3] >> (8 - bitCount - (bit & 7))) & ((1u << bitCount) - 1);
+				memcpy(out, palette[index], 4);
+				break;
+			}
+			case 24:
+				out[0] = row[x * 3 + 2];
+				out[1] = row[x * 3 + 1];
+				out[2] = row[x * 3 + 0];
+				out[3] = 255;
+				break;
+			default: {
+				//16/32bit(BI_RGB32bit̓At@AWICƓ)
+				const uint32_t pixel = bitCount == 16 ? ReadLE16(row + x * 2) : ReadLE32(row + x * 4);
+				out[0] = red.Extract(pixel, 0);
+				out[1] = green.Extract(pixel, 0);
+				out[2] = blue.Extract(pixel, 0);
+				out[3] = alpha.Extract(pixel, 255);
+				break;
+			}
+			}
+		}
+	}
+	return Result::Ok;
+}
+
+/**
+	@brief	TGA(J[}bv/tJ[/O[XP[ARLE)
+*/
+ImageDecoder::Result ImageDecoder::DecodeTga(const uint8_t* data, size_t size, ImageLevel& level)
+{
+	if (size < 18)
+		return Result::Unsupported;
+
+	const uint32_t idLength     = data[0];
+	const uint32_t colorMapType = data[1];
+	const uint32_t imageType    = data[2];
+	const uint32_t mapFirst     = ReadLE16(data + 3);
+	const uint32_t mapLength    = ReadLE16(data + 5);
+	const uint32_t mapDepth     = data[7];
+	const uint32_t width        = ReadLE16(data + 12);
+	const uint32_t height       = ReadLE16(data + 14);
+	const uint32_t pixelDepth   = data[16];
+	const uint32_t descriptor   = data[17];
+
+	const uint32_t baseType = imageType & 7;
+	const bool     rle      = (imageType & 8) != 0;
+	if ((imageType & ~0xbu) != 0 || baseType == 0 || baseType > 3 || colorMapType > 1)
+		return Result::Unsupported;
+	if (!ValidSize(width, height))
+		return Result::Corrupt;
+	if ((baseType == 1 && (pixelDepth != 8 || colorMapType != 1)) ||
+		(baseType == 2 && pixelDepth != 15 && pixelDepth != 16 && pixelDepth != 24 && pixelDepth != 32) ||
+		(baseType == 3 && pixelDepth != 8 && pixelDepth != 16))
+		return Result::Unsupported;
+
+	size_t offset = 18 + idLength;
+
+	auto colorOf = [](const uint8_t* p, uint32_t depth, uint8_t* out) {
+		switch (depth) {
+		case 15:
+		case 16: {
+			const uint32_t v = ReadLE16(p);
+			out[0] = static_cast<uint8_t>(((v >> 10) & 31) * 255 / 31);
+			out[1] = static_cast<uint8_t>(((v >> 5) & 31) * 255 / 31);
+			out[2] = static_cast<uint8_t>((v & 31) * 255 / 31);
+			out[3] = 255;
+			break;
+		}
+		case 24:
+			out[0] = p[2]; out[1] = p[1]; out[2] = p[0]; out[3] = 255;
+			break;
+		default:
+			out[0] = p[2]; out[1] = p[1]; out[2] = p[0]; out[3] = p[3];
+			break;
+		}
+	};
+
+	//J[}bv
+	std::vector<uint8_t> palette;
+	if (colorMapType == 1) {
+		const uint32_t entrySize = (mapDepth + 7) / 8;
+		if (entrySize < 2 || entrySize > 4 || offset + static_cast<size_t>(mapLength) * entrySize > size)
+			return Result::Corrupt;
+		palette.resize((static_cast<size_t>(mapFirst) + mapLength) * 4);
+		for (uint32_t i = 0; i < mapLength; ++i)
+			colorOf(data + offset + i * entrySize, mapDepth, &palette[(mapFirst + i) * 4]);
+		offset += static_cast<size_t>(mapLength) * entrySize;
+	}
+
+	const uint32_t bytesPerPixel = (pixelDepth + 7) / 8;
+	auto readPixel = [&](const uint8_t* p, uint8_t* out) {
+		switch (baseType) {
+		case 1: {
+			const size_t index = static_cast<size_t>(p[0]) * 4;
+			if (index + 4 <= palette.size())
+				memcpy(out, &palette[index], 4);
+			else
+				memset(out, 0, 4);
+			break;
+		}
+		case 2:
+			colorOf(p, pixelDepth, out);
+			break;
+		default:
+			out[0] = out[1] = out[2] = p[0];
+			out[3] = pixelDepth == 16 ? p[1] : 255;
+			break;
+		}
+	};
+
+	//t@CɕׂĂ𒼂
+	Resize(level, width, height);
+	const size_t pixelCount = static_cast<size_t>(width) * height;
+	size_t written = 0;
+	while (written < pixelCount) {
+		if (!rle) {
+			if (offset + bytesPerPixel > size)
+				return Result::Corrupt;
+			readPixel(data + offset, &level.pixels[written * 4]);
+			offset += bytesPerPixel;
+			++written;
+			continue;
+		}
+
+		if (offset >= size)
+			return Result::Corrupt;
+		const uint8_t header = data[offset++];
+		const size_t count = std::min<size_t>((header & 0x7f) + 1, pixelCount - written);
+		if (header & 0x80) {
+			if (offset + bytesPerPixel > size)
+				return Result::Corrupt;
+			uint8_t pixel[4];
+			readPixel(data + offset, pixel);
+			offset += bytesPerPixel;
+			for (size_t i = 0; i < count; ++i)
+				memcpy(&level.pixels[(written + i) * 4], pixel, 4);
+		}
+		else {
+			if (offset + count * bytesPerPixel > size)
+				return Result::Corrupt;
+			for (size_t i = 0; i < count; ++i, offset += bytesPerPixel)
+				readPixel(data + offset, &level.pixels[(written + i) * 4]);
+		}
+		written += count;
+	}
+
+	//32bitŃAt@S0̂̂̓At@ƂĈ
+	if (pixelDepth == 32 || (colorMapType == 1 && mapDepth == 32)) {
+		bool allZero = true;
+		for (size_t i = 0; i < pixelCount && allZero; ++i)
+			allZero = level.pixels[i * 4 + 3] == 0;
+		if (allZero) {
+			for (size_t i = 0; i < pixelCount; ++i)
+				level.pixels[i * 4 + 3] = 255;
+		}
+	}
+
+	//_Ȃ㉺]AE獶Ȃ獶E]
+	const size_t rowSize = static_cast<size_t>(width) * 4;
+	if (!(descriptor & 0x20)) {
+		std::vector<uint8_t> temp(rowSize);
+		for (uint32_t y = 0; y < height / 2; ++y) {
+			uint8_t* top    = &level.pixels[y * rowSize];
+			uint8_t* bottom = &level.pixels[(height - 1 - y) * rowSize];
+			memcpy(temp.data(), top, rowSize);
+			memcpy(top, bottom, rowSize);
+			memcpy(bottom, temp.data(), rowSize);
+		}
+	}
+	if (descriptor & 0x10) {
+		for (uint32_t y = 0; y < height; ++y) {
+			auto row = reinterpret_cast<uint32_t*>(&level.pixels[y * rowSize]);
+			std::reverse(row, row + width);
+		}
+	}
+	return Result::Ok;
+}
+
+/**
+	@brief	PNG(SJ[^CvA1`16bitAC^[[X)
+*/
+ImageDecoder::Result ImageDecoder::DecodePng(const uint8_t* data, size_t size, ImageLevel& level)
+{
+	uint32_t width = 0, height = 0;
+	int depth = 0, colorType = -1, interlace = 0;
+	uint8_t palette[256][4] = {};
+	bool     hasKey = false;
+	uint32_t key[3] = {};
+	std::vector<uint8_t> compressed;
+
+	//`N
+	size_t offset = 8;
+	bool ended = false;
+	while (!ended) {
+		if (offset + 12 > size)
+			return Result::Corrupt;
+		const uint32_t length = ReadBE32(data + offset);
+		const uint8_t* type   = data + offset + 4;
+		const uint8_t* chunk  = data + offset + 8;
+		if (length > size - offset - 12)
+			return Result::Corrupt;
+
+		if (memcmp(type, "IHDR", 4) == 0) {
+			if (length < 13)
+				return Result::Corrupt;
+			width     = ReadBE32(chunk);
+			height    = ReadBE32(chunk + 4);
+			depth     = chunk[8];
+			colorType = chunk[9];
+			interlace = chunk[12];
+		}
+		else if (memcmp(type, "PLTE", 4) == 0) {
+			for (uint32_t i = 0; i < length / 3 && i < 256; ++i) {
+				palette[i][0] = chunk[i * 3 + 0];
+				palette[i][1] = chunk[i * 3 + 1];
+				palette[i][2] = chunk[i * 3 + 2];
+				palette[i][3] = 255;
+			}
+		}
+		else if (memcmp(type, "tRNS", 4) == 0) {
+			if (colorType == 3) {
+				for (uint32_t i = 0; i < length && i < 256; ++i)
+					palette[i][3] = chunk[i];
+			}
+			else if (colorType == 0 && length >= 2) {
+				hasKey = true;
+				key[0] = (chunk[0] << 8) | chunk[1];
+			}
+			else if (colorType == 2 && length >= 6) {
+				hasKey = true;
+				for (int i = 0; i < 3; ++i)
+					key[i] = (chunk[i * 2] << 8) | chunk[i * 2 + 1];
+			}
+		}
+		else if (memcmp(type, "IDAT", 4) == 0) {
+			compressed.insert(compressed.end(), chunk, chunk + length);
+		}
+		else if (memcmp(type, "IEND", 4) == 0) {
+			ended = true;
+		}
+		offset += 12 + static_cast<size_t>(length);
+	}
+
+	if (!ValidSize(width, height))
+		return Result::Corrupt;
+	if (interlace != 0)
+		return Result::Unsupported;
+
+	int channels;
+	switch (colorType) {
+	case 0: channels = 1; break;
+	case 2: channels = 3; break;
+	case 3: channels = 1; break;
+	case 4: channels = 2; break;
+	case 6: channels = 4; break;
+	default: return Result::Corrupt;
+	}
+	if (depth != 1 && depth != 2 && depth != 4 && depth != 8 && depth != 16)
+		return Result::Corrupt;
+
+	const size_t bitsPerPixel = static_cast<size_t>(channels) * depth;
+	const size_t rowSize      = (width * bitsPerPixel + 7) / 8;
+	const size_t filterStep   = std::max<size_t>(1, bitsPerPixel / 8);
+
+	//tB^[ނ1oCg + 1s(葽WĴ͉Ă)
+	const size_t expected = (rowSize + 1) * height;
+	std::vector<uint8_t> raw;
+	raw.reserve(expected);
+	if (!Inflate(compressed.data(), compressed.size(), raw, expected) || raw.size() != expected)
+		return Result::Corrupt;
+
+	//tB^[߂(s1oCgtB^[)
+	std::vector<uint8_t> previous(rowSize, 0);
+	Resize(level, width, height);
+	for (uint32_t y = 0; y < height; ++y) {
+		uint8_t* row = &raw[y * (rowSize + 1) + 1];
+		const uint8_t filter = row[-1];
+		for (size_t i = 0; i < rowSize; ++i) {
+			const int a = i >= filterStep ? row[i - filterStep] : 0;
+			const int b = previous[i];
+			const int c = i >= filterStep ? previous[i - filterStep] : 0;
+			switch (filter) {
+			case 0: break;
+			case 1: row[i] = static_cast<uint8_t>(row[i] + a); break;
+			case 2: row[i] = static_cast<uint8_t>(row[i] + b); break;
+			case 3: row[i] = static_cast<uint8_t>(row[i] + ((a + b) >> 1)); break;
+			case 4: row[i] = static_cast<uint8_t>(row[i] + Paeth(a, b, c)); break;
+			default: return Result::Corrupt;
+			}
+		}
+		memcpy(previous.data(), row, rowSize);
+
+		uint8_t* out = &level.pixels[static_cast<size_t>(y) * width * 4];
+		for (uint32_t x = 0; x < width; ++x, out += 4) {
+			const uint32_t base = x * channels;
+			switch (colorType) {
+			case 0: {
+				const uint32_t v = Sample(row, base, depth);
+				out[0] = out[1] = out[2] = ToByte(v, depth);
+				out[3] = (hasKey && v == key[0]) ? 0 : 255;
+				break;
+			}
+			case 2: {
+				const uint32_t r = Sample(row, base, depth), g = Sample(row, base + 1, depth), b = Sample(row, base + 2, depth);
+				out[0] = ToByte(r, depth);
+				out[1] = ToByte(g, depth);
+				out[2] = ToByte(b, depth);
+				out[3] = (hasKey && r == key[0] && g == key[1] && b == key[2]) ? 0 : 255;
+				break;
+			}
+			case 3:
+				memcpy(out, palette[Sample(row, base, depth) & 0xff], 4);
+				break;
+			case 4:
+				out[0] = out[1] = out[2] = ToByte(Sample(row, base, depth), depth);
+				out[3] = ToByte(Sample(row, base + 1, depth), depth);
+				break;
+			default:
+				for (int c = 0; c < 4; ++c)
+					out[c] = ToByte(Sample(row, base + c, depth), depth);
+				break;
+			}
+		}
+	}
+	return Result::Ok;
+}
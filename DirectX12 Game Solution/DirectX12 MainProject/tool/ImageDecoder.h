@@ -0,0 +1,67 @@
+/**
+ * @file ImageDecoder.h
+ * @brief 摜t@C̃fR[h(BMP/PNG/TGA/SPA/SPH  RGBA8̃~bv`F[)
+ * @author hoshi hirofumi
+ * @date 2026/10/19
+ * @note Windows̃wb_[ɈˑȂ̂ŁA[J[XbhWindowsȊOłg
+ */
+
+#pragma once
+
+/*
+-------------------------------------------------------------------------------------
+	CN[h
+-------------------------------------------------------------------------------------
+*/
+#include <cstddef>
+#include <cstdint>
+#include <filesystem>
+#include <vector>
+
+/*
+-------------------------------------------------------------------------------------
+	\
+-------------------------------------------------------------------------------------
+*/
+// ~bvx1(RGBA8As̋lߕȂ)
+struct ImageLevel {
+	uint32_t             width;
+	uint32_t             height;
+	std::vector<uint8_t> pixels;
+};
+
+// fR[h(levels[0]̉𑜓x)
+struct DecodedImage {
+	std::vector<ImageLevel> levels;
+
+	uint32_t Width() const { return levels.empty() ? 0 : levels[0].width; }
+	uint32_t Height() const { return levels.empty() ? 0 : levels[0].height; }
+	size_t   SizeInBytes() const;
+};
+
+/*
+-------------------------------------------------------------------------------------
+	ImageDecoderNX@錾
+-------------------------------------------------------------------------------------
+*/
+class ImageDecoder {
+public:
+	enum class Result {
+		Ok,
+		NotFound,		//t@CJȂ
+		Unsupported,	//ΉĂȂ`(JPEGARLEBMPAC^[[XPNGȂ)
+		Corrupt			//Ă
+	};
+
+	//gqł͂Ȃt@C̐擪Ō`𔻒肷(.bmp̒gPNG̃f)
+	static Result DecodeFile(const std::filesystem::path& path, DecodedImage& image, bool generateMips = true);
+	static Result DecodeMemory(const uint8_t* data, size_t size, DecodedImage& image, bool generateMips = true);
+
+	//levels[0]1x1܂ł̃~bv2x2̕ςō
+	static void GenerateMips(DecodedImage& image);
+
+private:
+	static Result DecodeBmp(const uint8_t* data, size_t size, ImageLevel& level);
+	static Result DecodeTga(const uint8_t* data, size_t size, ImageLevel& level);
+	static Result DecodePng(const uint8_t* data, size_t size, ImageLevel& level);
+};
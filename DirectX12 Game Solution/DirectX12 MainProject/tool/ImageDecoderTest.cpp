@@ -0,0 +1,150 @@
+/**
+ * @file ImageDecoderTest.cpp
+ * @brief ImageDecoderPNGWJ̊mF(R}hCAQ[{̂̃vWFNgɂ͊܂߂Ȃ)
+ * @author hoshi hirofumi
+ * @date 2026/10/19
+ * @note őgPNG(kEŒnt})ŁAWJƁAIHDȒ傫𒴂WJEȂWJm߂
+ */
+
+#include "ImageDecoder.h"
+#include "TestCheck.h"
+
+#include <chrono>
+#include <cstdio>
+#include <cstring>
+#include <string>
+#include <vector>
+
+namespace {
+	using TestCheck::Check;
+
+	void PutBE32(std::vector<uint8_t>& out, uint32_t value)
+	{
+		for (int shift = 24; shift >= 0; shift -= 8)
+			out.push_back(static_cast<uint8_t>(value >> shift));
+	}
+
+	//! `N(ImageDecoderCRCȂ̂0)
+	void PutChunk(std::vector<uint8_t>& png, const char* type, const std::vector<uint8_t>& data)
+	{
+		PutBE32(png, static_cast<uint32_t>(data.size()));
+		png.insert(png.end(), type, type + 4);
+		png.insert(png.end(), data.begin(), data.end());
+		PutBE32(png, 0);
+	}
+
+	//! O[XP[8bitPNG(idatzlibwb_[܂)
+	std::vector<uint8_t> MakePng(uint32_t width, uint32_t height, const std::vector<uint8_t>& idat)
+	{
+		static const uint8_t SIGNATURE[8] = { 0x89, 'P', 'N', 'G', 0x0d, 0x0a, 0x1a, 0x0a };
+		std::vector<uint8_t> png(SIGNATURE, SIGNATURE + 8);
+
+		std::vector<uint8_t> header;
+		PutBE32(header, width);
+		PutBE32(header, height);
+		header.insert(header.end(), { 8, 0, 0, 0, 0 });
+		PutChunk(png, "IHDR", header);
+		PutChunk(png, "IDAT", idat);
+		PutChunk(png, "IEND", {});
+		return png;
+	}
+
+	//! kubN1zlibXg[(Adler-32ImageDecoderȂ̂ŏȂ)
+	std::vector<uint8_t> Stored(const std::vector<uint8_t>& raw)
+	{
+		std::vector<uint8_t> out = { 0x78, 0x01, 0x01 };
+		const uint16_t length = static_cast<uint16_t>(raw.size());
+		out.insert(out.end(), { static_cast<uint8_t>(length), static_cast<uint8_t>(length >> 8),
+			static_cast<uint8_t>(~length), static_cast<uint8_t>(~length >> 8) });
+		out.insert(out.end(), raw.begin(), raw.end());
+		return out;
+	}
+
+	//! ʃrbgl߂(nt}͏ʃrbg)
+	struct BitWriter {
+		std::vector<uint8_t> bytes;
+		int                  count = 0;
+
+		void Bits(uint32_t value, int bits)
+		{
+			for (int i = 0; i < bits; ++i)
+				Bit((value >> i) & 1);
+		}
+		void Code(uint32_t code, int bits)
+		{
+			for (int i = bits - 1; i >= 0; --i)
+				Bit((code >> i) & 1);
+		}
+		void Bit(uint32_t bit)
+		{
+			if (count % 8 == 0)
+				bytes.push_back(0);
+			bytes.back() |= static_cast<uint8_t>(bit << (count % 8));
+			++count;
+		}
+	};
+
+	//! Œnt}01oCgA258oCg̃Rs[copies񑱂(IDAT傫WJ)
+	std::vector<uint8_t> Bomb(size_t copies)
+	{
+		BitWriter writer;
+		writer.Bits(1, 1);					//Ō̃ubN
+		writer.Bits(1, 2);					//Œnt}
+		writer.Code(0x30 + 0, 8);			//e0
+		for (size_t i = 0; i < copies; ++i) {
+			writer.Code(0xc0 + (285 - 280), 8);	//258
+			writer.Code(0, 5);					//1
+		}
+		writer.Code(0, 7);					//I(256)
+
+		std::vector<uint8_t> out = { 0x78, 0x01 };
+		out.insert(out.end(), writer.bytes.begin(), writer.bytes.end());
+		return out;
+	}
+
+	ImageDecoder::Result Decode(const std::vector<uint8_t>& png, DecodedImage& image)
+	{
+		return ImageDecoder::DecodeMemory(png.data(), png.size(), image, false);
+	}
+
+	//傤ǂ̑傫ȂWJłAtB^[߂
+	void Valid()
+	{
+		//2x2A1sڂ̓tB^[A2sڂ͏(Up)
+		const std::vector<uint8_t> raw = { 0, 10, 20, 2, 5, 5 };
+		DecodedImage image;
+		Check(Decode(MakePng(2, 2, Stored(raw)), image) == ImageDecoder::Result::Ok, "an exact stored stream decodes");
+		const auto& pixels = image.levels.empty() ? std::vector<uint8_t>() : image.levels[0].pixels;
+		Check(pixels.size() == 16 && pixels[0] == 10 && pixels[4] == 20 && pixels[8] == 15 && pixels[12] == 25 && pixels[15] == 255,
+			"filters are undone");
+
+		//Œnt}258x1(tB^[1oCg + 258oCg)
+		Check(Decode(MakePng(258, 1, Bomb(1)), image) == ImageDecoder::Result::Ok && image.Width() == 258, "an exact fixed Huffman stream decodes");
+	}
+
+	//IHDȒ傫葽WJ́EȂ͉̂Ă
+	void Limit()
+	{
+		DecodedImage image;
+		Check(Decode(MakePng(2, 2, Stored({ 0, 10, 20, 2, 5, 5, 0 })), image) == ImageDecoder::Result::Corrupt, "one extra stored byte is corrupt");
+		Check(Decode(MakePng(2, 2, Stored({ 0, 10, 20, 2, 5 })), image) == ImageDecoder::Result::Corrupt, "one missing byte is corrupt");
+		Check(Decode(MakePng(257, 1, Bomb(1)), image) == ImageDecoder::Result::Corrupt, "one extra copied byte is corrupt");
+
+		//1x1IHDR256MBɓWJIDAT(1.7MB): 2oCg𒴂ƂŎ~܂
+		const auto bomb = MakePng(1, 1, Bomb(256u * 1048576u / 258));
+		const auto start = std::chrono::steady_clock::now();
+		const auto result = Decode(bomb, image);
+		const double ms = std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - start).count();
+		Check(result == ImageDecoder::Result::Corrupt, "a small IDAT that inflates past the image is corrupt");
+		Check(ms < 50.0, "inflation stops at the image size instead of expanding everything");
+		printf("bomb: %zu byte PNG rejected in %.3f ms\n", bomb.size(), ms);
+	}
+}
+
+int main()
+{
+	Valid();
+	Limit();
+
+	return TestCheck::Finish("ImageDecoderTest");
+}
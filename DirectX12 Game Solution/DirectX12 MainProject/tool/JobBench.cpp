@@ -0,0 +1,278 @@
+/**
+ * @file JobBench.cpp
+ * @brief WuVXe̕׎ƃXP[Ǒv(R}hCAQ[{̂̃vWFNgɂ͊܂߂Ȃ)
+ * @author hoshi hirofumi
+ * @date 2026/10/19
+ * @note CIł̃rh: g++ -std=c++17 -O2 -pthread -DDXTK_PROFILE=1 JobBench.cpp JobSystem.cpp Profiler.cpp -o JobBench
+ *       (-fsanitize=threadtƃf[^m߂)
+ *       JobBench stress  [rounds] [workers] [trace.json]   ˑ֌WEqParallelForEBackgroundČʂm߂
+ *                                                         (trace.jsontChrome/Perfettõg[Xo)
+ *       JobBench scaling [items] [threads]    [J[ςParallelFor̎Ԃׂ(ȗ̓RA܂)
+ *       JobBench overflow [frames] [threads]  Profiler̃OꂳÂĂƏW߂ԂĂȂm߂
+ */
+
+#include "JobSystem.h"
+#include "Profiler.h"
+
+#include <chrono>
+#include <cmath>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <thread>
+#include <vector>
+
+namespace {
+	typedef std::chrono::steady_clock Clock;
+
+	double Elapsed(Clock::time_point start)
+	{
+		return std::chrono::duration<double, std::milli>(Clock::now() - start).count();
+	}
+
+	//{[̍svZ炢̏d(œKŏȂ悤ɌʂԂ)
+	double Work(size_t index, int iterations)
+	{
+		double value = static_cast<double>(index);
+		for (int i = 0; i < iterations; ++i)
+			value = std::sin(value) * 0.5 + std::cos(value * 0.25);
+		return value;
+	}
+
+	int Usage()
+	{
+		fprintf(stderr,
+			"usage: JobBench stress [rounds] [workers] [trace.json]\n"
+			"       JobBench scaling [items] [threads]\n"
+			"       JobBench overflow [frames] [threads]\n");
+		return 2;
+	}
+
+	int Stress(int rounds, unsigned int workers, const char* tracePath)
+	{
+		JobSystem jobs(workers);
+		int failures = 0;
+		const auto start = Clock::now();
+
+		PROFILE_THREAD("Main");
+		if (tracePath)
+			Profiler::Get().StartCapture();
+
+		for (int round = 0; round < rounds; ++round) {
+			PROFILE_ZONE("Stress::Round");
+
+			//A(64)  B(Ǎʂg)  C(qParallelFor)̏Ɉˑ
+			std::atomic<int64_t> stageA(0);
+			std::atomic<int64_t> stageB(0);
+			std::atomic<int64_t> stageC(0);
+			std::atomic<int>     background(0);
+
+			JobCounter a, b, c, loading;
+			for (int i = 0; i < 64; ++i)
+				jobs.Run([&stageA, i]() { stageA += i; }, &a);
+			jobs.RunAfter(a, [&]() { stageB = stageA.load() * 2; }, &b);
+			for (int i = 0; i < 8; ++i) {
+				jobs.RunAfter(b, [&]() {
+					PROFILE_ZONE("Stress::Nested");
+					jobs.ParallelFor(1000, [&](size_t begin, size_t end) {
+						PROFILE_ZONE("Stress::Chunk");
+						int64_t sum = 0;
+						for (size_t j = begin; j < end; ++j)
+							sum += static_cast<int64_t>(j);
+						stageC += sum;
+					});
+				}, &c);
+			}
+			for (int i = 0; i < 4; ++i)
+				jobs.Run([&background]() { ++background; }, &loading, JobSystem::Priority::Background);
+
+			{
+				PROFILE_ZONE("Stress::Wait");
+				jobs.Wait(c);
+				jobs.Wait(b);
+			}
+			//Background͎`Ȃ̂ŁA[J[Еt̂҂
+			while (!loading.IsDone())
+				std::this_thread::yield();
+
+			const int64_t expectA = 63 * 64 / 2;
+			const int64_t expectC = 8 * (999 * 1000 / 2);
+			if (stageA != expectA || stageB != expectA * 2 || stageC != expectC || background != 4) {
+				fprintf(stderr, "round %d: A=%lld B=%lld C=%lld background=%d\n", round,
+					static_cast<long long>(stageA.load()), static_cast<long long>(stageB.load()),
+					static_cast<long long>(stageC.load()), background.load());
+				++failures;
+			}
+			Profiler::Get().EndFrame();
+		}
+
+		const auto statistics = jobs.GetStatistics();
+		printf("stress: %d rounds, %u workers, %.1f ms, jobs=%llu steals=%llu helped=%llu background=%llu, %s\n",
+			rounds, jobs.GetWorkerCount(), Elapsed(start),
+			static_cast<unsigned long long>(statistics.jobs), static_cast<unsigned long long>(statistics.steals),
+			static_cast<unsigned long long>(statistics.helped), static_cast<unsigned long long>(statistics.background),
+			failures == 0 ? "ok" : "FAILED");
+
+		for (const auto& zone : Profiler::Get().GetTopZones(5))
+			printf("  %-16s %8.3f ms %8.1f calls per round\n", zone.name, zone.ms, zone.calls);
+		if (tracePath) {
+			const auto profile = Profiler::Get().GetStatistics();
+			if (!Profiler::Get().WriteChromeTrace(tracePath)) {
+				fprintf(stderr, "failed to write %s\n", tracePath);
+				return 1;
+			}
+			printf("trace: %s (%llu events, %llu dropped)\n", tracePath,
+				static_cast<unsigned long long>(profile.captured), static_cast<unsigned long long>(profile.dropped));
+		}
+		return failures == 0 ? 0 : 1;
+	}
+
+	int Scaling(size_t items, unsigned int threads)
+	{
+		const unsigned int cores = threads != 0 ? threads : std::max(std::thread::hardware_concurrency(), 1u);
+		std::vector<double> results(items);
+
+		//1Xbh(WuVXeʂȂ)ɂ
+		double baseline = 0.0;
+		for (unsigned int total = 1; total <= cores; total *= 2) {
+			//҂Xbh`̂ŁA[J[1ȂĂ悢
+			JobSystem jobs(std::max(total - 1, 1u));
+			const auto run = [&]() {
+				if (total == 1) {
+					for (size_t i = 0; i < items; ++i)
+						results[i] = Work(i, 200);
+					return;
+				}
+				jobs.ParallelFor(items, [&](size_t begin, size_t end) {
+					for (size_t i = begin; i < end; ++i)
+						results[i] = Work(i, 200);
+				});
+			};
+
+			run();	//߂
+			const auto start = Clock::now();
+			const int repeat = 5;
+			for (int i = 0; i < repeat; ++i)
+				run();
+			const double ms = Elapsed(start) / repeat;
+			if (total == 1)
+				baseline = ms;
+
+			printf("scaling: %2u threads  %8.2f ms  x%.2f  grain=%zu\n",
+				total, ms, baseline / ms, total == 1 ? items : jobs.GrainSize(items));
+		}
+		return 0;
+	}
+
+	/**
+		@brief	Profiler̃Ö
+		@note	Ԃ̒𖼑OƂɌ߂ĂAWvςĂȂōԂ
+				(Jn1ԂƂ2^20imbi߂̂ŁAʂ݂̏ƍƒ傫ς)
+	*/
+	int Overflow(int frames, unsigned int threads)
+	{
+		static const char* const names[] = { "Overflow::A", "Overflow::B", "Overflow::C", "Overflow::D" };
+		const auto duration = [](size_t name) { return static_cast<uint64_t>(name + 1) * 1000; };
+		int failures = 0;
+
+		//1Xbh: EndFrame܂ł3ƏƁAŌ1c
+		{
+			Profiler profiler;
+			auto track = profiler.CreateTrack("Overflow");
+			const uint64_t written = Profiler::RING_SIZE * 3 + 17;
+			for (uint64_t i = 0; i < written; ++i) {
+				const bool last = i >= written - Profiler::RING_SIZE;
+				profiler.Record(track, last ? names[1] : names[0], i << 20, (i << 20) + duration(last ? 1 : 0));
+			}
+			profiler.EndFrame();
+			auto statistics = profiler.GetStatistics();
+			if (statistics.dropped != written - Profiler::RING_SIZE || statistics.events != Profiler::RING_SIZE) {
+				fprintf(stderr, "overflow: single thread kept %llu and dropped %llu of %llu\n",
+					static_cast<unsigned long long>(statistics.events), static_cast<unsigned long long>(statistics.dropped),
+					static_cast<unsigned long long>(written));
+				++failures;
+			}
+
+			for (unsigned int frame = 1; frame < Profiler::SUMMARY_FRAMES; ++frame)
+				profiler.EndFrame();
+			const auto top = profiler.GetTopZones(4);
+			if (top.size() != 1 || strcmp(top[0].name, names[1]) != 0 ||
+				std::fabs(top[0].calls * Profiler::SUMMARY_FRAMES - Profiler::RING_SIZE) > 0.5) {
+				fprintf(stderr, "overflow: single thread did not keep exactly the newest ring\n");
+				++failures;
+			}
+		}
+
+		//Xbh: ĂŒ̃OEndFrameǂ(͑҂Ȃ)
+		Profiler profiler;
+		const unsigned int writers = threads != 0 ? threads : 4;
+		std::atomic<bool> stop(false);
+		std::vector<uint64_t> written(writers, 0);
+		std::vector<std::thread> workers;
+		for (unsigned int t = 0; t < writers; ++t) {
+			workers.emplace_back([&, t]() {
+				uint64_t count = 0;
+				while (!stop.load(std::memory_order_relaxed)) {
+					const size_t name = (count + t) % 4;
+					profiler.Record(names[name], count << 20, (count << 20) + duration(name));
+					++count;
+				}
+				written[t] = count;
+			});
+		}
+
+		const auto start = Clock::now();
+		uint64_t version = profiler.GetSummaryVersion();
+		size_t torn = 0, summaries = 0;
+		for (int frame = 0; frame < frames; ++frame) {
+			std::this_thread::sleep_for(std::chrono::microseconds(500));
+			profiler.EndFrame();
+			if (profiler.GetSummaryVersion() == version)
+				continue;
+			version = profiler.GetSummaryVersion();
+			++summaries;
+			for (const auto& zone : profiler.GetTopZones(8)) {
+				const size_t name = static_cast<size_t>(zone.name[10] - 'A');
+				const double expected = duration(name) * 1e-6;
+				if (name >= 4 || zone.calls <= 0.0 || std::fabs(zone.ms / zone.calls - expected) > expected * 1e-9)
+					++torn;
+			}
+		}
+		stop = true;
+		for (auto& worker : workers)
+			worker.join();
+		profiler.EndFrame();
+
+		uint64_t total = 0;
+		for (auto count : written)
+			total += count;
+		const auto statistics = profiler.GetStatistics();
+		const bool counted = statistics.events + statistics.dropped == total;
+		if (!counted || torn != 0 || statistics.dropped == 0)
+			++failures;
+
+		printf("overflow: %d frames, %u writers, %.1f ms, written=%llu events=%llu dropped=%llu (%.1f%%) summaries=%zu torn=%zu, %s\n",
+			frames, writers, Elapsed(start), static_cast<unsigned long long>(total),
+			static_cast<unsigned long long>(statistics.events), static_cast<unsigned long long>(statistics.dropped),
+			total ? 100.0 * statistics.dropped / total : 0.0, summaries, torn, failures == 0 ? "ok" : "FAILED");
+		if (!counted)
+			fprintf(stderr, "overflow: events + dropped != written\n");
+		if (statistics.dropped == 0)
+			fprintf(stderr, "overflow: the rings never overflowed (raise frames or threads)\n");
+		return failures == 0 ? 0 : 1;
+	}
+}
+
+int main(int argc, char* argv[])
+{
+	if (argc < 2)
+		return Usage();
+
+	if (strcmp(argv[1], "stress") == 0)
+		return Stress(argc > 2 ? atoi(argv[2]) : 1000, argc > 3 ? static_cast<unsigned int>(atoi(argv[3])) : 0, argc > 4 ? argv[4] : nullptr);
+	if (strcmp(argv[1], "scaling") == 0)
+		return Scaling(argc > 2 ? static_cast<size_t>(atoll(argv[2])) : 100000, argc > 3 ? static_cast<unsigned int>(atoi(argv[3])) : 0);
+	if (strcmp(argv[1], "overflow") == 0)
+		return Overflow(argc > 2 ? atoi(argv[2]) : 300, argc > 3 ? static_cast<unsigned int>(atoi(argv[3])) : 0);
+	return Usage();
+}
@@ -0,0 +1,328 @@
+/**
+ * @file JobSystem.cpp
+ * @brief [NXeB[ÕWuVXe(ǂݍ݁EAj[VEJOŋLXbhv[)
+ * @author hoshi hirofumi
+ * @date 2026/10/19
+ */
+
+#include "JobSystem.h"
+
+#include <algorithm>
+#include <chrono>
+
+/*
+-------------------------------------------------------------------------------------
+	Wu
+-------------------------------------------------------------------------------------
+*/
+struct JobCounter::Job {
+	JobSystem::Function function;
+	JobCounter*         counter;
+	JobSystem::Priority priority;
+};
+
+namespace {
+	//! ̃Xbh[J[ƂđWuVXeƁÃ[J[ԍ
+	thread_local JobSystem*   t_system = nullptr;
+	thread_local unsigned int t_worker = 0;
+}
+
+/**
+	@note	l0ɂȂ̂̓bN̒Ȃ̂ŁAbN蒼FinishGȂƂ킩
+*/
+bool JobCounter::IsDone() const
+{
+	if (m_value.load(std::memory_order_acquire) != 0)
+		return false;
+
+	std::lock_guard<std::mutex> lock(m_mutex);
+	return true;
+}
+
+JobSystem::JobSystem(unsigned int workerCount)
+	: m_queued(0), m_backgroundQueued(0), m_backgroundRunning(0), m_quit(false),
+	  m_jobs(0), m_steals(0), m_helped(0), m_backgroundJobs(0), m_exceptions(0)
+{
+	if (workerCount == 0)
+		workerCount = std::max(std::thread::hardware_concurrency(), 2u) - 1;
+
+	//1BackgroundŖ߂Ƀt[̃Wû߂ɋ󂯂Ă
+	m_backgroundLimit = std::max(workerCount - 1, 1u);
+
+	for (unsigned int i = 0; i < workerCount; ++i)
+		m_workers.push_back(std::make_unique<Worker>());
+	//S̃fbNłĂ瓮(ނƂɑS)
+	for (unsigned int i = 0; i < workerCount; ++i)
+		m_workers[i]->thread = std::thread(&JobSystem::WorkerMain, this, i);
+}
+
+/**
+	@note	cĂWu͎sɎ̂Ă(JE^[҂Ă鑤͐ɑ҂IĂ邱)
+*/
+JobSystem::~JobSystem()
+{
+	{
+		std::lock_guard<std::mutex> lock(m_sleepMutex);
+		m_quit = true;
+	}
+	m_wake.notify_all();
+	for (auto& worker : m_workers)
+		worker->thread.join();
+
+	for (auto& worker : m_workers) {
+		while (Job* job = worker->queue.Pop())
+			delete job;
+	}
+	for (Job* job : m_shared)
+		delete job;
+	for (Job* job : m_background)
+		delete job;
+}
+
+JobSystem& JobSystem::Get()
+{
+	static JobSystem jobSystem;
+	return jobSystem;
+}
+
+void JobSystem::Run(Function function, JobCounter* counter, Priority priority)
+{
+	if (counter)
+		counter->m_value.fetch_add(1, std::memory_order_acq_rel);
+	Submit(new Job{ std::move(function), counter, priority });
+}
+
+/**
+	@note	dependency0ɂFinishƎ荇̂ŁA0ǂdependencỹbN̒Ō
+*/
+void JobSystem::RunAfter(JobCounter& dependency, Function function, JobCounter* counter, Priority priority)
+{
+	if (counter)
+		counter->m_value.fetch_add(1, std::memory_order_acq_rel);
+	Job* job = new Job{ std::move(function), counter, priority };
+	{
+		std::lock_guard<std::mutex> lock(dependency.m_mutex);
+		if (dependency.m_value.load(std::memory_order_acquire) != 0) {
+			dependency.m_continuations.push_back(job);
+			return;
+		}
+	}
+	Submit(job);
+}
+
+/**
+	@brief	`Ȃ҂
+	@note	Background̃Wu͏EȂ(ǂݍ݂Ńt[~߂Ȃ)
+*/
+void JobSystem::Wait(const JobCounter& counter)
+{
+	unsigned int idle = 0;
+	while (!counter.IsDone()) {
+		if (Job* job = FindJob(false)) {
+			Execute(job, true);
+			idle = 0;
+		}
+		else if (++idle < 64) {
+			std::this_thread::yield();
+		}
+		else {
+			//c͑̃Xbhs(Î҂)
+			std::this_thread::sleep_for(std::chrono::microseconds(50));
+		}
+	}
+}
+
+void JobSystem::ParallelFor(size_t count, const RangeFunction& function, size_t grain)
+{
+	if (count == 0)
+		return;
+
+	grain = GrainSize(count, grain);
+	if (grain >= count) {
+		function(0, count);
+		return;
+	}
+
+	JobCounter counter;
+	for (size_t begin = grain; begin < count; begin += grain) {
+		const size_t end = std::min(begin + grain, count);
+		Run([&function, begin, end]() { function(begin, end); }, &counter);
+	}
+	function(0, grain);
+	Wait(counter);
+}
+
+/**
+	@note	Xbh~CHUNKS_PER_THREADɕ(ƃWȕoAȂƕ΂肪ڗ)
+*/
+size_t JobSystem::GrainSize(size_t count, size_t grain) const
+{
+	const size_t chunks = (m_workers.size() + 1) * CHUNKS_PER_THREAD;
+	return std::max<size_t>({ (count + chunks - 1) / chunks, grain, 1 });
+}
+
+bool JobSystem::IsWorkerThread() const
+{
+	return t_system == this;
+}
+
+JobSystem::Statistics JobSystem::GetStatistics() const
+{
+	Statistics statistics;
+	statistics.jobs       = m_jobs.load(std::memory_order_relaxed);
+	statistics.steals     = m_steals.load(std::memory_order_relaxed);
+	statistics.helped     = m_helped.load(std::memory_order_relaxed);
+	statistics.background = m_backgroundJobs.load(std::memory_order_relaxed);
+	statistics.exceptions = m_exceptions.load(std::memory_order_relaxed);
+	return statistics;
+}
+
+/**
+	@note	[J[͎̃fbNցAȊOƈꂽ͋L̃L[֐ς
+*/
+void JobSystem::Submit(Job* job)
+{
+	if (job->priority == Priority::Background) {
+		{
+			std::lock_guard<std::mutex> lock(m_sharedMutex);
+			m_background.push_back(job);
+		}
+		m_backgroundQueued.fetch_add(1, std::memory_order_acq_rel);
+	}
+	else {
+		m_queued.fetch_add(1, std::memory_order_acq_rel);
+		if (t_system != this || !m_workers[t_worker]->queue.Push(job)) {
+			std::lock_guard<std::mutex> lock(m_sharedMutex);
+			m_shared.push_back(job);
+		}
+	}
+
+	//Q悤ƂĂ郏[J[Ă҂܂ł̊ԂɋNȂ悤ɁAbNʂĂ
+	{
+		std::lock_guard<std::mutex> lock(m_sleepMutex);
+	}
+	m_wake.notify_one();
+}
+
+/**
+	@note	̃fbN  L̃L[  ̃[J[瓐  Background̏
+*/
+JobSystem::Job* JobSystem::FindJob(bool background)
+{
+	const bool worker = (t_system == this);
+
+	if (m_queued.load(std::memory_order_acquire) > 0) {
+		Job* job = nullptr;
+		if (worker)
+			job = m_workers[t_worker]->queue.Pop();
+
+		if (job == nullptr) {
+			std::lock_guard<std::mutex> lock(m_sharedMutex);
+			if (!m_shared.empty()) {
+				job = m_shared.front();
+				m_shared.pop_front();
+			}
+		}
+
+		if (job == nullptr) {
+			const size_t count = m_workers.size();
+			const size_t start = worker ? t_worker + 1 : 0;
+			for (size_t i = 0; i < count && job == nullptr; ++i) {
+				const size_t victim = (start + i) % count;
+				if (worker && victim == t_worker)
+					continue;
+				job = m_workers[victim]->queue.Steal();
+			}
+			if (job)
+				m_steals.fetch_add(1, std::memory_order_relaxed);
+		}
+
+		if (job) {
+			m_queued.fetch_sub(1, std::memory_order_acq_rel);
+			return job;
+		}
+	}
+
+	if (background && m_backgroundQueued.load(std::memory_order_acquire) > 0) {
+		//s̐ɑ₵ď
+		if (m_backgroundRunning.fetch_add(1, std::memory_order_acq_rel) < m_backgroundLimit) {
+			std::lock_guard<std::mutex> lock(m_sharedMutex);
+			if (!m_background.empty()) {
+				Job* job = m_background.front();
+				m_background.pop_front();
+				m_backgroundQueued.fetch_sub(1, std::memory_order_acq_rel);
+				return job;
+			}
+		}
+		m_backgroundRunning.fetch_sub(1, std::memory_order_acq_rel);
+	}
+	return nullptr;
+}
+
+void JobSystem::Execute(Job* job, bool helping)
+{
+	try {
+		job->function();
+	}
+	catch (...) {
+		m_exceptions.fetch_add(1, std::memory_order_relaxed);
+	}
+
+	m_jobs.fetch_add(1, std::memory_order_relaxed);
+	if (helping)
+		m_helped.fetch_add(1, std::memory_order_relaxed);
+
+	if (job->priority == Priority::Background) {
+		m_backgroundJobs.fetch_add(1, std::memory_order_relaxed);
+		m_backgroundRunning.fetch_sub(1, std::memory_order_acq_rel);
+		//󂢂gŎBackgroundn߂
+		if (m_backgroundQueued.load(std::memory_order_acquire) > 0) {
+			{
+				std::lock_guard<std::mutex> lock(m_sleepMutex);
+			}
+			m_wake.notify_one();
+		}
+	}
+
+	if (job->counter)
+		Finish(*job->counter);
+	delete job;
+}
+
+/**
+	@note	0ɂăbN𗣂̓JE^[ɐGȂ(҂Ă鑤ɔj)
+*/
+void JobSystem::Finish(JobCounter& counter)
+{
+	std::vector<Job*> continuations;
+	{
+		std::lock_guard<std::mutex> lock(counter.m_mutex);
+		if (counter.m_value.fetch_sub(1, std::memory_order_acq_rel) == 1)
+			continuations.swap(counter.m_continuations);
+	}
+	for (Job* job : continuations)
+		Submit(job);
+}
+
+void JobSystem::WorkerMain(unsigned int index)
+{
+	t_system = this;
+	t_worker = index;
+
+	for (;;) {
+		if (Job* job = FindJob(true)) {
+			Execute(job, false);
+			continue;
+		}
+
+		std::unique_lock<std::mutex> lock(m_sleepMutex);
+		m_wake.wait(lock, [this]() {
+			return m_quit ||
+				m_queued.load(std::memory_order_acquire) > 0 ||
+				(m_backgroundQueued.load(std::memory_order_acquire) > 0 &&
+				 m_backgroundRunning.load(std::memory_order_acquire) < m_backgroundLimit);
+		});
+		if (m_quit)
+			return;
+	}
+}
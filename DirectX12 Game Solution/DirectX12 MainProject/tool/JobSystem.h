@@ -0,0 +1,236 @@
+/**
+ * @file JobSystem.h
+ * @brief [NXeB[ÕWuVXe(ǂݍ݁EAj[VEJOŋLXbhv[)
+ * @author hoshi hirofumi
+ * @date 2026/10/19
+ * @note [J[Chase-LeṽfbNA󂢂[J[͑̃[J[̃fbN̐擪瓐
+ *       ҂(CXbhȂ)҂ĂԂ̓Wus
+ *       x`}[N(JobBench.cpp)Linuxœ߁AWindowsɈˑȂ
+ */
+
+#pragma once
+
+/*
+-------------------------------------------------------------------------------------
+	CN[h
+-------------------------------------------------------------------------------------
+*/
+#include <atomic>
+#include <condition_variable>
+#include <cstddef>
+#include <cstdint>
+#include <deque>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+class JobSystem;
+
+/*
+-------------------------------------------------------------------------------------
+	JobCounter@IĂȂWu̐(0ɂȂ҂AɑWun܂)
+-------------------------------------------------------------------------------------
+*/
+class JobCounter {
+public:
+	JobCounter() : m_value(0) {}
+	virtual ~JobCounter() {}
+
+	JobCounter(JobCounter&&) = delete;
+	JobCounter& operator= (JobCounter&&) = delete;
+
+	JobCounter(JobCounter const&) = delete;
+	JobCounter& operator= (JobCounter const&) = delete;
+
+	//trueԂ̓JE^[jĂ悢
+	bool IsDone() const;
+	int  Value() const { return m_value.load(std::memory_order_acquire); }
+
+private:
+	friend class JobSystem;
+	struct Job;
+
+	std::atomic<int>   m_value;
+	mutable std::mutex m_mutex;			//0ɂEɑWuo^ƂɎ
+	std::vector<Job*>  m_continuations;	//0ɂȂn߂Wu
+};
+
+/*
+-------------------------------------------------------------------------------------
+	WorkStealingQueue@Chase-LeṽfbN(͖ɐςŖÃXbh͐擪瓐)
+-------------------------------------------------------------------------------------
+*/
+template <class T, size_t Capacity>
+class WorkStealingQueue {
+public:
+	static_assert((Capacity & (Capacity - 1)) == 0, "capacity must be a power of two");
+
+	WorkStealingQueue() : m_top(0), m_bottom(0)
+	{
+		for (auto& item : m_items)
+			item.store(nullptr, std::memory_order_relaxed);
+	}
+
+	//̃Xbh(tȂfalse)
+	bool Push(T* item)
+	{
+		const int64_t bottom = m_bottom.load(std::memory_order_relaxed);
+		const int64_t top    = m_top.load(std::memory_order_acquire);
+		if (bottom - top >= static_cast<int64_t>(Capacity))
+			return false;
+
+		m_items[bottom & MASK].store(item, std::memory_order_release);
+		std::atomic_thread_fence(std::memory_order_release);
+		m_bottom.store(bottom + 1, std::memory_order_relaxed);
+		return true;
+	}
+
+	//̃Xbh(Ō1͓ރXbhƎ荇)
+	T* Pop()
+	{
+		const int64_t bottom = m_bottom.load(std::memory_order_relaxed) - 1;
+		m_bottom.store(bottom, std::memory_order_relaxed);
+		std::atomic_thread_fence(std::memory_order_seq_cst);
+		int64_t top = m_top.load(std::memory_order_relaxed);
+
+		if (top > bottom) {
+			m_bottom.store(bottom + 1, std::memory_order_relaxed);
+			return nullptr;
+		}
+
+		T* item = m_items[bottom & MASK].load(std::memory_order_acquire);
+		if (top == bottom) {
+			if (!m_top.compare_exchange_strong(top, top + 1, std::memory_order_seq_cst, std::memory_order_relaxed))
+				item = nullptr;
+			m_bottom.store(bottom + 1, std::memory_order_relaxed);
+		}
+		return item;
+	}
+
+	//ǂ̃Xbhł(荇ɕƂnullptr)
+	T* Steal()
+	{
+		int64_t top = m_top.load(std::memory_order_acquire);
+		std::atomic_thread_fence(std::memory_order_seq_cst);
+		const int64_t bottom = m_bottom.load(std::memory_order_acquire);
+		if (top >= bottom)
+			return nullptr;
+
+		T* item = m_items[top & MASK].load(std::memory_order_acquire);
+		if (!m_top.compare_exchange_strong(top, top + 1, std::memory_order_seq_cst, std::memory_order_relaxed))
+			return nullptr;
+		return item;
+	}
+
+	bool IsEmpty() const
+	{
+		return m_bottom.load(std::memory_order_acquire) <= m_top.load(std::memory_order_acquire);
+	}
+
+private:
+	static constexpr int64_t MASK = static_cast<int64_t>(Capacity) - 1;
+
+	alignas(64) std::atomic<int64_t> m_top;
+	alignas(64) std::atomic<int64_t> m_bottom;
+	std::atomic<T*>                  m_items[Capacity];
+};
+
+/*
+-------------------------------------------------------------------------------------
+	JobSystemNX@錾
+-------------------------------------------------------------------------------------
+*/
+class JobSystem {
+public:
+	typedef std::function<void()> Function;
+	//! ParallelFor1`N([begin, end))
+	typedef std::function<void(size_t begin, size_t end)> RangeFunction;
+
+	//! [J[̃fbN̑傫(ꂽ͋L̃L[)
+	static constexpr size_t QUEUE_CAPACITY = 4096;
+	//! ̃`N̑傫̓Xbh1肱̐̃`NɂȂ悤Ɍ߂(΂𓐂łȂ炷)
+	static constexpr size_t CHUNKS_PER_THREAD = 4;
+
+	enum class Priority {
+		Frame,		//t[ő҂Z(҂ĂXbh`)
+		Background	//t@C̓ǂݍ݁EfR[hȂǒ([J[sAt[̑҂ł͏EȂ)
+	};
+
+	struct Statistics {
+		uint64_t jobs;			//sWu
+		uint64_t steals;		//̃[J[瓐񂾐
+		uint64_t helped;		//Wait̒Ŏs
+		uint64_t background;	//Background̃Wu
+		uint64_t exceptions;	//WuO(̂Ă)
+	};
+
+	//workerCount0ȂRA-1(҂Xbh̕c)
+	explicit JobSystem(unsigned int workerCount = 0);
+	virtual ~JobSystem();
+
+	JobSystem(JobSystem&&) = delete;
+	JobSystem& operator= (JobSystem&&) = delete;
+
+	JobSystem(JobSystem const&) = delete;
+	JobSystem& operator= (JobSystem const&) = delete;
+
+	//counter͎sO1AI1(Ô͎Ă̂ŁAKvȂWu̒Ŏ󂯎~߂)
+	void Run(Function function, JobCounter* counter = nullptr, Priority priority = Priority::Frame);
+	//dependency0ɂȂĂs
+	void RunAfter(JobCounter& dependency, Function function, JobCounter* counter = nullptr, Priority priority = Priority::Frame);
+
+	//counter0ɂȂ܂ŁAFramẽWusȂ҂
+	void Wait(const JobCounter& counter);
+
+	//[0, count)`NɕĕɎsASI܂ő҂(ŏ̃`N͌Ă񂾃Xbh)
+	//grain1`N̍ŏ̐(01)
+	void ParallelFor(size_t count, const RangeFunction& function, size_t grain = 0);
+	//ParallelFor̃`N̑傫
+	size_t GrainSize(size_t count, size_t grain = 0) const;
+
+	unsigned int GetWorkerCount() const { return static_cast<unsigned int>(m_workers.size()); }
+	//̃Xbh[J[
+	bool IsWorkerThread() const;
+	Statistics GetStatistics() const;
+
+	//VOg(g̃VOg͎̃RXgN^[ŐɌĂłAj̏Ԃ̂)
+	static JobSystem& Get();
+
+private:
+	typedef JobCounter::Job Job;
+	struct Worker {
+		WorkStealingQueue<Job, QUEUE_CAPACITY> queue;
+		std::thread                            thread;
+	};
+
+	void Submit(Job* job);
+	Job* FindJob(bool background);
+	void Execute(Job* job, bool helping);
+	void Finish(JobCounter& counter);
+	void WorkerMain(unsigned int index);
+
+	std::vector<std::unique_ptr<Worker>> m_workers;
+
+	//! [J[ȊOς񂾂́EfbNꂽ
+	std::mutex        m_sharedMutex;
+	std::deque<Job*>  m_shared;
+	std::deque<Job*>  m_background;
+
+	//! ς܂ĂĒNĂȂ([J[Q邩̔f)
+	std::atomic<int64_t>    m_queued;
+	std::atomic<int64_t>    m_backgroundQueued;
+	//! sBackground(̓[J[-1At[̃Wû߂1󂯂)
+	std::atomic<int>        m_backgroundRunning;
+	int                     m_backgroundLimit;
+	std::mutex              m_sleepMutex;
+	std::condition_variable m_wake;
+	std::atomic<bool>       m_quit;
+
+	std::atomic<uint64_t> m_jobs;
+	std::atomic<uint64_t> m_steals;
+	std::atomic<uint64_t> m_helped;
+	std::atomic<uint64_t> m_backgroundJobs;
+	std::atomic<uint64_t> m_exceptions;
+};
@@ -0,0 +1,165 @@
+/**
+ * @file MappedFile.cpp
+ * @brief ǂݍݐp̃}bvht@CƁÄꕔǂރr[
+ * @author hoshi hirofumi
+ * @date 2026/10/19
+ */
+
+#include "MappedFile.h"
+
+#include <algorithm>
+#include <cstring>
+
+#ifdef _WIN32
+#ifndef WIN32_LEAN_AND_MEAN
+#define WIN32_LEAN_AND_MEAN
+#endif
+#ifndef NOMINMAX
+#define NOMINMAX
+#endif
+#include <windows.h>
+#else
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+
+namespace {
+	//! 0oCg̃t@C̃f[^(nullptr͊JȂƂ\̂)
+	const uint8_t EMPTY_FILE[1] = {};
+}
+
+#ifdef _WIN32
+MappedFile::MappedFile() : m_data(nullptr), m_size(0), m_mapped(false), m_file(INVALID_HANDLE_VALUE), m_mapping(nullptr)
+{
+}
+
+bool MappedFile::Open(const std::filesystem::path& path)
+{
+	Close();
+
+	m_file = CreateFileW(path.c_str(), GENERIC_READ, FILE_SHARE_READ, nullptr, OPEN_EXISTING, FILE_ATTRIBUTE_NORMAL, nullptr);
+	if (m_file == INVALID_HANDLE_VALUE)
+		return false;
+
+	LARGE_INTEGER size;
+	if (!GetFileSizeEx(m_file, &size)) {
+		Close();
+		return false;
+	}
+
+	m_size = static_cast<size_t>(size.QuadPart);
+	if (m_size == 0) {
+		m_data = EMPTY_FILE;
+		return true;
+	}
+
+	m_mapping = CreateFileMappingW(m_file, nullptr, PAGE_READONLY, 0, 0, nullptr);
+	if (m_mapping == nullptr) {
+		Close();
+		return false;
+	}
+
+	m_data = static_cast<const uint8_t*>(MapViewOfFile(m_mapping, FILE_MAP_READ, 0, 0, 0));
+	if (m_data == nullptr) {
+		Close();
+		return false;
+	}
+	m_mapped = true;
+	return true;
+}
+
+void MappedFile::Close()
+{
+	if (m_mapped)
+		UnmapViewOfFile(m_data);
+	if (m_mapping != nullptr)
+		CloseHandle(m_mapping);
+	if (m_file != INVALID_HANDLE_VALUE)
+		CloseHandle(m_file);
+
+	m_data    = nullptr;
+	m_size    = 0;
+	m_mapped  = false;
+	m_file    = INVALID_HANDLE_VALUE;
+	m_mapping = nullptr;
+}
+#else
+MappedFile::MappedFile() : m_data(nullptr), m_size(0), m_mapped(false), m_file(-1)
+{
+}
+
+bool MappedFile::Open(const std::filesystem::path& path)
+{
+	Close();
+
+	m_file = open(path.c_str(), O_RDONLY);
+	if (m_file < 0)
+		return false;
+
+	struct stat status;
+	if (fstat(m_file, &status) != 0) {
+		Close();
+		return false;
+	}
+
+	m_size = static_cast<size_t>(status.st_size);
+	if (m_size == 0) {
+		m_data = EMPTY_FILE;
+		return true;
+	}
+
+	void* data = mmap(nullptr, m_size, PROT_READ, MAP_PRIVATE, m_file, 0);
+	if (data == MAP_FAILED) {
+		Close();
+		return false;
+	}
+	m_data   = static_cast<const uint8_t*>(data);
+	m_mapped = true;
+	return true;
+}
+
+void MappedFile::Close()
+{
+	if (m_mapped)
+		munmap(const_cast<uint8_t*>(m_data), m_size);
+	if (m_file >= 0)
+		close(m_file);
+
+	m_data   = nullptr;
+	m_size   = 0;
+	m_mapped = false;
+	m_file   = -1;
+}
+#endif
+
+/**
+	@brief	fread̑
+	@return	ǂ߂(Ō1r܂łȂǂ߂Ac0)
+*/
+size_t FileView::Read(void* buffer, size_t size, size_t count)
+{
+	const size_t wanted = size * count;
+	const size_t bytes  = std::min(wanted, Remaining());
+
+	memcpy(buffer, m_data + m_position, bytes);
+	if (bytes < wanted)
+		memset(static_cast<uint8_t*>(buffer) + bytes, 0, wanted - bytes);
+
+	m_position += bytes;
+	return size == 0 ? 0 : bytes / size;
+}
+
+void FileView::Skip(long long offset)
+{
+	if (offset < 0)
+		m_position -= std::min(static_cast<size_t>(-offset), m_position);
+	else
+		m_position += std::min(static_cast<size_t>(offset), Remaining());
+}
+
+void FileView::Seek(size_t position)
+{
+	m_position = std::min(position, m_size);
+}
@@ -0,0 +1,91 @@
+/**
+ * @file MappedFile.h
+ * @brief ǂݍݐp̃}bvht@CƁÄꕔǂރr[
+ * @author hoshi hirofumi
+ * @date 2026/10/19
+ * @note Windows(CreateFileMapping)Linux(mmap)̗Ŏg(pbJ[CIœ)
+ */
+
+#pragma once
+
+/*
+-------------------------------------------------------------------------------------
+	CN[h
+-------------------------------------------------------------------------------------
+*/
+#include <cstddef>
+#include <cstdint>
+#include <filesystem>
+#include <memory>
+
+/*
+-------------------------------------------------------------------------------------
+	MappedFileNX@錾
+-------------------------------------------------------------------------------------
+*/
+class MappedFile {
+public:
+	MappedFile();
+	virtual ~MappedFile() { Close(); }
+
+	MappedFile(MappedFile&&) = delete;
+	MappedFile& operator= (MappedFile&&) = delete;
+
+	MappedFile(MappedFile const&) = delete;
+	MappedFile& operator= (MappedFile const&) = delete;
+
+	//t@CŜ}bv(0oCg̃t@CJ)
+	bool Open(const std::filesystem::path& path);
+	void Close();
+
+	bool           IsOpen() const { return m_data != nullptr; }
+	const uint8_t* Data() const { return m_data; }
+	size_t         Size() const { return m_size; }
+
+private:
+	const uint8_t* m_data;
+	size_t         m_size;
+	bool           m_mapped;	//0oCg̃t@C̓}bvȂ
+
+#ifdef _WIN32
+	void* m_file;
+	void* m_mapping;
+#else
+	int   m_file;
+#endif
+};
+
+/*
+-------------------------------------------------------------------------------------
+	FileView@}bvt@C(܂̓A[JCu1Gg)擪ǂ
+-------------------------------------------------------------------------------------
+*/
+class FileView {
+public:
+	FileView() : m_data(nullptr), m_size(0), m_position(0) {}
+	FileView(std::shared_ptr<const MappedFile> owner, const uint8_t* data, size_t size)
+		: m_owner(std::move(owner)), m_data(data), m_size(size), m_position(0) {}
+
+	//t@CJ
+	explicit operator bool() const { return m_data != nullptr; }
+
+	const uint8_t* Data() const { return m_data; }
+	size_t         Size() const { return m_size; }
+
+	//freadƓg(߂l͓ǂ߂AȂ0Ŗ߂)
+	size_t Read(void* buffer, size_t size, size_t count);
+	//fseekSEEK_CURESEEK_SET
+	void Skip(long long offset);
+	void Seek(size_t position);
+
+	size_t Tell() const { return m_position; }
+	size_t Remaining() const { return m_size - m_position; }
+	bool   IsEnd() const { return m_position >= m_size; }
+
+private:
+	//! }bvێ(A[JCũr[̓A[JCuŜ̃}bvL)
+	std::shared_ptr<const MappedFile> m_owner;
+	const uint8_t*                    m_data;
+	size_t                            m_size;
+	size_t                            m_position;
+};
@@ -0,0 +1,778 @@
+/**
+ * @file ModelBench.cpp
+ * @brief fE[V̓ǂݍ݂ƍXṼx`}[N(R}hCAQ[{̂̃vWFNgɂ͊܂߂Ȃ)
+ * @author hoshi hirofumi
+ * @date 2026/10/19
+ * @note CIł̃rh: g++ -std=c++17 -O2 -pthread ModelBench.cpp PmxReader.cpp VmdReader.cpp AssetFiles.cpp Archive.cpp
+ *                    MappedFile.cpp NameTable.cpp TextDecoder.cpp ImageDecoder.cpp BlockCompressor.cpp JobSystem.cpp -o ModelBench
+ *       ModelBench run [options] [model.pmx...]     Assets̑΃pX(ȗMainScene2)
+ *           --root <dir>       Assets̃fBNg(ȗ̓Jg)
+ *           --pak <file>       A[JCu}EgāAǂ
+ *           --vmd <file>       L[t[̕ԁE|[Yv郂[V(ȗ͓Motion/ModelBench.vmd)
+ *           --no-vmd           [Vǂ܂Ȃ(ԁE|[YvȂ)
+ *           --instances <n>    ԁE|[YEXLjOEJOv郂f̐(ȗ16)
+ *           --frames <n>       ԁE|[YEJOvt[(ȗ300AXLjO1/30)
+ *           --repeat <n>       JԂĒl(ȗ5)
+ *           --no-bake          eNX`̃fR[hEBCkvȂ
+ *           --out <file.json>  ʂo(compareŔׂ)
+ *       ModelBench compare <baseline.json> <current.json> [threshold%]
+ *           threshold%(ȗ10)xȂڂ1ŏI(0.05ms̍͏)
+ *       (f): loadEparseEskeletonEpose(--no-vmdȊO)EskinEcullEsubmit1/100/1000EdecodeEbakeA
+ *                       [V: vmd/parseEvmd/sample@(loadEparseEbakeȊO1t[)
+ *       submitNN̂1t[oCPŨRXg̖͌^(PmxLoader͓̂ȂBCaptureEWriteConstantsEDrawƓʂ
+ *       Rs[ƃR}h̋ŨAbv[ḧER}hXgɐςނŁAPmxLoader̕ύX͎ł͔fꂸAhCo[̕܂܂Ȃ)
+ *       Q[IKÊ͖ŌvȂ(|[YVMDLoader::UpdateƓ]ƃZ^[̐eq̊|Z)
+ */
+
+#include "PmxReader.h"
+#include "VmdReader.h"
+#include "AssetFiles.h"
+#include "ImageDecoder.h"
+#include "BlockCompressor.h"
+#include "JobSystem.h"
+#include "TextDecoder.h"
+
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <fstream>
+#include <map>
+#include <sstream>
+#include <string>
+
+namespace {
+	typedef std::chrono::steady_clock Clock;
+	//! ږ  ~b(قǗǂ)
+	typedef std::map<std::string, double> Metrics;
+
+	//! compareł菬͗hƂĈ(ZڂňȂ悤)
+	constexpr double NOISE_MS = 0.05;
+
+	double Elapsed(Clock::time_point start)
+	{
+		return std::chrono::duration<double, std::milli>(Clock::now() - start).count();
+	}
+
+	struct Options {
+		std::vector<std::string> models;
+		std::string  root;
+		std::string  pak;
+		std::string  vmd       = "Motion/ModelBench.vmd";	//Z^[E㔼gErEȂMMD̕W{[13{10t[
+		std::string  out;
+		unsigned int instances = 16;
+		unsigned int frames    = 300;
+		unsigned int repeat    = 5;
+		bool         bake      = true;
+	};
+
+	int Usage()
+	{
+		fprintf(stderr,
+			"usage: ModelBench run [--root dir] [--pak file] [--vmd file | --no-vmd] [--instances n] [--frames n]\n"
+			"                      [--repeat n] [--no-bake] [--out file.json] [model.pmx...]\n"
+			"       ModelBench compare <baseline.json> <current.json> [threshold%%]\n");
+		return 2;
+	}
+
+	//repeatvĒl(1ڂ̓t@C̃LbV߂̂Ŋ܂߂Ȃ)
+	template <class Function>
+	double Median(unsigned int repeat, Function function)
+	{
+		function();
+		std::vector<double> samples;
+		for (unsigned int i = 0; i < repeat; ++i) {
+			const auto start = Clock::now();
+			function();
+			samples.push_back(Elapsed(start));
+		}
+		std::sort(samples.begin(), samples.end());
+		return samples[samples.size() / 2];
+	}
+
+	//! VMDLoaderVMDKeyFrameƓo[(VmdReader::FindSegmentɓn)
+	struct KeyFrame {
+		unsigned int frame_no;
+		XMFLOAT4     quaternion;
+		XMFLOAT2     p1;
+		XMFLOAT2     p2;
+	};
+
+	//! {[  L[t[(VMDLoader::LoadVMDƓt[ԍ)
+	struct Motion {
+		std::unordered_map<NameId, std::vector<KeyFrame>> tracks;
+		unsigned int                                      maxFrame = 0;
+	};
+
+	//! DirectXMathƓsxNg(v * M)̍s(LinuxɂDirectXMatĥŕKvȕ)
+	struct Matrix4 {
+		float m[4][4];
+	};
+
+	Matrix4 Identity()
+	{
+		return Matrix4{ { { 1, 0, 0, 0 }, { 0, 1, 0, 0 }, { 0, 0, 1, 0 }, { 0, 0, 0, 1 } } };
+	}
+
+	Matrix4 Translation(float x, float y, float z)
+	{
+		auto matrix = Identity();
+		matrix.m[3][0] = x;
+		matrix.m[3][1] = y;
+		matrix.m[3][2] = z;
+		return matrix;
+	}
+
+	//XMMatrixRotationQuaternionƓ
+	Matrix4 Rotation(const XMFLOAT4& q)
+	{
+		const float xx = q.x * q.x, yy = q.y * q.y, zz = q.z * q.z;
+		const float xy = q.x * q.y, xz = q.x * q.z, yz = q.y * q.z;
+		const float wx = q.w * q.x, wy = q.w * q.y, wz = q.w * q.z;
+		return Matrix4{ {
+			{ 1 - 2 * (yy + zz), 2 * (xy + wz),     2 * (xz - wy),     0 },
+			{ 2 * (xy - wz),     1 - 2 * (xx + zz), 2 * (yz + wx),     0 },
+			{ 2 * (xz + wy),     2 * (yz - wx),     1 - 2 * (xx + yy), 0 },
+			{ 0,                 0,                 0,                 1 } } };
+	}
+
+	Matrix4 Multiply(const Matrix4& a, const Matrix4& b)
+	{
+		Matrix4 result;
+		for (int r = 0; r < 4; ++r)
+			for (int c = 0; c < 4; ++c)
+				result.m[r][c] = a.m[r][0] * b.m[0][c] + a.m[r][1] * b.m[1][c] + a.m[r][2] * b.m[2][c] + a.m[r][3] * b.m[3][c];
+		return result;
+	}
+
+	XMFLOAT3 TransformPoint(const XMFLOAT3& v, const Matrix4& m)
+	{
+		return XMFLOAT3{
+			v.x * m.m[0][0] + v.y * m.m[1][0] + v.z * m.m[2][0] + m.m[3][0],
+			v.x * m.m[0][1] + v.y * m.m[1][1] + v.z * m.m[2][1] + m.m[3][1],
+			v.x * m.m[0][2] + v.y * m.m[1][2] + v.z * m.m[2][2] + m.m[3][2] };
+	}
+
+	XMFLOAT3 TransformNormal(const XMFLOAT3& v, const Matrix4& m)
+	{
+		return XMFLOAT3{
+			v.x * m.m[0][0] + v.y * m.m[1][0] + v.z * m.m[2][0],
+			v.x * m.m[0][1] + v.y * m.m[1][1] + v.z * m.m[2][1],
+			v.x * m.m[0][2] + v.y * m.m[1][2] + v.z * m.m[2][2] };
+	}
+
+	//XMQuaternionSlerpƓ(߂)
+	XMFLOAT4 Slerp(const XMFLOAT4& a, XMFLOAT4 b, float t)
+	{
+		float cosine = a.x * b.x + a.y * b.y + a.z * b.z + a.w * b.w;
+		if (cosine < 0.0f) {
+			cosine = -cosine;
+			b = XMFLOAT4{ -b.x, -b.y, -b.z, -b.w };
+		}
+		float s0 = 1.0f - t, s1 = t;
+		if (cosine < 0.9999f) {
+			const float omega = std::acos(cosine);
+			const float sine  = std::sin(omega);
+			s0 = std::sin(s0 * omega) / sine;
+			s1 = std::sin(s1 * omega) / sine;
+		}
+		return XMFLOAT4{ a.x * s0 + b.x * s1, a.y * s0 + b.y * s1, a.z * s0 + b.z * s1, a.w * s0 + b.w * s1 };
+	}
+
+	//! f1̃̕|[Y(VMDLoadertracksEboneMatricesƓ)
+	struct Pose {
+		struct Track {
+			const PmxData::BoneNode*     node;
+			const std::vector<KeyFrame>* keyframes;
+		};
+		std::vector<Track>   tracks;
+		PmxData::BoneNode*   center = nullptr;
+		std::vector<Matrix4> matrices;
+
+		void MultiplyChildren(const PmxData::BoneNode* node, const Matrix4& parent)
+		{
+			auto& matrix = matrices[node->boneIndex];
+			matrix = Multiply(matrix, parent);
+			for (const auto* child : node->children)
+				MultiplyChildren(child, matrix);
+		}
+
+		//VMDLoader::UpdateBoneMatricesEUpdateTrackƓ(L[t[̒TVmdReader::FindSegmentL)
+		void Update(float frame)
+		{
+			std::fill(matrices.begin(), matrices.end(), Identity());
+			for (const auto& track : tracks) {
+				const auto& keyframes = *track.keyframes;
+				VmdReader::Segment segment;
+				if (!VmdReader::FindSegment(keyframes, frame, segment))
+					continue;
+
+				const auto& previous = keyframes[segment.previous];
+				const auto  rotation = segment.next != segment.previous
+					? Rotation(Slerp(previous.quaternion, keyframes[segment.next].quaternion, segment.weight))
+					: Rotation(previous.quaternion);
+				const auto& pos = track.node->startPos;
+				matrices[track.node->boneIndex] =
+					Multiply(Multiply(Translation(-pos.x, -pos.y, -pos.z), rotation), Translation(pos.x, pos.y, pos.z));
+			}
+			if (center)
+				MultiplyChildren(center, Identity());
+		}
+	};
+
+	//! 1t[ɕԂ郂[V̈ʒu(fɂ炷A60Hzŉ񂷂̂Œ[̃t[ʂ)
+	float MotionFrame(unsigned int frame, size_t instance, unsigned int maxFrame)
+	{
+		return std::fmod(static_cast<float>(frame) * 0.5f + static_cast<float>(instance) * 7.0f, static_cast<float>(maxFrame + 1));
+	}
+
+	/**
+		@brief	VMDLoader::UpdateƓ|[Y̌vZ
+	*/
+	void BenchPose(const Options& options, const std::string& key, PmxData& data, const Motion& motion,
+		std::vector<Pose>& poses, Metrics& metrics)
+	{
+		Pose pose;
+		pose.matrices.assign(data.bones.size(), Identity());
+		for (const auto& track : motion.tracks) {
+			auto it = data.boneNodeTable.find(track.first);
+			if (it != data.boneNodeTable.end())
+				pose.tracks.push_back({ &it->second, &track.second });
+		}
+		//\[X̕R[hɈˑȂ悤GXP[vŏ(Z^[)
+		auto center = data.boneNodeTable.find(NameTable::Get().Find(L"\u30bb\u30f3\u30bf\u30fc"));
+		if (center != data.boneNodeTable.end())
+			pose.center = &center->second;
+		poses.assign(options.instances, pose);
+
+		auto& jobs = JobSystem::Get();
+		const double total = Median(options.repeat, [&]() {
+			for (unsigned int frame = 0; frame < options.frames; ++frame) {
+				jobs.ParallelFor(poses.size(), [&](size_t begin, size_t end) {
+					for (size_t instance = begin; instance < end; ++instance)
+						poses[instance].Update(MotionFrame(frame, instance, motion.maxFrame));
+				});
+			}
+		});
+		metrics[key + "/pose"] = total / options.frames;
+		printf("%-24s %4zu of %zu motion tracks match bones%s\n", key.c_str(), pose.tracks.size(), motion.tracks.size(),
+			pose.center ? "" : " (no center bone, hierarchy not applied)");
+	}
+
+	/**
+		@brief	CPUł̃XLjO(VS.hlslƓő4{̃{[̏dݕtaAʒuƖ@)
+		@note	posesȂoCh|[Y(Pʍs)œʂvZ
+	*/
+	void BenchSkinning(const Options& options, const std::string& key, const PmxData& data,
+		const std::vector<Pose>& poses, Metrics& metrics)
+	{
+		const std::vector<Matrix4> bindPose(std::max<size_t>(data.bones.size(), 1), Identity());
+		const int bones = static_cast<int>(data.bones.size());
+		std::vector<std::vector<XMFLOAT3>> positions(options.instances, std::vector<XMFLOAT3>(data.vertices.size()));
+		std::vector<std::vector<XMFLOAT3>> normals(options.instances, std::vector<XMFLOAT3>(data.vertices.size()));
+
+		auto& jobs = JobSystem::Get();
+		const unsigned int frames = std::max(options.frames / 30, 1u);
+		const double total = Median(options.repeat, [&]() {
+			for (unsigned int frame = 0; frame < frames; ++frame) {
+				jobs.ParallelFor(options.instances, [&](size_t begin, size_t end) {
+					for (size_t instance = begin; instance < end; ++instance) {
+						const auto& palette = poses.empty() ? bindPose : poses[instance].matrices;
+						for (size_t i = 0; i < data.vertices.size(); ++i) {
+							const auto& vertex = data.vertices[i];
+							const auto& weight = vertex.weight;
+							const int   born[4]   = { weight.born1, weight.born2, weight.born3, weight.born4 };
+							const float amount[4] = { weight.weight1, weight.weight2, weight.weight3, weight.weight4 };
+
+							XMFLOAT3 position{ 0, 0, 0 }, normal{ 0, 0, 0 };
+							for (int k = 0; k < 4; ++k) {
+								if (born[k] < 0 || born[k] >= bones)
+									continue;
+								const auto p = TransformPoint(vertex.pos, palette[born[k]]);
+								const auto n = TransformNormal(vertex.normal, palette[born[k]]);
+								position = XMFLOAT3{ position.x + p.x * amount[k], position.y + p.y * amount[k], position.z + p.z * amount[k] };
+								normal   = XMFLOAT3{ normal.x + n.x * amount[k], normal.y + n.y * amount[k], normal.z + n.z * amount[k] };
+							}
+							positions[instance][i] = position;
+							normals[instance][i]   = normal;
+						}
+					}
+				});
+			}
+		});
+		const double ms = total / frames;
+		metrics[key + "/skin"] = ms;
+		printf("%-24s skinning %.1f M vertices/s\n", key.c_str(),
+			ms > 0.0 ? data.vertices.size() * static_cast<double>(options.instances) / (ms * 1000.0) : 0.0);
+	}
+
+	/**
+		@brief	PmxLoader::MaterialScreenSizesƓ(}eA̋E ~ CX^XŔ肵Aʏ̑傫߂)
+		@note	CX^X̓J̎ɕׁAJ񂵂Ĉꕔ䂩O悤ɂ
+	*/
+	void BenchCulling(const Options& options, const std::string& key, const PmxData& data, Metrics& metrics)
+	{
+		//PmxLoader::MaterialBoundsƓ}eÃCfbNX͈͂̒_(S͔͈͂̒S)
+		struct Sphere { XMFLOAT3 center; float radius; };
+		std::vector<Sphere> bounds;
+		size_t offset = 0;
+		for (const auto& material : data.materials) {
+			XMFLOAT3 lower{ 1e30f, 1e30f, 1e30f }, upper{ -1e30f, -1e30f, -1e30f };
+			const size_t end = std::min(offset + material.indicesNum, data.surfaces.size());
+			for (size_t j = offset; j < end; ++j) {
+				const auto& pos = data.vertices[data.surfaces[j].vertexIndex].pos;
+				lower = XMFLOAT3{ std::min(lower.x, pos.x), std::min(lower.y, pos.y), std::min(lower.z, pos.z) };
+				upper = XMFLOAT3{ std::max(upper.x, pos.x), std::max(upper.y, pos.y), std::max(upper.z, pos.z) };
+			}
+			Sphere sphere{ { 0, 0, 0 }, 0 };
+			if (end > offset) {
+				sphere.center = XMFLOAT3{ (lower.x + upper.x) * 0.5f, (lower.y + upper.y) * 0.5f, (lower.z + upper.z) * 0.5f };
+				for (size_t j = offset; j < end; ++j) {
+					const auto& pos = data.vertices[data.surfaces[j].vertexIndex].pos;
+					const float dx = pos.x - sphere.center.x, dy = pos.y - sphere.center.y, dz = pos.z - sphere.center.z;
+					sphere.radius = std::max(sphere.radius, std::sqrt(dx * dx + dy * dy + dz * dz));
+				}
+			}
+			bounds.push_back(sphere);
+			offset += material.indicesNum;
+		}
+
+		std::vector<Matrix4> worlds;
+		const int side = static_cast<int>(std::ceil(std::sqrt(static_cast<double>(options.instances))));
+		for (unsigned int i = 0; i < options.instances; ++i)
+			worlds.push_back(Translation((static_cast<float>(i % side) - side * 0.5f) * 30.0f, 0.0f, (static_cast<float>(i / side) - side * 0.5f) * 30.0f));
+
+		//c̉p45xE16:9A1080sNZ(1̔a1̉ʏ̑傫)
+		const float tanY = std::tan(3.14159265f / 8.0f), tanX = tanY * 16.0f / 9.0f;
+		const float pixelScale = 1080.0f * 0.5f / tanY;
+		const float cosX = 1.0f / std::sqrt(1.0f + tanX * tanX), sinX = tanX * cosX;
+		const float cosY = 1.0f / std::sqrt(1.0f + tanY * tanY), sinY = tanY * cosY;
+
+		std::vector<float>  screenSizes(bounds.size());
+		std::vector<size_t> visible(bounds.size());
+		auto& jobs = JobSystem::Get();
+		const double total = Median(options.repeat, [&]() {
+			std::fill(visible.begin(), visible.end(), 0);
+			for (unsigned int frame = 0; frame < options.frames; ++frame) {
+				//J͌_̏ŉ(r[sY]̋t)
+				const float yaw = static_cast<float>(frame) * 0.02f;
+				const Matrix4 view = Multiply(Translation(0.0f, -15.0f, 0.0f), Rotation(XMFLOAT4{ 0.0f, std::sin(-yaw * 0.5f), 0.0f, std::cos(-yaw * 0.5f) }));
+				std::fill(screenSizes.begin(), screenSizes.end(), -1.0f);
+
+				jobs.ParallelFor(bounds.size(), [&](size_t begin, size_t end) {
+					for (size_t i = begin; i < end; ++i) {
+						for (const auto& world : worlds) {
+							const auto center = TransformPoint(bounds[i].center, Multiply(world, view));
+							const float radius = bounds[i].radius;
+							if (center.z < 0.1f - radius || center.z > 1000.0f + radius ||
+								std::fabs(center.x) * cosX - center.z * sinX > radius ||
+								std::fabs(center.y) * cosY - center.z * sinY > radius)
+								continue;
+
+							const float length   = std::sqrt(center.x * center.x + center.y * center.y + center.z * center.z);
+							const float distance = std::max(length - radius, 0.1f);
+							screenSizes[i] = std::max(screenSizes[i], 2.0f * radius * pixelScale / distance);
+							++visible[i];
+						}
+					}
+				});
+			}
+		});
+		metrics[key + "/cull"] = total / options.frames;
+		size_t drawn = 0;
+		for (size_t count : visible)
+			drawn += count;
+		printf("%-24s culling %zu materials x %u instances, %.0f%% drawn\n", key.c_str(), bounds.size(), options.instances,
+			bounds.empty() ? 0.0 : 100.0 * drawn / (static_cast<double>(bounds.size()) * options.instances * options.frames));
+	}
+
+	//! PmxStructList.hInstanceDataƓ(VSStructuredBuffer)
+	struct InstanceData {
+		Matrix4      world;
+		unsigned int boneOffset;
+		unsigned int padding[3];
+	};
+	static_assert(sizeof(InstanceData) == 80, "InstanceData must match the shader layout");
+
+	//! L^邾̃R}hXg(ID3D12GraphicsCommandLisťĂяo1 = 1)
+	struct CommandRecorder {
+		struct Command {
+			unsigned int op;
+			uint64_t     args[3];
+		};
+		std::vector<Command> commands;
+
+		void Record(unsigned int op, uint64_t a = 0, uint64_t b = 0, uint64_t c = 0) { commands.push_back(Command{ op, { a, b, c } }); }
+	};
+
+	//! GraphicsMemory̑(t[ɐ擪l߂A萔obt@[256oCgE)
+	struct UploadRing {
+		std::vector<unsigned char> memory;
+		size_t                     offset = 0;
+
+		void* Allocate(size_t size, size_t alignment)
+		{
+			offset = (offset + alignment - 1) & ~(alignment - 1);
+			if (offset + size > memory.size())
+				memory.resize((offset + size) * 2);
+			void* result = memory.data() + offset;
+			offset += size;
+			return result;
+		}
+	};
+
+	/**
+		@brief	1t[̒o̖͌^(PmxLoaderCapture  WriteConstants  DrawƓʂ̃Rs[ER}hς)
+		@note	PmxLoaderĂԂ̂ł͂Ȃʂ̂Ȃ̂ŁAPmxLoaderς炱킹
+		@param	instanced trueȂCX^X`(}eA1)AfalseȂPmxLoaderׂ̐Ƃ
+	*/
+	void Submit(const PmxData& data, unsigned int count, bool instanced, const std::vector<Matrix4>& bones,
+		std::vector<InstanceData>& instances, std::vector<InstanceData>& captured, UploadRing& upload, CommandRecorder& commands)
+	{
+		const unsigned int loaders = instanced ? 1 : count;
+		const unsigned int drawn   = instanced ? count : 1;
+
+		//Q[: ̖ɍs(SetInstanceTransform)
+		for (unsigned int i = 0; i < count; ++i) {
+			instances[i].world      = Translation(static_cast<float>(i % 32) * 2.0f, 0.0f, static_cast<float>(i / 32) * 2.0f);
+			instances[i].boneOffset = 0;
+		}
+
+		for (unsigned int loader = 0; loader < loaders; ++loader) {
+			const InstanceData* source = instanced ? instances.data() : &instances[loader];
+
+			//Capture
+			captured.assign(source, source + drawn);
+
+			//WriteConstants(JE[h͒萔obt@[A{[512{ACX^XStructuredBuffer)
+			Matrix4 camera[2] = { Identity(), Identity() };
+			memcpy(upload.Allocate(sizeof(camera), 256), camera, sizeof(camera));
+			const Matrix4 world = Identity();
+			memcpy(upload.Allocate(sizeof(world), 256), &world, sizeof(world));
+			auto palette = static_cast<Matrix4*>(upload.Allocate(sizeof(Matrix4) * 512, 256));
+			for (size_t i = 0; i < 512; ++i)
+				palette[i] = i < bones.size() ? bones[i] : Identity();
+			memcpy(upload.Allocate(sizeof(InstanceData) * drawn, 16), captured.data(), sizeof(InstanceData) * drawn);
+
+			//Draw(Ԃ̐ݒƃ}eA̕`)
+			for (unsigned int op = 0; op < 13; ++op)
+				commands.Record(op, loader);
+			unsigned int indexOffset = 0;
+			for (size_t i = 0; i < data.materials.size(); ++i) {
+				commands.Record(100, i);
+				commands.Record(101, data.materials[i].indicesNum, drawn, indexOffset);
+				indexOffset += data.materials[i].indicesNum;
+			}
+		}
+	}
+
+	/**
+		@brief	1E100E1000̂`ƂCPU̒oRXg̖͌^(CX^X`ƁAPmxLoaderׂ̐Ƃ̔r)
+	*/
+	void BenchSubmission(const Options& options, const std::string& key, const PmxData& data, Metrics& metrics)
+	{
+		const std::vector<Matrix4> bones(data.bones.size(), Identity());
+		std::vector<InstanceData> instances(1000), captured;
+		UploadRing upload;
+		CommandRecorder commands;
+
+		for (unsigned int count : { 1u, 100u, 1000u }) {
+			double ms[2];
+			size_t recorded[2];
+			for (int instanced = 1; instanced >= 0; --instanced) {
+				ms[instanced] = Median(options.repeat, [&]() {
+					upload.offset = 0;
+					commands.commands.clear();
+					Submit(data, count, instanced != 0, bones, instances, captured, upload, commands);
+				});
+				recorded[instanced] = commands.commands.size();
+			}
+			metrics[key + "/submit" + std::to_string(count)] = ms[1];
+			printf("%-24s submit %4u (model): instanced %8.3f ms %6zu commands, separate loaders %8.3f ms %7zu commands\n",
+				key.c_str(), count, ms[1], recorded[1], ms[0], recorded[0]);
+		}
+	}
+
+	bool BenchModel(const Options& options, const std::string& model, const Motion* motion, Metrics& metrics)
+	{
+		const std::filesystem::path path = std::filesystem::u8path(model);
+		const std::string key = path.filename().u8string();
+
+		PmxData data;
+		{
+			FileView fp = AssetFiles::Get().Open(path);
+			if (!fp || !PmxReader::Read(fp, data)) {
+				fprintf(stderr, "%s: failed to read\n", model.c_str());
+				return false;
+			}
+		}
+
+		//JƂ납(A[JCuȂ}bv̋LAʂ̃t@CȂ}bv)
+		metrics[key + "/load"] = Median(options.repeat, [&]() {
+			FileView fp = AssetFiles::Get().Open(path);
+			PmxData loaded;
+			PmxReader::Read(fp, loaded);
+		});
+
+		FileView view = AssetFiles::Get().Open(path);
+		metrics[key + "/parse"] = Median(options.repeat, [&]() {
+			FileView fp = view;
+			PmxData parsed;
+			PmxReader::Read(fp, parsed);
+		});
+
+		metrics[key + "/skeleton"] = Median(options.repeat, [&]() {
+			data.boneNodeTable.clear();
+			PmxReader::Map(data);
+		});
+
+		printf("%-24s %7d vertices %7d indices %4d materials %4d bones %3d textures\n", key.c_str(),
+			data.numVertex, data.numSurfaces, data.numMaterial, data.numBone, data.numTexture);
+
+		std::vector<Pose> poses;
+		if (motion)
+			BenchPose(options, key, data, *motion, poses, metrics);
+		BenchSkinning(options, key, data, poses, metrics);
+		BenchCulling(options, key, data, metrics);
+		BenchSubmission(options, key, data, metrics);
+
+		if (!options.bake)
+			return true;
+
+		//TextureBakerƓfR[h  ~bv  BC1/BC3(Linux̃P[ŃCh̃pXϊȂ悤UTF-8)
+		std::vector<std::filesystem::path> textures;
+		for (const auto& texture : data.texturePaths)
+			textures.push_back(path.parent_path() / std::filesystem::u8path(TextDecoder::ToUtf8(texture)));
+
+		size_t missing = 0;
+		metrics[key + "/decode"] = Median(options.repeat, [&]() {
+			missing = 0;
+			DecodedImage image;
+			for (const auto& texture : textures) {
+				if (ImageDecoder::DecodeFile(texture, image) != ImageDecoder::Result::Ok)
+					++missing;
+			}
+		});
+		metrics[key + "/bake"] = Median(options.repeat, [&]() {
+			DecodedImage    image;
+			CompressedImage compressed;
+			for (const auto& texture : textures) {
+				if (ImageDecoder::DecodeFile(texture, image) != ImageDecoder::Result::Ok)
+					continue;
+				BlockCompressor::Compress(image, BlockCompressor::ChooseFormat(image.levels[0]), compressed);
+			}
+		});
+		if (missing > 0)
+			printf("%-24s %zu of %zu textures skipped (missing or not supported by ImageDecoder)\n", key.c_str(), missing, textures.size());
+		return true;
+	}
+
+	bool BenchMotion(const Options& options, Motion& motion, Metrics& metrics)
+	{
+		const std::filesystem::path path = std::filesystem::u8path(options.vmd);
+		std::vector<VMDData> motions;
+		metrics["vmd/parse"] = Median(options.repeat, [&]() {
+			FileView fp = AssetFiles::Get().Open(path);
+			motions.clear();
+			if (fp)
+				VmdReader::Read(fp, motions);
+		});
+		if (motions.empty()) {
+			fprintf(stderr, "%s: no keyframes\n", options.vmd.c_str());
+			return false;
+		}
+
+		//VMDLoader::LoadVMDƓ
+		for (const auto& data : motions) {
+			motion.tracks[data.name].push_back(KeyFrame{ data.frame_no, data.quaternion,
+				XMFLOAT2{ data.bezier[3] / 127.0f, data.bezier[7] / 127.0f },
+				XMFLOAT2{ data.bezier[11] / 127.0f, data.bezier[15] / 127.0f } });
+			motion.maxFrame = std::max(motion.maxFrame, data.frame_no);
+		}
+		std::vector<const std::vector<KeyFrame>*> tracks;
+		for (auto& track : motion.tracks) {
+			std::stable_sort(track.second.begin(), track.second.end(), [](const KeyFrame& a, const KeyFrame& b) { return a.frame_no < b.frame_no; });
+			tracks.push_back(&track.second);
+		}
+
+		//L[t[̒TƕԌW(VMDLoaderƓVmdReader::FindSegment)AQ[ƓWuVXeŕ
+		auto& jobs = JobSystem::Get();
+		std::vector<float> weights(static_cast<size_t>(options.instances) * tracks.size());
+		const double total = Median(options.repeat, [&]() {
+			for (unsigned int frame = 0; frame < options.frames; ++frame) {
+				jobs.ParallelFor(options.instances, [&](size_t begin, size_t end) {
+					for (size_t instance = begin; instance < end; ++instance) {
+						const float position = MotionFrame(frame, instance, motion.maxFrame);
+						for (size_t i = 0; i < tracks.size(); ++i) {
+							VmdReader::Segment segment;
+							weights[instance * tracks.size() + i] =
+								VmdReader::FindSegment(*tracks[i], position, segment) ? segment.weight : -1.0f;
+						}
+					}
+				});
+			}
+		});
+		metrics["vmd/sample"] = total / std::max(options.frames, 1u);
+
+		printf("%-24s %7zu keyframes %4zu tracks %6u frames, %u instances x %u frames\n",
+			path.filename().u8string().c_str(), motions.size(), tracks.size(), motion.maxFrame, options.instances, options.frames);
+		return true;
+	}
+
+	bool WriteJson(const std::string& path, const Options& options, const Metrics& metrics)
+	{
+		std::ofstream file(path, std::ios::trunc);
+		if (!file)
+			return false;
+
+		file << "{\n  \"instances\": " << options.instances << ",\n  \"frames\": " << options.frames
+			<< ",\n  \"repeat\": " << options.repeat << ",\n  \"workers\": " << JobSystem::Get().GetWorkerCount()
+			<< ",\n  \"metrics\": {";
+		bool first = true;
+		char value[32];
+		for (const auto& metric : metrics) {
+			snprintf(value, sizeof(value), "%.4f", metric.second);
+			file << (first ? "\n" : ",\n") << "    \"" << metric.first << "\": " << value;
+			first = false;
+		}
+		file << "\n  }\n}\n";
+		return static_cast<bool>(file);
+	}
+
+	/**
+		@note	WriteJson`ǂ("metrics"̒ "O": l)
+	*/
+	bool ReadJson(const std::string& path, Metrics& metrics)
+	{
+		std::ifstream file(path);
+		if (!file)
+			return false;
+		std::stringstream stream;
+		stream << file.rdbuf();
+		const std::string text = stream.str();
+
+		size_t position = text.find("\"metrics\"");
+		if (position == std::string::npos)
+			return false;
+		position = text.find('{', position);
+		const size_t end = text.find('}', position);
+		if (position == std::string::npos || end == std::string::npos)
+			return false;
+
+		while ((position = text.find('"', position + 1)) < end) {
+			const size_t close = text.find('"', position + 1);
+			const size_t colon = text.find(':', close);
+			if (close >= end || colon >= end)
+				return false;
+			metrics[text.substr(position + 1, close - position - 1)] = atof(text.c_str() + colon + 1);
+			position = text.find_first_of(",}", colon);
+		}
+		return true;
+	}
+
+	int Run(int argc, char* argv[])
+	{
+		Options options;
+		for (int i = 2; i < argc; ++i) {
+			const std::string arg = argv[i];
+			const bool hasValue = i + 1 < argc;
+			if (arg == "--root" && hasValue)
+				options.root = argv[++i];
+			else if (arg == "--pak" && hasValue)
+				options.pak = argv[++i];
+			else if (arg == "--vmd" && hasValue)
+				options.vmd = argv[++i];
+			else if (arg == "--no-vmd")
+				options.vmd.clear();
+			else if (arg == "--out" && hasValue)
+				options.out = argv[++i];
+			else if (arg == "--instances" && hasValue)
+				options.instances = std::max(atoi(argv[++i]), 1);
+			else if (arg == "--frames" && hasValue)
+				options.frames = std::max(atoi(argv[++i]), 1);
+			else if (arg == "--repeat" && hasValue)
+				options.repeat = std::max(atoi(argv[++i]), 1);
+			else if (arg == "--no-bake")
+				options.bake = false;
+			else if (arg.compare(0, 2, "--") == 0)
+				return Usage();
+			else
+				options.models.push_back(arg);
+		}
+		//\[X̕R[hɈˑȂ悤GXP[vŏ(ɂ񎮗얲)
+		if (options.models.empty())
+			options.models = { u8"Model/\u306b\u304c\u3082\u3093\u5f0f\u970a\u5922/reimu.pmx", "Model/Stage_ST43/ST43.pmx" };
+
+		//Q[ƓAssets̑΃pXŊJ
+		if (!options.root.empty())
+			std::filesystem::current_path(std::filesystem::u8path(options.root));
+		if (!options.pak.empty() && !AssetFiles::Get().Mount(std::filesystem::u8path(options.pak))) {
+			fprintf(stderr, "failed to mount %s\n", options.pak.c_str());
+			return 1;
+		}
+
+		//[Vɓǂ݁Aef̃|[YɎg
+		Metrics metrics;
+		Motion  motion;
+		int failures = 0;
+		const bool hasMotion = !options.vmd.empty() && BenchMotion(options, motion, metrics);
+		if (!options.vmd.empty() && !hasMotion)
+			++failures;
+		for (const auto& model : options.models)
+			failures += BenchModel(options, model, hasMotion ? &motion : nullptr, metrics) ? 0 : 1;
+
+		for (const auto& metric : metrics)
+			printf("  %-32s %10.3f ms\n", metric.first.c_str(), metric.second);
+
+		if (!options.out.empty() && !WriteJson(options.out, options, metrics)) {
+			fprintf(stderr, "failed to write %s\n", options.out.c_str());
+			return 1;
+		}
+		return failures == 0 ? 0 : 1;
+	}
+
+	int Compare(const char* baselinePath, const char* currentPath, double threshold)
+	{
+		Metrics baseline, current;
+		if (!ReadJson(baselinePath, baseline) || !ReadJson(currentPath, current)) {
+			fprintf(stderr, "failed to read %s or %s\n", baselinePath, currentPath);
+			return 2;
+		}
+
+		int regressions = 0;
+		for (const auto& metric : baseline) {
+			const auto it = current.find(metric.first);
+			if (it == current.end()) {
+				printf("  %-32s %10.3f ms -> (missing)\n", metric.first.c_str(), metric.second);
+				continue;
+			}
+
+			const double change = metric.second > 0.0 ? (it->second / metric.second - 1.0) * 100.0 : 0.0;
+			const bool regressed = change > threshold && it->second - metric.second > NOISE_MS;
+			printf("  %-32s %10.3f ms -> %10.3f ms %+7.1f%%%s\n", metric.first.c_str(),
+				metric.second, it->second, change, regressed ? "  REGRESSION" : "");
+			regressions += regressed ? 1 : 0;
+		}
+		for (const auto& metric : current) {
+			if (baseline.find(metric.first) == baseline.end())
+				printf("  %-32s (new)         -> %10.3f ms\n", metric.first.c_str(), metric.second);
+		}
+
+		printf("%d regression(s) over %.1f%%\n", regressions, threshold);
+		return regressions == 0 ? 0 : 1;
+	}
+}
+
+int main(int argc, char* argv[])
+{
+	if (argc < 2)
+		return Usage();
+
+	if (strcmp(argv[1], "run") == 0)
+		return Run(argc, argv);
+	if (strcmp(argv[1], "compare") == 0 && argc >= 4)
+		return Compare(argv[2], argv[3], argc > 4 ? atof(argv[4]) : 10.0);
+	return Usage();
+}
@@ -0,0 +1,64 @@
+/**
+ * @file ModelCache.cpp
+ * @brief ǂݍݍς݃f(͂PMXƒ_ECfbNXobt@[)̋L
+ * @author hoshi hirofumi
+ * @date 2026/10/19
+ */
+
+#include "ModelCache.h"
+
+/**
+	@brief	ǂݍݍς݂̃fT
+	@param	fileName Kt@C
+	@return Ȃnullptr
+*/
+std::shared_ptr<const ModelCache::Model> ModelCache::Find(const std::wstring& fileName)
+{
+	return m_cache.Find(fileName);
+}
+
+/**
+	@brief	ǂݍ񂾃fo^
+	@note	f𓯎ɓǂݍ񂾏ꍇ͐ɓo^c(͎̃̕obt@[g)
+*/
+std::shared_ptr<const ModelCache::Model> ModelCache::Insert(const std::wstring& fileName, const PmxData& data,
+	ID3D12Resource* vertexBuffer, ID3D12Resource* indexBuffer, UploadQueue::Token upload)
+{
+	return m_cache.Insert(fileName, [&]() {
+		auto model = std::make_shared<Model>();
+		model->data         = data;
+		model->vertexBuffer = vertexBuffer;
+		model->indexBuffer  = indexBuffer;
+		model->upload       = upload;
+		return model;
+	});
+}
+
+/**
+	@brief	LbVQƂĂȂf
+	@return 
+	@note	GPUgIĂĂԂ(V[̐؂ւ̌Ȃ)
+*/
+size_t ModelCache::Trim()
+{
+	return m_cache.Trim();
+}
+
+void ModelCache::Clear()
+{
+	m_cache.Clear();
+}
+
+ModelCache::Statistics ModelCache::GetStatistics() const
+{
+	return m_cache.GetStatistics();
+}
+
+/**
+	@brief	Sfʂ̃CX^X
+*/
+ModelCache& ModelCache::Get()
+{
+	static ModelCache instance;
+	return instance;
+}
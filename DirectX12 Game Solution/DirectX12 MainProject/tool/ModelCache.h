@@ -0,0 +1,78 @@
+/**
+ * @file ModelCache.h
+ * @brief ǂݍݍς݃f(͂PMXƒ_ECfbNXobt@[)̋L
+ * @author hoshi hirofumi
+ * @date 2026/10/19
+ * @note V[؂ւĂÃV[ǂݍݏI܂TrimȂ
+ *       ̃V[Ŏgf(Xe[WȂ)͓ǂݒɈp
+ */
+
+#pragma once
+
+/*
+-------------------------------------------------------------------------------------
+	CN[h
+-------------------------------------------------------------------------------------
+*/
+#include "Base/pch.h"
+#include "Base/dxtk.h"
+#include "PmxData.h"
+#include "UploadQueue.h"
+#include "SharedCache.h"
+
+/*
+-------------------------------------------------------------------------------------
+	using
+-------------------------------------------------------------------------------------
+*/
+using Microsoft::WRL::ComPtr;
+using std::unique_ptr;
+using std::make_unique;
+using namespace DirectX;
+
+/*
+-------------------------------------------------------------------------------------
+	ModelCacheNX@錾
+-------------------------------------------------------------------------------------
+*/
+class ModelCache {
+public:
+	//! ǂݍݍς݂̃f(Ȃ)
+	struct Model {
+		PmxData                data;
+		ComPtr<ID3D12Resource> vertexBuffer;
+		ComPtr<ID3D12Resource> indexBuffer;
+		UploadQueue::Token     upload;		//_ECfbNX̓]
+	};
+
+	typedef SharedCache<Model>::Statistics Statistics;
+
+	ModelCache() {}
+	virtual ~ModelCache() {}
+
+	ModelCache(ModelCache&&) = delete;
+	ModelCache& operator= (ModelCache&&) = delete;
+
+	ModelCache(ModelCache const&) = delete;
+	ModelCache& operator= (ModelCache const&) = delete;
+
+	//Ȃnullptr(fileNameTextureCache::NormalizePath)
+	std::shared_ptr<const Model> Find(const std::wstring& fileName);
+	//ǂݍ񂾃fo^(ɓo^Ă΂Ԃ)
+	std::shared_ptr<const Model> Insert(const std::wstring& fileName, const PmxData& data,
+		ID3D12Resource* vertexBuffer, ID3D12Resource* indexBuffer, UploadQueue::Token upload);
+
+	//ǂPmxLoadergĂȂf
+	size_t Trim();
+	//S(foCXXg)
+	void Clear();
+
+	Statistics GetStatistics() const;
+
+	//VOg
+	static ModelCache& Get();
+
+private:
+	//! KpX  f
+	SharedCache<Model> m_cache;
+};
@@ -0,0 +1,50 @@
+/**
+ * @file NameTable.cpp
+ * @brief {[E}eAE[t̋L(OɓԍUAƍ𐮐̔rɂ)
+ * @author hoshi hirofumi
+ * @date 2026/10/19
+ */
+
+#include "NameTable.h"
+
+NameId NameTable::Intern(std::wstring_view name)
+{
+	std::lock_guard<std::mutex> lock(m_mutex);
+
+	auto it = m_ids.find(name);
+	if (it != m_ids.end())
+		return it->second;
+
+	const NameId id = static_cast<NameId>(m_names.size());
+	m_names.emplace_back(name);
+	m_ids.emplace(m_names.back(), id);
+	return id;
+}
+
+NameId NameTable::Find(std::wstring_view name) const
+{
+	std::lock_guard<std::mutex> lock(m_mutex);
+
+	auto it = m_ids.find(name);
+	return it != m_ids.end() ? it->second : INVALID_NAME;
+}
+
+const std::wstring& NameTable::Lookup(NameId id) const
+{
+	static const std::wstring EMPTY;
+
+	std::lock_guard<std::mutex> lock(m_mutex);
+	return id < m_names.size() ? m_names[id] : EMPTY;
+}
+
+size_t NameTable::Size() const
+{
+	std::lock_guard<std::mutex> lock(m_mutex);
+	return m_names.size();
+}
+
+NameTable& NameTable::Get()
+{
+	static NameTable instance;
+	return instance;
+}
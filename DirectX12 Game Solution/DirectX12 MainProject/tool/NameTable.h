@@ -0,0 +1,66 @@
+/**
+ * @file NameTable.h
+ * @brief {[E}eAE[t̋L(OɓԍUAƍ𐮐̔rɂ)
+ * @author hoshi hirofumi
+ * @date 2026/10/19
+ */
+
+#pragma once
+
+/*
+-------------------------------------------------------------------------------------
+	CN[h
+-------------------------------------------------------------------------------------
+*/
+#include <cstdint>
+#include <deque>
+#include <mutex>
+#include <string>
+#include <string_view>
+#include <unordered_map>
+
+/*
+-------------------------------------------------------------------------------------
+	using
+-------------------------------------------------------------------------------------
+*/
+//! O̔ԍ(vZXI܂ŕςȂ)
+typedef uint32_t NameId;
+
+/*
+-------------------------------------------------------------------------------------
+	NameTableNX@錾
+-------------------------------------------------------------------------------------
+*/
+class NameTable {
+public:
+	static constexpr NameId INVALID_NAME = UINT32_MAX;
+
+	NameTable() {}
+	virtual ~NameTable() {}
+
+	NameTable(NameTable&&) = delete;
+	NameTable& operator= (NameTable&&) = delete;
+
+	NameTable(NameTable const&) = delete;
+	NameTable& operator= (NameTable const&) = delete;
+
+	//߂Ă̖OȂԍU([J[XbhĂł悢)
+	NameId Intern(std::wstring_view name);
+	//UĂȂINVALID_NAME(\𑝂₳Ȃ)
+	NameId Find(std::wstring_view name) const;
+	//fobO\p
+	const std::wstring& Lookup(NameId id) const;
+
+	size_t Size() const;
+
+	//VOg
+	static NameTable& Get();
+
+private:
+	//! ̎(dequeȂ̂ŒǉĂ̗vf͓Ȃ)
+	std::deque<std::wstring>                      m_names;
+	std::unordered_map<std::wstring_view, NameId> m_ids;
+
+	mutable std::mutex m_mutex;
+};
@@ -0,0 +1,147 @@
+/**
+ * @file PipelineHash.h
+ * @brief pCvCݒ̃nbV(PipelineLibrarỹL[)
+ * @author hoshi hirofumi
+ * @date 2026/10/19
+ * @note D3D12_GRAPHICS_PIPELINE_STATE_DESCƓo[̍\̂Ȃ牽ł󂯎̂ŁA
+ *       D3D12̃wb_[ĂCPUŊm߂(PipelineHashTest.cpp)
+ */
+
+#pragma once
+
+/*
+-------------------------------------------------------------------------------------
+	CN[h
+-------------------------------------------------------------------------------------
+*/
+#include "Hash.h"
+
+#include <cstdint>
+
+/*
+-------------------------------------------------------------------------------------
+	PipelineHash@錾
+-------------------------------------------------------------------------------------
+*/
+namespace PipelineHash {
+	template<class Bytecode>
+	void AddBytecode(Hasher& hash, const Bytecode& shader)
+	{
+		hash.Add(shader.BytecodeLength);
+		hash.Add(shader.pShaderBytecode, shader.BytecodeLength);
+	}
+
+	template<class Layout>
+	void AddInputLayout(Hasher& hash, const Layout& layout)
+	{
+		hash.Add(layout.NumElements);
+		for (unsigned int i = 0; i < layout.NumElements; ++i) {
+			const auto& element = layout.pInputElementDescs[i];
+			hash.Add(element.SemanticName);
+			hash.Add(element.SemanticIndex);
+			hash.Add(element.Format);
+			hash.Add(element.InputSlot);
+			hash.Add(element.AlignedByteOffset);
+			hash.Add(element.InputSlotClass);
+			hash.Add(element.InstanceDataStepRate);
+		}
+	}
+
+	template<class StencilOp>
+	void AddStencilOp(Hasher& hash, const StencilOp& op)
+	{
+		hash.Add(op.StencilFailOp);
+		hash.Add(op.StencilDepthFailOp);
+		hash.Add(op.StencilPassOp);
+		hash.Add(op.StencilFunc);
+	}
+
+	/**
+		@brief	`挋ʂ߂(VF[_[EuhEX^CU[E[xE`E_̌`)
+		@note	ꂪȂ쐬҂̊ԂɑɎgĂڂ͕ςȂ
+	*/
+	template<class Desc>
+	void AddDrawState(Hasher& hash, const Desc& desc)
+	{
+		AddBytecode(hash, desc.VS);
+		AddBytecode(hash, desc.PS);
+		AddBytecode(hash, desc.DS);
+		AddBytecode(hash, desc.HS);
+		AddBytecode(hash, desc.GS);
+
+		const auto& blend = desc.BlendState;
+		hash.Add(blend.AlphaToCoverageEnable);
+		hash.Add(blend.IndependentBlendEnable);
+		for (const auto& target : blend.RenderTarget) {
+			hash.Add(target.BlendEnable);
+			hash.Add(target.LogicOpEnable);
+			hash.Add(target.SrcBlend);
+			hash.Add(target.DestBlend);
+			hash.Add(target.BlendOp);
+			hash.Add(target.SrcBlendAlpha);
+			hash.Add(target.DestBlendAlpha);
+			hash.Add(target.BlendOpAlpha);
+			hash.Add(target.LogicOp);
+			hash.Add(target.RenderTargetWriteMask);
+		}
+		hash.Add(desc.SampleMask);
+
+		const auto& raster = desc.RasterizerState;
+		hash.Add(raster.FillMode);
+		hash.Add(raster.CullMode);
+		hash.Add(raster.FrontCounterClockwise);
+		hash.Add(raster.DepthBias);
+		hash.Add(raster.DepthBiasClamp);
+		hash.Add(raster.SlopeScaledDepthBias);
+		hash.Add(raster.DepthClipEnable);
+		hash.Add(raster.MultisampleEnable);
+		hash.Add(raster.AntialiasedLineEnable);
+		hash.Add(raster.ForcedSampleCount);
+		hash.Add(raster.ConservativeRaster);
+
+		const auto& depth = desc.DepthStencilState;
+		hash.Add(depth.DepthEnable);
+		hash.Add(depth.DepthWriteMask);
+		hash.Add(depth.DepthFunc);
+		hash.Add(depth.StencilEnable);
+		hash.Add(depth.StencilReadMask);
+		hash.Add(depth.StencilWriteMask);
+		AddStencilOp(hash, depth.FrontFace);
+		AddStencilOp(hash, depth.BackFace);
+
+		//[gVOl`GetRootSignatureŋLĂ̂ŃAhXŋʂł
+		hash.Add(reinterpret_cast<uintptr_t>(desc.pRootSignature));
+		AddInputLayout(hash, desc.InputLayout);
+		hash.Add(desc.PrimitiveTopologyType);
+		hash.Add(desc.IBStripCutValue);
+		hash.Add(desc.NumRenderTargets);
+		for (unsigned int i = 0; i < desc.NumRenderTargets && i < 8; ++i)
+			hash.Add(desc.RTVFormats[i]);
+		hash.Add(desc.DSVFormat);
+		hash.Add(desc.SampleDesc.Count);
+		hash.Add(desc.SampleDesc.Quality);
+	}
+
+	/**
+		@brief	pCvCݒ̃nbV
+		@note	VF[_[̓oCgR[h̒gA̓CAEg̓Z}eBNX̕Ŕr
+	*/
+	template<class Desc>
+	unsigned long long Full(const Desc& desc)
+	{
+		Hasher hash;
+		AddDrawState(hash, desc);
+		hash.Add(desc.NodeMask);
+		hash.Add(desc.Flags);
+		return hash.Value();
+	}
+
+	//! 쐬҂̊ԂɑɎg邩ǂ(NodeMaskEFlagŝ悤ȍႤ)
+	template<class Desc>
+	unsigned long long Compatibility(const Desc& desc)
+	{
+		Hasher hash;
+		AddDrawState(hash, desc);
+		return hash.Value();
+	}
+}
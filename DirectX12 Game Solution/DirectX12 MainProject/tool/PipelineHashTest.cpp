@@ -0,0 +1,160 @@
+/**
+ * @file PipelineHashTest.cpp
+ * @brief PipelineHash̊mF(R}hCAQ[{̂̃vWFNgɂ͊܂߂Ȃ)
+ * @author hoshi hirofumi
+ * @date 2026/10/19
+ * @note D3D12̃wb_[̂ŁAD3D12_GRAPHICS_PIPELINE_STATE_DESCƓo[̍\̂Ŋm߂
+ *       g͓L[E`挋ʂ̈Ⴂ͕ʂ̌݊L[ɂȂ邩m߂
+ */
+
+#include "PipelineHash.h"
+#include "TestCheck.h"
+
+#include <cstdio>
+#include <cstring>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+namespace {
+	//! D3D12̍\̂Ɠo[𑵂
+	struct Bytecode          { const void* pShaderBytecode; size_t BytecodeLength; };
+	struct InputElement      { const char* SemanticName; unsigned int SemanticIndex; int Format; unsigned int InputSlot;
+	                           unsigned int AlignedByteOffset; int InputSlotClass; unsigned int InstanceDataStepRate; };
+	struct InputLayoutDesc   { const InputElement* pInputElementDescs; unsigned int NumElements; };
+	struct RenderTargetBlend { int BlendEnable; int LogicOpEnable; int SrcBlend; int DestBlend; int BlendOp;
+	                           int SrcBlendAlpha; int DestBlendAlpha; int BlendOpAlpha; int LogicOp; unsigned char RenderTargetWriteMask; };
+	struct Blend             { int AlphaToCoverageEnable; int IndependentBlendEnable; RenderTargetBlend RenderTarget[8]; };
+	struct Rasterizer        { int FillMode; int CullMode; int FrontCounterClockwise; int DepthBias; float DepthBiasClamp;
+	                           float SlopeScaledDepthBias; int DepthClipEnable; int MultisampleEnable; int AntialiasedLineEnable;
+	                           unsigned int ForcedSampleCount; int ConservativeRaster; };
+	struct StencilOp         { int StencilFailOp; int StencilDepthFailOp; int StencilPassOp; int StencilFunc; };
+	struct DepthStencil      { int DepthEnable; int DepthWriteMask; int DepthFunc; int StencilEnable;
+	                           unsigned char StencilReadMask; unsigned char StencilWriteMask; StencilOp FrontFace; StencilOp BackFace; };
+	struct Sample            { unsigned int Count; unsigned int Quality; };
+	struct Desc {
+		const void*     pRootSignature;
+		Bytecode        VS, PS, DS, HS, GS;
+		Blend           BlendState;
+		unsigned int    SampleMask;
+		Rasterizer      RasterizerState;
+		DepthStencil    DepthStencilState;
+		InputLayoutDesc InputLayout;
+		int             IBStripCutValue;
+		int             PrimitiveTopologyType;
+		unsigned int    NumRenderTargets;
+		int             RTVFormats[8];
+		int             DSVFormat;
+		Sample          SampleDesc;
+		unsigned int    NodeMask;
+		int             Flags;
+	};
+
+	using TestCheck::Check;
+
+	//! VF[_[ƃZ}eBNX͌ĂяoƂɕʂ̃ɒu(AhXł͂ȂgŔׂ邩)
+	struct Fixture {
+		std::vector<unsigned char> vs, ps;
+		std::vector<std::string>   names;
+		std::vector<InputElement>  elements;
+		Desc                       desc;
+
+		Fixture(unsigned char psByte = 0x22)
+			: vs(64, 0x11), ps(48, psByte), names{ "POSITION", "NORMAL", "TEXCOORD" }, desc{}
+		{
+			for (unsigned int i = 0; i < names.size(); ++i)
+				elements.push_back({ names[i].c_str(), 0, 2 + static_cast<int>(i), 0, i * 12, 0, 0 });
+
+			static int rootSignature;
+			desc.pRootSignature = &rootSignature;
+			desc.VS = { vs.data(), vs.size() };
+			desc.PS = { ps.data(), ps.size() };
+			desc.BlendState.RenderTarget[0].RenderTargetWriteMask = 0x0f;
+			desc.SampleMask = 0xffffffff;
+			desc.RasterizerState.FillMode = 3;
+			desc.RasterizerState.CullMode = 3;
+			desc.DepthStencilState.DepthEnable = 1;
+			desc.InputLayout = { elements.data(), static_cast<unsigned int>(elements.size()) };
+			desc.PrimitiveTopologyType = 3;
+			desc.NumRenderTargets = 1;
+			desc.RTVFormats[0] = 28;
+			desc.RTVFormats[5] = 99;	//NumRenderTargets͌Ȃ
+			desc.DSVFormat = 40;
+			desc.SampleDesc = { 1, 0 };
+		}
+	};
+}
+
+int main()
+{
+	const Fixture base;
+	const auto full = PipelineHash::Full(base.desc);
+	const auto compatible = PipelineHash::Compatibility(base.desc);
+
+	//ʂ̃ɂ铯g͓L[(fmŋLł)
+	{
+		Fixture copy;
+		Check(PipelineHash::Full(copy.desc) == full, "same contents give the same key");
+		Check(PipelineHash::Compatibility(copy.desc) == compatible, "same contents give the same compatible key");
+		copy.desc.RTVFormats[5] = 7;
+		Check(PipelineHash::Full(copy.desc) == full, "render target formats past NumRenderTargets are ignored");
+	}
+
+	//`挋ʂς̂̓L[݊L[ς(쐬҂̊Ԃɕʂ̃VF[_[EԂŕ`Ȃ)
+	struct Change            { const char* what; void (*apply)(Desc&); };
+	const Change changes[] = {
+		{ "vertex shader",  [](Desc& d) { const_cast<unsigned char*>(static_cast<const unsigned char*>(d.VS.pShaderBytecode))[3] ^= 1; } },
+		{ "pixel shader",   [](Desc& d) { d.PS.BytecodeLength -= 4; } },
+		{ "blend",          [](Desc& d) { d.BlendState.RenderTarget[0].BlendEnable = 1; } },
+		{ "write mask",     [](Desc& d) { d.BlendState.RenderTarget[0].RenderTargetWriteMask = 0x07; } },
+		{ "cull mode",      [](Desc& d) { d.RasterizerState.CullMode = 1; } },
+		{ "depth bias",     [](Desc& d) { d.RasterizerState.SlopeScaledDepthBias = 1.0f; } },
+		{ "depth write",    [](Desc& d) { d.DepthStencilState.DepthWriteMask = 1; } },
+		{ "stencil",        [](Desc& d) { d.DepthStencilState.BackFace.StencilFunc = 8; } },
+		{ "input layout",   [](Desc& d) { const_cast<InputElement*>(d.InputLayout.pInputElementDescs)[1].AlignedByteOffset = 16; } },
+		{ "topology",       [](Desc& d) { d.PrimitiveTopologyType = 2; } },
+		{ "render target",  [](Desc& d) { d.RTVFormats[0] = 87; } },
+		{ "depth format",   [](Desc& d) { d.DSVFormat = 45; } },
+		{ "sample count",   [](Desc& d) { d.SampleDesc.Count = 4; } },
+	};
+	for (const auto& change : changes) {
+		Fixture changed;
+		change.apply(changed.desc);
+		char what[96];
+		snprintf(what, sizeof(what), "%s changes the key", change.what);
+		Check(PipelineHash::Full(changed.desc) != full, what);
+		snprintf(what, sizeof(what), "%s changes the compatible key", change.what);
+		Check(PipelineHash::Compatibility(changed.desc) != compatible, what);
+	}
+
+	//Z}eBNX͕Ŕׂ(OႤCAEg͕ʕ)
+	{
+		Fixture renamed;
+		renamed.names[2] = "COLOR";
+		renamed.elements[2].SemanticName = renamed.names[2].c_str();
+		Check(PipelineHash::Full(renamed.desc) != full, "semantic name changes the key");
+	}
+
+	//Ⴄ͕̂ʂPSOA쐬҂̊Ԃ͑Ɏg
+	{
+		Fixture flagged;
+		flagged.desc.Flags = 1;
+		flagged.desc.NodeMask = 1;
+		Check(PipelineHash::Full(flagged.desc) != full, "flags change the key");
+		Check(PipelineHash::Compatibility(flagged.desc) == compatible, "flags keep the compatible key");
+	}
+
+	//d̔r: PipelineLibraryƓL[ňAݒ̗v1ɂ܂Ƃ܂
+	{
+		std::unordered_map<unsigned long long, int> pipelines;
+		int created = 0;
+		for (int model = 0; model < 100; ++model) {
+			Fixture request(model % 4 == 0 ? 0x33 : 0x22);
+			if (pipelines.emplace(PipelineHash::Full(request.desc), created).second)
+				++created;
+		}
+		Check(created == 2, "100 models with two pixel shaders create two pipelines");
+	}
+
+	return TestCheck::Finish("PipelineHashTest");
+}
@@ -0,0 +1,274 @@
+/**
+ * @file PipelineLibrary.cpp
+ * @brief [gVOl`ƃpCvCXe[g̋L
+ * @author hoshi hirofumi
+ * @date 2026/10/19
+ */
+
+#include "PipelineLibrary.h"
+#include "PipelineHash.h"
+#include "JobSystem.h"
+
+namespace {
+	//! GetōCX^X
+	PipelineLibrary* g_instance = nullptr;
+
+	//! [J[Xbhɓn߁A|C^[̐܂ŕݒ
+	struct PipelineDescStorage {
+		D3D12_GRAPHICS_PIPELINE_STATE_DESC    desc;
+		ComPtr<ID3D12RootSignature>           rootSignature;
+		std::vector<unsigned char>            bytecode[5];
+		std::vector<std::string>              semanticNames;
+		std::vector<D3D12_INPUT_ELEMENT_DESC> inputElements;
+	};
+
+	void CopyBytecode(D3D12_SHADER_BYTECODE& shader, std::vector<unsigned char>& storage)
+	{
+		auto bytes = static_cast<const unsigned char*>(shader.pShaderBytecode);
+		storage.assign(bytes, bytes + shader.BytecodeLength);
+		shader.pShaderBytecode = storage.empty() ? nullptr : storage.data();
+	}
+
+	std::shared_ptr<PipelineDescStorage> CopyDesc(const D3D12_GRAPHICS_PIPELINE_STATE_DESC& desc)
+	{
+		auto storage = std::make_shared<PipelineDescStorage>();
+		storage->desc = desc;
+		storage->rootSignature = desc.pRootSignature;
+
+		auto& copy = storage->desc;
+		CopyBytecode(copy.VS, storage->bytecode[0]);
+		CopyBytecode(copy.PS, storage->bytecode[1]);
+		CopyBytecode(copy.DS, storage->bytecode[2]);
+		CopyBytecode(copy.HS, storage->bytecode[3]);
+		CopyBytecode(copy.GS, storage->bytecode[4]);
+
+		//rōĊmۂc_str()ɂȂ̂ŐɊmۂĂ
+		const auto& layout = desc.InputLayout;
+		storage->semanticNames.reserve(layout.NumElements);
+		storage->inputElements.assign(layout.pInputElementDescs, layout.pInputElementDescs + layout.NumElements);
+		for (auto& element : storage->inputElements) {
+			storage->semanticNames.emplace_back(element.SemanticName);
+			element.SemanticName = storage->semanticNames.back().c_str();
+		}
+		copy.InputLayout.pInputElementDescs = storage->inputElements.data();
+
+		//LbVςPSO͎gȂ
+		copy.CachedPSO = {};
+		return storage;
+	}
+}
+
+/*
+-------------------------------------------------------------------------------------
+	Pipeline
+-------------------------------------------------------------------------------------
+*/
+bool PipelineLibrary::Pipeline::IsReady() const
+{
+	return m_future.wait_for(std::chrono::seconds(0)) == std::future_status::ready;
+}
+
+/**
+	@brief	pCvC̎擾
+	@return 쐬ς݂ȂpCvCA쐬쐬ɎsĂnullptr
+	@note	s͍ŏ1񂾂o̓EBhEɏA`̒֗O𓊂Ȃ
+*/
+ID3D12PipelineState* PipelineLibrary::Pipeline::Get() const
+{
+	if (!IsReady())
+		return nullptr;
+
+	std::call_once(m_resolved, [this]() {
+		try {
+			m_pipelineState = m_future.get();
+		}
+		catch (const std::exception& e) {
+			OutputDebugStringA((std::string("PipelineLibrary: failed to create a pipeline (") + e.what() + ")\n").c_str());
+		}
+		catch (...) {
+			OutputDebugStringA("PipelineLibrary: failed to create a pipeline\n");
+		}
+	});
+	return m_pipelineState.Get();
+}
+
+bool PipelineLibrary::Pipeline::IsFailed() const
+{
+	return IsReady() && Get() == nullptr;
+}
+
+/*
+-------------------------------------------------------------------------------------
+	PipelineLibrary
+-------------------------------------------------------------------------------------
+*/
+PipelineLibrary::PipelineLibrary(ID3D12Device* device) : m_device(device), m_statistics{}
+{
+	JobSystem::Get();
+	g_instance = this;
+}
+
+PipelineLibrary::~PipelineLibrary()
+{
+	g_instance = nullptr;
+}
+
+/**
+	@brief	[gVOl`̎擾(VACYʂȂ狤L)
+	@param	desc [gVOl`̐ݒ
+	@return [gVOl`
+*/
+ComPtr<ID3D12RootSignature> PipelineLibrary::GetRootSignature(const D3D12_ROOT_SIGNATURE_DESC& desc)
+{
+	ComPtr<ID3DBlob> blob;
+	ComPtr<ID3DBlob> error_blob;
+	HRESULT result = D3D12SerializeRootSignature(&desc, D3D_ROOT_SIGNATURE_VERSION_1, blob.GetAddressOf(), error_blob.GetAddressOf());
+	if (FAILED(result)) {
+		if (error_blob)
+			OutputDebugStringA(static_cast<const char*>(error_blob->GetBufferPointer()));
+		DX::ThrowIfFailed(result);
+	}
+
+	const auto key = HashRootSignature(blob->GetBufferPointer(), blob->GetBufferSize());
+
+	std::lock_guard<std::mutex> lock(m_mutex);
+	++m_statistics.rootSignatureRequests;
+
+	auto it = m_rootSignatures.find(key);
+	if (it != m_rootSignatures.end()) {
+		++m_statistics.rootSignatureHits;
+		return it->second;
+	}
+
+	ComPtr<ID3D12RootSignature> rootSignature;
+	result = m_device->CreateRootSignature(0, blob->GetBufferPointer(), blob->GetBufferSize(), IID_PPV_ARGS(rootSignature.GetAddressOf()));
+	DX::ThrowIfFailed(result);
+
+	m_rootSignatures.emplace(key, rootSignature);
+	return rootSignature;
+}
+
+/**
+	@brief	pCvC̎擾(΃[J[Xbhō쐬n߂)
+	@param	desc pCvC̐ݒ([gVOl`GetRootSignatureŎ擾)
+	@return L̃pCvC
+*/
+std::shared_ptr<PipelineLibrary::Pipeline> PipelineLibrary::GetPipeline(const D3D12_GRAPHICS_PIPELINE_STATE_DESC& desc)
+{
+	//Xg[o͕͂ɑΉĂȂ
+	if (desc.StreamOutput.NumEntries != 0)
+		DX::ThrowIfFailed(E_INVALIDARG);
+
+	const auto key = HashPipelineDesc(desc);
+
+	std::lock_guard<std::mutex> lock(m_mutex);
+	++m_statistics.pipelineRequests;
+
+	auto it = m_pipelines.find(key);
+	if (it != m_pipelines.end()) {
+		++m_statistics.pipelineHits;
+		return it->second;
+	}
+
+	//hCo[̃RpC͒̂Background(t[̑҂ł͏EȂ)
+	auto storage = CopyDesc(desc);
+	ComPtr<ID3D12Device> device(m_device);
+	auto promise = std::make_shared<std::promise<ComPtr<ID3D12PipelineState>>>();
+	auto future  = promise->get_future().share();
+	JobSystem::Get().Run([device, storage, promise]() {
+		try {
+			ComPtr<ID3D12PipelineState> pipelineState;
+			DX::ThrowIfFailed(device->CreateGraphicsPipelineState(&storage->desc, IID_PPV_ARGS(pipelineState.GetAddressOf())));
+			promise->set_value(pipelineState);
+		}
+		catch (...) {
+			promise->set_exception(std::current_exception());
+		}
+	}, nullptr, JobSystem::Priority::Background);
+
+	auto pipeline = std::make_shared<Pipeline>(key, future);
+	m_pipelines.emplace(key, pipeline);
+	return pipeline;
+}
+
+/**
+	@brief	`ɎgpCvC
+	@param	pipeline GetPipeline̖߂l
+	@return 쐬ς݂Ȃ炻̃pCvCA쐬҂sĂnullptr(̕`͔΂)
+	@note	݊L[NodeMaskEFlags킸A`̑ɂȂ쐬ς݂̂̂͂܂̂ő͎gȂ
+	@note	ŝ͕\OAGetPipelineō蒼
+*/
+ID3D12PipelineState* PipelineLibrary::Acquire(const std::shared_ptr<Pipeline>& pipeline)
+{
+	if (!pipeline)
+		return nullptr;
+
+	std::lock_guard<std::mutex> lock(m_mutex);
+
+	if (auto pipelineState = pipeline->Get())
+		return pipelineState;
+
+	if (pipeline->IsFailed()) {
+		auto it = m_pipelines.find(pipeline->Key());
+		if (it != m_pipelines.end() && it->second == pipeline) {
+			m_pipelines.erase(it);
+			++m_statistics.failedPipelines;
+		}
+	}
+
+	++m_statistics.skippedDraws;
+	return nullptr;
+}
+
+PipelineLibrary::Statistics PipelineLibrary::GetStatistics() const
+{
+	std::lock_guard<std::mutex> lock(m_mutex);
+	return m_statistics;
+}
+
+unsigned long long PipelineLibrary::HashPipelineDesc(const D3D12_GRAPHICS_PIPELINE_STATE_DESC& desc)
+{
+	return PipelineHash::Full(desc);
+}
+
+unsigned long long PipelineLibrary::HashRootSignature(const void* blob, size_t size)
+{
+	return Hasher().Add(blob, size).Value();
+}
+
+/**
+	@brief	foCX̏(̂S)
+	@note	쐬̃Wu͌ÂfoCX܂܏IAʂ͂ǂgȂ
+*/
+void PipelineLibrary::OnDeviceLost()
+{
+	if (g_instance == nullptr)
+		return;
+
+	std::lock_guard<std::mutex> lock(g_instance->m_mutex);
+	g_instance->m_rootSignatures.clear();
+	g_instance->m_pipelines.clear();
+	g_instance->m_device = nullptr;
+}
+
+/**
+	@brief	ȍ~̃[gVOl`EpCvC͐VfoCXō
+*/
+void PipelineLibrary::OnDeviceRestored(ID3D12Device* device)
+{
+	if (g_instance == nullptr)
+		return;
+
+	std::lock_guard<std::mutex> lock(g_instance->m_mutex);
+	g_instance->m_device = device;
+}
+
+/**
+	@brief	Sfʂ̃CX^X
+	@param	device 񂾂Kv
+*/
+PipelineLibrary& PipelineLibrary::Get(ID3D12Device* device)
+{
+	static PipelineLibrary instance(device ? device : DXTK->Device);
+	return instance;
+}
@@ -0,0 +1,108 @@
+/**
+ * @file PipelineLibrary.h
+ * @brief [gVOl`ƃpCvCXe[g̋L
+ * @author hoshi hirofumi
+ * @date 2026/10/19
+ */
+
+#pragma once
+
+/*
+-------------------------------------------------------------------------------------
+	CN[h
+-------------------------------------------------------------------------------------
+*/
+#include "Base/pch.h"
+#include "Base/dxtk.h"
+
+#include <future>
+#include <mutex>
+#include <unordered_map>
+
+/*
+-------------------------------------------------------------------------------------
+	using
+-------------------------------------------------------------------------------------
+*/
+using Microsoft::WRL::ComPtr;
+using std::unique_ptr;
+using std::make_unique;
+using namespace DirectX;
+
+/*
+-------------------------------------------------------------------------------------
+	PipelineLibraryNX@錾
+-------------------------------------------------------------------------------------
+*/
+class PipelineLibrary {
+public:
+	//! 쐬E쐬ς݂̃pCvC(ݒ̃fmŋL)
+	class Pipeline {
+	public:
+		Pipeline(unsigned long long key, std::shared_future<ComPtr<ID3D12PipelineState>> future)
+			: m_key(key), m_future(std::move(future)) {}
+
+		//쐬IĂȂsĂnullptr
+		ID3D12PipelineState* Get() const;
+		//쐬I(s܂)
+		bool IsReady() const;
+		bool IsFailed() const;
+
+		unsigned long long Key() const { return m_key; }
+
+	private:
+		unsigned long long                               m_key;
+		std::shared_future<ComPtr<ID3D12PipelineState>> m_future;
+
+		//! ʂ͍ŏGet1xo(sȂnullptr̂܂)
+		mutable std::once_flag                           m_resolved;
+		mutable ComPtr<ID3D12PipelineState>              m_pipelineState;
+	};
+
+	struct Statistics {
+		size_t rootSignatureRequests;
+		size_t rootSignatureHits;
+		size_t pipelineRequests;
+		size_t pipelineHits;		//̃pCvCg񂵂
+		size_t skippedDraws;		//쐬҂Esŕ`΂
+		size_t failedPipelines;		//쐬ɎsĊO(̗vō蒼)pCvC̐
+	};
+
+	PipelineLibrary(ID3D12Device* device);
+	virtual ~PipelineLibrary();
+
+	PipelineLibrary(PipelineLibrary&&) = delete;
+	PipelineLibrary& operator= (PipelineLibrary&&) = delete;
+
+	PipelineLibrary(PipelineLibrary const&) = delete;
+	PipelineLibrary& operator= (PipelineLibrary const&) = delete;
+
+	ComPtr<ID3D12RootSignature> GetRootSignature(const D3D12_ROOT_SIGNATURE_DESC& desc);
+	std::shared_ptr<Pipeline> GetPipeline(const D3D12_GRAPHICS_PIPELINE_STATE_DESC& desc);
+
+	//`ɎgpCvC(쐬҂̊ԂnullptrŁA̕`͔΂)
+	ID3D12PipelineState* Acquire(const std::shared_ptr<Pipeline>& pipeline);
+
+	Statistics GetStatistics() const;
+
+	//PipelineHasȟĂяo(foCXgȂ)
+	static unsigned long long HashPipelineDesc(const D3D12_GRAPHICS_PIPELINE_STATE_DESC& desc);
+	static unsigned long long HashRootSignature(const void* blob, size_t size);
+
+	//foCX̏ƍč쐬(GameBase::OnDeviceLostAGet̑OȂ牽Ȃ)
+	static void OnDeviceLost();
+	static void OnDeviceRestored(ID3D12Device* device);
+
+	//VOg
+	static PipelineLibrary& Get(ID3D12Device* device = nullptr);
+
+private:
+	ID3D12Device* m_device;
+
+	std::unordered_map<unsigned long long, ComPtr<ID3D12RootSignature>> m_rootSignatures;
+	std::unordered_map<unsigned long long, std::shared_ptr<Pipeline>>   m_pipelines;
+
+	Statistics m_statistics;
+
+	mutable std::mutex m_mutex;
+};
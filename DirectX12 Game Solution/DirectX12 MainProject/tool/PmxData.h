@@ -0,0 +1,229 @@
+/**
+ * @file PmxData.h
+ * @brief PMXEVMD̃t@Cǂ񂾂܂܂̃f[^(`ɈˑȂ)
+ * @author hoshi hirofumi
+ * @date 2026/10/19
+ * @note PmxReaderƈꏏLinux̃x`}[N(ModelBench.cpp)g
+ *       WindowsłDirectXMatȟ^AȊOł͓т̑̌^g
+ */
+
+#pragma once
+
+/*
+-------------------------------------------------------------------------------------
+	CN[h
+-------------------------------------------------------------------------------------
+*/
+#ifdef _WIN32
+#include "Base/pch.h"
+#include "Base/dxtk.h"
+#endif
+#include "NameTable.h"
+
+#include <cstdint>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+#ifndef _WIN32
+namespace DirectX {
+	struct XMFLOAT2 { float x, y; };
+	struct XMFLOAT3 { float x, y, z; };
+	struct XMFLOAT4 { float x, y, z, w; };
+}
+#endif
+
+using namespace DirectX;
+
+/*
+-------------------------------------------------------------------------------------
+	\
+-------------------------------------------------------------------------------------
+*/
+struct PmxData {
+	//ꂼ̃^Cvۑ
+	uint8_t encord;
+	uint8_t addUv;
+	uint8_t verticesIndex;
+	uint8_t textureIndex;
+	uint8_t materialIndex;
+	uint8_t boneIndex;
+	uint8_t morphIndex;
+	uint8_t rigidbodyIndex;
+	uint8_t weightType;
+
+	//ef[^̐
+	int numVertex;
+	int numSurfaces;
+	int numTexture;
+	int numMaterial;
+	int numBone;
+	int numLinks;
+
+	//_f[^\
+	struct Vertex
+	{
+		XMFLOAT3 pos;
+		XMFLOAT3 normal;
+		XMFLOAT2 uv;
+		//std::vector<XMFLOAT4> addUv;
+
+		struct Weight {
+			enum Type
+			{
+				BDEF,
+				BDEF1,
+				BDEF4,
+				SDEF
+			};
+
+			//Type type;
+			int born1;
+			int born2;
+			int born3;
+			int born4;
+			float weight1;
+			float weight2;
+			float weight3;
+			float weight4;
+			XMFLOAT3 c;
+			XMFLOAT3 r0;
+			XMFLOAT3 r1;
+
+
+		}weight;
+		float edge;
+	};
+
+	//ʃf[^
+	struct Surface
+	{
+		int vertexIndex;
+	};
+
+	//}eAf[^
+	struct Material
+	{
+		std::wstring materialPaths;
+		NameId nameId;			//{ꖼ(NameTable̔ԍ)
+		XMFLOAT4 diffuse;
+		XMFLOAT4 specular;
+		XMFLOAT3 ambient;
+
+		uint8_t bitFlag;
+
+		XMFLOAT4 edgeColor;
+		float edgeSize;
+
+		uint8_t sphereMode;
+		uint8_t toonFlag;
+
+		int colorMapTextureIndex;
+		int mapTextureIndex;
+		int toonTextureIndex;
+		int toonTexture;
+
+		int vertexNum;
+	};
+
+	//VF[_ɓ}eAf[^
+	struct MaterialForHlsl {
+		XMFLOAT4 diffuse; //fBt[YF
+		XMFLOAT4 specular; //XyLF
+		XMFLOAT3 ambient; //ArGgF
+	};
+	//ȊÕ}eAf[^
+	struct AdditionalMaterial {
+		std::string texPath;//eNX`t@CpX
+		int toonIdx; //gD[ԍ
+		bool edgeFlg;//}eA̗֊stO
+	};
+	//܂Ƃ߂
+	struct Materials {
+		unsigned int indicesNum;//CfbNX
+		MaterialForHlsl material;
+		AdditionalMaterial additional;
+	};
+
+	//{[
+	struct Bone
+	{
+		//{[
+		std::wstring name;
+		std::wstring nameEnglish;
+		NameId nameId;			//nameNameTable̔ԍ(VMDƂ̏ƍp)
+
+		XMFLOAT3 pos;
+		int parentNo;
+		int transformationHierarchy;
+		unsigned short flag;
+
+		XMFLOAT3 posOffSet;
+		int boneIndexSize;
+
+		int parentBoneIndexSize;
+		float grantRate;
+
+		XMFLOAT3 axisvVector;
+
+		XMFLOAT3 xAxisVector;
+		XMFLOAT3 zAxizVector;
+
+		int keyIndex;
+
+		//IK
+		int ikBoneIndexSize;
+		int numLoop;
+		float axizLimits;
+
+
+		struct IKLink
+		{
+			int linkBoneIndexSize;;
+			uint8_t limitFlag;
+			XMFLOAT3 lowerLimit;
+			XMFLOAT3 higherLimit;
+		};
+		std::vector<IKLink> ikLinks;
+
+	};
+
+	// {[̏
+	enum boneFlag
+	{
+		ACCESS_POINT = 0x0001,
+		IK = 0x0020,
+		IMPART_TRANSLATION = 0x0100,
+		IMPART_ROTATION = 0x0200,
+		AXIS_FIXING = 0x0400,
+		LOCAL_AXIS = 0x0800,
+		EXTERNAL_PARENT_TRANS = 0x2000,
+	};
+
+	//e{[f[^
+	struct BoneNode
+	{
+		int boneIndex;
+		XMFLOAT3 startPos;
+		XMFLOAT3 endPos;
+		std::vector<BoneNode*> children;
+	};
+
+	std::vector<PmxData::Materials> materials;								//}eAf[^
+	std::vector<PmxData::MaterialForHlsl> shaderData;						//VF[_[f[^
+	std::unordered_map<NameId, BoneNode> boneNodeTable;						//{[̐ڑf[^({[̔ԍ  m[h)
+	std::vector<Vertex> vertices;											//_f[^
+	std::vector<Surface> surfaces;											//ʃf[^
+	std::wstring modelName[4];												//f
+	std::vector<std::wstring> texturePaths;									//eNX`
+	std::vector<Material> material;											//}eAf[^
+	std::vector<Bone> bones;												//{[f[^
+};
+
+struct VMDData {
+	NameId       name;			//{[̔ԍ
+	unsigned int frame_no;
+	XMFLOAT3     location;
+	XMFLOAT4     quaternion;
+	uint8_t      bezier[64];
+};
@@ -6,20 +6,56 @@
  */
 
 #include "PmxLoader.h"
+#include "JobSystem.h"
+#include "Profiler.h"
+#include "GpuTimer.h"
 
+#include <algorithm>
 #include <array>
-#include <d3dcompiler.h>
+#include <cstring>
 #include <filesystem>
 
+namespace {
+	//! 풓Ǘɓn̉𑜓xƃtH[}bg̑傫
+	TextureResidency::Description DescribeTexture(const StreamedTexture& texture)
+	{
+		TextureResidency::Description description{};
+		description.width    = texture.FullWidth();
+		description.height   = texture.FullHeight();
+		description.mipCount = std::max(1u, texture.FullMipCount());
+
+		switch (texture.Resource()->GetDesc().Format) {
+		case DXGI_FORMAT_BC1_UNORM:
+		case DXGI_FORMAT_BC1_UNORM_SRGB:
+			description.bitsPerPixel    = 4;
+			description.blockCompressed = true;
+			break;
+		case DXGI_FORMAT_BC2_UNORM:
+		case DXGI_FORMAT_BC2_UNORM_SRGB:
+		case DXGI_FORMAT_BC3_UNORM:
+		case DXGI_FORMAT_BC3_UNORM_SRGB:
+			description.bitsPerPixel    = 8;
+			description.blockCompressed = true;
+			break;
+		default:
+			description.bitsPerPixel = 32;
+			break;
+		}
+		return description;
+	}
+}
+
 
 // Initialize member variables.
 
 PmxLoader::PmxLoader() : m_vertexBuffer(nullptr), m_vertexBufferView{},
-m_vsBlob(nullptr), m_psBlob(nullptr), m_rootSignature(nullptr), m_pipelineState(nullptr),
-m_indexBuffer(nullptr),m_constantBuffer(nullptr), m_materialBuffer(nullptr),
+m_vsBlob(nullptr), m_psBlob(nullptr), m_rootSignature(nullptr), m_pipeline(nullptr),
+m_indexBuffer(nullptr), m_geometryUpload(0), m_materialDirty(true), m_texturesReady(false),
+m_instanceCount(0), m_dirtyFlags(DIRTY_ALL),
 m_texture(NULL), m_position(), m_scale(), m_rotation(), m_worldTransform(),
-m_resourceDescriptors(nullptr), m_materialDescriptors(nullptr), m_ps(), m_data{}
+m_ps(), m_gpuZone("GPU::Pmx"), m_firstFrameMs(-1.0), m_texturesReadyMs(-1.0), m_data{}
 {
+	SetInstanceCount(1);
 }
 
 /**
@@ -28,433 +64,381 @@ m_resourceDescriptors(nullptr), m_materialDescriptors(nullptr), m_ps(), m_data{}
  */
 void PmxLoader::PmxRead(const char* fileName)
 {
+	if (!ReadFile(fileName))
+		return;
+	InitShader();
+	SetUp();
+}
+
+/**
+ * @brief Pmxt@C̓ǂݍ݂(GPŨ\[X͍Ȃ)
+ * @param fileName t@C
+ * @return t@CJ
+ */
+bool PmxLoader::ReadFile(const char* fileName)
+{
+	PROFILE_ZONE("Pmx::ReadFile");
+	m_loadStart = std::chrono::steady_clock::now();
+
 	std::filesystem::path ps =fileName;
+	m_gpuZone = Profiler::Get().Intern("GPU::" + ps.filename().string());
 	ps.remove_filename();
 
 	m_ps = ps;
 
-	// t@CJ
-	FILE* fp;
-	fp = fopen(fileName, "rb");
-
-	Header(fp);
-	Vertex(fp);
-	Surface(fp);
-	Texture(fp);
-	Material(fp);
-	Born(fp);
-	Map();
-	SetUp();
+	// ÕV[Ȃǂœǂݍݍς݂Ȃt@C͓ǂ܂Ȃ
+	m_cacheKey    = TextureCache::NormalizePath(std::filesystem::path(fileName).wstring());
+	m_cachedModel = ModelCache::Get().Find(m_cacheKey);
+	if (m_cachedModel) {
+		m_data = m_cachedModel->data;
+		return true;
+	}
+
+	// t@CJ(A[JCuɂ΂)
+	FileView fp = AssetFiles::Get().Open(fileName);
+	if (!fp) {
+		OutputDebugStringA((std::string("PmxLoader: failed to open ") + fileName + "\n").c_str());
+		return false;
+	}
+
+	if (!PmxReader::Read(fp, m_data)) {
+		OutputDebugStringA((std::string("PmxLoader: not a PMX 2.x file ") + fileName + "\n").c_str());
+		DX::ThrowIfFailed(E_FAIL);
+	}
+	return true;
+}
+
+/**
+ * @brief [V̓ǂݍ(ReadFilě)
+ */
+void PmxLoader::LoadMotion(const char* fileName)
+{
+	m_vmd.Initialize(m_data, fileName);
+	m_dirtyFlags |= DIRTY_BONE;
+}
+
+bool PmxLoader::IsReady() const
+{
+	return m_pipeline && m_pipeline->IsReady() && UploadQueue::Get().IsComplete(m_geometryUpload);
 }
 
 void PmxLoader::Update()
 {
-	m_worldTransform = m_scale * m_rotation * m_position;
+	UpdateConstants();
+}
+
+/**
+	@brief	ύX̂萔Abv[hOɏ
+	@note	Ot[̗̈GPUǂݏI܂GraphicsMemoryێ
+*/
+void PmxLoader::UpdateConstants()
+{
+	if (m_dirtyFlags & DIRTY_WORLD)
+		m_worldTransform = m_scale * m_rotation * m_position;
 
-	VSOUT* map_buffer = nullptr;
-	m_constantBuffer->Map(0, nullptr, (void**)&map_buffer);
-	map_buffer->world = m_worldTransform;
-	map_buffer->view = m_camera->GetViewMatrix();
-	map_buffer->proj = m_camera->GetProjectionMatrix();
-	map_buffer->eye = m_camera->GetForwardVector();
-	m_constantBuffer->Unmap(0, nullptr);
+	WriteConstants(m_dirtyFlags, m_camera, m_worldTransform, m_vmd.GetBoneMatrices(), m_instances.data(), m_instanceCount);
+	m_dirtyFlags = 0;
+	UploadMaterials();
 }
 
 /**
-	@brief	`
+	@brief	萔̏(UpdateConstantsƃpCvCRenderŋ)
+	@param	flags ޒ萔(DirtyFlags)
+	@note	GraphicsMemory̓t[̋؂CXbhŕt̂ŁACXbh炾Ă
 */
-void PmxLoader::Render()
+void PmxLoader::WriteConstants(unsigned int flags, const DX12::CAMERA& camera, const Matrix& world,
+	const std::vector<Matrix>& bones, const InstanceData* instances, unsigned int instanceCount)
 {
+	if (flags == 0)
+		return;
 
-	DXTK->CommandList->SetPipelineState(m_pipelineState.Get());
-	DXTK->CommandList->SetGraphicsRootSignature(m_rootSignature.Get());
-	DXTK->CommandList->IASetPrimitiveTopology(D3D_PRIMITIVE_TOPOLOGY_TRIANGLELIST);
-	DXTK->CommandList->IASetVertexBuffers(0, 1, &m_vertexBufferView);
-	DXTK->CommandList->IASetIndexBuffer(&m_indexBufferView);
+	auto& graphicsMemory = GraphicsMemory::Get(DXTK->Device);
 
-	unsigned int idx0ffset = 0;
-	ID3D12DescriptorHeap* heapes[2] = { m_resourceDescriptors->Heap(), m_materialDescriptors->Heap() };
+	if (flags & DIRTY_CAMERA) {
+		CameraConstants constants{};
+		constants.view = camera.GetViewMatrix();
+		constants.proj = camera.GetProjectionMatrix();
+		constants.eye  = camera.GetForwardVector();
+		m_cameraConstants = graphicsMemory.AllocateConstant(constants);
+	}
 
-	DXTK->CommandList->SetDescriptorHeaps(1, &heapes[0]);
-	DXTK->CommandList->SetGraphicsRootDescriptorTable(0, m_resourceDescriptors->GetGpuHandle(0));
-	DXTK->CommandList->SetDescriptorHeaps(1, &heapes[1]);
-	for (int i = 0; i < m_data.material.size(); ++i) {
-		DXTK->CommandList->SetGraphicsRootDescriptorTable(1, m_materialDescriptors->GetGpuHandle(i * 3));
-		DXTK->CommandList->DrawIndexedInstanced(m_data.materials[i].indicesNum, 1, idx0ffset, 0, 0);
-		idx0ffset += m_data.materials[i].indicesNum;
+	if (flags & DIRTY_WORLD) {
+		WorldConstants constants{};
+		constants.world = world;
+		m_worldConstants = graphicsMemory.AllocateConstant(constants);
+	}
+
+	if (flags & DIRTY_BONE) {
+		m_boneConstants = graphicsMemory.AllocateConstant<BoneConstants>();
+		auto bone = static_cast<BoneConstants*>(m_boneConstants.Memory());
+
+		//CX^XboneOffset̓pbĝǂłŵŁAf̃{[PʍsŖ߂
+		const size_t boneNum = std::min<size_t>(m_data.bones.size(), BoneConstants::MAX_BONE);
+		for (size_t i = 0; i < BoneConstants::MAX_BONE; ++i) {
+			bone->bone[i] = i < boneNum && i < bones.size() ? XMMATRIX(bones[i]) : XMMatrixIdentity();
+		}
 	}
 
+	if (flags & DIRTY_INSTANCE) {
+		const size_t size = sizeof(InstanceData) * instanceCount;
+		m_instanceConstants = graphicsMemory.Allocate(size, 16);
+		CopyMemory(m_instanceConstants.Memory(), instances, size);
+	}
 }
 
 /**
-	@brief	Jݒ
-	@param	camera	J̍s(OCũJgp)
+	@brief	}eAe[ũAbv[h(ςƂ)
 */
-void PmxLoader::SetCamera(DX12::CAMERA camera)
+void PmxLoader::UploadMaterials()
 {
+	if (!m_materialDirty)
+		return;
 
-	m_worldTransform = m_scale * m_rotation * m_position;
-	m_camera = camera;
+	const size_t size = sizeof(MaterialRecord) * m_materialRecords.size();
+	m_materialConstants = GraphicsMemory::Get(DXTK->Device).Allocate(size, 16);
+	CopyMemory(m_materialConstants.Memory(), m_materialRecords.data(), size);
+	m_materialDirty = false;
+}
 
-	VSOUT* map_buffer = nullptr;
-	m_constantBuffer->Map(0, nullptr, (void**)&map_buffer);
-	map_buffer->world = m_worldTransform;
-	map_buffer->view = m_camera->GetViewMatrix();
-	map_buffer->proj = m_camera->GetProjectionMatrix();
-	map_buffer->eye = m_camera->GetForwardVector();
-	m_constantBuffer->Unmap(0, nullptr);
+/**
+	@brief	`
+*/
+void PmxLoader::Render()
+{
+	//UpdateĂ΂Ȃf̂łŔf
+	UpdateConstants();
+	const bool texturesReady = RequestTextures(m_camera);
+	ApplyStreamedTextures();
+	UploadMaterials();
 
+	Draw(DXTK->CommandList, texturesReady, m_instanceCount);
 }
 
 /**
-	@brief	|WVݒ
-	@param	position |WV
+	@brief	`ɕKvȏԂt[Ɏʂ(V~[ṼXbh)
+	@note	GPUɂ͐GȂ@eNX`̗vʏ̑傫vZRenderɔC
 */
-void PmxLoader::SetPosition(Vector3 position = Vector3(0,0,0))
+void PmxLoader::Capture(ModelFrame& frame)
 {
-	m_position = Matrix::CreateTranslation(position);
+	if (m_dirtyFlags & DIRTY_WORLD)
+		m_worldTransform = m_scale * m_rotation * m_position;
+
+	frame.model         = this;
+	frame.dirtyFlags    = m_dirtyFlags;
+	frame.camera        = m_camera;
+	frame.world         = m_worldTransform;
+	frame.instanceCount = m_instanceCount;
+
+	if (m_dirtyFlags & DIRTY_BONE) {
+		const auto& bones = m_vmd.GetBoneMatrices();
+		frame.bones.assign(bones.begin(), bones.end());
+	}
+	if (m_dirtyFlags & DIRTY_INSTANCE)
+		frame.instances.assign(m_instances.begin(), m_instances.begin() + m_instanceCount);
+
+	MaterialScreenSizes(m_camera, m_worldTransform, m_instances.data(), m_instanceCount, frame.materialSizes);
+	m_dirtyFlags = 0;
 }
 
 /**
-	@brief@XP[ݒ
-	@param	scale g嗦
+	@brief	Capturet[̕`(CXbh)
 */
-void PmxLoader::SetScale(Vector3 scale = Vector3(1,1,1))
+void PmxLoader::Render(const ModelFrame& frame)
 {
-	m_scale = Matrix::CreateScale(scale);
+	Prepare(frame);
+	Record(DXTK->CommandList, frame);
 }
 
 /**
-	@brief	[e[Vݒ
-	@param	rotation [e[V
+	@brief	萔݂̏ƃeNX`̗vEւ
+	@note	GraphicsMemoryE풓ǗEfXNv^[ĜŃCXbhŁASfRecord̑Oɍς܂
 */
-void PmxLoader::SetRotation(Vector3 rotation = Vector3(0, 0, 0))
+void PmxLoader::Prepare(const ModelFrame& frame)
 {
-	m_rotation = Matrix::CreateFromYawPitchRoll(
-		XMConvertToRadians(rotation.y),
-		XMConvertToRadians(rotation.x),
-		XMConvertToRadians(rotation.z)
-	);
+	WriteConstants(frame.dirtyFlags, frame.camera, frame.world, frame.bones, frame.instances.data(), frame.instanceCount);
+	m_texturesReady = RequestTextures(frame.materialSizes);
+	ApplyStreamedTextures();
+	UploadMaterials();
 }
 
-void PmxLoader::Animetion(float deltaTime)
+/**
+	@brief	R}h̋L^(Preparě)
+	@note	ǂނȂ̂ŁAfɕʂ̃XbhER}hXgŋL^Ă悢
+*/
+void PmxLoader::Record(ID3D12GraphicsCommandList* commandList, const ModelFrame& frame)
 {
-	m_vmd.Update(deltaTime);
+	PROFILE_ZONE("Pmx::Record");
+	Draw(commandList, m_texturesReady, frame.instanceCount);
 }
 
 /**
- * @brief wb_[ǂݍ
- * @param fp t@Cf[^
- */
-void PmxLoader::Header(FILE* fp)
+	@brief	R}h̋L^
+	@param	texturesReady Ă}eÃeNX`Ă邩(vp)
+*/
+void PmxLoader::Draw(ID3D12GraphicsCommandList* commandList, bool texturesReady, unsigned int instanceCount)
 {
-	// wb_[`FbN
-	BYTE header[4];
-	fread(header, 4, 1, fp);
-	if (memcmp(header, "PMX ", 4) != 0)
-		DX::ThrowIfFailed(E_FAIL);
+	GPU_ZONE(commandList, m_gpuZone);
+
+	//pCvC̓[J[Xbhō쐬̂ŁAԂɍȂΕ`悵Ȃ
+	auto pipelineState = PipelineLibrary::Get().Acquire(m_pipeline);
+	if (pipelineState == nullptr)
+		return;
+
+	//_ECfbNXRs[L[œ]Ȃ`悵Ȃ
+	if (!UploadQueue::Get().IsComplete(m_geometryUpload))
+		return;
+
+	if (m_firstFrameMs < 0.0 || (texturesReady && m_texturesReadyMs < 0.0)) {
+		const double ms = std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - m_loadStart).count();
+		if (m_firstFrameMs < 0.0)
+			m_firstFrameMs = ms;
+		if (texturesReady && m_texturesReadyMs < 0.0) {
+			m_texturesReadyMs = ms;
+
+			const auto statistics = GetLoadStatistics();
+			char message[192];
+			sprintf_s(message, "PmxLoader: first frame %.1fms, visible textures ready %.1fms (%zu/%zu textures loaded)\n",
+				m_firstFrameMs, m_texturesReadyMs, statistics.texturesRequested, statistics.texturesTotal);
+			OutputDebugStringA(message);
+		}
+	}
 
-	float ver;
-	fread(&ver, sizeof(ver), 1, fp);
-	if (ver < 2.0f)
-		DX::ThrowIfFailed(E_FAIL);
+	commandList->SetPipelineState(pipelineState);
+	commandList->SetGraphicsRootSignature(m_rootSignature.Get());
+	commandList->IASetPrimitiveTopology(D3D_PRIMITIVE_TOPOLOGY_TRIANGLELIST);
+	commandList->IASetVertexBuffers(0, 1, &m_vertexBufferView);
+	commandList->IASetIndexBuffer(&m_indexBufferView);
 
-	fseek(fp, 1, SEEK_CUR);
-	fread(&m_data.encord, 1, 1, fp);
-	fread(&m_data.addUv, 1, 1, fp);
-	fread(&m_data.verticesIndex, 1, 1, fp);
-	fread(&m_data.textureIndex, 1, 1, fp);
-	fread(&m_data.materialIndex, 1, 1, fp);
-	fread(&m_data.boneIndex, 1, 1, fp);
-	fread(&m_data.morphIndex, 1, 1, fp);
-	fread(&m_data.rigidbodyIndex, 1, 1, fp);
-
-	//f
-	std::wstring m_name;
-	for (int i = 0; i < 4; i++)
-	{
-		getPMXStringUTF16(fp, m_name);
-		m_data.modelName[i] = m_name;
+	unsigned int idx0ffset = 0;
+	auto& descriptors = DescriptorAllocator::Get();
+	ID3D12DescriptorHeap* heapes[1] = { descriptors.Heap() };
+
+	//Sfʂ̃q[vȂ̂ŁA}eA̐؂ւ̓[g萔ōς
+	commandList->SetDescriptorHeaps(1, heapes);
+	commandList->SetGraphicsRootConstantBufferView(0, m_cameraConstants.GpuAddress());
+	commandList->SetGraphicsRootShaderResourceView(2, m_instanceConstants.GpuAddress());
+	commandList->SetGraphicsRootConstantBufferView(3, m_worldConstants.GpuAddress());
+	commandList->SetGraphicsRootConstantBufferView(4, m_boneConstants.GpuAddress());
+	commandList->SetGraphicsRootShaderResourceView(5, m_materialConstants.GpuAddress());
+	commandList->SetGraphicsRootDescriptorTable(6, descriptors.GetGpuHandleStart());
+	commandList->SetGraphicsRootDescriptorTable(7, ToonTextureArray::Get().GetGpuHandle());
+	for (int i = 0; i < m_data.material.size(); ++i) {
+		commandList->SetGraphicsRoot32BitConstant(1, i, 0);
+		commandList->DrawIndexedInstanced(m_data.materials[i].indicesNum, instanceCount, idx0ffset, 0, 0);
+		idx0ffset += m_data.materials[i].indicesNum;
 	}
+
 }
 
 /**
- * @brief _f[^ǂݍ
- * @param fp t@Cf[^
- */
-void PmxLoader::Vertex(FILE* fp)
-{
-	// _ǂݍ
-	fread(&m_data.numVertex, sizeof(int), 1, fp);
-
-	// zmۂ
-	m_data.vertices.resize(m_data.numVertex);
-
-	// t@C璸_f[^擾
-	for (int i = 0; i < m_data.numVertex; ++i) {
-		fread(&m_data.vertices[i].pos, sizeof(XMFLOAT3), 1, fp);
-		fread(&m_data.vertices[i].normal, sizeof(XMFLOAT3), 1, fp);
-		fread(&m_data.vertices[i].uv, sizeof(XMFLOAT2), 1, fp);
-
-		byte weighttype;
-		fread(&weighttype, 1, 1, fp);
-
-		switch (weighttype) {
-		case PmxData::Vertex::Weight::BDEF:
-			//_data.vertices[i].weight.type = PmxData::Vertex::Weight::BDEF;
-			fread(&m_data.vertices[i].weight.born1, m_data.boneIndex, 1, fp);
-			m_data.vertices[i].weight.born2 = -1;
-			m_data.vertices[i].weight.born3 = -1;
-			m_data.vertices[i].weight.born4 = -1;
-			m_data.vertices[i].weight.weight1 = 1.0f;
-			break;
-
-		case PmxData::Vertex::Weight::BDEF1:
-			//_data.vertices[i].weight.type = PmxData::Vertex::Weight::BDEF1;
-			fread(&m_data.vertices[i].weight.born1, m_data.boneIndex, 1, fp);
-			fread(&m_data.vertices[i].weight.born2, m_data.boneIndex, 1, fp);
-			m_data.vertices[i].weight.born3 = -1;
-			m_data.vertices[i].weight.born4 = -1;
-			fread(&m_data.vertices[i].weight.weight1, 4, 1, fp);
-			m_data.vertices[i].weight.weight2 = 1.0f - m_data.vertices[i].weight.weight1;
-			break;
-
-		case PmxData::Vertex::Weight::BDEF4:
-			//_data.vertices[i].weight.type = PmxData::Vertex::Weight::BDEF4;
-			fread(&m_data.vertices[i].weight.born1, m_data.boneIndex, 1, fp);
-			fread(&m_data.vertices[i].weight.born2, m_data.boneIndex, 1, fp);
-			fread(&m_data.vertices[i].weight.born3, m_data.boneIndex, 1, fp);
-			fread(&m_data.vertices[i].weight.born4, m_data.boneIndex, 1, fp);
-			fread(&m_data.vertices[i].weight.weight1, 4, 1, fp);
-			fread(&m_data.vertices[i].weight.weight2, 4, 1, fp);
-			fread(&m_data.vertices[i].weight.weight3, 4, 1, fp);
-			fread(&m_data.vertices[i].weight.weight4, 4, 1, fp);
-			break;
-
-		case PmxData::Vertex::Weight::SDEF:
-			//_data.vertices[i].weight.type = PmxData::Vertex::Weight::SDEF;
-			fread(&m_data.vertices[i].weight.born1, m_data.boneIndex, 1, fp);
-			fread(&m_data.vertices[i].weight.born2, m_data.boneIndex, 1, fp);
-			fread(&m_data.vertices[i].weight.weight1, 4, 1, fp);
-			m_data.vertices[i].weight.weight2 = 1.0f - m_data.vertices[i].weight.weight1;
-			fread(&m_data.vertices[i].weight.c, 12, 1, fp);
-			fread(&m_data.vertices[i].weight.r0, 12, 1, fp);
-			fread(&m_data.vertices[i].weight.r1, 12, 1, fp);
-			break;
+	@brief	Jݒ
+	@param	camera	J̍s(OCũJgp)
+*/
+void PmxLoader::SetCamera(DX12::CAMERA camera)
+{
+	//t[Jn邱Ƃ̂ŕω
+	if (Matrix(camera->GetViewMatrix()) != Matrix(m_camera->GetViewMatrix()) ||
+		Matrix(camera->GetProjectionMatrix()) != Matrix(m_camera->GetProjectionMatrix()))
+		m_dirtyFlags |= DIRTY_CAMERA;
 
-		}
-		fread(&m_data.vertices[i].edge, 4, 1, fp);
-	}
+	m_camera = camera;
 }
 
 /**
- * @brief CfbNXf[^ǂݍ
- * @param fp t@Cf[^
- */
-void PmxLoader::Surface(FILE* fp)
+	@brief	|WVݒ
+	@param	position |WV
+*/
+void PmxLoader::SetPosition(Vector3 position = Vector3(0,0,0))
 {
-	//
-	fread(&m_data.numSurfaces, 4, 1, fp);
-	m_data.surfaces.resize(m_data.numSurfaces);
-	for (int i = 0; i < m_data.numSurfaces; i++)
-		fread(&m_data.surfaces[i].vertexIndex, m_data.verticesIndex, 1, fp);
+	const auto matrix = Matrix::CreateTranslation(position);
+	if (matrix != m_position)
+		m_dirtyFlags |= DIRTY_WORLD;
+	m_position = matrix;
 }
 
 /**
- * @brief eNX`ǂݍ
- * @param fp t@Cf[^
- */
-void PmxLoader::Texture(FILE* fp)
+	@brief@XP[ݒ
+	@param	scale g嗦
+*/
+void PmxLoader::SetScale(Vector3 scale = Vector3(1,1,1))
 {
-	//eNX`
-	fread(&m_data.numTexture, 4, 1, fp);
-	m_data.texturePaths.resize(m_data.numTexture);
-	std::wstring texturePath{};
-	for (int i = 0; i < m_data.numTexture; i++)
-	{
-		getPMXStringUTF16(fp, texturePath);
-
-		m_data.texturePaths[i] += texturePath;
-	}
+	const auto matrix = Matrix::CreateScale(scale);
+	if (matrix != m_scale)
+		m_dirtyFlags |= DIRTY_WORLD;
+	m_scale = matrix;
 }
 
 /**
- * @brief }eAf[^ǂݍ
- * @param fp t@Cf[^
- */
-void PmxLoader::Material(FILE* fp)
+	@brief	[e[Vݒ
+	@param	rotation [e[V
+*/
+void PmxLoader::SetRotation(Vector3 rotation = Vector3(0, 0, 0))
 {
-	//}eA
-	fread(&m_data.numMaterial, 4, 1, fp);
-	m_data.material.resize(m_data.numMaterial);
-	std::wstring materialPath{};
-	for (int i = 0; i < m_data.numMaterial; i++)
-	{
-		for (int k = 0; k < 2; k++) {
-			getPMXStringUTF16(fp, materialPath);
-			m_data.material[i].materialPaths += materialPath;
-		}
-
-		fread(&m_data.material[i].diffuse, 16, 1, fp);
-		fread(&m_data.material[i].specular, 16, 1, fp);
-		fread(&m_data.material[i].ambient, 12, 1, fp);
-
-		fread(&m_data.material[i].bitFlag, 1, 1, fp);
-		fread(&m_data.material[i].edgeColor, 16, 1, fp);
-		fread(&m_data.material[i].edgeSize, 4, 1, fp);
-		fread(&m_data.material[i].colorMapTextureIndex, m_data.textureIndex, 1, fp);
-		fread(&m_data.material[i].mapTextureIndex, m_data.textureIndex, 1, fp);
-
-		fread(&m_data.material[i].sphereMode, 1, 1, fp);
-
-		fread(&m_data.material[i].toonFlag, 1, 1, fp);
+	const auto matrix = Matrix::CreateFromYawPitchRoll(
+		XMConvertToRadians(rotation.y),
+		XMConvertToRadians(rotation.x),
+		XMConvertToRadians(rotation.z)
+	);
+	if (matrix != m_rotation)
+		m_dirtyFlags |= DIRTY_WORLD;
+	m_rotation = matrix;
+}
 
-		if (m_data.material[i].toonFlag)
-			fread(&m_data.material[i].toonTextureIndex, 1, 1, fp);
-		else {
-			fread(&m_data.material[i].toonTexture, m_data.textureIndex, 1, fp);
-		}
-		int memo;
-		fread(&memo, 4, 1, fp);
-		fseek(fp, memo, SEEK_CUR);
-		fread(&m_data.material[i].vertexNum, 4, 1, fp);
-	}
+void PmxLoader::Animetion(float deltaTime)
+{
+	//|[YςȂ΃{[̒萔͏Ȃ
+	if (m_vmd.Update(deltaTime))
+		m_dirtyFlags |= DIRTY_BONE;
 }
 
 /**
- * @brief {[f[^ǂݍ
- * @param fp t@Cf[^
- */
-void PmxLoader::Born(FILE* fp)
+	@brief	CX^Xݒ
+	@param	count `悷CX^X
+	@note	̃CX^X͒Pʍsŏ
+*/
+void PmxLoader::SetInstanceCount(unsigned int count)
 {
-	//{[
-	fread(&m_data.numBone, 4, 1, fp);
-	m_data.bones.resize(m_data.numBone);
-	std::wstring mate_name;
-	for (int i = 0; i < m_data.numBone; i++)
-	{
-		getPMXStringUTF16(fp, mate_name);
-		m_data.bones[i].name += mate_name;
-
-		getPMXStringUTF16(fp, mate_name);
-		m_data.bones[i].nameEnglish += mate_name;
-
-		fread(&m_data.bones[i].pos, 12, 1, fp);
-		fread(&m_data.bones[i].parentNo, m_data.boneIndex, 1, fp);
-		fread(&m_data.bones[i].transformationHierarchy, 4, 1, fp);
-		fread(&m_data.bones[i].flag, 2, 1, fp);
-
-		if (m_data.bones[i].flag & PmxData::ACCESS_POINT)
-		{
-			fread(&m_data.bones[i].boneIndexSize, m_data.boneIndex, 1, fp);
-		}
-		else
-		{
-			m_data.bones[i].boneIndexSize = -1;
-			fread(&m_data.bones[i].posOffSet, 12, 1, fp);
-		}
-
-		if ((m_data.bones[i].flag & PmxData::IMPART_TRANSLATION) || (m_data.bones[i].flag & PmxData::IMPART_ROTATION))
-		{
-			fread(&m_data.bones[i].parentBoneIndexSize, m_data.boneIndex, 1, fp);
-			fread(&m_data.bones[i].grantRate, 4, 1, fp);
-		}
-
-		if (m_data.bones[i].flag & PmxData::AXIS_FIXING)
-			fread(&m_data.bones[i].axisvVector, 12, 1, fp);
-
-		if (m_data.bones[i].flag & PmxData::LOCAL_AXIS) {
-			fread(&m_data.bones[i].xAxisVector, 12, 1, fp);
-			fread(&m_data.bones[i].zAxizVector, 12, 1, fp);
-		}
+	if (count == 0)
+		count = 1;
 
-		if (m_data.bones[i].flag & PmxData::EXTERNAL_PARENT_TRANS)
-			fread(&m_data.bones[i].keyIndex, 4, 1, fp);
+	InstanceData identity{};
+	identity.world = XMMatrixIdentity();
+	m_instances.resize(count, identity);
 
-		if (m_data.bones[i].flag & PmxData::IK)
-		{
-			fread(&m_data.bones[i].ikBoneIndexSize, m_data.boneIndex, 1, fp);
-			fread(&m_data.bones[i].numLoop, 4, 1, fp);
-			fread(&m_data.bones[i].axizLimits, 4, 1, fp);
-			fread(&m_data.numLinks, 4, 1, fp);
-			m_data.bones[i].ikLinks.resize(m_data.numLinks);
-
-			for (int j = 0; j < m_data.numLinks; j++)
-			{
-				fread(&m_data.bones[i].ikLinks[j].linkBoneIndexSize, m_data.boneIndex, 1, fp);
-				fread(&m_data.bones[i].ikLinks[j].limitFlag, 1, 1, fp);
-
-				if (m_data.bones[i].ikLinks[j].limitFlag) {
-					fread(&m_data.bones[i].ikLinks[j].lowerLimit, 12, 1, fp);
-					fread(&m_data.bones[i].ikLinks[j].higherLimit, 12, 1, fp);
-
-				}
-			}
-		}
-	}
-	fclose(fp);
-	m_data.materials.resize(m_data.material.size());
+	m_instanceCount = count;
+	m_dirtyFlags |= DIRTY_INSTANCE;
 }
 
 /**
- * @brief g₷悤ɕϊ
- */
-void PmxLoader::Map()
+	@brief	CX^X̍sݒ
+	@param	index      CX^Xԍ
+	@param	transform  fs񂩂̑΍s
+	@param	boneOffset {[pbg̐擪(f̃{[pbgɎ܂Ȃl0ɂ)
+*/
+void PmxLoader::SetInstanceTransform(unsigned int index, const Matrix& transform, unsigned int boneOffset)
 {
-	//}eARs[
-	for (int i = 0; i < m_data.material.size(); i++)
-	{
-		m_data.materials[i].indicesNum = m_data.material[i].vertexNum;
-		m_data.materials[i].material.diffuse = m_data.material[i].diffuse;
-		m_data.materials[i].material.specular = m_data.material[i].specular;
-		m_data.materials[i].material.ambient = m_data.material[i].ambient;
-	}
-
-	m_data.shaderData.resize(m_data.material.size());
-	for (int i = 0; i < m_data.material.size(); i++)
-	{
-		m_data.shaderData[i].diffuse = m_data.material[i].diffuse;
-		m_data.shaderData[i].specular = m_data.material[i].specular;
-		m_data.shaderData[i].ambient = m_data.material[i].ambient;
-	}
-
-	//{[g₷悤Map
-	std::vector<std::wstring> boneNames(m_data.bones.size());
-	for (int i = 0; i < m_data.bones.size(); i++)
-	{
-		auto& pb = m_data.bones[i];
-		boneNames[i] = pb.name;
-		auto& node = m_data.boneNodeTable[pb.name];
-		node.boneIndex = i;
-		node.startPos = pb.pos;
-	}
+	if (index >= m_instanceCount)
+		return;
 
-	for (auto& pb : m_data.bones)
-	{
-		if (pb.parentNo >= m_data.bones.size())
-		{
-			continue;
-		}
+	if (boneOffset + m_data.bones.size() > BoneConstants::MAX_BONE)
+		boneOffset = 0;
 
-		auto parentName = boneNames[pb.parentNo];
-		m_data.boneNodeTable[parentName].children.emplace_back(
-			&m_data.boneNodeTable[pb.name]
-		);
-
-	}
+	m_instances[index].world      = transform;
+	m_instances[index].boneOffset = boneOffset;
+	m_dirtyFlags |= DIRTY_INSTANCE;
 }
 
+
 /**
 	@brief	`悷邽߂̏ݒ
 */
 void PmxLoader::SetUp()
 {
+	PROFILE_ZONE("Pmx::SetUp");
 
-	m_resourceDescriptors = make_unique<DescriptorHeap>(DXTK->Device, 1);
-	m_materialDescriptors = make_unique<DescriptorHeap>(DXTK->Device, m_data.numMaterial * 3);
-
+	//GPUt[ǂނ̂ŃftHgq[vɒuAgUploadQueueœ]
 	D3D12_HEAP_PROPERTIES heapprop = {};
-	heapprop.Type = D3D12_HEAP_TYPE_UPLOAD;
+	heapprop.Type = D3D12_HEAP_TYPE_DEFAULT;
 	heapprop.CPUPageProperty = D3D12_CPU_PAGE_PROPERTY_UNKNOWN;
 	heapprop.MemoryPoolPreference = D3D12_MEMORY_POOL_UNKNOWN;
 
@@ -469,13 +453,24 @@ void PmxLoader::SetUp()
 	resdesc.Flags = D3D12_RESOURCE_FLAG_NONE;
 	resdesc.Layout = D3D12_TEXTURE_LAYOUT_ROW_MAJOR;
 
-	VertexBuffer(heapprop, resdesc);
-	IndexBuffer(heapprop, resdesc);
-	ConstantBuffer(heapprop, resdesc);
+	if (m_cachedModel) {
+		SharedBuffers();
+	}
+	else {
+		VertexBuffer(heapprop, resdesc);
+		IndexBuffer(heapprop, resdesc);
+		m_cachedModel = ModelCache::Get().Insert(m_cacheKey, m_data, m_vertexBuffer.Get(), m_indexBuffer.Get(), m_geometryUpload);
+	}
 	ExportTexture();
-	InitShader();
+	MaterialTable();
+	MaterialBounds();
+	//AssetLoaderł̓[J[Xbhōς܂Ă
+	if (!m_vsBlob || !m_psBlob)
+		InitShader();
 	CreatePipeLine();
-	//m_vmd.Initialize(m_data, m_constantBuffer,"Motion/IA_Conqueror_light_version.vmd");
+	//m_vmd.Initialize(m_data, "Motion/IA_Conqueror_light_version.vmd");
+	m_dirtyFlags    = DIRTY_ALL;
+	m_materialDirty = true;
 
 }
 
@@ -493,16 +488,13 @@ void PmxLoader::VertexBuffer(D3D12_HEAP_PROPERTIES heapprop, D3D12_RESOURCE_DESC
 		&heapprop,
 		D3D12_HEAP_FLAG_NONE,
 		&resdesc,
-		D3D12_RESOURCE_STATE_GENERIC_READ,
+		D3D12_RESOURCE_STATE_COMMON,
 		nullptr,
 		IID_PPV_ARGS(m_vertexBuffer.ReleaseAndGetAddressOf()));
 	DX::ThrowIfFailed(result);
 
-	//
-	void* map_addr = nullptr;
-	m_vertexBuffer->Map(0, nullptr, &map_addr);
-	CopyMemory(map_addr, m_data.vertices.data(), sizeof(m_data.vertices[0]) * m_data.numVertex);
-	m_vertexBuffer->Unmap(0, nullptr);
+	//Rs[L[̌COMMONɖ߂A`ňÖقɒ_obt@[֏i
+	m_geometryUpload = UploadQueue::Get().UploadBuffer(m_vertexBuffer.Get(), m_data.vertices.data(), sizeof(m_data.vertices[0]) * m_data.numVertex);
 
 	m_vertexBufferView.BufferLocation = m_vertexBuffer->GetGPUVirtualAddress();
 	m_vertexBufferView.SizeInBytes = sizeof(m_data.vertices[0]) * m_data.numVertex;
@@ -523,16 +515,14 @@ void PmxLoader::IndexBuffer(D3D12_HEAP_PROPERTIES heapprop, D3D12_RESOURCE_DESC
 		&heapprop,
 		D3D12_HEAP_FLAG_NONE,
 		&resdesc,
-		D3D12_RESOURCE_STATE_GENERIC_READ,
+		D3D12_RESOURCE_STATE_COMMON,
 		nullptr,
 		IID_PPV_ARGS(m_indexBuffer.ReleaseAndGetAddressOf()));
 	DX::ThrowIfFailed(result);
 
-	//IndexBuffeȑo
-	void* map_addr = nullptr;
-	m_indexBuffer->Map(0, nullptr, &map_addr);
-	CopyMemory(map_addr, m_data.surfaces.data(), sizeof(m_data.surfaces[0]) * m_data.surfaces.size());
-	m_indexBuffer->Unmap(0, nullptr);
+	//IndexBuffeȑo(_Ɠob`Ȃ̂Ńg[N͐Vc)
+	const auto token = UploadQueue::Get().UploadBuffer(m_indexBuffer.Get(), m_data.surfaces.data(), sizeof(m_data.surfaces[0]) * m_data.surfaces.size());
+	m_geometryUpload = std::max(m_geometryUpload, token);
 
 	m_indexBufferView.BufferLocation = m_indexBuffer->GetGPUVirtualAddress();
 	m_indexBufferView.Format = DXGI_FORMAT_R32_UINT;
@@ -540,163 +530,310 @@ void PmxLoader::IndexBuffer(D3D12_HEAP_PROPERTIES heapprop, D3D12_RESOURCE_DESC
 }
 
 /**
-	@brief	RX^gobt@[Ar[̐
-	@param	heapprop q[vvpeB̍\
-	@param  resdesc  \[XfBXN̍\
+	@brief	ModelCache̒_ECfbNXobt@[g
+	@note	]͍ŏɓǂݍPmxLoaderς܂Ă
 */
-void PmxLoader::ConstantBuffer(D3D12_HEAP_PROPERTIES heapprop, D3D12_RESOURCE_DESC resdesc)
+void PmxLoader::SharedBuffers()
 {
-	//ConstantBuffer̐
-	HRESULT result;
-	resdesc.Width = (sizeof(VSOUT) + 0xff) & ~0xff;
-	result = DXTK->Device->CreateCommittedResource(
-		&heapprop,
-		D3D12_HEAP_FLAG_NONE,
-		&resdesc,
-		D3D12_RESOURCE_STATE_GENERIC_READ,
-		nullptr,
-		IID_PPV_ARGS(m_constantBuffer.ReleaseAndGetAddressOf())
-	);
-	DX::ThrowIfFailed(result);
+	m_vertexBuffer   = m_cachedModel->vertexBuffer;
+	m_indexBuffer    = m_cachedModel->indexBuffer;
+	m_geometryUpload = m_cachedModel->upload;
 
-	//
-	resdesc.Width = (sizeof(PmxData::MaterialForHlsl) + 0xff) & ~0xff;
-	result = DXTK->Device->CreateCommittedResource(
-		&heapprop,
-		D3D12_HEAP_FLAG_NONE,
-		&resdesc,
-		D3D12_RESOURCE_STATE_GENERIC_READ,
-		nullptr,
-		IID_PPV_ARGS(m_materialBuffer.ReleaseAndGetAddressOf())
-	);
-	DX::ThrowIfFailed(result);
-
-	//ConstantBufferView̐
-	auto desc_addr = m_resourceDescriptors->GetCpuHandle(0);
-
-	D3D12_CONSTANT_BUFFER_VIEW_DESC cbv_desc{};
-	cbv_desc.BufferLocation = m_constantBuffer->GetGPUVirtualAddress();
-	cbv_desc.SizeInBytes = (UINT)m_constantBuffer->GetDesc().Width;
-	DXTK->Device->CreateConstantBufferView(&cbv_desc, desc_addr);
-
-	cbv_desc.BufferLocation = m_materialBuffer->GetGPUVirtualAddress();
-	cbv_desc.SizeInBytes = (UINT)m_materialBuffer->GetDesc().Width;
-
-	auto materialSize = sizeof(PmxData::MaterialForHlsl);
-	materialSize = (materialSize + 0xff) & ~0xff;
-
-	PmxData::MaterialForHlsl* mapMaterial = nullptr;
-	m_materialBuffer->Map(0, nullptr, (void**)&mapMaterial);
-	for (int i = 0; i < m_data.numMaterial; ++i) {
-		mapMaterial[i] = m_data.shaderData[i];
-	}
-	m_materialBuffer->Unmap(0, nullptr);
+	m_vertexBufferView.BufferLocation = m_vertexBuffer->GetGPUVirtualAddress();
+	m_vertexBufferView.SizeInBytes = sizeof(m_data.vertices[0]) * m_data.numVertex;
+	m_vertexBufferView.StrideInBytes = sizeof(m_data.vertices[0]);
 
-	for (int i = 0; i < m_data.numMaterial; i++) {
-		desc_addr = m_materialDescriptors->GetCpuHandle(i * 3);
+	m_indexBufferView.BufferLocation = m_indexBuffer->GetGPUVirtualAddress();
+	m_indexBufferView.Format = DXGI_FORMAT_R32_UINT;
+	m_indexBufferView.SizeInBytes = sizeof(m_data.surfaces[0]) * m_data.surfaces.size();
+}
 
-		DXTK->Device->CreateConstantBufferView(&cbv_desc, desc_addr);
+/**
+	@brief	eNX`f[^o
+	@note	ǂݍ݂̓}eAĂTextureStreamerɈ˗A͂܂ł1x1̔őp
+*/
+void PmxLoader::ExportTexture()
+{
+	const int white = m_data.numTexture;
+	m_texture.resize(m_data.numTexture + 1);
+	m_textureDescriptors.resize(m_texture.size());
+	m_streamingTextures.resize(m_texture.size());
+
+	//(eNX`)ƓǂݍݑÕeNX`1x1̑L
+	auto& descriptors = DescriptorAllocator::Get();
+	m_texture[white] = TextureStreamer::Get().Placeholder();
+	m_textureDescriptors[white] = descriptors.Allocate(1);
+	CreateShaderResourceView(DXTK->Device, m_texture[white].Get(), m_textureDescriptors[white].GetCpuHandle(0));
+
+	//ǂݍ݂̓}eA߂Č܂Œx点(RequestTextures  ApplyStreamedTextures)
+	auto& residency = TextureResidency::Get();
+	m_residency.resize(m_data.numTexture);
+	m_textureSizes.assign(m_data.numTexture, TEXTURE_NOT_REQUESTED);
+	for (int i = 0; i < m_data.numTexture; i++) {
+		m_residency[i] = residency.Register(TextureCache::NormalizePath(m_ps + m_data.texturePaths[i]));
+		m_texture[i] = m_texture[white];
+		m_textureDescriptors[i] = descriptors.Allocate(1);
+		CreateShaderResourceView(DXTK->Device, m_texture[i].Get(), m_textureDescriptors[i].GetCpuHandle(0));
 	}
 
-	// ConstantBufferւ̏
-	//VSOUT* map_buffer = nullptr;
-	//m_constantBuffer->Map(0, nullptr, (void**)&map_buffer);
-	//map_buffer->world = m_worldTransform;
-	//map_buffer->view = m_camera->GetViewMatrix();
-	//map_buffer->proj = m_camera->GetProjectionMatrix();
-	//m_constantBuffer->Unmap(0, nullptr);
+	//̃fŌƂ̂̂͂ǂݎn߂
+	ApplyStreamedTextures();
 }
 
 /**
-	@brief	eNX`f[^o
+	@brief	͂eNX`̍ւ
+	@note	`撆̃t[ÂXbgQƂĂ̂ŁAVXbgɏČÂ͒xĕԋp
 */
-void PmxLoader::ExportTexture()
+void PmxLoader::ApplyStreamedTextures()
 {
-	ResourceUploadBatch resourceUpload(DXTK->Device);
-	resourceUpload.Begin();
-
-	//eNX`o
-	m_texture.resize(m_data.numMaterial);
-	m_sphTexture.resize(m_data.numMaterial);
-	m_toonTexture.resize(m_data.numMaterial);
-	std::wstring textureData[256] = {};
-	for (int i = 0; i < m_data.numTexture + 1; i++) {
-		if (i == m_data.numTexture)
-		{
-			std::wstring textureName = L"Model/white.bmp";
-			textureData[255] = textureName.c_str();
-			break;
+	bool changed = false;
+	auto& descriptors = DescriptorAllocator::Get();
+	auto& residency   = TextureResidency::Get();
+	for (size_t i = 0; i < m_streamingTextures.size(); ++i) {
+		auto& streaming = m_streamingTextures[i];
+		const bool resident = i < m_residency.size() && m_residency[i];
+
+		if (streaming && streaming->IsDone()) {
+			//ǂݍ߂Ȃ͔̂̂܂
+			if (streaming->IsReady()) {
+				auto slot = descriptors.Allocate(1);
+				CreateShaderResourceView(DXTK->Device, streaming->Resource(), slot.GetCpuHandle(0));
+				descriptors.DeferredFree(std::move(m_textureDescriptors[i]));
+				m_textureDescriptors[i] = std::move(slot);
+				m_texture[i] = streaming->Resource();
+				changed = true;
+
+				if (resident) {
+					const auto id   = m_residency[i].Get();
+					const auto desc = streaming->Resource()->GetDesc();
+					const auto size = std::max(static_cast<uint32_t>(desc.Width), desc.Height);
+					residency.SetDescription(id, DescribeTexture(*streaming));
+					residency.Complete(id, size);
+					m_textureSizes[i] = size >= std::max(streaming->FullWidth(), streaming->FullHeight()) ? 0 : size;
+				}
+			}
+			else if (resident) {
+				residency.Failed(m_residency[i].Get());
+			}
+			streaming.reset();
 		}
-		auto textureName = m_ps + m_data.texturePaths[i];
-		textureData[i] = textureName.c_str();
-	}
 
-	std::wstring toonTextureData[10];
-	for (int i = 1; i < 11; i++)
-	{
-		if (i == 10)
-		{
-			std::wstring n = L"Model/toon/toon10.bmp";
-			toonTextureData[i-1] = n;
-			break;
+		//߂Čǂݎn߁A풓Ǘ̖ڕWςǂݒ(͂܂ł͍̃~bv\)
+		if (!streaming && resident) {
+			const auto id = m_residency[i].Get();
+			const bool first = m_textureSizes[i] == TEXTURE_NOT_REQUESTED;
+			if (first ? residency.IsNeeded(id) : residency.IsDescribed(id) && residency.TargetSize(id) != m_textureSizes[i]) {
+				m_textureSizes[i]    = residency.TargetSize(id);
+				m_streamingTextures[i] = TextureStreamer::Get().Request(m_ps + m_data.texturePaths[i], m_textureSizes[i]);
+			}
 		}
+	}
 
-		std::wstring textureName = L"Model/toon/toon0";
+	if (changed)
+		MaterialTable();
+}
 
-		textureName.append(std::to_wstring(i));
-		textureName.append(L".bmp");
+/**
+	@brief	Ă}eÃeNX`풓Ǘɓ`
+	@param	camera J(ǂ݂ł͐؂ւ̃J)
+	@return	Ă}eÃeNX`SĂ邩
+*/
+bool PmxLoader::RequestTextures(const DX12::CAMERA& camera)
+{
+	MaterialScreenSizes(camera, m_worldTransform, m_instances.data(), m_instanceCount, m_screenSizes);
+	return RequestTextures(m_screenSizes);
+}
+
+/**
+	@param	screenSizes MaterialScreenSizeš
+	@note	풓ǗEǂݍݒ̃eNX`ɐĜŃCXbhĂ
+*/
+bool PmxLoader::RequestTextures(const std::vector<float>& screenSizes)
+{
+	if (m_residency.empty())
+		return true;
+
+	bool ready = true;
+	auto& residency = TextureResidency::Get();
+	const auto request = [&](int index, float screenSize) {
+		if (index < 0 || index >= m_data.numTexture)
+			return;
+		residency.Request(m_residency[index].Get(), screenSize);
+
+		//ǂݍݑOA܂͍ŏ̃~bv͂ĂȂ
+		if (m_textureSizes[index] == TEXTURE_NOT_REQUESTED ||
+			(m_streamingTextures[index] && m_texture[index].Get() == m_texture[m_data.numTexture].Get()))
+			ready = false;
+	};
 
-		toonTextureData[i-1] = textureName;
+	const size_t count = std::min(screenSizes.size(), m_data.material.size());
+	for (size_t i = 0; i < count; ++i) {
+		if (screenSizes[i] < 0.0f)
+			continue;
+
+		const auto& material = m_data.material[i];
+		request(material.colorMapTextureIndex, screenSizes[i]);
+		request(material.mapTextureIndex, screenSizes[i]);
+		if (!material.toonFlag)
+			request(material.toonTexture, screenSizes[i]);
 	}
+	return ready;
+}
 
-	//eNX`fXNv^[q[vɏo
-	for (int i = 0; i < m_data.numMaterial; i++) {
+/**
+	@brief	}eẢʏ̑傫(sNZAĂȂΕ)
+	@note	}eA̋E𓊉eã}eÃeNX`ɕKvȉ𑜓xƂ݂Ȃ
+			ǂݍ݌͕ςȂf[^ǂ܂Ȃ̂ŁAV~[ṼXbhĂׂ
+			}eAɕʂ̗vfɏ̂ŁA}eA`Nɕĕɔ肷
+*/
+void PmxLoader::MaterialScreenSizes(const DX12::CAMERA& camera, const Matrix& world,
+	const InstanceData* instances, unsigned int instanceCount, std::vector<float>& screenSizes) const
+{
+	PROFILE_ZONE("Pmx::MaterialScreenSizes");
+	screenSizes.assign(m_materialBounds.size(), -1.0f);
+	if (m_materialBounds.empty())
+		return;
+
+	const Matrix view = camera.GetViewMatrix();
+	const Matrix proj = camera.GetProjectionMatrix();
+	//1̔a1ʏŉsNZɂȂ邩
+	const float pixelScale = proj._22 * DXTK->ScreenHeight * 0.5f;
+
+	BoundingFrustum frustum;
+	BoundingFrustum::CreateFromMatrix(frustum, proj);
+
+	//1Wu̔񐔂CULL_GRAINȏɂȂ悤
+	const size_t grain = std::max<size_t>(CULL_GRAIN / std::max(instanceCount, 1u), 1);
+	JobSystem::Get().ParallelFor(m_materialBounds.size(), [&](size_t begin, size_t end) {
+		for (size_t i = begin; i < end; ++i) {
+			for (unsigned int k = 0; k < instanceCount; ++k) {
+				BoundingSphere sphere;
+				m_materialBounds[i].Transform(sphere, Matrix(instances[k].world) * world * view);
+				if (frustum.Contains(sphere) == DISJOINT)
+					continue;
+
+				const float distance = std::max(Vector3(sphere.Center).Length() - sphere.Radius, 0.1f);
+				screenSizes[i] = std::max(screenSizes[i], 2.0f * sphere.Radius * pixelScale / distance);
+			}
+		}
+	}, grain);
+}
 
-		auto textureName = textureData[m_data.material[i].colorMapTextureIndex];
-		DX12::CreateTextureSRV(DXTK->Device, textureName.c_str(), resourceUpload, m_materialDescriptors.get(), i * 3 + 1, m_texture[i].ReleaseAndGetAddressOf());
+/**
+	@brief	SeNX`̓ǂݍ݂n߂
+*/
+void PmxLoader::Prefetch()
+{
+	auto& residency = TextureResidency::Get();
+	for (const auto& handle : m_residency)
+		residency.MarkNeeded(handle.Get());
+	ApplyStreamedTextures();
+}
 
-		auto sphName = textureData[m_data.material[i].mapTextureIndex];
-		DX12::CreateTextureSRV(DXTK->Device, sphName.c_str(), resourceUpload, m_materialDescriptors.get(), i * 3 + 2, m_sphTexture[i].ReleaseAndGetAddressOf());
+/**
+	@brief	؂ւ̃J猩eNX`̓ǂݍ݂n߂
+	@return	eNX`SĂ邩(܂Ŗt[Ăł悢)
+	@note	𑜓xTextureResidency::UpdateŐ؂ւ̑傫܂ŏオ
+*/
+bool PmxLoader::Prefetch(const DX12::CAMERA& camera)
+{
+	UpdateConstants();
+	const bool ready = RequestTextures(camera);
+	ApplyStreamedTextures();
+	return ready;
+}
 
-		auto toonName = toonTextureData[m_data.material[i].toonTextureIndex];
-		if (!m_data.material[i].toonFlag)
-			toonName = textureData[m_data.material[i].toonTexture];
+/**
+	@brief	ǂݍ݂̌vl
+*/
+PmxLoader::LoadStatistics PmxLoader::GetLoadStatistics() const
+{
+	LoadStatistics statistics{};
+	statistics.firstFrameMs      = m_firstFrameMs;
+	statistics.texturesReadyMs   = m_texturesReadyMs;
+	statistics.texturesTotal     = m_textureSizes.size();
+	statistics.texturesRequested = std::count_if(m_textureSizes.begin(), m_textureSizes.end(), [](uint32_t size) {
+		return size != TEXTURE_NOT_REQUESTED;
+	});
+	return statistics;
+}
 
-		//DX12::CreateTextureSRV(DXTK->Device, toonName.c_str(), resourceUpload, m_materialDescriptors.get(), i * 4 + 3, m_toonTexture[i].ReleaseAndGetAddressOf());
+/**
+	@brief	}eA̋E
+*/
+void PmxLoader::MaterialBounds()
+{
+	m_materialBounds.resize(m_data.material.size());
+
+	std::vector<XMFLOAT3> points;
+	unsigned int offset = 0;
+	for (size_t i = 0; i < m_data.material.size(); ++i) {
+		const unsigned int count = m_data.materials[i].indicesNum;
+		points.clear();
+		for (unsigned int j = offset; j < offset + count && j < m_data.surfaces.size(); ++j)
+			points.push_back(m_data.vertices[m_data.surfaces[j].vertexIndex].pos);
+		offset += count;
+
+		if (points.empty())
+			m_materialBounds[i] = BoundingSphere();
+		else
+			BoundingSphere::CreateFromPoints(m_materialBounds[i], points.size(), points.data(), sizeof(XMFLOAT3));
 	}
+}
+
+/**
+	@brief	}eAe[u̐
+	@note	VF[_[ɂStructuredBufferœnA`掞̓[g萔Ŕԍw肷
+*/
+void PmxLoader::MaterialTable()
+{
+	//͈͊O(-1)̃eNX`ԍ͔eNX`ɂ
+	const auto textureSlot = [&](int index) {
+		if (index < 0 || index >= m_data.numTexture)
+			index = m_data.numTexture;
+		return static_cast<unsigned int>(m_textureDescriptors[index].Index());
+	};
 
+	m_materialRecords.resize(m_data.numMaterial);
+	for (int i = 0; i < m_data.numMaterial; i++) {
+		const auto& material = m_data.material[i];
+		auto& record = m_materialRecords[i];
+
+		record.diffuse      = material.diffuse;
+		record.specular     = material.specular;
+		record.ambient      = material.ambient;
+		record.edgeSize     = material.edgeSize;
+		record.edgeColor    = material.edgeColor;
+		record.textureIndex = textureSlot(material.colorMapTextureIndex);
+		record.sphereIndex  = textureSlot(material.mapTextureIndex);
+		record.flags        = material.bitFlag;
+
+		//LgD[͑Sfʂ̃eNX`z̃XCX
+		if (material.toonFlag) {
+			record.toonIndex = ToonTextureArray::SharedToonSlice(material.toonTextureIndex);
+		}
+		else if (material.toonTexture >= 0 && material.toonTexture < m_data.numTexture) {
+			record.toonIndex = textureSlot(material.toonTexture);
+			record.flags    |= MaterialRecord::TOON_TEXTURE;
+		}
+		else {
+			record.toonIndex = ToonTextureArray::SharedToonSlice(-1);
+		}
+	}
 
-	auto uploadResourcesFinished = resourceUpload.End(DXTK->CommandQueue);
-	uploadResourcesFinished.wait();
+	m_materialDirty = true;
 }
 
 /**
 	@brief	VF[_[̐ݒ
+	@note	VF[_[gfmShaderCacheŃoCgR[hL
 */
 void PmxLoader::InitShader()
 {
-
-	HRESULT result;
-	ComPtr<ID3DBlob> error_blob;
-	result = D3DCompileFromFile(
-		vsfileName,
-		nullptr, D3D_COMPILE_STANDARD_FILE_INCLUDE,
-		"BasicVS", "vs_5_0",
-		D3DCOMPILE_DEBUG | D3DCOMPILE_SKIP_OPTIMIZATION, 0,
-		m_vsBlob.ReleaseAndGetAddressOf(),
-		error_blob.ReleaseAndGetAddressOf()
-	);
-	DX::ThrowIfFailed(result);
-
-	result = D3DCompileFromFile(
-		psfileName,
-		nullptr, D3D_COMPILE_STANDARD_FILE_INCLUDE,
-		"BasicPS", "ps_5_0",
-		D3DCOMPILE_DEBUG | D3DCOMPILE_SKIP_OPTIMIZATION, 0,
-		m_psBlob.ReleaseAndGetAddressOf(),
-		error_blob.ReleaseAndGetAddressOf()
-	);
-	DX::ThrowIfFailed(result);
+	PROFILE_ZONE("Pmx::InitShader");
+	auto& shaderCache = ShaderCache::Get();
+	m_vsBlob = shaderCache.Compile(vsfileName, "BasicVS", "vs_5_1");
+	m_psBlob = shaderCache.Compile(psfileName, "BasicPS", "ps_5_1");
 }
 
 /**
@@ -705,61 +842,99 @@ void PmxLoader::InitShader()
 void PmxLoader::CreatePipeLine()
 {
 	// [gVOl`
-	HRESULT result;
-	D3D12_DESCRIPTOR_RANGE descRange[3] = {};
-	descRange[0].NumDescriptors = 1;
-	descRange[0].RangeType = D3D12_DESCRIPTOR_RANGE_TYPE_CBV;
+	D3D12_DESCRIPTOR_RANGE descRange[1] = {};
+	//ʃq[ṽeNX`S(t0, space1)
+	descRange[0].NumDescriptors = UINT_MAX;
+	descRange[0].RangeType = D3D12_DESCRIPTOR_RANGE_TYPE_SRV;
 	descRange[0].BaseShaderRegister = 0;
-	descRange[0].OffsetInDescriptorsFromTableStart = D3D12_DESCRIPTOR_RANGE_OFFSET_APPEND;
+	descRange[0].RegisterSpace = 1;
+	descRange[0].OffsetInDescriptorsFromTableStart = 0;
 
-	descRange[1].NumDescriptors = 1;
-	descRange[1].RangeType = D3D12_DESCRIPTOR_RANGE_TYPE_CBV;
-	descRange[1].BaseShaderRegister = 1;
-	descRange[1].OffsetInDescriptorsFromTableStart = D3D12_DESCRIPTOR_RANGE_OFFSET_APPEND;
-
-	descRange[2].NumDescriptors = 2;
-	descRange[2].RangeType = D3D12_DESCRIPTOR_RANGE_TYPE_SRV;
-	descRange[2].BaseShaderRegister = 0;
-	descRange[2].OffsetInDescriptorsFromTableStart = D3D12_DESCRIPTOR_RANGE_OFFSET_APPEND;
 
+	//LgD[̃eNX`z(t5)
+	D3D12_DESCRIPTOR_RANGE toonRange = {};
+	toonRange.NumDescriptors = 1;
+	toonRange.RangeType = D3D12_DESCRIPTOR_RANGE_TYPE_SRV;
+	toonRange.BaseShaderRegister = 5;
+	toonRange.RegisterSpace = 0;
+	toonRange.OffsetInDescriptorsFromTableStart = 0;
 
 	//[gp
-	D3D12_ROOT_PARAMETER rootparam[2] = {};
-	rootparam[0].ParameterType = D3D12_ROOT_PARAMETER_TYPE_DESCRIPTOR_TABLE;
-	rootparam[0].DescriptorTable.pDescriptorRanges = &descRange[0];
-	rootparam[0].DescriptorTable.NumDescriptorRanges = 1;
+	D3D12_ROOT_PARAMETER rootparam[8] = {};
+	//J(b0)
+	rootparam[0].ParameterType = D3D12_ROOT_PARAMETER_TYPE_CBV;
+	rootparam[0].Descriptor.ShaderRegister = 0;
 	rootparam[0].ShaderVisibility = D3D12_SHADER_VISIBILITY_ALL;
 
-	rootparam[1].ParameterType = D3D12_ROOT_PARAMETER_TYPE_DESCRIPTOR_TABLE;
-	rootparam[1].DescriptorTable.pDescriptorRanges = &descRange[1];
-	rootparam[1].DescriptorTable.NumDescriptorRanges = 2;
+	//}eAԍ(b1)
+	rootparam[1].ParameterType = D3D12_ROOT_PARAMETER_TYPE_32BIT_CONSTANTS;
+	rootparam[1].Constants.ShaderRegister = 1;
+	rootparam[1].Constants.Num32BitValues = 1;
 	rootparam[1].ShaderVisibility = D3D12_SHADER_VISIBILITY_PIXEL;
 
-	//Tv[
-	D3D12_STATIC_SAMPLER_DESC samplerDesc = {};
-	samplerDesc.AddressU = D3D12_TEXTURE_ADDRESS_MODE_WRAP;
-	samplerDesc.AddressV = D3D12_TEXTURE_ADDRESS_MODE_WRAP;
-	samplerDesc.AddressW = D3D12_TEXTURE_ADDRESS_MODE_WRAP;
-	samplerDesc.BorderColor = D3D12_STATIC_BORDER_COLOR_OPAQUE_BLACK;
-	samplerDesc.Filter = D3D12_FILTER_COMPARISON_MIN_LINEAR_MAG_POINT_MIP_LINEAR;
-	samplerDesc.MaxLOD = D3D12_FLOAT32_MAX;
-	samplerDesc.MinLOD = 0.0f;
-	samplerDesc.ShaderVisibility = D3D12_SHADER_VISIBILITY_PIXEL;
-	samplerDesc.ComparisonFunc = D3D12_COMPARISON_FUNC_NEVER;
+	//CX^Xf[^(t3)
+	rootparam[2].ParameterType = D3D12_ROOT_PARAMETER_TYPE_SRV;
+	rootparam[2].Descriptor.ShaderRegister = 3;
+	rootparam[2].Descriptor.RegisterSpace = 0;
+	rootparam[2].ShaderVisibility = D3D12_SHADER_VISIBILITY_VERTEX;
+
+	//[h(b2)
+	rootparam[3].ParameterType = D3D12_ROOT_PARAMETER_TYPE_CBV;
+	rootparam[3].Descriptor.ShaderRegister = 2;
+	rootparam[3].ShaderVisibility = D3D12_SHADER_VISIBILITY_VERTEX;
+
+	//{[(b3)
+	rootparam[4].ParameterType = D3D12_ROOT_PARAMETER_TYPE_CBV;
+	rootparam[4].Descriptor.ShaderRegister = 3;
+	rootparam[4].ShaderVisibility = D3D12_SHADER_VISIBILITY_VERTEX;
+
+	//}eAe[u(t4)
+	rootparam[5].ParameterType = D3D12_ROOT_PARAMETER_TYPE_SRV;
+	rootparam[5].Descriptor.ShaderRegister = 4;
+	rootparam[5].ShaderVisibility = D3D12_SHADER_VISIBILITY_PIXEL;
+
+	//eNX`
+	rootparam[6].ParameterType = D3D12_ROOT_PARAMETER_TYPE_DESCRIPTOR_TABLE;
+	rootparam[6].DescriptorTable.pDescriptorRanges = &descRange[0];
+	rootparam[6].DescriptorTable.NumDescriptorRanges = 1;
+	rootparam[6].ShaderVisibility = D3D12_SHADER_VISIBILITY_PIXEL;
+
+	//LgD[
+	rootparam[7].ParameterType = D3D12_ROOT_PARAMETER_TYPE_DESCRIPTOR_TABLE;
+	rootparam[7].DescriptorTable.pDescriptorRanges = &toonRange;
+	rootparam[7].DescriptorTable.NumDescriptorRanges = 1;
+	rootparam[7].ShaderVisibility = D3D12_SHADER_VISIBILITY_PIXEL;
+
+	//Tv[(s0:eNX` s1:gD[)
+	D3D12_STATIC_SAMPLER_DESC samplerDesc[2] = {};
+	samplerDesc[0].AddressU = D3D12_TEXTURE_ADDRESS_MODE_WRAP;
+	samplerDesc[0].AddressV = D3D12_TEXTURE_ADDRESS_MODE_WRAP;
+	samplerDesc[0].AddressW = D3D12_TEXTURE_ADDRESS_MODE_WRAP;
+	samplerDesc[0].BorderColor = D3D12_STATIC_BORDER_COLOR_OPAQUE_BLACK;
+	samplerDesc[0].Filter = D3D12_FILTER_COMPARISON_MIN_LINEAR_MAG_POINT_MIP_LINEAR;
+	samplerDesc[0].MaxLOD = D3D12_FLOAT32_MAX;
+	samplerDesc[0].MinLOD = 0.0f;
+	samplerDesc[0].ShaderVisibility = D3D12_SHADER_VISIBILITY_PIXEL;
+	samplerDesc[0].ComparisonFunc = D3D12_COMPARISON_FUNC_NEVER;
+
+	//gD[͒[Ő܂ԂȂ
+	samplerDesc[1] = samplerDesc[0];
+	samplerDesc[1].AddressU = D3D12_TEXTURE_ADDRESS_MODE_CLAMP;
+	samplerDesc[1].AddressV = D3D12_TEXTURE_ADDRESS_MODE_CLAMP;
+	samplerDesc[1].AddressW = D3D12_TEXTURE_ADDRESS_MODE_CLAMP;
+	samplerDesc[1].Filter = D3D12_FILTER_MIN_MAG_MIP_LINEAR;
+	samplerDesc[1].ShaderRegister = 1;
 
 	D3D12_ROOT_SIGNATURE_DESC rootSignatureDesc = {};
 	rootSignatureDesc.Flags = D3D12_ROOT_SIGNATURE_FLAG_ALLOW_INPUT_ASSEMBLER_INPUT_LAYOUT;
 	rootSignatureDesc.pParameters = rootparam;
-	rootSignatureDesc.NumParameters = 2;
-	rootSignatureDesc.pStaticSamplers = &samplerDesc;
-	rootSignatureDesc.NumStaticSamplers = 1;
-
-	result = DirectX::CreateRootSignature(
-		DXTK->Device,
-		&rootSignatureDesc,
-		m_rootSignature.ReleaseAndGetAddressOf()
-	);
-	DX::ThrowIfFailed(result);
+	rootSignatureDesc.NumParameters = _countof(rootparam);
+	rootSignatureDesc.pStaticSamplers = samplerDesc;
+	rootSignatureDesc.NumStaticSamplers = _countof(samplerDesc);
+
+	//ݒ̃fm̓[gVOl`EpCvCL
+	auto& pipelineLibrary = PipelineLibrary::Get();
+	m_rootSignature = pipelineLibrary.GetRootSignature(rootSignatureDesc);
 
 	// pCvCXe[g
 	D3D12_GRAPHICS_PIPELINE_STATE_DESC gpipeline = {};
@@ -820,40 +995,9 @@ void PmxLoader::CreatePipeLine()
 	gpipeline.SampleDesc.Quality = 0;
 
 	gpipeline.pRootSignature = m_rootSignature.Get();
-	result = DXTK->Device->CreateGraphicsPipelineState(
-		&gpipeline,
-		IID_PPV_ARGS(m_pipelineState.ReleaseAndGetAddressOf())
-	);
-	DX::ThrowIfFailed(result);
+	m_pipeline = pipelineLibrary.GetPipeline(gpipeline);
 }
 
-/**
-	@brief	t@C̃jR[hϊA]vȕ폜
-	@param	_file   t@Cf[^
-	@param  output  ϊt@C
-	@return @s
-*/
-bool PmxLoader::getPMXStringUTF16(FILE* file, std::wstring& output)
-{
-	if (file == NULL)
-		return false;
-
-	std::array<wchar_t, 512> wBuffer{};
-	int a;
-
-	fread(&a, sizeof(a), 1, file);
-
-	fread(&wBuffer, a, 1, file);
-
-	output = std::wstring(wBuffer.data());
-	wchar_t chars[] = L"\\";
-
-	int i = output.find(chars);
-	if (i != -1)
-		output.replace(i, 1, L"/");
-
-	return true;
-}
 
 void PmxLoader::ToonTexture()
 {
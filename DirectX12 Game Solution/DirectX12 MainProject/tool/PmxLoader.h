@@ -13,7 +13,22 @@
 -------------------------------------------------------------------------------------
 */
 #include "PmxStructList.h"
+#include "PmxReader.h"
 #include "VMDLoader.h"
+#include "DescriptorAllocator.h"
+#include "ShaderCache.h"
+#include "PipelineLibrary.h"
+#include "TextureCache.h"
+#include "TextureStreamer.h"
+#include "UploadQueue.h"
+#include "ModelCache.h"
+#include "TextureResidency.h"
+#include "ToonTextureArray.h"
+#include "AssetFiles.h"
+#include "TextDecoder.h"
+#include "FramePacket.h"
+
+#include <chrono>
 
 /*
 -------------------------------------------------------------------------------------
@@ -35,6 +50,13 @@ using namespace DirectX::SimpleMath;
 */
 class PmxLoader {
 public:
+	struct LoadStatistics {
+		double firstFrameMs;		//PmxRead珉߂ĕ`悳܂(܂Ȃ畉)
+		double texturesReadyMs;		//PmxRead猩Ă}eÃeNX`S܂()
+		size_t texturesRequested;	//ǂݍ݂n߂eNX`
+		size_t texturesTotal;
+	};
+
 	PmxLoader();
 	virtual ~PmxLoader() {}
 
@@ -46,7 +68,24 @@ public:
 
 	void PmxRead(const char*);
 	void Update();
+
+	//AssetLoaderiKƂɌĂ(ReadFileEInitShaderELoadMotion̓[J[XbhĂׂ)
+	bool ReadFile(const char* fileName);
+	void InitShader();
+	void SetUp();
+	void LoadMotion(const char* fileName);
+	//pCvCƒ_ECfbNX̓]IĂ邩
+	bool IsReady() const;
+
 	void Render();
+
+	//t[pCvC(Capture̓V~[ṼXbhUpdatěARender̓CXbh)
+	void Capture(ModelFrame& frame);
+	void Render(const ModelFrame& frame);
+	//Render𕪂(Prepare̓CXbhARecord͕L^̃[J[Ăׂ)
+	void Prepare(const ModelFrame& frame);
+	void Record(ID3D12GraphicsCommandList* commandList, const ModelFrame& frame);
+
 	void SetShader(LPCWSTR vs, LPCWSTR ps)
 	{
 		vsfileName = vs;
@@ -59,28 +98,40 @@ public:
 
 	//Aj[V
 	void Animetion(float deltaTime);
+	//[VvZpx(30/60/120HzA0Ȃ疈t[)
+	void SetMotionRate(unsigned int hz) { m_vmd.SetSampleRate(hz); }
 
+	//CX^X`
+	void SetInstanceCount(unsigned int count);
+	void SetInstanceTransform(unsigned int index, const Matrix& transform, unsigned int boneOffset = 0);
+	unsigned int GetInstanceCount() const { return m_instanceCount; }
 
-private:
-	//f񃍁[h
-	void Header(FILE* fp);
-	void Vertex(FILE* fp);
-	void Surface(FILE* fp);
-	void Texture(FILE* fp);
-	void Material(FILE* fp);
-	void Born(FILE* fp);
-	void Map();
+	//eNX`̐ǂ(J̐؂ւOɌĂԁAJ͑S)
+	void Prefetch();
+	bool Prefetch(const DX12::CAMERA& camera);
 
+	LoadStatistics GetLoadStatistics() const;
+
+private:
 	//`揀
-	void SetUp();
 	void VertexBuffer(D3D12_HEAP_PROPERTIES, D3D12_RESOURCE_DESC);
 	void IndexBuffer(D3D12_HEAP_PROPERTIES, D3D12_RESOURCE_DESC);
-	void ConstantBuffer(D3D12_HEAP_PROPERTIES, D3D12_RESOURCE_DESC);
-	void InitShader();
+	void SharedBuffers();
+	void MaterialTable();
+	void MaterialBounds();
+	void ApplyStreamedTextures();
+	bool RequestTextures(const DX12::CAMERA& camera);
+	bool RequestTextures(const std::vector<float>& screenSizes);
+	void MaterialScreenSizes(const DX12::CAMERA& camera, const Matrix& world,
+		const InstanceData* instances, unsigned int instanceCount, std::vector<float>& screenSizes) const;
+	void UpdateConstants();
+	void WriteConstants(unsigned int flags, const DX12::CAMERA& camera, const Matrix& world,
+		const std::vector<Matrix>& bones, const InstanceData* instances, unsigned int instanceCount);
+	void UploadMaterials();
+	void Draw(ID3D12GraphicsCommandList* commandList, bool texturesReady, unsigned int instanceCount);
 	void ExportTexture();
 	void CreatePipeLine();
 
-	bool getPMXStringUTF16(FILE* _file, std::wstring& output);
 	void ToonTexture();
 	std::string GetExtension(const std::string& path);
 
@@ -92,23 +143,68 @@ private:
 	ComPtr<ID3DBlob>			m_vsBlob;
 	ComPtr<ID3DBlob>			m_psBlob;
 
-	//!@[gVOl`@pCvC
-	ComPtr<ID3D12RootSignature> m_rootSignature;
-	ComPtr<ID3D12PipelineState> m_pipelineState;
+	//!@[gVOl`@pCvC(PipelineLibraryŋL)
+	ComPtr<ID3D12RootSignature>                m_rootSignature;
+	std::shared_ptr<PipelineLibrary::Pipeline> m_pipeline;
 
 	//!@CfbNXobt@[@r[
 	ComPtr<ID3D12Resource>		m_indexBuffer;
 	D3D12_INDEX_BUFFER_VIEW		m_indexBufferView;
 
-	//! RX^gobt@[
-	ComPtr<ID3D12Resource> m_constantBuffer;
-	//! }eAp
-	ComPtr<ID3D12Resource> m_materialBuffer;
-
-	//! eNX`\[X
-	std::vector<ComPtr<ID3D12Resource>>  m_texture;
-	std::vector<ComPtr<ID3D12Resource>>  m_sphTexture;
-	std::vector<ComPtr<ID3D12Resource>>  m_toonTexture;
+	//! _ECfbNX̃Rs[L[ł̓](I܂ŕ`悵Ȃ)
+	UploadQueue::Token			m_geometryUpload;
+
+	//! ModelCacheŋL郂f(΃t@Cǂ܂A_ECfbNXȂ)
+	std::shared_ptr<const ModelCache::Model> m_cachedModel;
+	std::wstring                             m_cacheKey;
+
+	//! RX^gobt@[(GraphicsMemorỹO疈t[m)
+	GraphicsResource m_cameraConstants;
+	GraphicsResource m_worldConstants;
+	GraphicsResource m_boneConstants;
+
+	//! }eA(ʃq[ṽXbgԍ܂Ƃ߂)
+	std::vector<MaterialRecord> m_materialRecords;
+	GraphicsResource            m_materialConstants;
+	//! eNX`̍ւŕς(CXbhG)
+	bool                        m_materialDirty;
+	//! Preparě(RecordŎg)
+	bool                        m_texturesReady;
+
+	//! CX^Xp
+	GraphicsResource          m_instanceConstants;
+	std::vector<InstanceData> m_instances;
+	unsigned int              m_instanceCount;
+
+	//! KvȒ萔(pCvC̓V~[ṼXbhACaptureModelFrameɈڂ)
+	enum DirtyFlags : unsigned int {
+		DIRTY_CAMERA   = 0x01,
+		DIRTY_WORLD    = 0x02,
+		DIRTY_BONE     = 0x04,
+		DIRTY_INSTANCE = 0x08,
+		DIRTY_ALL      = 0x0f
+	};
+	unsigned int m_dirtyFlags;
+
+	//! eNX`\[X(PMX̃eNX`ԍA͔@̂TextureCacheƋL)
+	std::vector<ComPtr<ID3D12Resource>>           m_texture;
+	std::vector<ComPtr<ID3D12Resource>>           m_toonTexture;
+	//! ւ悤1mۂ
+	std::vector<DescriptorRange>                  m_textureDescriptors;
+	//! ǂݍݑ҂(͂܂ł͔eNX`\)
+	std::vector<std::shared_ptr<StreamedTexture>> m_streamingTextures;
+	//! 풓Ǘ̓o^(͏)
+	std::vector<TextureResidency::Handle>         m_residency;
+	//! ǂݍݍς݁Eǂݍݒ̍őTCY(TextureResidency::TargetSizeƓ\)
+	std::vector<uint32_t>                         m_textureSizes;
+	//! ܂xĂȂeNX`m_textureSizes
+	static constexpr uint32_t TEXTURE_NOT_REQUESTED = UINT32_MAX;
+	//! MaterialScreenSizes1Wu󂯎E̔̍ŏ
+	static constexpr size_t CULL_GRAIN = 256;
+	//! }eA̋E(fԁAʏ̑傫̌vZp)
+	std::vector<BoundingSphere>                   m_materialBounds;
+	//! RequestTextures(camera)̍Ɨp
+	std::vector<float>                            m_screenSizes;
 
 	SimpleMath::Matrix m_position;
 	SimpleMath::Matrix m_scale;
@@ -117,11 +213,15 @@ private:
 
 	SimpleMath::Matrix m_worldTransform;
 
-	unique_ptr<DescriptorHeap>  m_resourceDescriptors;
-	unique_ptr<DescriptorHeap>  m_materialDescriptors;
-
 	//! t@CpX
 	std::wstring m_ps;
+	//! GPǓv̋Ԗ("GPU::t@C")
+	const char*  m_gpuZone;
+
+	//! ǂݍݎԂ̌v
+	std::chrono::steady_clock::time_point m_loadStart;
+	double                                m_firstFrameMs;
+	double                                m_texturesReadyMs;
 
 	PmxData m_data;
 	VMDLoader m_vmd;
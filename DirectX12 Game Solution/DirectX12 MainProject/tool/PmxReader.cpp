@@ -0,0 +1,377 @@
+/**
+ * @file PmxReader.cpp
+ * @brief PMX̉(FileViewPmxDataցA`ɈˑȂ)
+ * @author hoshi hirofumi
+ * @date 2026/10/19
+ */
+
+#include "PmxReader.h"
+#include "Profiler.h"
+#include "TextDecoder.h"
+
+#include <algorithm>
+#include <cstring>
+
+/**
+ * @brief wb_[{[܂œǂ݁AMap܂ōs
+ * @param fp t@Cf[^
+ * @return PMX 2.xȊOȂfalse
+ */
+bool PmxReader::Read(FileView& fp, PmxData& data)
+{
+	if (!Header(fp, data))
+		return false;
+
+	Vertex(fp, data);
+	Surface(fp, data);
+	Texture(fp, data);
+	Material(fp, data);
+	Born(fp, data);
+	Map(data);
+	return true;
+}
+
+/**
+ * @brief wb_[ǂݍ
+ * @param fp t@Cf[^
+ * @return PMX 2.xȊOȂfalse
+ */
+bool PmxReader::Header(FileView& fp, PmxData& data)
+{
+	PROFILE_ZONE("Pmx::Header");
+	// wb_[`FbN
+	uint8_t header[4];
+	fp.Read(header, 4, 1);
+	if (memcmp(header, "PMX ", 4) != 0)
+		return false;
+
+	float ver;
+	fp.Read(&ver, sizeof(ver), 1);
+	if (ver < 2.0f)
+		return false;
+
+	fp.Skip(1);
+	fp.Read(&data.encord, 1, 1);
+	fp.Read(&data.addUv, 1, 1);
+	fp.Read(&data.verticesIndex, 1, 1);
+	fp.Read(&data.textureIndex, 1, 1);
+	fp.Read(&data.materialIndex, 1, 1);
+	fp.Read(&data.boneIndex, 1, 1);
+	fp.Read(&data.morphIndex, 1, 1);
+	fp.Read(&data.rigidbodyIndex, 1, 1);
+
+	//f
+	std::wstring m_name;
+	for (int i = 0; i < 4; i++)
+	{
+		ReadString(fp, data, m_name);
+		data.modelName[i] = m_name;
+	}
+	return true;
+}
+
+/**
+ * @brief _f[^ǂݍ
+ * @param fp t@Cf[^
+ */
+void PmxReader::Vertex(FileView& fp, PmxData& data)
+{
+	PROFILE_ZONE("Pmx::Vertex");
+	// _ǂݍ
+	fp.Read(&data.numVertex, sizeof(int), 1);
+
+	// zmۂ
+	data.vertices.resize(data.numVertex);
+
+	// t@C璸_f[^擾
+	for (int i = 0; i < data.numVertex; ++i) {
+		fp.Read(&data.vertices[i].pos, sizeof(XMFLOAT3), 1);
+		fp.Read(&data.vertices[i].normal, sizeof(XMFLOAT3), 1);
+		fp.Read(&data.vertices[i].uv, sizeof(XMFLOAT2), 1);
+
+		uint8_t weighttype;
+		fp.Read(&weighttype, 1, 1);
+
+		switch (weighttype) {
+		case PmxData::Vertex::Weight::BDEF:
+			//_data.vertices[i].weight.type = PmxData::Vertex::Weight::BDEF;
+			fp.Read(&data.vertices[i].weight.born1, data.boneIndex, 1);
+			data.vertices[i].weight.born2 = -1;
+			data.vertices[i].weight.born3 = -1;
+			data.vertices[i].weight.born4 = -1;
+			data.vertices[i].weight.weight1 = 1.0f;
+			break;
+
+		case PmxData::Vertex::Weight::BDEF1:
+			//_data.vertices[i].weight.type = PmxData::Vertex::Weight::BDEF1;
+			fp.Read(&data.vertices[i].weight.born1, data.boneIndex, 1);
+			fp.Read(&data.vertices[i].weight.born2, data.boneIndex, 1);
+			data.vertices[i].weight.born3 = -1;
+			data.vertices[i].weight.born4 = -1;
+			fp.Read(&data.vertices[i].weight.weight1, 4, 1);
+			data.vertices[i].weight.weight2 = 1.0f - data.vertices[i].weight.weight1;
+			break;
+
+		case PmxData::Vertex::Weight::BDEF4:
+			//_data.vertices[i].weight.type = PmxData::Vertex::Weight::BDEF4;
+			fp.Read(&data.vertices[i].weight.born1, data.boneIndex, 1);
+			fp.Read(&data.vertices[i].weight.born2, data.boneIndex, 1);
+			fp.Read(&data.vertices[i].weight.born3, data.boneIndex, 1);
+			fp.Read(&data.vertices[i].weight.born4, data.boneIndex, 1);
+			fp.Read(&data.vertices[i].weight.weight1, 4, 1);
+			fp.Read(&data.vertices[i].weight.weight2, 4, 1);
+			fp.Read(&data.vertices[i].weight.weight3, 4, 1);
+			fp.Read(&data.vertices[i].weight.weight4, 4, 1);
+			break;
+
+		case PmxData::Vertex::Weight::SDEF:
+			//_data.vertices[i].weight.type = PmxData::Vertex::Weight::SDEF;
+			fp.Read(&data.vertices[i].weight.born1, data.boneIndex, 1);
+			fp.Read(&data.vertices[i].weight.born2, data.boneIndex, 1);
+			fp.Read(&data.vertices[i].weight.weight1, 4, 1);
+			data.vertices[i].weight.weight2 = 1.0f - data.vertices[i].weight.weight1;
+			fp.Read(&data.vertices[i].weight.c, 12, 1);
+			fp.Read(&data.vertices[i].weight.r0, 12, 1);
+			fp.Read(&data.vertices[i].weight.r1, 12, 1);
+			break;
+
+		}
+		fp.Read(&data.vertices[i].edge, 4, 1);
+	}
+}
+
+/**
+ * @brief CfbNXf[^ǂݍ
+ * @param fp t@Cf[^
+ */
+void PmxReader::Surface(FileView& fp, PmxData& data)
+{
+	PROFILE_ZONE("Pmx::Surface");
+	//
+	fp.Read(&data.numSurfaces, 4, 1);
+	data.surfaces.resize(data.numSurfaces);
+	for (int i = 0; i < data.numSurfaces; i++)
+		fp.Read(&data.surfaces[i].vertexIndex, data.verticesIndex, 1);
+}
+
+/**
+ * @brief eNX`ǂݍ
+ * @param fp t@Cf[^
+ */
+void PmxReader::Texture(FileView& fp, PmxData& data)
+{
+	PROFILE_ZONE("Pmx::Texture");
+	//eNX`
+	fp.Read(&data.numTexture, 4, 1);
+	data.texturePaths.resize(data.numTexture);
+	std::wstring texturePath{};
+	for (int i = 0; i < data.numTexture; i++)
+	{
+		ReadString(fp, data, texturePath);
+
+		data.texturePaths[i] += texturePath;
+	}
+}
+
+/**
+ * @brief }eAf[^ǂݍ
+ * @param fp t@Cf[^
+ */
+void PmxReader::Material(FileView& fp, PmxData& data)
+{
+	PROFILE_ZONE("Pmx::Material");
+	//}eA
+	fp.Read(&data.numMaterial, 4, 1);
+	data.material.resize(data.numMaterial);
+	std::wstring materialPath{};
+	for (int i = 0; i < data.numMaterial; i++)
+	{
+		for (int k = 0; k < 2; k++) {
+			ReadString(fp, data, materialPath);
+			if (k == 0)
+				data.material[i].nameId = NameTable::Get().Intern(materialPath);
+			data.material[i].materialPaths += materialPath;
+		}
+
+		fp.Read(&data.material[i].diffuse, 16, 1);
+		fp.Read(&data.material[i].specular, 16, 1);
+		fp.Read(&data.material[i].ambient, 12, 1);
+
+		fp.Read(&data.material[i].bitFlag, 1, 1);
+		fp.Read(&data.material[i].edgeColor, 16, 1);
+		fp.Read(&data.material[i].edgeSize, 4, 1);
+		fp.Read(&data.material[i].colorMapTextureIndex, data.textureIndex, 1);
+		fp.Read(&data.material[i].mapTextureIndex, data.textureIndex, 1);
+
+		fp.Read(&data.material[i].sphereMode, 1, 1);
+
+		fp.Read(&data.material[i].toonFlag, 1, 1);
+
+		if (data.material[i].toonFlag)
+			fp.Read(&data.material[i].toonTextureIndex, 1, 1);
+		else {
+			fp.Read(&data.material[i].toonTexture, data.textureIndex, 1);
+		}
+		int memo;
+		fp.Read(&memo, 4, 1);
+		fp.Skip(memo);
+		fp.Read(&data.material[i].vertexNum, 4, 1);
+	}
+}
+
+/**
+ * @brief {[f[^ǂݍ
+ * @param fp t@Cf[^
+ */
+void PmxReader::Born(FileView& fp, PmxData& data)
+{
+	PROFILE_ZONE("Pmx::Born");
+	//{[
+	fp.Read(&data.numBone, 4, 1);
+	data.bones.resize(data.numBone);
+	std::wstring mate_name;
+	for (int i = 0; i < data.numBone; i++)
+	{
+		ReadString(fp, data, mate_name);
+		data.bones[i].name += mate_name;
+		data.bones[i].nameId = NameTable::Get().Intern(mate_name);
+
+		ReadString(fp, data, mate_name);
+		data.bones[i].nameEnglish += mate_name;
+
+		fp.Read(&data.bones[i].pos, 12, 1);
+		fp.Read(&data.bones[i].parentNo, data.boneIndex, 1);
+		fp.Read(&data.bones[i].transformationHierarchy, 4, 1);
+		fp.Read(&data.bones[i].flag, 2, 1);
+
+		if (data.bones[i].flag & PmxData::ACCESS_POINT)
+		{
+			fp.Read(&data.bones[i].boneIndexSize, data.boneIndex, 1);
+		}
+		else
+		{
+			data.bones[i].boneIndexSize = -1;
+			fp.Read(&data.bones[i].posOffSet, 12, 1);
+		}
+
+		if ((data.bones[i].flag & PmxData::IMPART_TRANSLATION) || (data.bones[i].flag & PmxData::IMPART_ROTATION))
+		{
+			fp.Read(&data.bones[i].parentBoneIndexSize, data.boneIndex, 1);
+			fp.Read(&data.bones[i].grantRate, 4, 1);
+		}
+
+		if (data.bones[i].flag & PmxData::AXIS_FIXING)
+			fp.Read(&data.bones[i].axisvVector, 12, 1);
+
+		if (data.bones[i].flag & PmxData::LOCAL_AXIS) {
+			fp.Read(&data.bones[i].xAxisVector, 12, 1);
+			fp.Read(&data.bones[i].zAxizVector, 12, 1);
+		}
+
+		if (data.bones[i].flag & PmxData::EXTERNAL_PARENT_TRANS)
+			fp.Read(&data.bones[i].keyIndex, 4, 1);
+
+		if (data.bones[i].flag & PmxData::IK)
+		{
+			fp.Read(&data.bones[i].ikBoneIndexSize, data.boneIndex, 1);
+			fp.Read(&data.bones[i].numLoop, 4, 1);
+			fp.Read(&data.bones[i].axizLimits, 4, 1);
+			fp.Read(&data.numLinks, 4, 1);
+			data.bones[i].ikLinks.resize(data.numLinks);
+
+			for (int j = 0; j < data.numLinks; j++)
+			{
+				fp.Read(&data.bones[i].ikLinks[j].linkBoneIndexSize, data.boneIndex, 1);
+				fp.Read(&data.bones[i].ikLinks[j].limitFlag, 1, 1);
+
+				if (data.bones[i].ikLinks[j].limitFlag) {
+					fp.Read(&data.bones[i].ikLinks[j].lowerLimit, 12, 1);
+					fp.Read(&data.bones[i].ikLinks[j].higherLimit, 12, 1);
+
+				}
+			}
+		}
+	}
+	data.materials.resize(data.material.size());
+}
+
+/**
+ * @brief g₷悤ɕϊ
+ */
+void PmxReader::Map(PmxData& data)
+{
+	PROFILE_ZONE("Pmx::Map");
+	//}eARs[
+	for (size_t i = 0; i < data.material.size(); i++)
+	{
+		data.materials[i].indicesNum = data.material[i].vertexNum;
+		data.materials[i].material.diffuse = data.material[i].diffuse;
+		data.materials[i].material.specular = data.material[i].specular;
+		data.materials[i].material.ambient = data.material[i].ambient;
+	}
+
+	data.shaderData.resize(data.material.size());
+	for (size_t i = 0; i < data.material.size(); i++)
+	{
+		data.shaderData[i].diffuse = data.material[i].diffuse;
+		data.shaderData[i].specular = data.material[i].specular;
+		data.shaderData[i].ambient = data.material[i].ambient;
+	}
+
+	//{[g₷悤Map(L[͖O̔ԍAVMDƂ̏ƍ͐̔r)
+	data.boneNodeTable.reserve(data.bones.size());
+	for (size_t i = 0; i < data.bones.size(); i++)
+	{
+		auto& pb = data.bones[i];
+		auto& node = data.boneNodeTable[pb.nameId];
+		node.boneIndex = static_cast<int>(i);
+		node.startPos = pb.pos;
+	}
+
+	for (auto& pb : data.bones)
+	{
+		if (pb.parentNo < 0 || static_cast<size_t>(pb.parentNo) >= data.bones.size())
+		{
+			continue;
+		}
+
+		const NameId parentName = data.bones[pb.parentNo].nameId;
+		data.boneNodeTable[parentName].children.emplace_back(
+			&data.boneNodeTable[pb.nameId]
+		);
+
+	}
+}
+
+/**
+	@brief	̓ǂݍ(wb_[̃GR[hwɏ]UTF-16EUTF-8ϊ)A؂'/'ɓ
+	@param	file    t@Cf[^
+	@param	data    GR[h̎w(Headerœǂ񂾂)
+	@param  output  ϊ
+	@return @s
+*/
+bool PmxReader::ReadString(FileView& file, const PmxData& data, std::wstring& output)
+{
+	if (!file)
+		return false;
+
+	int a;
+	file.Read(&a, sizeof(a), 1);
+
+	//ꂽŃt@C̊Oǂ܂Ȃ悤
+	const size_t length = std::min<size_t>(std::max(a, 0), file.Remaining());
+	const char* text = reinterpret_cast<const char*>(file.Data() + file.Tell());
+
+	if (data.encord == 1) {
+		output = TextDecoder::FromUtf8(text, length);
+	}
+	else {
+		std::u16string utf16(length / sizeof(char16_t), u'\0');
+		memcpy(utf16.data(), text, utf16.size() * sizeof(char16_t));
+		output = TextDecoder::FromUtf16(utf16.data(), utf16.size());
+	}
+	file.Skip(length);
+
+	std::replace(output.begin(), output.end(), L'\\', L'/');
+	return true;
+}
@@ -0,0 +1,41 @@
+/**
+ * @file PmxReader.h
+ * @brief PMX̉(FileViewPmxDataցA`ɈˑȂ)
+ * @author hoshi hirofumi
+ * @date 2026/10/19
+ * @note PmxLoader::ReadFileLinux̃x`}[N(ModelBench.cpp)œ͂g
+ */
+
+#pragma once
+
+/*
+-------------------------------------------------------------------------------------
+	CN[h
+-------------------------------------------------------------------------------------
+*/
+#include "PmxData.h"
+#include "MappedFile.h"
+
+/*
+-------------------------------------------------------------------------------------
+	PmxReaderNX@錾
+-------------------------------------------------------------------------------------
+*/
+class PmxReader {
+public:
+	//wb_[{[܂œǂ݁A{[̐ڑ(PMX 2.xȊOȂfalse)
+	static bool Read(FileView& fp, PmxData& data);
+
+	//ǂ񂾃f[^g₷悤ɕϊ(}eÂ܂Ƃ߁A{[̐ڑ)
+	static void Map(PmxData& data);
+
+private:
+	static bool Header(FileView& fp, PmxData& data);
+	static void Vertex(FileView& fp, PmxData& data);
+	static void Surface(FileView& fp, PmxData& data);
+	static void Texture(FileView& fp, PmxData& data);
+	static void Material(FileView& fp, PmxData& data);
+	static void Born(FileView& fp, PmxData& data);
+
+	static bool ReadString(FileView& file, const PmxData& data, std::wstring& output);
+};
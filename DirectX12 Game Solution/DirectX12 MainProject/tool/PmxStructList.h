@@ -2,6 +2,7 @@
 
 #include "Base/pch.h"
 #include "Base/dxtk.h"
+#include "PmxData.h"
 
 using Microsoft::WRL::ComPtr;
 using std::unique_ptr;
@@ -13,200 +14,50 @@ using namespace DirectX;
 	\
 -------------------------------------------------------------------------------------
 */
-struct PmxData {
-	//ꂼ̃^Cvۑ
-	byte encord;
-	byte addUv;
-	byte verticesIndex;
-	byte textureIndex;
-	byte materialIndex;
-	byte boneIndex;
-	byte morphIndex;
-	byte rigidbodyIndex;
-	byte weightType;
-
-	//ef[^̐
-	int numVertex;
-	int numSurfaces;
-	int numTexture;
-	int numMaterial;
-	int numBone;
-	int numLinks;
-
-	//_f[^\
-	struct Vertex
-	{
-		XMFLOAT3 pos;
-		XMFLOAT3 normal;
-		XMFLOAT2 uv;
-		//std::vector<XMFLOAT4> addUv;
-
-		struct Weight {
-			enum Type
-			{
-				BDEF,
-				BDEF1,
-				BDEF4,
-				SDEF
-			};
-
-			//Type type;
-			int born1;
-			int born2;
-			int born3;
-			int born4;
-			float weight1;
-			float weight2;
-			float weight3;
-			float weight4;
-			XMFLOAT3 c;
-			XMFLOAT3 r0;
-			XMFLOAT3 r1;
-
-
-		}weight;
-		float edge;
-	};
-
-	//ʃf[^
-	struct Surface
-	{
-		int vertexIndex;
-	};
-
-	//}eAf[^
-	struct Material
-	{
-		std::wstring materialPaths;
-		XMFLOAT4 diffuse;
-		XMFLOAT4 specular;
-		XMFLOAT3 ambient;
-
-		byte bitFlag;
-
-		XMFLOAT4 edgeColor;
-		float edgeSize;
-
-		byte sphereMode;
-		byte toonFlag;
-
-		int colorMapTextureIndex;
-		int mapTextureIndex;
-		int toonTextureIndex;
-		int toonTexture;
-
-		int vertexNum;
-	};
-
-	//VF[_ɓ}eAf[^
-	struct MaterialForHlsl {
-		XMFLOAT4 diffuse; //fBt[YF
-		XMFLOAT4 specular; //XyLF
-		XMFLOAT3 ambient; //ArGgF
-	};
-	//ȊÕ}eAf[^
-	struct AdditionalMaterial {
-		std::string texPath;//eNX`t@CpX
-		int toonIdx; //gD[ԍ
-		bool edgeFlg;//}eA̗֊stO
-	};
-	//܂Ƃ߂
-	struct Materials {
-		unsigned int indicesNum;//CfbNX
-		MaterialForHlsl material;
-		AdditionalMaterial additional;
-	};
-
-	//{[
-	struct Bone
-	{
-		//{[
-		std::wstring name;
-		std::wstring nameEnglish;
-
-		XMFLOAT3 pos;
-		int parentNo;
-		int transformationHierarchy;
-		unsigned short flag;
-
-		XMFLOAT3 posOffSet;
-		int boneIndexSize;
-
-		int parentBoneIndexSize;
-		float grantRate;
-
-		XMFLOAT3 axisvVector;
-
-		XMFLOAT3 xAxisVector;
-		XMFLOAT3 zAxizVector;
-
-		int keyIndex;
-
-		//IK
-		int ikBoneIndexSize;
-		int numLoop;
-		float axizLimits;
-
-
-		struct IKLink
-		{
-			int linkBoneIndexSize;;
-			byte limitFlag;
-			XMFLOAT3 lowerLimit;
-			XMFLOAT3 higherLimit;
-		};
-		std::vector<IKLink> ikLinks;
+// VF[_[f[^(XVpxƂɕ)
+struct CameraConstants		//b0
+{
+	XMMATRIX view;
+	XMMATRIX proj;
+	XMFLOAT3 eye;
+};
 
-	};
+struct WorldConstants		//b2
+{
+	XMMATRIX world;				//f
+};
 
-	// {[̏
-	enum boneFlag
-	{
-		ACCESS_POINT = 0x0001,
-		IK = 0x0020,
-		IMPART_TRANSLATION = 0x0100,
-		IMPART_ROTATION = 0x0200,
-		AXIS_FIXING = 0x0400,
-		LOCAL_AXIS = 0x0800,
-		EXTERNAL_PARENT_TRANS = 0x2000,
-	};
+struct BoneConstants		//b3
+{
+	static constexpr size_t MAX_BONE = 512;
+	XMMATRIX bone[MAX_BONE];	//{[
+};
 
-	//e{[f[^
-	struct BoneNode
-	{
-		int boneIndex;
-		XMFLOAT3 startPos;
-		XMFLOAT3 endPos;
-		std::vector<BoneNode*> children;
+// oChXp}eAf[^(PSStructuredBufferƓ)
+struct MaterialRecord
+{
+	//! flags̏ʃrbg(8rbgPMX̕`tO)
+	enum : unsigned int {
+		TOON_TEXTURE = 0x100	//toonIndex͋ʃq[ṽXbg(fŗL̃gD[)A΋LgD[̃XCX
 	};
 
-	std::vector<PmxData::Materials> materials;								//}eAf[^
-	std::vector<PmxData::MaterialForHlsl> shaderData;						//VF[_[f[^
-	std::map<std::wstring, BoneNode> boneNodeTable;							//{[̐ڑf[^
-	std::vector<Vertex> vertices;											//_f[^
-	std::vector<Surface> surfaces;											//ʃf[^
-	std::wstring modelName[4];												//f
-	std::vector<std::wstring> texturePaths;									//eNX`
-	std::vector<Material> material;											//}eAf[^
-	std::vector<Bone> bones;												//{[f[^
+	XMFLOAT4     diffuse;
+	XMFLOAT4     specular;
+	XMFLOAT3     ambient;
+	float        edgeSize;
+	XMFLOAT4     edgeColor;
+	unsigned int textureIndex;		//ʃq[ṽXbgԍ
+	unsigned int sphereIndex;
+	unsigned int toonIndex;			//LgD[̃XCXԍ ܂ Xbgԍ
+	unsigned int flags;
 };
 
-// VF[_[f[^
-struct VSOUT
+// CX^Xf[^(VSStructuredBufferƓ)
+struct InstanceData
 {
-	XMMATRIX world;				//f
-	XMMATRIX view;
-	XMMATRIX proj;
-	XMFLOAT3 eye;
-	XMMATRIX bone[512];			//{[
-};
-
-struct VMDData {
-	wchar_t name[16];
-	unsigned int frame_no;
-	XMFLOAT3     location;
-	XMFLOAT4     quaternion;
-	BYTE         bezier[64];
+	XMMATRIX     world;				//fs񂩂̑΍s
+	unsigned int boneOffset;		//{[pbg̐擪
+	unsigned int padding[3];
 };
 
 
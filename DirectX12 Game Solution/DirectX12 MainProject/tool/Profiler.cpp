@@ -0,0 +1,298 @@
+/**
+ * @file Profiler.cpp
+ * @brief CPŨvt@C[(XR[vPʂ̌vAChrome/Perfettõg[XóAʂ̋Ԃ̏Wv)
+ * @author hoshi hirofumi
+ * @date 2026/10/19
+ */
+
+#include "Profiler.h"
+
+#include <algorithm>
+#include <chrono>
+#include <cstdio>
+#include <cstring>
+#include <fstream>
+
+/*
+-------------------------------------------------------------------------------------
+	Xbh̃Oobt@[
+-------------------------------------------------------------------------------------
+*/
+//! ͎̂̃Xbh(͌܂1̃Xbh)Aǂނ̂EndFrame(ɓǂ񂾋Ԃm_begunŌĎ̂Ă)
+struct Profiler::ThreadBuffer {
+	struct Slot {
+		std::atomic<const char*> name;
+		std::atomic<uint64_t>    start;
+		std::atomic<uint64_t>    end;
+	};
+
+	std::atomic<uint64_t> begun;	//n߂
+	std::atomic<uint64_t> written;	//I
+	uint64_t              read;		//EndFrameœǂ񂾐
+	uint32_t              id;
+	std::string           name;		//m_mutex̒
+	Slot                  slots[RING_SIZE];
+
+	explicit ThreadBuffer(uint32_t threadId) : begun(0), written(0), read(0), id(threadId) {}
+};
+
+namespace {
+	constexpr uint64_t RING_MASK = Profiler::RING_SIZE - 1;
+
+	//JSON̕ɓ(Ԃ̖O̓eȂ̂ŁA"\Ɛ䕶)
+	void AppendEscaped(std::string& out, const char* text)
+	{
+		for (; *text; ++text) {
+			const char c = *text;
+			if (c == '"' || c == '\\') {
+				out += '\\';
+				out += c;
+			}
+			else if (static_cast<unsigned char>(c) < 0x20) {
+				out += ' ';
+			}
+			else {
+				out += c;
+			}
+		}
+	}
+}
+
+Profiler::Profiler()
+	: m_origin(Now()), m_capturing(false), m_summaryFrames(0), m_summaryVersion(0), m_statistics{}
+{
+}
+
+Profiler::~Profiler()
+{
+}
+
+Profiler& Profiler::Get()
+{
+	static Profiler profiler;
+	return profiler;
+}
+
+uint64_t Profiler::Now()
+{
+	return static_cast<uint64_t>(std::chrono::duration_cast<std::chrono::nanoseconds>(
+		std::chrono::steady_clock::now().time_since_epoch()).count());
+}
+
+/**
+	@note	ŏ1񂾂bNăobt@[(XbhIĂobt@[͎c)
+*/
+Profiler::ThreadBuffer& Profiler::GetThreadBuffer()
+{
+	static thread_local ThreadBuffer* buffer = nullptr;
+	if (buffer == nullptr) {
+		std::lock_guard<std::mutex> lock(m_mutex);
+		m_threads.push_back(std::make_unique<ThreadBuffer>(static_cast<uint32_t>(m_threads.size())));
+		buffer = m_threads.back().get();
+	}
+	return *buffer;
+}
+
+void Profiler::Record(const char* name, uint64_t start, uint64_t end)
+{
+	Write(GetThreadBuffer(), name, start, end);
+}
+
+void Profiler::Record(Track track, const char* name, uint64_t start, uint64_t end)
+{
+	Write(*track, name, start, end);
+}
+
+void Profiler::Write(ThreadBuffer& buffer, const char* name, uint64_t start, uint64_t end)
+{
+	const uint64_t index = buffer.written.load(std::memory_order_relaxed);
+
+	//̃Xbg̑ŐԂǂłEndFrameɁAn܂Ƃɒm点
+	buffer.begun.store(index + 1, std::memory_order_relaxed);
+	std::atomic_thread_fence(std::memory_order_release);
+
+	auto& slot = buffer.slots[index & RING_MASK];
+	slot.name.store(name, std::memory_order_relaxed);
+	slot.start.store(start, std::memory_order_relaxed);
+	slot.end.store(end, std::memory_order_relaxed);
+	buffer.written.store(index + 1, std::memory_order_release);
+}
+
+void Profiler::SetThreadName(const char* name)
+{
+	static thread_local bool named = false;
+	if (named)
+		return;
+	named = true;
+
+	auto& buffer = GetThreadBuffer();
+	std::lock_guard<std::mutex> lock(m_mutex);
+	buffer.name = name;
+}
+
+Profiler::Track Profiler::CreateTrack(const char* name)
+{
+	std::lock_guard<std::mutex> lock(m_mutex);
+	m_threads.push_back(std::make_unique<ThreadBuffer>(static_cast<uint32_t>(m_threads.size())));
+	m_threads.back()->name = name;
+	return m_threads.back().get();
+}
+
+const char* Profiler::Intern(const std::string& name)
+{
+	std::lock_guard<std::mutex> lock(m_mutex);
+	return m_names.insert(name).first->c_str();
+}
+
+/**
+	@brief	SXbh̋ԂW߂
+	@note	ǂłԂɃOꂽXbĝ͎Ă(Ă鑤͑҂Ȃ)
+*/
+void Profiler::EndFrame()
+{
+	std::lock_guard<std::mutex> lock(m_mutex);
+	const bool capturing = m_capturing.load(std::memory_order_relaxed);
+
+	auto& events = m_scratch;
+	for (auto& thread : m_threads) {
+		auto& buffer = *thread;
+		const uint64_t written = buffer.written.load(std::memory_order_acquire);
+		uint64_t first = buffer.read;
+		if (written - first > RING_SIZE) {
+			m_statistics.dropped += written - RING_SIZE - first;
+			first = written - RING_SIZE;
+		}
+
+		events.clear();
+		for (uint64_t i = first; i < written; ++i) {
+			const auto& slot = buffer.slots[i & RING_MASK];
+			events.push_back({
+				slot.name.load(std::memory_order_relaxed),
+				slot.start.load(std::memory_order_relaxed),
+				slot.end.load(std::memory_order_relaxed),
+				buffer.id });
+		}
+
+		//ǂ񂾌ɏn߂ꂽʒu1ȏŐԂ͒gĂ邩Ȃ
+		std::atomic_thread_fence(std::memory_order_acquire);
+		const uint64_t begun = buffer.begun.load(std::memory_order_relaxed);
+		const uint64_t valid = begun > RING_SIZE ? begun - RING_SIZE : 0;
+		size_t skip = 0;
+		if (valid > first) {
+			skip = static_cast<size_t>(std::min(valid - first, written - first));
+			m_statistics.dropped += skip;
+		}
+		buffer.read = written;
+
+		for (size_t i = skip; i < events.size(); ++i) {
+			const auto& event = events[i];
+			auto& total = m_totals[event.name];
+			total.ns    += event.end - event.start;
+			total.calls += 1;
+
+			if (capturing && m_captured.size() < MAX_CAPTURE)
+				m_captured.push_back(event);
+		}
+		m_statistics.events += events.size() - skip;
+	}
+
+	if (++m_summaryFrames >= SUMMARY_FRAMES)
+		Summarize();
+}
+
+/**
+	@note	Oł|PʂႦ΃ẽ|C^[Ⴄ̂ŁAł܂Ƃߒ
+*/
+void Profiler::Summarize()
+{
+	std::vector<Zone> zones;
+	for (const auto& total : m_totals) {
+		auto it = std::find_if(zones.begin(), zones.end(), [&](const Zone& zone) {
+			return strcmp(zone.name, total.first) == 0;
+		});
+		if (it == zones.end()) {
+			zones.push_back({ total.first, 0.0, 0.0 });
+			it = zones.end() - 1;
+		}
+		it->ms    += total.second.ns * 1e-6 / m_summaryFrames;
+		it->calls += static_cast<double>(total.second.calls) / m_summaryFrames;
+	}
+	std::sort(zones.begin(), zones.end(), [](const Zone& a, const Zone& b) { return a.ms > b.ms; });
+
+	m_top = std::move(zones);
+	m_totals.clear();
+	m_summaryFrames = 0;
+	++m_summaryVersion;
+}
+
+std::vector<Profiler::Zone> Profiler::GetTopZones(size_t count) const
+{
+	std::lock_guard<std::mutex> lock(m_mutex);
+	return std::vector<Zone>(m_top.begin(), m_top.begin() + std::min(count, m_top.size()));
+}
+
+uint64_t Profiler::GetSummaryVersion() const
+{
+	std::lock_guard<std::mutex> lock(m_mutex);
+	return m_summaryVersion;
+}
+
+void Profiler::StartCapture()
+{
+	m_capturing = true;
+}
+
+bool Profiler::IsCapturing() const
+{
+	return m_capturing;
+}
+
+/**
+	@brief	Chrome(chrome://tracing)EPerfettoŊJJSON
+	@note	Cxg("ph":"X")ŏ(q̓r[A[gݗĂ)
+*/
+bool Profiler::WriteChromeTrace(const std::string& path) const
+{
+	std::lock_guard<std::mutex> lock(m_mutex);
+
+	std::string json;
+	json.reserve(m_captured.size() * 96 + 1024);
+	json += "{\"displayTimeUnit\":\"ms\",\"traceEvents\":[\n";
+
+	char line[160];
+	bool first = true;
+	for (const auto& thread : m_threads) {
+		std::string name = thread->name.empty() ? "Thread " + std::to_string(thread->id) : thread->name;
+		json += first ? "" : ",\n";
+		json += "{\"ph\":\"M\",\"pid\":1,\"tid\":" + std::to_string(thread->id) + ",\"name\":\"thread_name\",\"args\":{\"name\":\"";
+		AppendEscaped(json, name.c_str());
+		json += "\"}}";
+		first = false;
+	}
+
+	for (const auto& event : m_captured) {
+		json += first ? "{\"ph\":\"X\",\"pid\":1,\"name\":\"" : ",\n{\"ph\":\"X\",\"pid\":1,\"name\":\"";
+		AppendEscaped(json, event.name);
+		//GetOɎn܂Ԃ͕̎ɂȂ
+		snprintf(line, sizeof(line), "\",\"tid\":%u,\"ts\":%.3f,\"dur\":%.3f}",
+			event.thread, static_cast<int64_t>(event.start - m_origin) * 1e-3, (event.end - event.start) * 1e-3);
+		json += line;
+		first = false;
+	}
+	json += "\n]}\n";
+
+	std::ofstream file(path, std::ios::binary | std::ios::trunc);
+	if (!file)
+		return false;
+	file.write(json.data(), static_cast<std::streamsize>(json.size()));
+	return static_cast<bool>(file);
+}
+
+Profiler::Statistics Profiler::GetStatistics() const
+{
+	std::lock_guard<std::mutex> lock(m_mutex);
+	Statistics statistics = m_statistics;
+	statistics.captured = m_captured.size();
+	statistics.threads  = m_threads.size();
+	return statistics;
+}
@@ -0,0 +1,168 @@
+/**
+ * @file Profiler.h
+ * @brief CPŨvt@C[(XR[vPʂ̌vAChrome/Perfettõg[XóAʂ̋Ԃ̏Wv)
+ * @author hoshi hirofumi
+ * @date 2026/10/19
+ * @note v̓Xbh̃Oobt@[ɏ(bNȂ)@W߂̂EndFrameĂԃXbh
+ *       DXTK_PROFILE0ȂPROFILE_ZONE͉cȂ(GameBase.hŐ؂ւALinux̃x`}[NłDXTK_PROFILE=1n)
+ *       WindowsɈˑȂ
+ */
+
+#pragma once
+
+/*
+-------------------------------------------------------------------------------------
+	CN[h
+-------------------------------------------------------------------------------------
+*/
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <unordered_map>
+#include <unordered_set>
+#include <vector>
+
+#ifndef DXTK_PROFILE
+#define DXTK_PROFILE 0
+#endif
+
+/*
+-------------------------------------------------------------------------------------
+	ProfilerNX@錾
+-------------------------------------------------------------------------------------
+*/
+class Profiler {
+public:
+	struct ThreadBuffer;	//gcpp
+	//! Xbhł͂Ȃ(GPUȂ)
+	typedef ThreadBuffer* Track;
+
+	//! XbhɕێԂ̐(EndFrame܂łɈꂽ͌Â̂̂Ă)
+	static constexpr size_t RING_SIZE = 1 << 14;
+	//! g[XɎcԂ̏
+	static constexpr size_t MAX_CAPTURE = 1 << 21;
+	//! ʂ̋Ԃ̃t[̕ςŏo
+	static constexpr unsigned int SUMMARY_FRAMES = 30;
+
+	//! 1񕪂̋(Now̃imb)
+	struct Event {
+		const char* name;
+		uint64_t    start;
+		uint64_t    end;
+		uint32_t    thread;
+	};
+
+	//! ʂ̋(̋Ԃ̎Ԃ܂)
+	struct Zone {
+		const char* name;
+		double      ms;		//1t[
+		double      calls;	//1t[
+	};
+
+	struct Statistics {
+		uint64_t events;	//W߂
+		uint64_t dropped;	//OĎ̂Ă
+		uint64_t captured;	//g[XɎcĂ
+		size_t   threads;
+	};
+
+	Profiler();
+	virtual ~Profiler();
+
+	Profiler(Profiler&&) = delete;
+	Profiler& operator= (Profiler&&) = delete;
+
+	Profiler(Profiler const&) = delete;
+	Profiler& operator= (Profiler const&) = delete;
+
+	//imb(steady_clockAWindowsłQueryPerformanceCounter)
+	static uint64_t Now();
+
+	//ԂL^(ǂ̃XbhłAbNȂ)
+	void Record(const char* name, uint64_t start, uint64_t end);
+	//g[XɏoXbh(̃XbhĂԁA2ڈȍ~͉Ȃ)
+	void SetThreadName(const char* name);
+
+	//Xbhł͂Ȃ(O̓g[X̃XbhɂȂ)
+	Track CreateTrack(const char* name);
+	//ɋԂL^(1̗ɏ͓̂1̃Xbh)
+	void Record(Track track, const char* name, uint64_t start, uint64_t end);
+	//eł͂ȂԂ̖O(fȂ)vZXI܂Ŏc
+	const char* Intern(const std::string& name);
+
+	//SXbh̋ԂW߂ďWv(1t[1A܂Xbh)
+	void EndFrame();
+	//SUMMARY_FRAMESt[̏(Ԃ̒)
+	std::vector<Zone> GetTopZones(size_t count) const;
+	//ʂXVꂽ(\̍XV̔f)
+	uint64_t GetSummaryVersion() const;
+
+	//g[XɎcn߂
+	void StartCapture();
+	bool IsCapturing() const;
+	//cԂChrome/Perfettǒ`(JSON)ŏo
+	bool WriteChromeTrace(const std::string& path) const;
+
+	Statistics GetStatistics() const;
+
+	static Profiler& Get();
+
+private:
+	struct Total {
+		uint64_t ns;
+		uint64_t calls;
+	};
+
+	ThreadBuffer& GetThreadBuffer();
+	static void Write(ThreadBuffer& buffer, const char* name, uint64_t start, uint64_t end);
+	void Summarize();
+
+	uint64_t m_origin;		//g[X̎0
+
+	std::vector<std::unique_ptr<ThreadBuffer>> m_threads;
+	std::vector<Event>                         m_captured;
+	std::vector<Event>                         m_scratch;	//EndFrame̍Ɨp(t[mۂȂ)
+	std::unordered_set<std::string>            m_names;		//InternO(vf͓Ȃ)
+	std::atomic<bool>                          m_capturing;
+
+	std::unordered_map<const char*, Total> m_totals;	//Wv(Õ|C^[)
+	unsigned int                           m_summaryFrames;
+	std::vector<Zone>                      m_top;
+	uint64_t                               m_summaryVersion;
+
+	Statistics m_statistics;
+
+	mutable std::mutex m_mutex;
+};
+
+/*
+-------------------------------------------------------------------------------------
+	ProfileZone@XR[v̋(PROFILE_ZONEg)
+-------------------------------------------------------------------------------------
+*/
+class ProfileZone {
+public:
+	//name͕񃊃e(|C^[̂܂܎c)
+	explicit ProfileZone(const char* name) : m_name(name), m_start(Profiler::Now()) {}
+	~ProfileZone() { Profiler::Get().Record(m_name, m_start, Profiler::Now()); }
+
+	ProfileZone(ProfileZone const&) = delete;
+	ProfileZone& operator= (ProfileZone const&) = delete;
+
+private:
+	const char* m_name;
+	uint64_t    m_start;
+};
+
+#if DXTK_PROFILE
+	#define PROFILE_CONCAT_INNER(a, b) a##b
+	#define PROFILE_CONCAT(a, b)       PROFILE_CONCAT_INNER(a, b)
+	#define PROFILE_ZONE(name)         ProfileZone PROFILE_CONCAT(profileZone, __LINE__)(name)
+	#define PROFILE_THREAD(name)       Profiler::Get().SetThreadName(name)
+#else
+	#define PROFILE_ZONE(name)         ((void)0)
+	#define PROFILE_THREAD(name)       ((void)0)
+#endif
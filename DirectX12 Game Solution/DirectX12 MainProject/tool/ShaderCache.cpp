@@ -0,0 +1,240 @@
+/**
+ * @file ShaderCache.cpp
+ * @brief RpCς݃VF[_[̃LbV
+ * @author hoshi hirofumi
+ * @date 2026/10/19
+ */
+
+#include "ShaderCache.h"
+#include "Hash.h"
+
+#include <chrono>
+#include <filesystem>
+#include <fstream>
+#include <iterator>
+#pragma comment(lib,"d3dcompiler.lib")
+
+namespace {
+	//! Q[ŎgSVF[_[(₵炱ɂǉ)
+	const ShaderCache::Permutation PERMUTATIONS[] = {
+		{ L"Shaders/VS.hlsl",  "BasicVS", "vs_5_1", nullptr },
+		{ L"Shaders/PS.hlsl",  "BasicPS", "ps_5_1", nullptr },
+		{ L"Shaders/VS2.hlsl", "BasicVS", "vs_5_1", nullptr },
+		{ L"Shaders/PS2.hlsl", "BasicPS", "ps_5_1", nullptr },
+	};
+
+	//! Collectœǂ񂾃t@Cn(L[ɓĂȂeŃRpCȂ)
+	class IncludeHandler : public ID3DInclude {
+	public:
+		explicit IncludeHandler(const ShaderIncludes& includes) : m_includes(includes) {}
+
+		HRESULT __stdcall Open(D3D_INCLUDE_TYPE, LPCSTR pFileName, LPCVOID pParentData, LPCVOID* ppData, UINT* pBytes) override
+		{
+			const auto content = m_includes.Find(pParentData, pFileName);
+			if (content == nullptr) {
+				const std::string message = std::string("ShaderCache: include ") + (pFileName ? pFileName : "") +
+					" not found (or not a literal #include).\n";
+				OutputDebugStringA(message.c_str());
+				return E_FAIL;
+			}
+			*ppData = content->data();
+			*pBytes = static_cast<UINT>(content->size());
+			return S_OK;
+		}
+
+		HRESULT __stdcall Close(LPCVOID) override { return S_OK; }
+
+	private:
+		const ShaderIncludes& m_includes;
+	};
+}
+
+ShaderCache::ShaderCache() : m_statistics{}
+{
+	//fobOoCgR[h͍œK(fobO񂾂t)
+	m_flags = D3DCOMPILE_OPTIMIZATION_LEVEL3;
+#ifdef _DEBUG
+	m_flags |= D3DCOMPILE_DEBUG;
+#endif
+}
+
+/**
+	@brief	VF[_[̎擾(  fBXN  RpC̏ɒT)
+	@param	fileName   t@C
+	@param	entryPoint Gg[|Cg
+	@param	target     VF[_[vt@C
+	@param	defines    }N(nullptrI[)
+	@return oCgR[h
+	@note	bN͕\Eo^ԂAfBXN̓ǂݍ݂ƃRpC͊Oōs
+*/
+ComPtr<ID3DBlob> ShaderCache::Compile(LPCWSTR fileName, const char* entryPoint, const char* target, const D3D_SHADER_MACRO* defines)
+{
+	std::ifstream file(fileName, std::ios::binary);
+	if (!file) {
+		OutputDebugString(TEXT("ShaderCache: shader file not found.\n"));
+		DX::ThrowIfFailed(HRESULT_FROM_WIN32(ERROR_FILE_NOT_FOUND));
+	}
+	const std::string source((std::istreambuf_iterator<char>(file)), std::istreambuf_iterator<char>());
+
+	//CN[ht@C̓eL[ɍ({̂ςɃCN[h悾ςĂÂLbVgȂ)
+	ShaderIncludes includes;
+	includes.Collect(fileName, source);
+	const auto key = MakeKey(source, includes, entryPoint, target, defines);
+
+	//VF[_[͈xRpCȂ(쐬Ȃ瑼̃Xbȟʂ҂)
+	std::promise<ComPtr<ID3DBlob>>       promise;
+	std::shared_future<ComPtr<ID3DBlob>> pending;
+	{
+		std::lock_guard<std::mutex> lock(m_mutex);
+		auto it = m_blobs.find(key);
+		if (it != m_blobs.end()) {
+			++m_statistics.memoryHits;
+			pending = it->second;
+		}
+		else {
+			m_blobs.emplace(key, promise.get_future().share());
+		}
+	}
+	if (pending.valid())
+		return pending.get();
+
+	try {
+		auto blob = Load(source, includes, key, fileName, entryPoint, target, defines);
+		promise.set_value(blob);
+		return blob;
+	}
+	catch (...) {
+		//s͕\OA̗vł蒼(҂ĂXbhɂ͓On)
+		{
+			std::lock_guard<std::mutex> lock(m_mutex);
+			m_blobs.erase(key);
+		}
+		promise.set_exception(std::current_exception());
+		throw;
+	}
+}
+
+/**
+	@brief	fBXNLbV̓ǂݍ݁A΃RpCďo
+	@note	CompileL[1̃XbhɂnȂ̂ŁAbN͓v̍XV
+*/
+ComPtr<ID3DBlob> ShaderCache::Load(const std::string& source, const ShaderIncludes& includes, unsigned long long key,
+	LPCWSTR fileName, const char* entryPoint, const char* target, const D3D_SHADER_MACRO* defines)
+{
+	char message[256];
+	const auto path = CachePath(key);
+
+	ComPtr<ID3DBlob> blob;
+	if (SUCCEEDED(D3DReadFileToBlob(path.c_str(), blob.GetAddressOf()))) {
+		{
+			std::lock_guard<std::mutex> lock(m_mutex);
+			++m_statistics.diskHits;
+		}
+		sprintf_s(message, "ShaderCache: hit  %s %s (%016llx)\n", entryPoint, target, key);
+		OutputDebugStringA(message);
+		return blob;
+	}
+
+	const auto start = std::chrono::steady_clock::now();
+
+	//G[bZ[Wɏot@C
+	const std::string sourceName = std::filesystem::path(fileName).string();
+	IncludeHandler includeHandler(includes);
+
+	ComPtr<ID3DBlob> error_blob;
+	const HRESULT result = D3DCompile(
+		source.data(), source.size(),
+		sourceName.c_str(), defines, &includeHandler,
+		entryPoint, target,
+		m_flags, 0,
+		blob.GetAddressOf(),
+		error_blob.GetAddressOf()
+	);
+	if (FAILED(result)) {
+		if (error_blob)
+			OutputDebugStringA(static_cast<const char*>(error_blob->GetBufferPointer()));
+		DX::ThrowIfFailed(result);
+	}
+
+	const double ms = std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - start).count();
+	{
+		std::lock_guard<std::mutex> lock(m_mutex);
+		++m_statistics.misses;
+		m_statistics.compileMs += ms;
+	}
+	sprintf_s(message, "ShaderCache: miss %s %s (%016llx) %.1fms\n", entryPoint, target, key, ms);
+	OutputDebugStringA(message);
+
+	//߂ȂĂRpCȂ̂ős
+	CreateDirectoryW(CACHE_DIRECTORY, nullptr);
+	if (FAILED(D3DWriteBlobToFile(blob.Get(), path.c_str(), TRUE)))
+		OutputDebugString(TEXT("ShaderCache: failed to write cache file.\n"));
+
+	return blob;
+}
+
+/**
+	@brief	Sgݍ킹RpCăfBXNLbV
+	@return SĐtrue
+*/
+bool ShaderCache::Precompile()
+{
+	bool succeeded = true;
+	for (const auto& permutation : PERMUTATIONS) {
+		try {
+			Compile(permutation.fileName, permutation.entryPoint, permutation.target, permutation.defines);
+		}
+		catch (const std::exception&) {
+			succeeded = false;
+		}
+	}
+
+	const auto stats = GetStatistics();
+	char message[128];
+	sprintf_s(message, "ShaderCache: %zu compiled, %zu cached, %.1fms\n", stats.misses, stats.diskHits, stats.compileMs);
+	OutputDebugStringA(message);
+
+	return succeeded;
+}
+
+ShaderCache::Statistics ShaderCache::GetStatistics() const
+{
+	std::lock_guard<std::mutex> lock(m_mutex);
+	return m_statistics;
+}
+
+/**
+	@brief	LbṼL[
+	@note	\[XECN[ht@CEGg[|CgEvt@CE}NERpCtOȂ瓯L[
+*/
+unsigned long long ShaderCache::MakeKey(const std::string& source, const ShaderIncludes& includes,
+	const char* entryPoint, const char* target, const D3D_SHADER_MACRO* defines) const
+{
+	Hasher hash;
+	hash.Add(source.data(), source.size());
+	includes.AddTo(hash);
+	hash.Add(entryPoint);
+	hash.Add(target);
+	for (auto define = defines; define && define->Name; ++define) {
+		hash.Add(define->Name);
+		hash.Add(define->Definition);
+	}
+	hash.Add(m_flags);
+	return hash.Value();
+}
+
+std::wstring ShaderCache::CachePath(unsigned long long key) const
+{
+	wchar_t name[32];
+	swprintf_s(name, L"/%016llx.cso", key);
+	return std::wstring(CACHE_DIRECTORY) + name;
+}
+
+/**
+	@brief	Sfʂ̃CX^X
+*/
+ShaderCache& ShaderCache::Get()
+{
+	static ShaderCache instance;
+	return instance;
+}
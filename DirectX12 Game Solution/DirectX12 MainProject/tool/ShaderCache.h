@@ -0,0 +1,92 @@
+/**
+ * @file ShaderCache.h
+ * @brief RpCς݃VF[_[̃LbV
+ * @author hoshi hirofumi
+ * @date 2026/10/19
+ */
+
+#pragma once
+
+/*
+-------------------------------------------------------------------------------------
+	CN[h
+-------------------------------------------------------------------------------------
+*/
+#include "Base/pch.h"
+#include "Base/dxtk.h"
+#include "ShaderIncludes.h"
+
+#include <d3dcompiler.h>
+#include <future>
+#include <mutex>
+#include <unordered_map>
+
+/*
+-------------------------------------------------------------------------------------
+	using
+-------------------------------------------------------------------------------------
+*/
+using Microsoft::WRL::ComPtr;
+using std::unique_ptr;
+using std::make_unique;
+using namespace DirectX;
+
+/*
+-------------------------------------------------------------------------------------
+	ShaderCacheNX@錾
+-------------------------------------------------------------------------------------
+*/
+class ShaderCache {
+public:
+	//! fBXNLbV̒uꏊ(sfBNg̑)
+	static constexpr const wchar_t* CACHE_DIRECTORY = L"Shaders/Cache";
+
+	//! ItCrhŐgݍ킹
+	struct Permutation {
+		const wchar_t*          fileName;
+		const char*             entryPoint;
+		const char*             target;
+		const D3D_SHADER_MACRO* defines;
+	};
+
+	struct Statistics {
+		size_t memoryHits;		//vZXŎg񂵂(̃Xbh̃RpC҂܂)
+		size_t diskHits;		//fBXNǂ񂾉
+		size_t misses;			//RpC
+		double compileMs;		//RpCɂv
+	};
+
+	ShaderCache();
+	virtual ~ShaderCache() {}
+
+	ShaderCache(ShaderCache&&) = delete;
+	ShaderCache& operator= (ShaderCache&&) = delete;
+
+	ShaderCache(ShaderCache const&) = delete;
+	ShaderCache& operator= (ShaderCache const&) = delete;
+
+	ComPtr<ID3DBlob> Compile(LPCWSTR fileName, const char* entryPoint, const char* target, const D3D_SHADER_MACRO* defines = nullptr);
+
+	//ItCrh(/shaders)
+	bool Precompile();
+
+	Statistics GetStatistics() const;
+
+	//VOg
+	static ShaderCache& Get();
+
+private:
+	unsigned long long MakeKey(const std::string& source, const ShaderIncludes& includes,
+		const char* entryPoint, const char* target, const D3D_SHADER_MACRO* defines) const;
+	std::wstring CachePath(unsigned long long key) const;
+	ComPtr<ID3DBlob> Load(const std::string& source, const ShaderIncludes& includes, unsigned long long key,
+		LPCWSTR fileName, const char* entryPoint, const char* target, const D3D_SHADER_MACRO* defines);
+
+	//! L[  oCgR[h(ǂݍ݁ERpCo^AL[̗v͂̊҂)
+	std::unordered_map<unsigned long long, std::shared_future<ComPtr<ID3DBlob>>> m_blobs;
+
+	Statistics m_statistics;
+	UINT       m_flags;
+
+	mutable std::mutex m_mutex;
+};
@@ -0,0 +1,127 @@
+/**
+ * @file ShaderIncludes.cpp
+ * @brief VF[_[#includeHēǂݍ(ShaderCachẽL[ID3DIncludeŋ)
+ * @author hoshi hirofumi
+ * @date 2026/10/19
+ */
+
+#include "ShaderIncludes.h"
+
+#include <fstream>
+#include <iterator>
+
+namespace {
+	//! s#include "name"E#include <name>nameo
+	bool ParseInclude(const std::string& source, size_t begin, size_t end, std::string& name)
+	{
+		auto skip = [&](size_t i) {
+			while (i < end && (source[i] == ' ' || source[i] == '\t'))
+				++i;
+			return i;
+		};
+
+		size_t i = skip(begin);
+		if (i >= end || source[i] != '#')
+			return false;
+		i = skip(i + 1);
+		if (source.compare(i, 7, "include") != 0)
+			return false;
+		i = skip(i + 7);
+		if (i >= end || (source[i] != '"' && source[i] != '<'))
+			return false;
+
+		const char close = source[i] == '"' ? '"' : '>';
+		const size_t last = source.find(close, i + 1);
+		if (last == std::string::npos || last >= end)
+			return false;
+		name = source.substr(i + 1, last - i - 1);
+		return !name.empty();
+	}
+}
+
+/**
+	@brief	{̂#includeHēǂݍ
+	@param	mainPath {̂̃t@C(CN[h̊̃fBNg)
+	@param	source   {̂̓e
+	@note	#ifŊOꂽsERg#includeH(L[]vɕς邾ŁA肱ڂ悢)
+*/
+void ShaderIncludes::Collect(const std::filesystem::path& mainPath, const std::string& source)
+{
+	m_files.clear();
+	m_directory = mainPath.parent_path();
+	Scan(m_directory, source, 0);
+}
+
+void ShaderIncludes::Scan(const std::filesystem::path& directory, const std::string& source, int depth)
+{
+	if (depth >= MAX_DEPTH)
+		return;
+
+	size_t begin = 0;
+	while (begin < source.size()) {
+		size_t end = source.find('\n', begin);
+		if (end == std::string::npos)
+			end = source.size();
+
+		std::string name;
+		if (ParseInclude(source, begin, end, name)) {
+			const auto path = Resolve(directory, name);
+			if (m_files.find(path) == m_files.end()) {
+				auto& file = m_files[path];
+				file.directory = std::filesystem::path(path).parent_path();
+
+				std::ifstream stream(path, std::ios::binary);
+				file.found = static_cast<bool>(stream);
+				if (file.found) {
+					file.content.assign(std::istreambuf_iterator<char>(stream), std::istreambuf_iterator<char>());
+					Scan(file.directory, file.content, depth + 1);
+				}
+			}
+		}
+		begin = end + 1;
+	}
+}
+
+/**
+	@brief	L[ɍ
+	@note	Ȃt@CO͍(ォuƂɃL[ς)
+*/
+void ShaderIncludes::AddTo(Hasher& hash) const
+{
+	hash.Add(m_files.size());
+	for (const auto& file : m_files) {
+		hash.Add(file.first.c_str());
+		hash.Add(file.second.found);
+		hash.Add(file.second.content.size());
+		hash.Add(file.second.content.data(), file.second.content.size());
+	}
+}
+
+/**
+	@brief	CN[h̏ꏊt@CT
+	@return	Collectœǂ񂾓e(Ȃnullptr)
+*/
+const std::string* ShaderIncludes::Find(const void* parentData, const char* name) const
+{
+	if (name == nullptr)
+		return nullptr;
+
+	//CN[hǂݍ񂾃t@CȂ炻̏ꏊAȊO͖{̂̏ꏊ
+	auto directory = m_directory;
+	for (const auto& file : m_files) {
+		if (file.second.found && !file.second.content.empty() && file.second.content.data() == parentData) {
+			directory = file.second.directory;
+			break;
+		}
+	}
+
+	auto it = m_files.find(Resolve(directory, name));
+	if (it == m_files.end() || !it->second.found)
+		return nullptr;
+	return &it->second.content;
+}
+
+std::string ShaderIncludes::Resolve(const std::filesystem::path& directory, const std::string& name) const
+{
+	return (directory / std::filesystem::path(name)).lexically_normal().generic_string();
+}
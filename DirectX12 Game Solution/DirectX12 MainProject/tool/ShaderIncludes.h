@@ -0,0 +1,59 @@
+/**
+ * @file ShaderIncludes.h
+ * @brief VF[_[#includeHēǂݍ(ShaderCachẽL[ID3DIncludeŋ)
+ * @author hoshi hirofumi
+ * @date 2026/10/19
+ * @note t@C̓ǂݍ݂ƕ̏Ȃ̂D3D12ɂ͈ˑȂ
+ */
+
+#pragma once
+
+/*
+-------------------------------------------------------------------------------------
+	CN[h
+-------------------------------------------------------------------------------------
+*/
+#include "Hash.h"
+
+#include <filesystem>
+#include <map>
+#include <string>
+
+/*
+-------------------------------------------------------------------------------------
+	ShaderIncludesNX@錾
+-------------------------------------------------------------------------------------
+*/
+class ShaderIncludes {
+public:
+	//! q̐[̏(zCN[hŎ~܂ȂȂȂ悤)
+	static constexpr int MAX_DEPTH = 32;
+
+	ShaderIncludes() {}
+	virtual ~ShaderIncludes() {}
+
+	//{(mainPathsource)#includeHēǂݍ(Ȃt@C͖Oo)
+	void Collect(const std::filesystem::path& mainPath, const std::string& source);
+
+	//ǂݍ񂾃t@C̖OƓeL[ɍ
+	void AddTo(Hasher& hash) const;
+
+	//ID3DInclude::Openp(parentData̓CN[h̓e̐擪ACollectœǂłȂt@Cnullptr)
+	const std::string* Find(const void* parentData, const char* name) const;
+
+	size_t Count() const { return m_files.size(); }
+
+private:
+	struct File {
+		std::filesystem::path directory;	//̃t@C̃CN[h̊
+		std::string           content;
+		bool                  found;
+	};
+
+	std::string Resolve(const std::filesystem::path& directory, const std::string& name) const;
+	void Scan(const std::filesystem::path& directory, const std::string& source, int depth);
+
+	//! KpX  e(OɕԂ̂ŃL[ǂݍݏɈˑȂ)
+	std::map<std::string, File> m_files;
+	std::filesystem::path       m_directory;	//{̂̃fBNg
+};
@@ -0,0 +1,110 @@
+/**
+ * @file ShaderIncludesTest.cpp
+ * @brief ShaderIncludes̊mF(R}hCAQ[{̂̃vWFNgɂ͊܂߂Ȃ)
+ * @author hoshi hirofumi
+ * @date 2026/10/19
+ * @note ꎞfBNgɒuVF[_[ŁAqE΃pXEzEȂCN[hƁAL[eŕς邱Ƃm߂
+ */
+
+#include "ShaderIncludes.h"
+#include "TestCheck.h"
+
+#include <cstdio>
+#include <fstream>
+#include <string>
+
+namespace {
+	using TestCheck::Check;
+
+	namespace fs = std::filesystem;
+
+	void Write(const fs::path& path, const std::string& text)
+	{
+		fs::create_directories(path.parent_path());
+		std::ofstream(path, std::ios::binary) << text;
+	}
+
+	unsigned long long Key(const fs::path& mainPath, const std::string& source)
+	{
+		ShaderIncludes includes;
+		includes.Collect(mainPath, source);
+		Hasher hash;
+		hash.Add(source.data(), source.size());
+		includes.AddTo(hash);
+		return hash.Value();
+	}
+
+	//qE΃pXEt@C̏dEz
+	void Nesting(const fs::path& root)
+	{
+		Write(root / "Common.hlsli", "#include \"Lighting/Light.hlsli\"\nfloat4 common;\n");
+		Write(root / "Lighting/Light.hlsli", "  #  include <../Common.hlsli>\n#include \"Shadow.hlsli\"\nfloat4 light;\n");
+		Write(root / "Lighting/Shadow.hlsli", "float4 shadow;\n");
+		const std::string source = "#include \"Common.hlsli\"\r\n\t#include \"Lighting/Shadow.hlsli\"\r\nfloat4 main() : SV_Target { return 0; }\r\n";
+
+		ShaderIncludes includes;
+		includes.Collect(root / "PS.hlsl", source);
+		Check(includes.Count() == 3, "nested, relative and repeated includes are read once each");
+
+		//{̂(parentData͖{́Enullptr̂ǂł悢)
+		const auto common = includes.Find(source.data(), "Common.hlsli");
+		Check(common != nullptr && common->find("float4 common") != std::string::npos, "an include from the main file resolves next to it");
+		Check(includes.Find(nullptr, "Lighting/Shadow.hlsli") != nullptr, "a null parent resolves from the main file");
+
+		//Common.hlsliLighting/Light.hlsliA瓯fBNgShadow.hlsli
+		const auto light = common ? includes.Find(common->data(), "Lighting/Light.hlsli") : nullptr;
+		Check(light != nullptr, "an include resolves next to its parent");
+		Check(light && includes.Find(light->data(), "Shadow.hlsli") != nullptr, "a nested include resolves next to its own parent");
+		Check(light && includes.Find(light->data(), "../Common.hlsli") == common, "a circular include returns the same content");
+		Check(includes.Find(source.data(), "Shadow.hlsli") == nullptr, "a file is not found from the wrong directory");
+	}
+
+	//ȂE#includě`łȂ(}N)̂FindłȂ(ShaderCache̓RpCs)
+	void Missing(const fs::path& root)
+	{
+		const std::string source = "#include \"Missing.hlsli\"\n#define FILE \"Common.hlsli\"\n#include FILE\n// include \"Common.hlsli\"\n";
+		ShaderIncludes includes;
+		includes.Collect(root / "VS.hlsl", source);
+		Check(includes.Count() == 1, "only literal includes are collected");
+		Check(includes.Find(source.data(), "Missing.hlsli") == nullptr, "a missing include is not found");
+		Check(includes.Find(source.data(), "Common.hlsli") == nullptr, "an include through a macro is rejected");
+
+		//ォt@CuƃL[ς
+		const auto before = Key(root / "VS.hlsl", source);
+		Write(root / "Missing.hlsli", "float4 found;\n");
+		Check(Key(root / "VS.hlsl", source) != before, "adding a missing include changes the key");
+	}
+
+	//CN[h̓eςĂL[ςA֌WȂt@Cł͕ςȂ
+	void KeyChanges(const fs::path& root)
+	{
+		const std::string source = "#include \"Common.hlsli\"\nfloat4 main() : SV_Target { return 0; }\n";
+		const auto mainPath = root / "PS.hlsl";
+		const auto original = Key(mainPath, source);
+		Check(Key(mainPath, source) == original, "the same files give the same key");
+
+		Write(root / "Lighting/Shadow.hlsli", "float4 shadow2;\n");
+		const auto nested = Key(mainPath, source);
+		Check(nested != original, "changing a nested include changes the key");
+
+		Write(root / "Unrelated.hlsli", "float4 unrelated;\n");
+		Check(Key(mainPath, source) == nested, "an unrelated file does not change the key");
+
+		//1ς
+		Write(root / "Lighting/Shadow.hlsli", "float4 shadow3;\n");
+		Check(Key(mainPath, source) != nested, "a one-character change in an include changes the key");
+	}
+}
+
+int main()
+{
+	const auto root = fs::temp_directory_path() / "ShaderIncludesTest";
+	fs::remove_all(root);
+
+	Nesting(root);
+	Missing(root);
+	KeyChanges(root);
+
+	fs::remove_all(root);
+	return TestCheck::Finish("ShaderIncludesTest");
+}
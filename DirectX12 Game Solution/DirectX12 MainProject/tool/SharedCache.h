@@ -0,0 +1,127 @@
+/**
+ * @file SharedCache.h
+ * @brief OňLLbV(gȂȂ̂Trimŉ)
+ * @author hoshi hirofumi
+ * @date 2026/10/19
+ * @note shared_ptr̎QƐŎgp𔻒f@D3D12ɂ͈ˑȂ(ModelCacheg߂)
+ */
+
+#pragma once
+
+/*
+-------------------------------------------------------------------------------------
+	CN[h
+-------------------------------------------------------------------------------------
+*/
+#include <cstddef>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <string>
+
+/*
+-------------------------------------------------------------------------------------
+	SharedCacheNX@錾
+-------------------------------------------------------------------------------------
+*/
+template<class T>
+class SharedCache {
+public:
+	struct Statistics {
+		size_t hits;			//ǂݍݍς݂̂̂Ԃ
+		size_t misses;			//ۂɓǂݍ񂾉
+		size_t released;		//Trimŉ
+		size_t entries;			//LbV̐
+	};
+
+	SharedCache() : m_statistics{} {}
+	virtual ~SharedCache() {}
+
+	SharedCache(SharedCache&&) = delete;
+	SharedCache& operator= (SharedCache&&) = delete;
+
+	SharedCache(SharedCache const&) = delete;
+	SharedCache& operator= (SharedCache const&) = delete;
+
+	/**
+		@brief	ǂݍݍς݂̂̂T
+		@return Ȃnullptr
+	*/
+	std::shared_ptr<const T> Find(const std::wstring& key)
+	{
+		std::lock_guard<std::mutex> lock(m_mutex);
+
+		auto it = m_entries.find(key);
+		if (it == m_entries.end())
+			return nullptr;
+
+		++m_statistics.hits;
+		return it->second;
+	}
+
+	/**
+		@brief	ǂݍ񂾂̂o^
+		@param	create o^̂(ɓo^ĂΌĂ΂Ȃ)
+		@note	̂𓯎ɓǂݍ񂾏ꍇ͐ɓo^Ԃ
+	*/
+	template<class Create>
+	std::shared_ptr<const T> Insert(const std::wstring& key, Create create)
+	{
+		std::lock_guard<std::mutex> lock(m_mutex);
+
+		++m_statistics.misses;
+
+		auto it = m_entries.find(key);
+		if (it != m_entries.end())
+			return it->second;
+
+		std::shared_ptr<const T> value = create();
+		m_entries.emplace(key, value);
+		return value;
+	}
+
+	/**
+		@brief	LbVQƂĂȂ̂
+		@return 
+	*/
+	size_t Trim()
+	{
+		std::lock_guard<std::mutex> lock(m_mutex);
+
+		size_t released = 0;
+		for (auto it = m_entries.begin(); it != m_entries.end();) {
+			if (it->second.use_count() == 1) {
+				it = m_entries.erase(it);
+				++released;
+			}
+			else {
+				++it;
+			}
+		}
+		m_statistics.released += released;
+		return released;
+	}
+
+	void Clear()
+	{
+		std::lock_guard<std::mutex> lock(m_mutex);
+		m_entries.clear();
+	}
+
+	Statistics GetStatistics() const
+	{
+		std::lock_guard<std::mutex> lock(m_mutex);
+
+		auto stats = m_statistics;
+		stats.entries = m_entries.size();
+		return stats;
+	}
+
+private:
+	//! L[  L
+	std::map<std::wstring, std::shared_ptr<const T>> m_entries;
+
+	Statistics m_statistics;
+
+	mutable std::mutex m_mutex;
+};
@@ -0,0 +1,112 @@
+/**
+ * @file SharedCacheTest.cpp
+ * @brief SharedCache(ModelCache̒g)̊mF(R}hCAQ[{̂̃vWFNgɂ͊܂߂Ȃ)
+ * @author hoshi hirofumi
+ * @date 2026/10/19
+ * @note V[̐؂ւ(̃V[ɓǂ݁AǂݏIĂTrim)ŋʂ̃fp邱ƁA
+ *       ɓo^Ƃɐ̕c邱ƁAv̐m߂
+ */
+
+#include "SharedCache.h"
+#include "TestCheck.h"
+
+#include <atomic>
+#include <cstdio>
+#include <thread>
+#include <vector>
+
+namespace {
+	using TestCheck::Check;
+
+	//! f̑(ǂݍ񂾂𐔂)
+	struct Model {
+		std::wstring name;
+	};
+
+	struct Loader {
+		SharedCache<Model>& cache;
+		int                 loads = 0;
+
+		//PmxLoader::ReadFileESetUpƓ(TĖΓǂœo^)
+		std::shared_ptr<const Model> Load(const std::wstring& name)
+		{
+			auto model = cache.Find(name);
+			if (model)
+				return model;
+			++loads;
+			return cache.Insert(name, [&]() { return std::make_shared<Model>(Model{ name }); });
+		}
+	};
+
+	//GameBaseƓ: ̃V[ǂ݁ÃV[jÃV[ǂݏIĂTrim
+	void Handover()
+	{
+		SharedCache<Model> cache;
+		Loader loader{ cache };
+
+		std::vector<std::shared_ptr<const Model>> current = { loader.Load(L"stage.pmx"), loader.Load(L"a.pmx") };
+		std::vector<std::shared_ptr<const Model>> next    = { loader.Load(L"stage.pmx"), loader.Load(L"b.pmx") };
+		Check(loader.loads == 3, "the stage both scenes use is loaded once");
+		Check(current[0] == next[0], "both scenes share the same stage");
+
+		current.clear();
+		Check(cache.Trim() == 1, "only the model the next scene does not use is released");
+		Check(cache.Find(L"stage.pmx") == next[0] && !cache.Find(L"a.pmx"), "the shared stage is taken over");
+
+		const auto statistics = cache.GetStatistics();
+		Check(statistics.misses == 3 && statistics.hits == 2 && statistics.released == 1 && statistics.entries == 2, "statistics");
+
+		//SgȂȂΑS
+		next.clear();
+		Check(cache.Trim() == 2 && cache.GetStatistics().entries == 0, "unreferenced models are all released");
+	}
+
+	//ɍ̃V[jTrimƁAʂ̃fǂݒɂȂ(Ԃ厖ȂƂ̊mF)
+	void TrimTooEarly()
+	{
+		SharedCache<Model> cache;
+		Loader loader{ cache };
+
+		std::vector<std::shared_ptr<const Model>> current = { loader.Load(L"stage.pmx") };
+		current.clear();
+		cache.Trim();
+		const auto stage = loader.Load(L"stage.pmx");
+		Check(loader.loads == 2, "trimming before the next scene loads reloads the shared model");
+
+		cache.Clear();
+		Check(cache.GetStatistics().entries == 0 && stage->name == L"stage.pmx", "clear drops entries but not models still held");
+	}
+
+	//f𓯎ɓǂݍ񂾂Ƃ͐ɓo^SɕԂÂ1
+	void ConcurrentInsert()
+	{
+		SharedCache<Model> cache;
+		std::atomic<int> created(0);
+		std::vector<std::shared_ptr<const Model>> results(8);
+		std::vector<std::thread> threads;
+		for (int t = 0; t < 8; ++t)
+			threads.emplace_back([&, t]() {
+				results[t] = cache.Insert(L"same.pmx", [&]() {
+					++created;
+					return std::make_shared<Model>(Model{ L"same.pmx" });
+				});
+			});
+		for (auto& thread : threads)
+			thread.join();
+
+		bool same = true;
+		for (const auto& result : results)
+			same &= result == results[0];
+		Check(same && created == 1, "concurrent inserts keep the first model");
+		Check(cache.GetStatistics().misses == 8, "every insert counts as a miss");
+	}
+}
+
+int main()
+{
+	Handover();
+	TrimTooEarly();
+	ConcurrentInsert();
+
+	return TestCheck::Finish("SharedCacheTest");
+}
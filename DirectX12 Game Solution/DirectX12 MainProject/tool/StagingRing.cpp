@@ -0,0 +1,80 @@
+/**
+ * @file StagingRing.cpp
+ * @brief Abv[hp̃Oobt@̊蓖(tFX̒lŌÂɕԋp)
+ * @author hoshi hirofumi
+ * @date 2026/10/19
+ */
+
+#include "StagingRing.h"
+
+namespace {
+	size_t AlignUp(size_t value, size_t alignment)
+	{
+		return (value + alignment - 1) & ~(alignment - 1);
+	}
+}
+
+StagingRing::StagingRing(size_t capacity)
+	: m_capacity(capacity), m_head(0), m_tail(0), m_used(0), m_openBytes(0)
+{
+}
+
+/**
+	@brief	蓖
+	@return	ÕItZbg
+	@note	ɓȂΐ擪ɖ߂(̗]͕ԋp܂Ŏgp̂܂)
+*/
+size_t StagingRing::Allocate(size_t size, size_t alignment)
+{
+	if (size > m_capacity)
+		return INVALID_OFFSET;
+
+	//Ȃ擪g
+	if (m_used == 0)
+		m_head = m_tail = 0;
+
+	size_t offset  = AlignUp(m_head, alignment);
+	size_t padding = offset - m_head;
+
+	if (m_used == 0 || m_head > m_tail) {
+		//gp[m_tail, m_head)
+		if (offset + size > m_capacity) {
+			if (m_used != 0 && size > m_tail)
+				return INVALID_OFFSET;
+			padding = m_capacity - m_head;
+			offset  = 0;
+		}
+	}
+	else if (m_head < m_tail) {
+		//gp[m_tail, )[0, m_head)
+		if (offset + size > m_tail)
+			return INVALID_OFFSET;
+	}
+	else {
+		//m_head == m_tailŎgp͖̂t
+		return INVALID_OFFSET;
+	}
+
+	m_head       = offset + size;
+	m_used      += padding + size;
+	m_openBytes += padding + size;
+	return offset;
+}
+
+void StagingRing::Close(uint64_t fence)
+{
+	if (m_openBytes == 0)
+		return;
+
+	m_closed.push_back({ fence, m_head, m_openBytes });
+	m_openBytes = 0;
+}
+
+void StagingRing::Retire(uint64_t completedFence)
+{
+	while (!m_closed.empty() && m_closed.front().fence <= completedFence) {
+		m_tail  = m_closed.front().end;
+		m_used -= m_closed.front().bytes;
+		m_closed.pop_front();
+	}
+}
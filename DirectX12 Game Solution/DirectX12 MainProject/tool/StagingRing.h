@@ -0,0 +1,62 @@
+/**
+ * @file StagingRing.h
+ * @brief Abv[hp̃Oobt@̊蓖(tFX̒lŌÂɕԋp)
+ * @author hoshi hirofumi
+ * @date 2026/10/19
+ * @note ItZbǧvZȂ̂D3D12ɂ͈ˑȂ(ۂ̃obt@UploadQueue)
+ */
+
+#pragma once
+
+/*
+-------------------------------------------------------------------------------------
+	CN[h
+-------------------------------------------------------------------------------------
+*/
+#include <cstddef>
+#include <cstdint>
+#include <deque>
+
+/*
+-------------------------------------------------------------------------------------
+	StagingRingNX@錾
+-------------------------------------------------------------------------------------
+*/
+class StagingRing {
+public:
+	static constexpr size_t INVALID_OFFSET = static_cast<size_t>(-1);
+
+	explicit StagingRing(size_t capacity);
+	virtual ~StagingRing() {}
+
+	//󂫂INVALID_OFFSET(alignment2̗ݏ)
+	size_t Allocate(size_t size, size_t alignment);
+
+	//܂łɊ蓖Ăfence̊ŕԋp悤ɂ(R}hXg̑M)
+	void Close(uint64_t fence);
+
+	//completedFenceȉ̃tFX̕ԋp
+	void Retire(uint64_t completedFence);
+
+	//ԌÂԋp҂̃tFX(0)
+	uint64_t OldestFence() const { return m_closed.empty() ? 0 : m_closed.front().fence; }
+
+	size_t Capacity() const { return m_capacity; }
+	size_t Used() const { return m_used; }		//ԋp҂ƑMO̍v(̋lߕ܂)
+	bool   HasOpen() const { return m_openBytes != 0; }
+
+private:
+	struct Span {
+		uint64_t fence;
+		size_t   end;		//ԋpƂm_tail
+		size_t   bytes;		//ԋpƂɌ炷m_used
+	};
+
+	size_t m_capacity;
+	size_t m_head;			//Ɋ蓖Ăʒu
+	size_t m_tail;			//ԌÂgp̈ʒu
+	size_t m_used;
+	size_t m_openBytes;		//CloseĂȂ
+
+	std::deque<Span> m_closed;
+};
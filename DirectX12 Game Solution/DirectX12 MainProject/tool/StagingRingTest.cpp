@@ -0,0 +1,162 @@
+/**
+ * @file StagingRingTest.cpp
+ * @brief StagingRing̊mF(R}hCAQ[{̂̃vWFNgɂ͊܂߂Ȃ)
+ * @author hoshi hirofumi
+ * @date 2026/10/19
+ * @note ܂Ԃ̋lߕEtEr܂ł̕ԋpE傫vƁA
+ *       _Ȋ蓖ĂŎgp͈̔͂dȂȂm߂
+ */
+
+#include "StagingRing.h"
+#include "TestCheck.h"
+
+#include <cstdio>
+#include <random>
+#include <vector>
+
+namespace {
+	using TestCheck::Check;
+
+	//ɓȂv͐擪ɖ߂A̗]͕ԋp܂Ŏgp
+	void WrapPadding()
+	{
+		StagingRing ring(1024);
+		Check(ring.Allocate(600, 256) == 0, "first allocation starts at 0");
+		ring.Close(1);
+		Check(ring.Allocate(200, 256) == 768, "second allocation is aligned");
+		ring.Close(2);
+		ring.Retire(1);
+		Check(ring.Used() == 168 + 200, "retire releases the first span (alignment padding stays with the second)");
+
+		//[968, 1024)ɂ͓Ȃ̂Ő擪(lߕ56oCggp)
+		Check(ring.Allocate(300, 4) == 0, "allocation wraps to the start");
+		Check(ring.Used() == 368 + 56 + 300, "wrap padding counts as used");
+		ring.Close(3);
+		Check(ring.Allocate(500, 4) == StagingRing::INVALID_OFFSET, "wrapped allocation cannot pass the tail");
+		Check(ring.Allocate(300, 4) == 300, "wrapped allocation fits up to the tail");
+		ring.Close(4);
+
+		ring.Retire(2);
+		Check(ring.Used() == 56 + 300 + 300, "padding stays used until its span retires");
+		ring.Retire(4);
+		Check(ring.Used() == 0 && ring.OldestFence() == 0, "everything is returned");
+	}
+
+	//head == tail͖t(Ƌʂ)
+	void ExactFill()
+	{
+		StagingRing ring(1024);
+		Check(ring.Allocate(1024, 1) == 0, "the whole ring can be allocated");
+		Check(ring.Allocate(1, 1) == StagingRing::INVALID_OFFSET, "a full ring rejects more");
+		ring.Close(1);
+		ring.Retire(1);
+
+		//r܂Ԃtailɂ҂͂
+		Check(ring.Allocate(512, 1) == 0, "refill from the start");
+		ring.Close(2);
+		Check(ring.Allocate(512, 1) == 512, "fill to the end");
+		ring.Close(3);
+		ring.Retire(2);
+		Check(ring.Allocate(512, 1) == 0, "wrap onto the retired half");
+		Check(ring.Used() == 1024, "head meets tail");
+		Check(ring.Allocate(1, 1) == StagingRing::INVALID_OFFSET, "head == tail with data is full");
+		ring.Close(4);
+		ring.Retire(3);
+		Check(ring.Allocate(256, 1) == 512, "the freed half is reused after head == tail");
+	}
+
+	//ԋp͊tFX̕AÂ
+	void PartialRetire()
+	{
+		StagingRing ring(4096);
+		for (uint64_t fence = 1; fence <= 4; ++fence) {
+			ring.Allocate(512, 256);
+			ring.Close(fence);
+		}
+		ring.Allocate(100, 4);
+		Check(ring.HasOpen(), "unclosed allocation is open");
+
+		ring.Retire(0);
+		Check(ring.Used() == 2148 && ring.OldestFence() == 1, "retiring nothing keeps everything");
+		ring.Retire(2);
+		Check(ring.Used() == 1124 && ring.OldestFence() == 3, "retire stops at the completed fence");
+		ring.Retire(4);
+		Check(ring.Used() == 100 && ring.OldestFence() == 0, "open allocation is not retired");
+
+		ring.Close(5);
+		ring.Close(6);
+		Check(ring.OldestFence() == 5, "closing with nothing open adds no span");
+		ring.Retire(5);
+		Check(ring.Used() == 0 && !ring.HasOpen(), "closed allocation retires");
+	}
+
+	//eʂ𒴂vE󂫂̖v͒f(Ăяo͐p̃obt@ɂ)
+	void Oversize()
+	{
+		StagingRing ring(1024);
+		Check(ring.Allocate(1025, 1) == StagingRing::INVALID_OFFSET, "larger than the ring is rejected");
+		Check(ring.Used() == 0, "a rejected request changes nothing");
+		ring.Allocate(100, 1);
+		Check(ring.Allocate(1000, 1) == StagingRing::INVALID_OFFSET, "larger than the free space is rejected");
+		Check(ring.Allocate(900, 1024) == StagingRing::INVALID_OFFSET, "alignment is counted against the free space");
+		Check(ring.Used() == 100, "a rejected aligned request changes nothing");
+	}
+
+	//_Ɋ蓖āEMEԋpāAgp͈̔͂dȂ炸eʂ𒴂Ȃ
+	void Random()
+	{
+		struct Live { uint64_t fence; size_t offset, size; };
+
+		const size_t capacity = 64 * 1024;
+		StagingRing ring(capacity);
+		std::vector<Live> live;
+		std::mt19937 random(7);
+		uint64_t fence = 0, completed = 0;
+		bool aligned = true, disjoint = true, bounded = true;
+		size_t allocations = 0;
+
+		for (int step = 0; step < 100000; ++step) {
+			const size_t size      = 1 + random() % 8192;
+			const size_t alignment = size_t(1) << (random() % 10);
+			const size_t offset    = ring.Allocate(size, alignment);
+			if (offset != StagingRing::INVALID_OFFSET) {
+				++allocations;
+				aligned &= offset % alignment == 0;
+				bounded &= offset + size <= capacity;
+				for (const auto& other : live)
+					disjoint &= offset + size <= other.offset || other.offset + other.size <= offset;
+				live.push_back({ fence + 1, offset, size });
+			}
+			if (random() % 3 == 0)
+				ring.Close(++fence);
+			if (random() % 4 == 0 && completed < fence) {
+				completed += 1 + random() % (fence - completed);
+				ring.Retire(completed);
+				for (size_t i = 0; i < live.size();)
+					if (live[i].fence <= completed) {
+						live[i] = live.back();
+						live.pop_back();
+					}
+					else {
+						++i;
+					}
+			}
+			bounded &= ring.Used() <= capacity;
+		}
+		Check(aligned, "random offsets are aligned");
+		Check(bounded, "random allocations stay inside the ring");
+		Check(disjoint, "random live allocations never overlap");
+		Check(allocations > 10000, "random allocations mostly succeed");
+	}
+}
+
+int main()
+{
+	WrapPadding();
+	ExactFill();
+	PartialRetire();
+	Oversize();
+	Random();
+
+	return TestCheck::Finish("StagingRingTest");
+}
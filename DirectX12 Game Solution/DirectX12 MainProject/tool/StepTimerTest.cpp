@@ -0,0 +1,172 @@
+/**
+ * @file StepTimerTest.cpp
+ * @brief DX::StepTimer̊mF(R}hCAQ[{̂̃vWFNgɂ͊܂߂Ȃ)
+ * @author hoshi hirofumi
+ * @date 2026/10/19
+ * @note U̎vŌŒXebv̉񐔁EXV̏Ǝ̂ĂԁEԂ̊E0.1b̑ł؂m߂
+ */
+
+#include "Base/StepTimer.h"
+#include "TestCheck.h"
+
+#include <cstdio>
+#include <stdexcept>
+
+namespace {
+	using TestCheck::Check;
+
+	//! }CNbŐi߂U̎v
+	struct FakeClock {
+		uint64_t now = 1000000;
+
+		DX::StepClock Get() { return DX::StepClock{ [this]() { return now; }, 1000000 }; }
+	};
+
+	const uint64_t STEP_120 = DX::StepTimer::TicksPerSecond / 120;	//83333
+
+	//60Hz̃t[120HžŒXebv2A]肪Ԃ̊ɂȂ
+	void FixedStep()
+	{
+		FakeClock clock;
+		DX::StepTimer timer(clock.Get());
+		timer.SetFixedTimeStep(true);
+		timer.SetTargetElapsedTicks(STEP_120);
+
+		int updates = 0;
+		clock.now += 16667;
+		timer.Tick([&]() { ++updates; });
+		Check(updates == 2 && timer.GetElapsedTicks() == STEP_120, "a 60Hz frame runs two 120Hz updates");
+		Check(timer.GetInterpolationAlpha() == 4.0 / STEP_120, "the remainder becomes the interpolation alpha");
+
+		//Xebv: XVAi
+		updates = 0;
+		clock.now += 4167;
+		timer.Tick([&]() { ++updates; });
+		Check(updates == 0, "half a step runs no update");
+		Check(timer.GetInterpolationAlpha() > 0.49 && timer.GetInterpolationAlpha() < 0.51, "half a step gives alpha 0.5");
+	}
+
+	//XV̏: ꂽ͎̂āA͎c(Q[͒xȂ邪x͗܂Ȃ)
+	void UpdateCap()
+	{
+		FakeClock clock;
+		DX::StepTimer timer(clock.Get());
+		timer.SetFixedTimeStep(true);
+		timer.SetTargetElapsedTicks(STEP_120);
+		timer.SetMaxUpdatesPerTick(4);
+
+		int updates = 0;
+		clock.now += 100000;
+		timer.Tick([&]() { ++updates; });
+		Check(updates == 4, "the cap limits updates per tick");
+		Check(timer.GetDroppedTicks() == 8 * STEP_120, "whole steps past the cap are dropped");
+		Check(timer.GetInterpolationAlpha() == 4.0 / STEP_120, "the fraction is kept for interpolation");
+		Check(timer.GetTotalTicks() == 4 * STEP_120, "dropped time does not reach the simulation");
+
+		//̃t[͕ʂɖ߂
+		updates = 0;
+		clock.now += 8333;
+		timer.Tick([&]() { ++updates; });
+		Check(updates == 1 && timer.GetDroppedTicks() == 8 * STEP_120, "the next normal frame drops nothing");
+
+		//ȂȂSǂ
+		timer.SetMaxUpdatesPerTick(0);
+		updates = 0;
+		clock.now += 100000;
+		timer.Tick([&]() { ++updates; });
+		Check(updates == 12, "without a cap every step runs");
+	}
+
+	//0.1b蒷Ԋu(fobK[Ŏ~߂Ȃ)0.1bƂĈ
+	void MaxDelta()
+	{
+		FakeClock clock;
+		DX::StepTimer timer(clock.Get());
+		timer.SetFixedTimeStep(true);
+		timer.SetTargetElapsedTicks(STEP_120);
+
+		int updates = 0;
+		clock.now += 5000000;
+		timer.Tick([&]() { ++updates; });
+		Check(updates == 12 && timer.GetTotalTicks() == 12 * STEP_120, "a 5s pause is clamped to 0.1s");
+
+		DX::StepTimer variable(clock.Get());
+		clock.now += 3000000;
+		variable.Tick([]() {});
+		Check(variable.GetElapsedTicks() == DX::StepTimer::TicksPerSecond / 10, "variable step is clamped to 0.1s");
+	}
+
+	//ڕW1/4msȓ̊Ԋu͖ڕWɑ(59.94Hz̉ʂ60HžŒXebvȂ)
+	void SnapToTarget()
+	{
+		FakeClock clock;
+		DX::StepTimer timer(clock.Get());
+		timer.SetFixedTimeStep(true);
+		timer.SetTargetElapsedSeconds(1.0 / 60);
+
+		bool steady = true;
+		for (int frame = 0; frame < 10000; ++frame) {
+			int updates = 0;
+			clock.now += 16683;
+			timer.Tick([&]() { ++updates; });
+			steady &= updates == 1;
+		}
+		Check(steady && timer.GetInterpolationAlpha() == 0.0, "59.94Hz frames run exactly one 60Hz update each");
+	}
+
+	//Advance: t[̌oߎԂʂ̎Ői߂([V30HzȂ)
+	void Advance()
+	{
+		FakeClock clock;
+		DX::StepTimer motion(clock.Get());
+		motion.SetFixedTimeStep(true);
+		motion.SetTargetElapsedTicks(DX::StepTimer::TicksPerSecond / 30);
+
+		int steps = 0;
+		for (int frame = 0; frame < 144; ++frame)
+			motion.Advance(DX::StepTimer::TicksPerSecond / 144, [&]() { ++steps; });
+		Check(steps == 29, "144 frames of 1/144s give 29 whole 30Hz steps");
+		Check(motion.GetInterpolationAlpha() > 0.99, "the 30th step is almost due");
+	}
+
+	//σXebvƃt[[ǧv
+	void Variable()
+	{
+		FakeClock clock;
+		DX::StepTimer timer(clock.Get());
+
+		int updates = 0;
+		clock.now += 1000;
+		timer.Tick([&]() { ++updates; });
+		Check(updates == 1 && timer.GetElapsedTicks() == 10000, "variable step updates once with the real delta");
+		Check(timer.GetInterpolationAlpha() == 1.0, "variable step renders the latest state");
+
+		DX::StepTimer counted(clock.Get());
+		for (int frame = 0; frame < 60; ++frame) {
+			clock.now += 16667;
+			counted.Tick([]() {});
+		}
+		Check(counted.GetFramesPerSecond() == 60, "frames per second after one second");
+
+		bool thrown = false;
+		try {
+			DX::StepTimer invalid(DX::StepClock{ nullptr, 0 });
+		}
+		catch (const std::invalid_argument&) {
+			thrown = true;
+		}
+		Check(thrown, "an invalid clock throws");
+	}
+}
+
+int main()
+{
+	FixedStep();
+	UpdateCap();
+	MaxDelta();
+	SnapToTarget();
+	Advance();
+	Variable();
+
+	return TestCheck::Finish("StepTimerTest");
+}
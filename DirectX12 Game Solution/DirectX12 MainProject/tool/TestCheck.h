@@ -0,0 +1,46 @@
+/**
+ * @file TestCheck.h
+ * @brief R}hC̊mF(tool/XxxTest.cpp)ŋʂ̔ƌʂ̕\
+ * @author hoshi hirofumi
+ * @date 2026/10/19
+ * @note mFtool/CMakeLists.txtł܂Ƃ߂ărhActestŎs
+ */
+
+#pragma once
+
+/*
+-------------------------------------------------------------------------------------
+	CN[h
+-------------------------------------------------------------------------------------
+*/
+#include <cstdio>
+
+/*
+-------------------------------------------------------------------------------------
+	TestCheck@錾
+-------------------------------------------------------------------------------------
+*/
+namespace TestCheck {
+	//! s(vZX1)
+	inline int& Failures()
+	{
+		static int failures = 0;
+		return failures;
+	}
+
+	//! UȂe\Ďs𐔂
+	inline void Check(bool condition, const char* what)
+	{
+		if (!condition) {
+			fprintf(stderr, "FAILED: %s\n", what);
+			++Failures();
+		}
+	}
+
+	//! ʂ\main̏IR[hԂ(s1)
+	inline int Finish(const char* name)
+	{
+		printf("%s: %s\n", name, Failures() == 0 ? "ok" : "FAILED");
+		return Failures() == 0 ? 0 : 1;
+	}
+}
@@ -0,0 +1,163 @@
+/**
+ * @file TextDecoder.cpp
+ * @brief t@C̕̕ϊ(Shift-JISEUTF-8EUTF-16  wstring)
+ * @author hoshi hirofumi
+ * @date 2026/10/19
+ */
+
+#include "TextDecoder.h"
+
+namespace {
+	//! 2oCg̕ϊ\(擪oCg̍s ~ 2oCgڂ̗)
+	constexpr int TRAIL_FIRST = 0x40;
+	constexpr int TRAIL_COUNT = 0xfc - 0x40 + 1;
+
+	const uint16_t SHIFT_JIS_TABLE[][TRAIL_COUNT] = {
+#include "ShiftJisTable.inc"
+	};
+
+	//! 擪oCg  \̍s(2oCg̐擪łȂ-1)
+	int LeadRow(uint8_t lead)
+	{
+		if (lead >= 0x81 && lead <= 0x9f)
+			return lead - 0x81;
+		if (lead >= 0xe0 && lead <= 0xfc)
+			return lead - 0xe0 + (0x9f - 0x81 + 1);
+		return -1;
+	}
+
+	bool IsHighSurrogate(uint32_t c) { return c >= 0xd800 && c <= 0xdbff; }
+	bool IsLowSurrogate(uint32_t c) { return c >= 0xdc00 && c <= 0xdfff; }
+}
+
+std::wstring TextDecoder::FromShiftJis(const char* text, size_t size)
+{
+	std::wstring output;
+	output.reserve(size);
+
+	const auto bytes = reinterpret_cast<const uint8_t*>(text);
+	for (size_t i = 0; i < size && bytes[i] != 0; ++i) {
+		const uint8_t c = bytes[i];
+		if (c < 0x80) {
+			output += static_cast<wchar_t>(c);
+			continue;
+		}
+		if (c >= 0xa1 && c <= 0xdf) {
+			output += static_cast<wchar_t>(0xff61 + (c - 0xa1));	//pJi
+			continue;
+		}
+
+		const int row = LeadRow(c);
+		if (row < 0 || i + 1 >= size || bytes[i + 1] < TRAIL_FIRST || bytes[i + 1] - TRAIL_FIRST >= TRAIL_COUNT) {
+			output += REPLACEMENT;		//rŐ؂ꂽ2oCg(VMD15oCg̗ł悭)܂
+			continue;
+		}
+
+		const uint16_t mapped = SHIFT_JIS_TABLE[row][bytes[++i] - TRAIL_FIRST];
+		output += mapped != 0 ? static_cast<wchar_t>(mapped) : REPLACEMENT;
+	}
+	return output;
+}
+
+std::wstring TextDecoder::FromUtf8(const char* text, size_t size)
+{
+	std::wstring output;
+	output.reserve(size);
+
+	const auto bytes = reinterpret_cast<const uint8_t*>(text);
+	for (size_t i = 0; i < size && bytes[i] != 0; ++i) {
+		const uint8_t c = bytes[i];
+
+		size_t length;
+		uint32_t codePoint;
+		if (c < 0x80)              { length = 1; codePoint = c; }
+		else if ((c & 0xe0) == 0xc0) { length = 2; codePoint = c & 0x1f; }
+		else if ((c & 0xf0) == 0xe0) { length = 3; codePoint = c & 0x0f; }
+		else if ((c & 0xf8) == 0xf0) { length = 4; codePoint = c & 0x07; }
+		else {
+			output += REPLACEMENT;
+			continue;
+		}
+
+		size_t read = 1;
+		for (; read < length && i + read < size && (bytes[i + read] & 0xc0) == 0x80; ++read)
+			codePoint = (codePoint << 6) | (bytes[i + read] & 0x3f);
+
+		static const uint32_t MINIMUM[] = { 0, 0, 0x80, 0x800, 0x10000 };
+		if (read < length || codePoint < MINIMUM[length] || codePoint > 0x10ffff || IsHighSurrogate(codePoint) || IsLowSurrogate(codePoint))
+			Append(output, REPLACEMENT);
+		else
+			Append(output, codePoint);
+		i += read - 1;
+	}
+	return output;
+}
+
+std::wstring TextDecoder::FromUtf16(const char16_t* text, size_t count)
+{
+	std::wstring output;
+	output.reserve(count);
+
+	for (size_t i = 0; i < count && text[i] != 0; ++i) {
+		const uint32_t c = text[i];
+		if (IsHighSurrogate(c) && i + 1 < count && IsLowSurrogate(text[i + 1])) {
+			Append(output, 0x10000 + ((c - 0xd800) << 10) + (text[++i] - 0xdc00));
+		}
+		else if (IsHighSurrogate(c) || IsLowSurrogate(c)) {
+			output += REPLACEMENT;
+		}
+		else {
+			output += static_cast<wchar_t>(c);
+		}
+	}
+	return output;
+}
+
+std::string TextDecoder::ToUtf8(const std::wstring& text)
+{
+	std::string output;
+	output.reserve(text.size() * 3);
+
+	for (size_t i = 0; i < text.size(); ++i) {
+		uint32_t c = static_cast<uint32_t>(text[i]);
+		if (sizeof(wchar_t) == 2 && IsHighSurrogate(c) && i + 1 < text.size() && IsLowSurrogate(static_cast<uint32_t>(text[i + 1])))
+			c = 0x10000 + ((c - 0xd800) << 10) + (static_cast<uint32_t>(text[++i]) - 0xdc00);
+		else if (IsHighSurrogate(c) || IsLowSurrogate(c) || c > 0x10ffff)
+			c = REPLACEMENT;
+
+		if (c < 0x80) {
+			output += static_cast<char>(c);
+		}
+		else if (c < 0x800) {
+			output += static_cast<char>(0xc0 | (c >> 6));
+			output += static_cast<char>(0x80 | (c & 0x3f));
+		}
+		else if (c < 0x10000) {
+			output += static_cast<char>(0xe0 | (c >> 12));
+			output += static_cast<char>(0x80 | ((c >> 6) & 0x3f));
+			output += static_cast<char>(0x80 | (c & 0x3f));
+		}
+		else {
+			output += static_cast<char>(0xf0 | (c >> 18));
+			output += static_cast<char>(0x80 | ((c >> 12) & 0x3f));
+			output += static_cast<char>(0x80 | ((c >> 6) & 0x3f));
+			output += static_cast<char>(0x80 | (c & 0x3f));
+		}
+	}
+	return output;
+}
+
+/**
+	@brief	1ǉ(wchar_t16bit̊łBMPOTQ[gyAɂ)
+*/
+void TextDecoder::Append(std::wstring& output, uint32_t codePoint)
+{
+	if (sizeof(wchar_t) == 2 && codePoint >= 0x10000) {
+		codePoint -= 0x10000;
+		output += static_cast<wchar_t>(0xd800 + (codePoint >> 10));
+		output += static_cast<wchar_t>(0xdc00 + (codePoint & 0x3ff));
+	}
+	else {
+		output += static_cast<wchar_t>(codePoint);
+	}
+}
@@ -0,0 +1,41 @@
+/**
+ * @file TextDecoder.h
+ * @brief t@C̕̕ϊ(Shift-JISEUTF-8EUTF-16  wstring)
+ * @author hoshi hirofumi
+ * @date 2026/10/19
+ * @note ϊ\AOS̃P[(CP_ACP)ɈˑȂ({ňȊOWindowsELinuxł)
+ */
+
+#pragma once
+
+/*
+-------------------------------------------------------------------------------------
+	CN[h
+-------------------------------------------------------------------------------------
+*/
+#include <cstddef>
+#include <cstdint>
+#include <string>
+
+/*
+-------------------------------------------------------------------------------------
+	TextDecoderNX@錾
+-------------------------------------------------------------------------------------
+*/
+class TextDecoder {
+public:
+	//! ϊłȂoCg̑
+	static constexpr wchar_t REPLACEMENT = 0xfffd;
+
+	//Œ蒷̗ǂނ̂ŁAǂŏ0Ŏ~܂
+	static std::wstring FromShiftJis(const char* text, size_t size);
+	static std::wstring FromUtf8(const char* text, size_t size);
+	//count͕(wchar_t32bit̊ł̓TQ[gyA܂Ƃ߂)
+	static std::wstring FromUtf16(const char16_t* text, size_t count);
+
+	static std::string ToUtf8(const std::wstring& text);
+	static std::string ShiftJisToUtf8(const char* text, size_t size) { return ToUtf8(FromShiftJis(text, size)); }
+
+private:
+	static void Append(std::wstring& output, uint32_t codePoint);
+};
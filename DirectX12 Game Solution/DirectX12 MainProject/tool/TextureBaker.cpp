@@ -0,0 +1,344 @@
+/**
+ * @file TextureBaker.cpp
+ * @brief PMXQƂeNX`BC1/BC3DDSɏĂ(ItC)
+ * @author hoshi hirofumi
+ * @date 2026/10/19
+ */
+
+#include "TextureBaker.h"
+#include "TextureCache.h"
+#include "AssetFiles.h"
+#include "TextDecoder.h"
+
+#include <wincodec.h>
+
+#include <cwctype>
+#include <fstream>
+
+using Microsoft::WRL::ComPtr;
+
+namespace {
+	//! PMX̃eLXg(GR[h0:UTF-16A1:UTF-8)
+	bool ReadText(const std::vector<uint8_t>& data, size_t& offset, uint8_t encoding, std::wstring* output)
+	{
+		if (offset + 4 > data.size())
+			return false;
+		int32_t length;
+		memcpy(&length, &data[offset], 4);
+		offset += 4;
+		if (length < 0 || offset + length > data.size())
+			return false;
+
+		if (output) {
+			//PmxLoaderƓϊ(؂'/'ւ̓̓pX鑤ōs)
+			if (encoding == 0) {
+				std::u16string utf16(length / sizeof(char16_t), u'\0');
+				memcpy(utf16.data(), &data[offset], utf16.size() * sizeof(char16_t));
+				*output = TextDecoder::FromUtf16(utf16.data(), utf16.size());
+			}
+			else {
+				*output = TextDecoder::FromUtf8(reinterpret_cast<const char*>(&data[offset]), length);
+			}
+		}
+		offset += length;
+		return true;
+	}
+
+	const wchar_t* FormatName(CompressedImage::Format format)
+	{
+		return format == CompressedImage::Format::BC1 ? L"BC1" : L"BC3";
+	}
+}
+
+TextureBaker::TextureBaker()
+{
+}
+
+/**
+	@brief	modelRootȉ̑SPMX̃eNX`Ă
+	@note	JgfBNgAssets(/shadersƓ)
+*/
+bool TextureBaker::BakeAll(const std::filesystem::path& modelRoot)
+{
+	bool succeeded = true;
+
+	std::error_code error;
+	for (std::filesystem::recursive_directory_iterator it(modelRoot, error), end; !error && it != end; it.increment(error)) {
+		if (!it->is_regular_file())
+			continue;
+
+		auto extension = it->path().extension().wstring();
+		for (auto& c : extension)
+			c = towlower(c);
+		if (extension == L".pmx")
+			succeeded &= BakeModel(it->path());
+	}
+
+	succeeded &= WriteReport(std::filesystem::path(BAKED_DIRECTORY) / L"report.txt");
+	return succeeded && !error;
+}
+
+/**
+	@brief	1f̃eNX`Ă
+*/
+bool TextureBaker::BakeModel(const std::filesystem::path& pmxPath)
+{
+	std::vector<std::wstring> paths;
+	if (!ReadTexturePaths(pmxPath, paths)) {
+		OutputDebugStringW((L"TextureBaker: failed to read " + pmxPath.wstring() + L"\n").c_str());
+		return false;
+	}
+
+	bool succeeded = true;
+	for (const auto& path : paths)
+		succeeded &= BakeTexture(pmxPath.parent_path() / path);
+	return succeeded;
+}
+
+/**
+	@brief	1Ă(~bv͑SiAAt@BC3)
+*/
+bool TextureBaker::BakeTexture(const std::filesystem::path& source)
+{
+	if (!m_baked.insert(TextureCache::NormalizePath(source.wstring())).second)
+		return true;
+
+	Report report{};
+	report.source = source.lexically_normal().wstring();
+
+	std::error_code error;
+	report.fileBytes = static_cast<size_t>(std::filesystem::file_size(source, error));
+
+	DecodedImage image;
+	const auto result = ImageDecoder::DecodeFile(source, image);
+	if (result == ImageDecoder::Result::Unsupported) {
+		//JPEGȂǂWICŃfR[h
+		if (!DecodeWithWic(source, image))
+			image.levels.clear();
+	}
+	else if (result != ImageDecoder::Result::Ok) {
+		image.levels.clear();
+	}
+
+	if (!image.levels.empty()) {
+		CompressedImage compressed;
+		report.format = BlockCompressor::ChooseFormat(image.levels[0]);
+		BlockCompressor::Compress(image, report.format, compressed);
+
+		ImageLevel decoded;
+		BlockCompressor::Decompress(compressed, 0, decoded);
+		report.psnr       = BlockCompressor::Psnr(image.levels[0], decoded);
+		report.rawBytes   = image.SizeInBytes();
+		report.bakedBytes = compressed.SizeInBytes();
+		report.succeeded  = BlockCompressor::WriteDds(BakedPath(source), compressed);
+	}
+
+	wchar_t message[512];
+	if (report.succeeded) {
+		swprintf_s(message, L"TextureBaker: %s %s %zu -> %zu bytes (file %zu) PSNR %.2fdB\n",
+			report.source.c_str(), FormatName(report.format), report.rawBytes, report.bakedBytes, report.fileBytes, report.psnr);
+	}
+	else {
+		swprintf_s(message, L"TextureBaker: failed to bake %s\n", report.source.c_str());
+	}
+	OutputDebugStringW(message);
+
+	m_reports.push_back(report);
+	return report.succeeded;
+}
+
+/**
+	@brief	|[gUTF-8̃eLXgŏo
+*/
+bool TextureBaker::WriteReport(const std::filesystem::path& path) const
+{
+	std::wstring text = L"source\tformat\tfile\traw\tbaked\tpsnr\n";
+	size_t rawTotal = 0, bakedTotal = 0;
+	for (const auto& report : m_reports) {
+		wchar_t line[512];
+		if (report.succeeded) {
+			swprintf_s(line, L"%s\t%s\t%zu\t%zu\t%zu\t%.2f\n",
+				report.source.c_str(), FormatName(report.format), report.fileBytes, report.rawBytes, report.bakedBytes, report.psnr);
+			rawTotal   += report.rawBytes;
+			bakedTotal += report.bakedBytes;
+		}
+		else {
+			swprintf_s(line, L"%s\tfailed\t%zu\t\t\t\n", report.source.c_str(), report.fileBytes);
+		}
+		text += line;
+	}
+
+	wchar_t total[128];
+	swprintf_s(total, L"total\t\t\t%zu\t%zu\t\n", rawTotal, bakedTotal);
+	text += total;
+
+	wchar_t message[128];
+	swprintf_s(message, L"TextureBaker: %zu textures, %zu -> %zu bytes\n", m_reports.size(), rawTotal, bakedTotal);
+	OutputDebugStringW(message);
+
+	const int size = WideCharToMultiByte(CP_UTF8, 0, text.c_str(), static_cast<int>(text.size()), nullptr, 0, nullptr, nullptr);
+	std::string utf8(size, '\0');
+	WideCharToMultiByte(CP_UTF8, 0, text.c_str(), static_cast<int>(text.size()), &utf8[0], size, nullptr, nullptr);
+
+	std::error_code error;
+	std::filesystem::create_directories(path.parent_path(), error);
+
+	std::ofstream file(path, std::ios::binary | std::ios::trunc);
+	file.write(utf8.data(), utf8.size());
+	return file.good();
+}
+
+/**
+	@brief	t@CɑΉDDS̃pX
+	@note	"Model/a/b.png"  "Baked/Model/a/b.png.dds"
+*/
+std::filesystem::path TextureBaker::BakedPath(const std::filesystem::path& source)
+{
+	std::error_code error;
+	const auto relative = std::filesystem::relative(source, error);
+	if (error || relative.empty() || *relative.begin() == L"..")
+		return {};
+
+	auto baked = std::filesystem::path(BAKED_DIRECTORY) / relative;
+	baked += L".dds";
+	return baked;
+}
+
+/**
+	@brief	ĂDDST
+	@param	source ̃t@C
+	@param	baked  DDS̃pX
+	@return t@CƓVDDStrue
+	@note	A[JCuɂ̂͏ĂĂ܂Ƃ߂̂Ȃ̂ŁAtׂɎg
+*/
+bool TextureBaker::FindBaked(const std::wstring& source, std::wstring& baked)
+{
+	const auto path = BakedPath(source);
+	if (path.empty())
+		return false;
+
+	if (AssetFiles::Get().IsInArchive(path)) {
+		baked = path.wstring();
+		return true;
+	}
+
+	std::error_code error;
+	const auto bakedTime = std::filesystem::last_write_time(path, error);
+	if (error)
+		return false;
+	const auto sourceTime = std::filesystem::last_write_time(source, error);
+	if (error || bakedTime < sourceTime)
+		return false;
+
+	baked = path.wstring();
+	return true;
+}
+
+/**
+	@brief	PMXeNX`̃pXǂ
+	@note	_Ɩʂ͓ǂݔ΂(PmxLoaderƓ)
+*/
+bool TextureBaker::ReadTexturePaths(const std::filesystem::path& pmxPath, std::vector<std::wstring>& paths)
+{
+	std::ifstream file(pmxPath, std::ios::binary);
+	if (!file)
+		return false;
+	const std::vector<uint8_t> data((std::istreambuf_iterator<char>(file)), std::istreambuf_iterator<char>());
+
+	if (data.size() < 17 || memcmp(data.data(), "PMX ", 4) != 0)
+		return false;
+
+	const uint8_t encoding      = data[9];
+	const uint8_t addUv         = data[10];
+	const uint8_t verticesIndex = data[11];
+	const uint8_t boneIndex     = data[14];
+	size_t offset = 9 + data[8];
+
+	//fERg
+	for (int i = 0; i < 4; ++i) {
+		if (!ReadText(data, offset, encoding, nullptr))
+			return false;
+	}
+
+	const auto readInt = [&](int32_t& value) {
+		if (offset + 4 > data.size())
+			return false;
+		memcpy(&value, &data[offset], 4);
+		offset += 4;
+		return value >= 0;
+	};
+
+	int32_t numVertex;
+	if (!readInt(numVertex))
+		return false;
+	for (int32_t i = 0; i < numVertex; ++i) {
+		//ʒuE@EUVEǉUV
+		offset += 32 + addUv * 16;
+		if (offset >= data.size())
+			return false;
+
+		switch (data[offset++]) {
+		case 0: offset += boneIndex; break;
+		case 1: offset += boneIndex * 2 + 4; break;
+		case 2: offset += boneIndex * 4 + 16; break;
+		case 3: offset += boneIndex * 2 + 4 + 36; break;
+		case 4: offset += boneIndex * 4 + 16; break;
+		default: return false;
+		}
+		//GbW{
+		offset += 4;
+	}
+
+	int32_t numSurfaces;
+	if (!readInt(numSurfaces))
+		return false;
+	offset += static_cast<size_t>(numSurfaces) * verticesIndex;
+
+	int32_t numTexture;
+	if (!readInt(numTexture))
+		return false;
+	paths.resize(numTexture);
+	for (auto& path : paths) {
+		if (!ReadText(data, offset, encoding, &path))
+			return false;
+		std::replace(path.begin(), path.end(), L'\\', L'/');
+	}
+	return true;
+}
+
+/**
+	@brief	ImageDecoderňȂ`(JPEGȂ)WICŃfR[h
+	@note	COMwWinMainŏς
+*/
+bool TextureBaker::DecodeWithWic(const std::filesystem::path& path, DecodedImage& image)
+{
+	ComPtr<IWICImagingFactory> factory;
+	if (FAILED(CoCreateInstance(CLSID_WICImagingFactory, nullptr, CLSCTX_INPROC_SERVER, IID_PPV_ARGS(factory.GetAddressOf()))))
+		return false;
+
+	ComPtr<IWICBitmapDecoder> decoder;
+	if (FAILED(factory->CreateDecoderFromFilename(path.c_str(), nullptr, GENERIC_READ, WICDecodeMetadataCacheOnDemand, decoder.GetAddressOf())))
+		return false;
+
+	ComPtr<IWICBitmapFrameDecode> frame;
+	if (FAILED(decoder->GetFrame(0, frame.GetAddressOf())))
+		return false;
+
+	ComPtr<IWICFormatConverter> converter;
+	if (FAILED(factory->CreateFormatConverter(converter.GetAddressOf())))
+		return false;
+	if (FAILED(converter->Initialize(frame.Get(), GUID_WICPixelFormat32bppRGBA, WICBitmapDitherTypeNone, nullptr, 0.0, WICBitmapPaletteTypeCustom)))
+		return false;
+
+	ImageLevel level{};
+	if (FAILED(converter->GetSize(&level.width, &level.height)) || level.width == 0 || level.height == 0)
+		return false;
+	level.pixels.resize(static_cast<size_t>(level.width) * level.height * 4);
+	if (FAILED(converter->CopyPixels(nullptr, level.width * 4, static_cast<UINT>(level.pixels.size()), level.pixels.data())))
+		return false;
+
+	image.levels.clear();
+	image.levels.push_back(std::move(level));
+	ImageDecoder::GenerateMips(image);
+	return true;
+}
@@ -0,0 +1,72 @@
+/**
+ * @file TextureBaker.h
+ * @brief PMXQƂeNX`BC1/BC3DDSɏĂ(ItC)
+ * @author hoshi hirofumi
+ * @date 2026/10/19
+ */
+
+#pragma once
+
+/*
+-------------------------------------------------------------------------------------
+	CN[h
+-------------------------------------------------------------------------------------
+*/
+#include "Base/pch.h"
+#include "BlockCompressor.h"
+
+#include <set>
+#include <string>
+
+/*
+-------------------------------------------------------------------------------------
+	TextureBakerNX@錾
+-------------------------------------------------------------------------------------
+*/
+class TextureBaker {
+public:
+	//! ĂDDS̒uꏊ(Assets̑΃pX̂܂܉ɍ)
+	static constexpr const wchar_t* BAKED_DIRECTORY = L"Baked";
+
+	struct Report {
+		std::wstring            source;
+		CompressedImage::Format format;
+		size_t                  fileBytes;		//̃t@CTCY
+		size_t                  rawBytes;		//RGBA8̃~bv`F[(GPȔĂÕTCY)
+		size_t                  bakedBytes;		//DDS̃~bv`F[
+		double                  psnr;			//ŏʃ~bvPSNR(dB)
+		bool                    succeeded;
+	};
+
+	TextureBaker();
+	virtual ~TextureBaker() {}
+
+	TextureBaker(TextureBaker&&) = default;
+	TextureBaker& operator= (TextureBaker&&) = default;
+
+	TextureBaker(TextureBaker const&) = delete;
+	TextureBaker& operator= (TextureBaker const&) = delete;
+
+	//modelRootȉ̑SPMXĂă|[go(/bake)
+	bool BakeAll(const std::filesystem::path& modelRoot = L"Model");
+	bool BakeModel(const std::filesystem::path& pmxPath);
+	bool BakeTexture(const std::filesystem::path& source);
+
+	bool WriteReport(const std::filesystem::path& path) const;
+	const std::vector<Report>& GetReports() const { return m_reports; }
+
+	//t@CɑΉDDS̃pX(Assets̊OȂ)
+	static std::filesystem::path BakedPath(const std::filesystem::path& source);
+
+	//t@CVDDStrue
+	static bool FindBaked(const std::wstring& source, std::wstring& baked);
+
+private:
+	static bool ReadTexturePaths(const std::filesystem::path& pmxPath, std::vector<std::wstring>& paths);
+	static bool DecodeWithWic(const std::filesystem::path& path, DecodedImage& image);
+
+	std::vector<Report>    m_reports;
+
+	//! Ăt@C(KpXÃfQƂ̂1񂾂)
+	std::set<std::wstring> m_baked;
+};
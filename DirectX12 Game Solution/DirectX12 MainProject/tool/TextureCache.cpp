@@ -0,0 +1,198 @@
+/**
+ * @file TextureCache.cpp
+ * @brief ǂݍݍς݃eNX`̋L
+ * @author hoshi hirofumi
+ * @date 2026/10/19
+ */
+
+#include "TextureCache.h"
+#include "AssetFiles.h"
+
+#include <algorithm>
+#include <cwctype>
+#include <filesystem>
+
+namespace {
+	//! GetōCX^X
+	TextureCache* g_instance = nullptr;
+}
+
+TextureCache::TextureCache(ID3D12Device* device) : m_device(device), m_statistics{}
+{
+	g_instance = this;
+}
+
+TextureCache::~TextureCache()
+{
+	g_instance = nullptr;
+}
+
+/**
+	@brief	eNX`̎擾(t@CEtOȂǂݍݍς݂̂̂Ԃ)
+	@param	fileName       t@C
+	@param	resourceUpload Vǂݍޏꍇ̃Abv[h
+	@param	flags          WIC̓ǂݍ݃tO
+	@return eNX`
+*/
+ComPtr<ID3D12Resource> TextureCache::Load(const std::wstring& fileName, ResourceUploadBatch& resourceUpload, WIC_LOADER_FLAGS flags)
+{
+	const auto key = MakeKey(fileName, flags);
+
+	std::lock_guard<std::mutex> lock(m_mutex);
+
+	auto it = m_entries.find(key);
+	if (it != m_entries.end()) {
+		++m_statistics.hits;
+		m_statistics.bytesSaved += it->second.size;
+		return it->second.resource;
+	}
+
+	//A[JCuɂ΂(WIC̓̃C[Wǂ)
+	const FileView file = AssetFiles::Get().Open(fileName);
+	if (!file)
+		DX::ThrowIfFailed(HRESULT_FROM_WIN32(ERROR_FILE_NOT_FOUND));
+
+	ComPtr<ID3D12Resource> resource;
+	DX::ThrowIfFailed(CreateWICTextureFromMemoryEx(
+		m_device, resourceUpload, file.Data(), file.Size(), 0,
+		D3D12_RESOURCE_FLAG_NONE, flags,
+		resource.GetAddressOf()
+	));
+
+	Add(key, resource.Get());
+	return resource;
+}
+
+/**
+	@brief	ǂݍݍς݂̃eNX`T
+	@param	fileName t@C
+	@param	flags    WIC̓ǂݍ݃tO
+	@return Ȃnullptr
+*/
+ComPtr<ID3D12Resource> TextureCache::Find(const std::wstring& fileName, WIC_LOADER_FLAGS flags)
+{
+	const auto key = MakeKey(fileName, flags);
+
+	std::lock_guard<std::mutex> lock(m_mutex);
+
+	auto it = m_entries.find(key);
+	if (it == m_entries.end())
+		return nullptr;
+
+	++m_statistics.hits;
+	m_statistics.bytesSaved += it->second.size;
+	return it->second.resource;
+}
+
+/**
+	@brief	ʂ̌oH(񓯊ǂݍ݂Ȃ)ōeNX`o^
+*/
+void TextureCache::Insert(const std::wstring& fileName, ID3D12Resource* resource, WIC_LOADER_FLAGS flags)
+{
+	const auto key = MakeKey(fileName, flags);
+
+	std::lock_guard<std::mutex> lock(m_mutex);
+	if (m_entries.find(key) == m_entries.end())
+		Add(key, resource);
+}
+
+TextureCache::Key TextureCache::MakeKey(const std::wstring& fileName, WIC_LOADER_FLAGS flags) const
+{
+	return std::make_pair(NormalizePath(fileName), static_cast<unsigned int>(flags));
+}
+
+void TextureCache::Add(const Key& key, ID3D12Resource* resource)
+{
+	Entry entry{};
+	entry.resource = resource;
+
+	const auto desc = resource->GetDesc();
+	entry.size = static_cast<size_t>(m_device->GetResourceAllocationInfo(0, 1, &desc).SizeInBytes);
+
+	++m_statistics.misses;
+	m_statistics.bytesLoaded += entry.size;
+
+	m_entries.emplace(key, entry);
+}
+
+/**
+	@brief	LbVQƂĂȂeNX`
+	@return 
+	@note	GPUgIĂĂԂ(V[̏IȂ)
+*/
+size_t TextureCache::Trim()
+{
+	std::lock_guard<std::mutex> lock(m_mutex);
+
+	size_t released = 0;
+	for (auto it = m_entries.begin(); it != m_entries.end();) {
+		//QƃJEgAddRef/Release̖߂lłȂ
+		it->second.resource->AddRef();
+		if (it->second.resource->Release() == 1) {
+			it = m_entries.erase(it);
+			++released;
+		}
+		else {
+			++it;
+		}
+	}
+	return released;
+}
+
+TextureCache::Statistics TextureCache::GetStatistics() const
+{
+	std::lock_guard<std::mutex> lock(m_mutex);
+
+	auto stats = m_statistics;
+	stats.entries = m_entries.size();
+	return stats;
+}
+
+/**
+	@brief	L[ɂpX̐K
+	@note	"Model/a/../white.bmp""model\\White.bmp"̂悤ȕ\L̈Ⴂ܂Ƃ߂
+*/
+std::wstring TextureCache::NormalizePath(const std::wstring& fileName)
+{
+	std::error_code error;
+	auto path = std::filesystem::absolute(std::filesystem::path(fileName), error);
+	if (error)
+		path = fileName;
+
+	auto normalized = path.lexically_normal().make_preferred().wstring();
+	std::transform(normalized.begin(), normalized.end(), normalized.begin(),
+		[](wchar_t c) { return static_cast<wchar_t>(towlower(c)); });
+	return normalized;
+}
+
+/**
+	@brief	foCX̏(LbVɂAgLoadAssetsœǂݒ)
+*/
+void TextureCache::OnDeviceLost()
+{
+	if (g_instance == nullptr)
+		return;
+
+	std::lock_guard<std::mutex> lock(g_instance->m_mutex);
+	g_instance->m_entries.clear();
+	g_instance->m_device = nullptr;
+}
+
+void TextureCache::OnDeviceRestored(ID3D12Device* device)
+{
+	if (g_instance == nullptr)
+		return;
+
+	std::lock_guard<std::mutex> lock(g_instance->m_mutex);
+	g_instance->m_device = device;
+}
+
+/**
+	@brief	Sfʂ̃CX^X
+	@param	device 񂾂Kv
+*/
+TextureCache& TextureCache::Get(ID3D12Device* device)
+{
+	static TextureCache instance(device ? device : DXTK->Device);
+	return instance;
+}
@@ -0,0 +1,93 @@
+/**
+ * @file TextureCache.h
+ * @brief ǂݍݍς݃eNX`̋L
+ * @author hoshi hirofumi
+ * @date 2026/10/19
+ */
+
+#pragma once
+
+/*
+-------------------------------------------------------------------------------------
+	CN[h
+-------------------------------------------------------------------------------------
+*/
+#include "Base/pch.h"
+#include "Base/dxtk.h"
+
+#include <map>
+#include <mutex>
+
+/*
+-------------------------------------------------------------------------------------
+	using
+-------------------------------------------------------------------------------------
+*/
+using Microsoft::WRL::ComPtr;
+using std::unique_ptr;
+using std::make_unique;
+using namespace DirectX;
+
+/*
+-------------------------------------------------------------------------------------
+	TextureCacheNX@錾
+-------------------------------------------------------------------------------------
+*/
+class TextureCache {
+public:
+	struct Statistics {
+		size_t hits;			//ǂݍݍς݂̂̂Ԃ
+		size_t misses;			//ۂɓǂݍ񂾉
+		size_t bytesLoaded;		//ǂݍ񂾃eNX`̍vTCY
+		size_t bytesSaved;		//g񂵂œǂݍ܂ɍς񂾍vTCY
+		size_t entries;			//LbṼeNX`
+	};
+
+	TextureCache(ID3D12Device* device);
+	virtual ~TextureCache();
+
+	TextureCache(TextureCache&&) = delete;
+	TextureCache& operator= (TextureCache&&) = delete;
+
+	TextureCache(TextureCache const&) = delete;
+	TextureCache& operator= (TextureCache const&) = delete;
+
+	ComPtr<ID3D12Resource> Load(const std::wstring& fileName, ResourceUploadBatch& resourceUpload, WIC_LOADER_FLAGS flags = WIC_LOADER_DEFAULT);
+
+	//񓯊ǂݍݗp(Ȃnullptr)
+	ComPtr<ID3D12Resource> Find(const std::wstring& fileName, WIC_LOADER_FLAGS flags = WIC_LOADER_DEFAULT);
+	void Insert(const std::wstring& fileName, ID3D12Resource* resource, WIC_LOADER_FLAGS flags = WIC_LOADER_DEFAULT);
+
+	//ǂ̃fgĂȂeNX`
+	size_t Trim();
+
+	Statistics GetStatistics() const;
+
+	static std::wstring NormalizePath(const std::wstring& fileName);
+
+	//foCX̏ƍč쐬(GameBase::OnDeviceLostAGet̑OȂ牽Ȃ)
+	static void OnDeviceLost();
+	static void OnDeviceRestored(ID3D12Device* device);
+
+	//VOg
+	static TextureCache& Get(ID3D12Device* device = nullptr);
+
+private:
+	struct Entry {
+		ComPtr<ID3D12Resource> resource;
+		size_t                 size;
+	};
+
+	typedef std::pair<std::wstring, unsigned int> Key;
+
+	Key MakeKey(const std::wstring& fileName, WIC_LOADER_FLAGS flags) const;
+	void Add(const Key& key, ID3D12Resource* resource);
+
+	//! (KpX, ǂݍ݃tO)  eNX`
+	std::map<Key, Entry> m_entries;
+
+	ID3D12Device* m_device;
+	Statistics    m_statistics;
+
+	mutable std::mutex m_mutex;
+};
@@ -0,0 +1,350 @@
+/**
+ * @file TextureResidency.cpp
+ * @brief eNX`̏풓Ǘ(ʏ̑傫ǂރ~bv߁A\Z𒴂dvx̒Ⴂ̂痎Ƃ)
+ * @author hoshi hirofumi
+ * @date 2026/10/19
+ */
+
+#include "TextureResidency.h"
+
+#include <algorithm>
+#include <cmath>
+#include <limits>
+
+TextureResidency::Handle& TextureResidency::Handle::operator= (Handle&& other) noexcept
+{
+	if (this != &other) {
+		Reset();
+		m_owner = other.m_owner;
+		m_id    = other.m_id;
+		other.m_owner = nullptr;
+		other.m_id    = INVALID_ID;
+	}
+	return *this;
+}
+
+void TextureResidency::Handle::Reset()
+{
+	if (m_owner && m_id != INVALID_ID)
+		m_owner->Release(m_id);
+	m_owner = nullptr;
+	m_id    = INVALID_ID;
+}
+
+TextureResidency::TextureResidency(size_t budget) : m_frame(0), m_budget(budget), m_statistics{}
+{
+}
+
+/**
+	@brief	eNX`̓o^
+	@param	key KpX(eNX`gfmŋL)
+*/
+TextureResidency::Handle TextureResidency::Register(const std::wstring& key)
+{
+	auto it = m_ids.find(key);
+	if (it != m_ids.end()) {
+		++m_entries[it->second].refCount;
+		return Handle(this, it->second);
+	}
+
+	Id id;
+	if (!m_freeIds.empty()) {
+		id = m_freeIds.back();
+		m_freeIds.pop_back();
+	}
+	else {
+		id = static_cast<Id>(m_entries.size());
+		m_entries.emplace_back();
+	}
+
+	auto& entry = m_entries[id];
+	entry = Entry{};
+	entry.key      = key;
+	entry.refCount = 1;
+	m_ids.emplace(key, id);
+	++m_statistics.registered;
+	return Handle(this, id);
+}
+
+void TextureResidency::Release(Id id)
+{
+	auto& entry = m_entries[id];
+	if (--entry.refCount > 0)
+		return;
+
+	if (!entry.needed)
+		++m_statistics.neverNeeded;
+
+	m_ids.erase(entry.key);
+	entry = Entry{};
+	m_freeIds.push_back(id);
+}
+
+/**
+	@brief	̉𑜓x̐ݒ(~bve[͂Ƃ)
+*/
+void TextureResidency::SetDescription(Id id, const Description& description)
+{
+	auto& entry = m_entries[id];
+	if (entry.described)
+		return;
+
+	entry.described     = true;
+	entry.description   = description;
+	entry.targetLevel   = TailLevel(description);
+	entry.residentLevel = description.mipCount;
+}
+
+void TextureResidency::Request(Id id, float screenSize)
+{
+	auto& entry = m_entries[id];
+	entry.screenSize = std::max(entry.screenSize, screenSize);
+	entry.needed     = true;
+}
+
+/**
+	@brief	ڕW̃~bv̍XV
+	@note	ʏőĂȂ̂珇ɏグA\Z𒴂镪͏dvx̒Ⴂ̂ċ󂯂
+*/
+void TextureResidency::Update()
+{
+	++m_frame;
+
+	struct Candidate {
+		Id       id;
+		uint32_t level;
+		float    priority;
+	};
+	std::vector<Candidate> candidates;
+
+	size_t totalBytes = 0;
+	for (Id id = 0; id < m_entries.size(); ++id) {
+		auto& entry = m_entries[id];
+		if (entry.refCount == 0)
+			continue;
+
+		if (entry.screenSize > 0.0f) {
+			entry.importance    = entry.screenSize;
+			entry.lastUsedFrame = m_frame;
+		}
+		else {
+			entry.importance *= IMPORTANCE_DECAY;
+		}
+
+		if (entry.described && !entry.failed && !entry.loading && entry.screenSize > 0.0f) {
+			const uint32_t level = LevelForScreenSize(entry.description, entry.screenSize);
+			if (level < entry.targetLevel) {
+				//Ȃ~bvقǐ
+				const float shortfall = static_cast<float>(1u << std::min(entry.targetLevel - level, 16u));
+				candidates.push_back({ id, level, entry.importance * shortfall });
+			}
+		}
+
+		entry.screenSize = 0.0f;
+		totalBytes += PlannedBytes(entry);
+	}
+
+	//\ZꂽƂ͌Ă̂Ƃ
+	while (totalBytes > m_budget && EvictOne(totalBytes, std::numeric_limits<float>::infinity()))
+		;
+
+	std::sort(candidates.begin(), candidates.end(), [](const Candidate& a, const Candidate& b) {
+		return a.priority > b.priority;
+	});
+
+	size_t loads = 0;
+	bool overBudget = false;
+	for (const auto& candidate : candidates) {
+		if (loads >= MAX_LOADS_PER_FRAME)
+			break;
+
+		auto& entry = m_entries[candidate.id];
+		const size_t current = BytesFromLevel(entry.description, entry.targetLevel);
+		const size_t extra   = BytesFromLevel(entry.description, candidate.level) - current;
+
+		//dvx̒Ⴂ̂𗎂Ƃ
+		while (totalBytes + extra > m_budget && EvictOne(totalBytes, entry.importance))
+			;
+		if (totalBytes + extra > m_budget) {
+			//̂Ȃ邩Ȃ̂ő
+			overBudget = true;
+			continue;
+		}
+
+		entry.targetLevel = candidate.level;
+		entry.loading     = entry.targetLevel != entry.residentLevel;
+		totalBytes += extra;
+		++m_statistics.loads;
+		++loads;
+	}
+	if (overBudget)
+		++m_statistics.overBudgetFrames;
+}
+
+/**
+	@brief	ǂݍނׂőTCY
+	@return	0͌̉𑜓x(TextureCacheƋLł)Ả𑜓xȂTAIL_SIZE
+*/
+uint32_t TextureResidency::TargetSize(Id id) const
+{
+	const auto& entry = m_entries[id];
+	if (!entry.described)
+		return TAIL_SIZE;
+	if (entry.targetLevel == 0)
+		return 0;
+	return SizeOfLevel(entry.description, entry.targetLevel);
+}
+
+/**
+	@brief	ǂݍ݂̊
+	@param	size ǂݍ񂾃eNX`̑傫̕
+*/
+void TextureResidency::Complete(Id id, uint32_t size)
+{
+	auto& entry = m_entries[id];
+	if (!entry.described)
+		return;
+
+	uint32_t level = 0;
+	if (size != 0) {
+		while (level + 1 < entry.description.mipCount && SizeOfLevel(entry.description, level) > size)
+			++level;
+	}
+	entry.residentLevel = level;
+
+	//񂾂傫̂͂(WICœǂ񂾂̂ȂǁAr̃~bvǂ߂Ȃ)
+	if (level < entry.targetLevel) {
+		entry.targetLevel = level;
+		entry.failed      = true;
+	}
+	entry.loading = entry.residentLevel != entry.targetLevel;
+}
+
+/**
+	@brief	ǂݍ݂̎s(Ȍ͉𑜓xςȂ)
+*/
+void TextureResidency::Failed(Id id)
+{
+	auto& entry = m_entries[id];
+	entry.failed  = true;
+	entry.loading = false;
+}
+
+TextureResidency::Statistics TextureResidency::GetStatistics() const
+{
+	auto statistics = m_statistics;
+	statistics.textures      = m_ids.size();
+	statistics.residentBytes = 0;
+	for (const auto& entry : m_entries) {
+		if (entry.refCount == 0)
+			continue;
+		statistics.residentBytes += PlannedBytes(entry);
+		if (!entry.needed)
+			++statistics.neverNeeded;
+	}
+	statistics.budget = m_budget;
+	return statistics;
+}
+
+/**
+	@brief	ʏ̑傫ɑŏʃ~bv
+*/
+uint32_t TextureResidency::LevelForScreenSize(const Description& description, float screenSize)
+{
+	const uint32_t lastLevel = description.mipCount - 1;
+	if (screenSize <= 0.0f)
+		return lastLevel;
+
+	const float size = static_cast<float>(std::max(description.width, description.height));
+	if (screenSize >= size)
+		return 0;
+
+	const auto level = static_cast<uint32_t>(std::floor(std::log2(size / screenSize)));
+	return std::min(level, lastLevel);
+}
+
+/**
+	@brief	~bve[̐擪(TAIL_SIZEȉɂȂŏ̃~bv)
+*/
+uint32_t TextureResidency::TailLevel(const Description& description)
+{
+	uint32_t level = 0;
+	while (level + 1 < description.mipCount && SizeOfLevel(description, level) > TAIL_SIZE)
+		++level;
+	return level;
+}
+
+uint32_t TextureResidency::SizeOfLevel(const Description& description, uint32_t level)
+{
+	return std::max(1u, std::max(description.width, description.height) >> level);
+}
+
+/**
+	@brief	level疖܂ł̃~bv̍vTCY
+*/
+size_t TextureResidency::BytesFromLevel(const Description& description, uint32_t level)
+{
+	size_t bytes = 0;
+	for (uint32_t i = level; i < description.mipCount; ++i) {
+		const size_t width  = std::max(1u, description.width >> i);
+		const size_t height = std::max(1u, description.height >> i);
+		if (description.blockCompressed)
+			bytes += ((width + 3) / 4) * ((height + 3) / 4) * description.bitsPerPixel * 2;
+		else
+			bytes += width * height * description.bitsPerPixel / 8;
+	}
+	return bytes;
+}
+
+/**
+	@brief	\ŽvZɎgTCY(ڕW̃~bv܂œǂ񂾂Ƃ)
+	@note	ǂݍݒ͌Â~bvcĂ̂ňꎞIɗ\Z𒴂邱Ƃ
+*/
+size_t TextureResidency::PlannedBytes(const Entry& entry) const
+{
+	if (!entry.described)
+		return 0;
+	return BytesFromLevel(entry.description, entry.targetLevel);
+}
+
+/**
+	@brief	dvẍԒႢ̂1iƂ
+	@param	protectImportance ȏ̏dvx̂̂͗ƂȂ
+	@return	Ƃ̂
+	@note	̃t[ŌĂ̂1iAĂȂ̂̓~bve[܂ŗƂ
+*/
+bool TextureResidency::EvictOne(size_t& totalBytes, float protectImportance)
+{
+	Entry* victim = nullptr;
+	for (auto& entry : m_entries) {
+		if (entry.refCount == 0 || !entry.described || entry.failed || entry.loading)
+			continue;
+		if (entry.targetLevel >= TailLevel(entry.description) || entry.importance >= protectImportance)
+			continue;
+		if (victim == nullptr || entry.importance < victim->importance ||
+			(entry.importance == victim->importance && entry.lastUsedFrame < victim->lastUsedFrame))
+			victim = &entry;
+	}
+	if (victim == nullptr)
+		return false;
+
+	const size_t before = BytesFromLevel(victim->description, victim->targetLevel);
+	if (victim->lastUsedFrame == m_frame)
+		++victim->targetLevel;
+	else
+		victim->targetLevel = TailLevel(victim->description);
+
+	totalBytes -= before - BytesFromLevel(victim->description, victim->targetLevel);
+	victim->loading = victim->targetLevel != victim->residentLevel;
+	++m_statistics.evictions;
+	return true;
+}
+
+/**
+	@brief	Sfʂ̃CX^X
+*/
+TextureResidency& TextureResidency::Get()
+{
+	static TextureResidency instance;
+	return instance;
+}
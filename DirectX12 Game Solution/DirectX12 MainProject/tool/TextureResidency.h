@@ -0,0 +1,156 @@
+/**
+ * @file TextureResidency.h
+ * @brief eNX`̏풓Ǘ(ʏ̑傫ǂރ~bv߁A\Z𒴂dvx̒Ⴂ̂痎Ƃ)
+ * @author hoshi hirofumi
+ * @date 2026/10/19
+ * @note DxƗ\ŽvZȂ̂D3D12ɂ͈ˑȂ(ǂݍ݂TextureStreamerAւPmxLoader)
+ */
+
+#pragma once
+
+/*
+-------------------------------------------------------------------------------------
+	CN[h
+-------------------------------------------------------------------------------------
+*/
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+/*
+-------------------------------------------------------------------------------------
+	TextureResidencyNX@錾
+-------------------------------------------------------------------------------------
+*/
+class TextureResidency {
+public:
+	typedef uint32_t Id;
+	static constexpr Id INVALID_ID = UINT32_MAX;
+
+	//! ŏɓǂރ~bv̑傫(ȉ̃~bvS = ~bve[)
+	static constexpr uint32_t TAIL_SIZE = 64;
+	//! \Z̏l
+	static constexpr size_t DEFAULT_BUDGET = 256 * 1024 * 1024;
+	//! 1t[ɉ𑜓xグeNX`̐
+	static constexpr size_t MAX_LOADS_PER_FRAME = 4;
+	//! ʂɉfȂt[̏dvx̌
+	static constexpr float IMPORTANCE_DECAY = 0.9f;
+
+	//! ̉𑜓x(ŏ̓ǂݍ݂I܂ŕȂ)
+	struct Description {
+		uint32_t width;
+		uint32_t height;
+		uint32_t mipCount;
+		uint32_t bitsPerPixel;
+		bool     blockCompressed;	//4x4ubNP(BC1/BC3)
+	};
+
+	struct Statistics {
+		size_t textures;			//o^̃eNX`
+		size_t residentBytes;		//ڕW̃~bv܂œǂ񂾂Ƃ̍v
+		size_t budget;
+		size_t loads;				//𑜓xグ
+		size_t evictions;			//\Ẑ߂ɉ𑜓x
+		size_t overBudgetFrames;	//Ƃ̂𑜓xグȂt[
+		size_t registered;			//܂łɓo^eNX`(̂܂)
+		size_t neverNeeded;			//xʂɉf炸ǂ܂ɍς񂾃eNX`()
+	};
+
+	//! o^̉YȂ߂̃nh(DescriptorRangeƓ[û)
+	class Handle {
+	public:
+		Handle() : m_owner(nullptr), m_id(INVALID_ID) {}
+		Handle(TextureResidency* owner, Id id) : m_owner(owner), m_id(id) {}
+		~Handle() { Reset(); }
+
+		Handle(Handle&& other) noexcept : m_owner(other.m_owner), m_id(other.m_id) { other.m_owner = nullptr; other.m_id = INVALID_ID; }
+		Handle& operator= (Handle&& other) noexcept;
+
+		Handle(Handle const&) = delete;
+		Handle& operator= (Handle const&) = delete;
+
+		Id Get() const { return m_id; }
+		explicit operator bool() const { return m_id != INVALID_ID; }
+		void Reset();
+
+	private:
+		TextureResidency* m_owner;
+		Id                m_id;
+	};
+
+	explicit TextureResidency(size_t budget = DEFAULT_BUDGET);
+	virtual ~TextureResidency() {}
+
+	TextureResidency(TextureResidency&&) = delete;
+	TextureResidency& operator= (TextureResidency&&) = delete;
+
+	TextureResidency(TextureResidency const&) = delete;
+	TextureResidency& operator= (TextureResidency const&) = delete;
+
+	//L[(KpX)͓IdԂ
+	Handle Register(const std::wstring& key);
+
+	//ŏ̓ǂݍ݂IƂɌ̉𑜓x
+	void SetDescription(Id id, const Description& description);
+	bool IsDescribed(Id id) const { return m_entries[id].described; }
+
+	//̃t[̉ʏ̑傫(sNZAĂ΂ꂽ傫)
+	void Request(Id id, float screenSize);
+
+	//xłEǂ݂𗊂܂ꂽeNX`ǂݍ
+	void MarkNeeded(Id id) { m_entries[id].needed = true; }
+	bool IsNeeded(Id id) const { return m_entries[id].needed; }
+
+	//t[̊JnɌĂ(Ot[RequestڕW̃~bvߒ)
+	void Update();
+
+	//ǂݍނׂőTCY(0͌̉𑜓x)
+	uint32_t TargetSize(Id id) const;
+
+	//ǂݍ݂I(sizeTargetSizeŎ󂯎l)
+	void Complete(Id id, uint32_t size);
+	void Failed(Id id);
+
+	void SetBudget(size_t bytes) { m_budget = bytes; }
+	size_t GetBudget() const { return m_budget; }
+	Statistics GetStatistics() const;
+
+	//vZp
+	static uint32_t LevelForScreenSize(const Description& description, float screenSize);
+	static uint32_t TailLevel(const Description& description);
+	static uint32_t SizeOfLevel(const Description& description, uint32_t level);
+	static size_t   BytesFromLevel(const Description& description, uint32_t level);
+
+	//VOg(CXbhp)
+	static TextureResidency& Get();
+
+private:
+	struct Entry {
+		std::wstring key;
+		uint32_t     refCount;
+		bool         described;
+		bool         failed;
+		bool         loading;			//ڕWςĂǂݍ݊҂
+		bool         needed;			//xł
+		Description  description;
+		uint32_t     residentLevel;		//ǂݍݍς݂̍ŏʃ~bv
+		uint32_t     targetLevel;		//ǂݍލŏʃ~bv
+		float        screenSize;		//̃t[̉ʏ̑傫
+		float        importance;		//ʏ̑傫(fȂt[͌)
+		uint64_t     lastUsedFrame;
+	};
+
+	void Release(Id id);
+	size_t PlannedBytes(const Entry& entry) const;
+	bool EvictOne(size_t& totalBytes, float protectImportance);
+
+	std::vector<Entry>                   m_entries;
+	std::vector<Id>                      m_freeIds;
+	std::unordered_map<std::wstring, Id> m_ids;
+
+	uint64_t   m_frame;
+	size_t     m_budget;
+	Statistics m_statistics;
+};
@@ -0,0 +1,238 @@
+/**
+ * @file TextureResidencyReplay.cpp
+ * @brief TextureResidencyJ̌oHōĐĊm߂(R}hCAQ[{̂̃vWFNgɂ͊܂߂Ȃ)
+ * @author hoshi hirofumi
+ * @date 2026/10/19
+ * @note TextureResidencyReplay check                               \Z̑召Eǂݍ݂̒xςčĐAʂm߂
+ *       TextureResidencyReplay run [budgetMB] [frames] [latency]    1Đēv\
+ *       GPUt@Cg킸APmxLoaderƓ(Update  ǂݍ݂̔s    Request)ŌĂ
+ */
+
+#include "TextureResidency.h"
+#include "TestCheck.h"
+
+#include <algorithm>
+#include <cmath>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <string>
+#include <vector>
+
+namespace {
+	//! (PmxLoader::MaterialScreenSizesƓeAc1080sNZEc̉p60x)
+	const float PIXEL_SCALE = 1080.0f / (2.0f * std::tan(3.14159265f / 6.0f));
+	const float VIEW_COS    = 0.7f;
+
+	//! ʘH̗ɕׂ(ꂼʂ̃eNX`)ƁAʘH猩Ȃ̕
+	struct Object {
+		float                          x, z, radius;
+		TextureResidency::Description  description;
+		TextureResidency::Handle       handle;
+	};
+
+	//! TextureStreameȓ(latencyt[ɗ񂾑傫œ͂)
+	struct Stream {
+		bool     pending;
+		bool     described;
+		uint32_t requested;		//TargetSizeŎ󂯎l(0͌̉𑜓x)
+		uint32_t loaded;		//͂eNX`̑傫̕
+		int      readyFrame;
+	};
+
+	struct Result {
+		size_t peakBytes;
+		size_t budget;
+		size_t undersampledFrames;	//Ă镨̂ǂꂩʂet[
+		size_t undersampled;		//ẻא
+		size_t visible;				//Ẳא
+		size_t endUndersampled;		//~܂̍Ō̃t[őe
+		size_t loadedAboveTail;		//xɃ~bve[ǂ񂾐
+		TextureResidency::Statistics statistics;
+	};
+
+	std::vector<Object> MakeScene(TextureResidency& residency)
+	{
+		std::vector<Object> objects;
+		const uint32_t sizes[] = { 512, 1024, 2048 };
+		for (int i = 0; i < 240; ++i) {
+			Object object{};
+			if (i < 200) {
+				//ʘH(x = 0)̗Az2m
+				object.x = (i % 2 == 0 ? -3.0f : 3.0f) + static_cast<float>(i % 3) * 0.5f;
+				object.z = static_cast<float>(i / 2) * 2.0f;
+			}
+			else {
+				//oȞ(J+zȂ)
+				object.x = static_cast<float>(i - 220) * 2.0f;
+				object.z = -40.0f;
+			}
+			object.radius = 0.5f + static_cast<float>(i % 4) * 0.25f;
+
+			const uint32_t size = sizes[i % 3];
+			object.description.width           = size;
+			object.description.height          = size;
+			object.description.mipCount        = static_cast<uint32_t>(std::log2(size)) + 1;
+			object.description.bitsPerPixel    = 4;
+			object.description.blockCompressed = true;
+			object.handle = residency.Register(L"texture" + std::to_wstring(i) + L".dds");
+			objects.push_back(std::move(object));
+		}
+		return objects;
+	}
+
+	//! J̉ʏ̑傫(Ȃ0)
+	float ScreenSize(const Object& object, float cameraZ)
+	{
+		const float dx = object.x, dz = object.z - cameraZ;
+		const float distance = std::sqrt(dx * dx + dz * dz);
+		if (distance <= object.radius)
+			return 2.0f * object.radius * PIXEL_SCALE;
+		if (dz / distance < VIEW_COS)
+			return 0.0f;
+		return 2.0f * object.radius * PIXEL_SCALE / distance;
+	}
+
+	//! J͒ʘH̑Ői݁AŌ60t[͎~܂
+	Result Replay(size_t budget, int frames, int latency)
+	{
+		TextureResidency residency(budget);
+		auto objects = MakeScene(residency);
+		std::vector<Stream> streams(objects.size(), Stream{});
+		Result result{};
+		result.budget = budget;
+
+		const int moving = std::max(frames - 60, 1);
+		for (int frame = 0; frame < frames; ++frame) {
+			residency.Update();
+			result.peakBytes = std::max(result.peakBytes, residency.GetStatistics().residentBytes);
+
+			//ǂݍ݂̔s(PmxLoader::ApplyStreamedTexturesƓ)
+			for (size_t i = 0; i < objects.size(); ++i) {
+				const auto id = objects[i].handle.Get();
+				auto& stream = streams[i];
+				if (stream.pending)
+					continue;
+				if (stream.described ? residency.TargetSize(id) != stream.requested : residency.IsNeeded(id)) {
+					stream.requested  = residency.TargetSize(id);
+					stream.pending    = true;
+					stream.readyFrame = frame + latency;
+				}
+			}
+
+			//(ŏ̓~bve[ƈꏏɌ̉𑜓x)
+			for (size_t i = 0; i < objects.size(); ++i) {
+				const auto id = objects[i].handle.Get();
+				auto& stream = streams[i];
+				if (!stream.pending || frame < stream.readyFrame)
+					continue;
+				const auto& description = objects[i].description;
+				stream.loaded  = stream.requested == 0 ? std::max(description.width, description.height) : stream.requested;
+				stream.pending = false;
+				if (!stream.described) {
+					residency.SetDescription(id, description);
+					stream.described = true;
+				}
+				residency.Complete(id, stream.requested);
+			}
+
+			//`(Ă镨̑傫`AĂ邩𐔂)
+			const float cameraZ = 200.0f * static_cast<float>(std::min(frame, moving)) / static_cast<float>(moving);
+			size_t undersampled = 0;
+			for (size_t i = 0; i < objects.size(); ++i) {
+				const float screenSize = ScreenSize(objects[i], cameraZ);
+				if (screenSize <= 0.0f)
+					continue;
+				residency.Request(objects[i].handle.Get(), screenSize);
+				++result.visible;
+
+				const auto& description = objects[i].description;
+				const uint32_t needed = TextureResidency::SizeOfLevel(description, TextureResidency::LevelForScreenSize(description, screenSize));
+				if (streams[i].loaded < needed)
+					++undersampled;
+			}
+			result.undersampled += undersampled;
+			if (undersampled != 0)
+				++result.undersampledFrames;
+			if (frame == frames - 1)
+				result.endUndersampled = undersampled;
+		}
+
+		for (size_t i = 200; i < objects.size(); ++i)
+			if (streams[i].loaded > TextureResidency::TAIL_SIZE || streams[i].pending)
+				++result.loadedAboveTail;
+		result.statistics = residency.GetStatistics();
+		return result;
+	}
+
+	void Print(const char* name, const Result& result, int frames)
+	{
+		const auto& statistics = result.statistics;
+		printf("%-10s budget %6.1fMB  peak %6.1fMB  loads %5zu  evictions %5zu  over budget %4zu frames\n"
+			"           undersampled %5.1f%% of visible (%zu/%d frames)  at rest %zu  never seen %zu\n",
+			name, result.budget / 1048576.0, result.peakBytes / 1048576.0, statistics.loads, statistics.evictions,
+			statistics.overBudgetFrames, result.visible ? 100.0 * result.undersampled / result.visible : 0.0,
+			result.undersampledFrames, frames, result.endUndersampled, statistics.neverNeeded);
+	}
+
+	int Usage()
+	{
+		fprintf(stderr,
+			"usage: TextureResidencyReplay check\n"
+			"       TextureResidencyReplay run [budgetMB] [frames] [latency]\n");
+		return 2;
+	}
+
+	using TestCheck::Check;
+
+	int CheckAll()
+	{
+		const int frames = 600;
+
+		//S\Z: ~܂ΌĂ镨͑SĂ
+		const auto generous = Replay(1024u * 1048576u, frames, 2);
+		Print("generous", generous, frames);
+		Check(generous.peakBytes <= generous.budget, "generous: planned bytes stay within the budget");
+		Check(generous.endUndersampled == 0, "generous: every visible texture is sharp once the camera stops");
+		Check(generous.statistics.evictions == 0, "generous: nothing is evicted");
+
+		//ʂ̑S͓Ȃ\Z: \ZAɎc痎Ƃ
+		const auto tight = Replay(8u * 1048576u, frames, 2);
+		Print("tight", tight, frames);
+		Check(tight.peakBytes <= tight.budget, "tight: planned bytes stay within the budget");
+		Check(tight.statistics.evictions > 0, "tight: textures left behind are evicted");
+		Check(tight.statistics.loads > 200, "tight: visible textures are still refined");
+		Check(tight.undersampled <= generous.undersampled + generous.undersampled / 20, "tight: evicting what is behind keeps the view as sharp");
+
+		//ǂݍ݂x: eԂт邾ŁA~܂Βǂ
+		const auto slow = Replay(1024u * 1048576u, frames, 20);
+		Print("slow", slow, frames);
+		Check(slow.undersampled >= generous.undersampled, "slow: latency does not reduce undersampling");
+		Check(slow.endUndersampled == 0, "slow: loads catch up once the camera stops");
+
+		//oH猩Ȃ̓~bve[̂܂(ǂ܂ɍς)
+		for (const auto* result : { &generous, &tight, &slow }) {
+			Check(result->loadedAboveTail == 0, "unseen textures never load above the mip tail");
+			Check(result->statistics.neverNeeded >= 40, "unseen textures are counted as never needed");
+		}
+
+		return TestCheck::Finish("TextureResidencyReplay");
+	}
+}
+
+int main(int argc, char* argv[])
+{
+	if (argc < 2)
+		return Usage();
+
+	if (strcmp(argv[1], "check") == 0)
+		return CheckAll();
+	if (strcmp(argv[1], "run") == 0) {
+		const double budget = argc > 2 ? atof(argv[2]) : 256.0;
+		const int    frames = argc > 3 ? std::max(atoi(argv[3]), 1) : 600;
+		const int    latency = argc > 4 ? std::max(atoi(argv[4]), 0) : 2;
+		Print("run", Replay(static_cast<size_t>(budget * 1048576.0), frames, latency), frames);
+		return 0;
+	}
+	return Usage();
+}
@@ -0,0 +1,412 @@
+/**
+ * @file TextureStreamer.cpp
+ * @brief eNX`̔񓯊ǂݍ([J[XbhŃfR[h  t[Jnɂ܂Ƃ߂ăRs[L[)
+ * @author hoshi hirofumi
+ * @date 2026/10/19
+ */
+
+#include "TextureStreamer.h"
+#include "TextureCache.h"
+#include "TextureBaker.h"
+#include "JobSystem.h"
+#include "Profiler.h"
+
+#include <algorithm>
+#include <chrono>
+
+namespace {
+	//! GetōCX^X
+	TextureStreamer* g_instance = nullptr;
+
+	//! DDS̃wb_[猳̉𑜓xǂ(maxsizeœǂݔ΂ƍ쐬ꂽ\[X͕Ȃ)
+	bool ReadDdsSize(const FileView& file, uint32_t& width, uint32_t& height, uint32_t& mipCount)
+	{
+		uint32_t header[8] = {};
+		if (file.Size() < sizeof(header))
+			return false;
+		memcpy(header, file.Data(), sizeof(header));
+		if (header[0] != 0x20534444)	//"DDS "
+			return false;
+
+		height   = header[3];
+		width    = header[4];
+		mipCount = std::max(1u, header[7]);
+		return true;
+	}
+}
+
+TextureStreamer::TextureStreamer(ID3D12Device* device, ID3D12CommandQueue* commandQueue)
+	: m_device(device), m_commandQueue(commandQueue), m_quit(false), m_statistics{}
+{
+	//WuVXeɍ(ÓIȔj͋tȂ̂ŁA炪ɔj)
+	JobSystem::Get();
+	g_instance = this;
+}
+
+/**
+	@note	n܂ĂȂfR[h͓ǂ܂ɏI
+*/
+TextureStreamer::~TextureStreamer()
+{
+	m_quit = true;
+	JobSystem::Get().Wait(m_decoding);
+
+	for (auto& upload : m_uploads)
+		upload.wait();
+	g_instance = nullptr;
+}
+
+/**
+	@brief	eNX`̓ǂݍ݂˗
+	@param	fileName t@C
+	@param	maxSize  傫~bv͓ǂ܂Ȃ(0͑S)
+	@return ǂݍݑ҂̃eNX`(ǂݍݍς݂ȂŏReady)
+*/
+std::shared_ptr<StreamedTexture> TextureStreamer::Request(const std::wstring& fileName, uint32_t maxSize)
+{
+	auto texture = std::make_shared<StreamedTexture>(fileName, maxSize);
+
+	ComPtr<ID3D12Resource> resource;
+	if (maxSize == 0 && (resource = TextureCache::Get().Find(fileName)) != nullptr) {
+		const auto desc = resource->GetDesc();
+		texture->m_resource     = resource;
+		texture->m_state        = StreamedTexture::State::Ready;
+		texture->m_fullWidth    = static_cast<uint32_t>(desc.Width);
+		texture->m_fullHeight   = desc.Height;
+		texture->m_fullMipCount = desc.MipLevels;
+
+		std::lock_guard<std::mutex> lock(m_mutex);
+		++m_statistics.requests;
+		++m_statistics.cacheHits;
+		return texture;
+	}
+
+	const auto key = PendingKey(fileName, maxSize);
+	{
+		std::lock_guard<std::mutex> lock(m_mutex);
+		++m_statistics.requests;
+
+		//ǂݍݒ̃t@Ĉ͓Ԃ
+		auto it = m_pending.find(key);
+		if (it != m_pending.end())
+			return it->second;
+
+		m_pending.emplace(key, texture);
+	}
+
+	JobSystem::Get().Run([this, texture]() { Decode(texture); }, &m_decoding, JobSystem::Priority::Background);
+	return texture;
+}
+
+/**
+	@brief	fR[hIeNX`Abv[h
+	@note	Rs[L[œ]AmFłt[Readyɂ(`͑҂Ȃ)
+*/
+void TextureStreamer::Update()
+{
+	PROFILE_ZONE("Texture::Update");
+	//Abv[ȟn
+	m_uploads.erase(std::remove_if(m_uploads.begin(), m_uploads.end(), [](std::future<void>& upload) {
+		return upload.wait_for(std::chrono::seconds(0)) == std::future_status::ready;
+	}), m_uploads.end());
+
+	auto& uploadQueue = UploadQueue::Get();
+	std::vector<std::shared_ptr<StreamedTexture>> finished;
+	for (auto it = m_copying.begin(); it != m_copying.end();) {
+		if (!uploadQueue.IsComplete(it->token)) {
+			++it;
+			continue;
+		}
+		if (it->share)
+			TextureCache::Get().Insert(it->texture->m_fileName, it->texture->m_resource.Get());
+		it->texture->m_state = StreamedTexture::State::Ready;
+		finished.push_back(std::move(it->texture));
+		it = m_copying.erase(it);
+	}
+	if (!finished.empty()) {
+		std::lock_guard<std::mutex> lock(m_mutex);
+		for (const auto& texture : finished)
+			m_pending.erase(PendingKey(texture->m_fileName, texture->m_maxSize));
+	}
+
+	//\Z̕o(傫1͗\Z𒴂Ă1͒ʂ)
+	std::vector<Decoded> decoded;
+	{
+		std::lock_guard<std::mutex> lock(m_mutex);
+		size_t bytes = 0;
+		while (!m_decoded.empty() && (decoded.empty() || bytes + m_decoded.front().UploadSize() <= UPLOAD_BUDGET)) {
+			bytes += m_decoded.front().UploadSize();
+			decoded.push_back(std::move(m_decoded.front()));
+			m_decoded.pop_front();
+		}
+	}
+	if (decoded.empty())
+		return;
+
+	//WICœǂނ̂͒ڃR}hL[ɐς
+	std::unique_ptr<ResourceUploadBatch> fallbackUpload;
+
+	size_t wicFallbacks = 0, failed = 0, bytesUploaded = 0;
+	for (auto& item : decoded) {
+		auto& texture = *item.texture;
+		try {
+			UploadQueue::Token token = 0;
+			if (item.baked) {
+				token = uploadQueue.UploadTexture(item.baked.Get(), 0, item.subresources.data(), static_cast<UINT>(item.subresources.size()));
+				texture.m_resource = item.baked;
+				bytesUploaded += item.UploadSize();
+			}
+			else if (item.result == ImageDecoder::Result::Ok) {
+				texture.m_resource = CreateTexture(item.image, token);
+				bytesUploaded += item.image.SizeInBytes();
+			}
+			else {
+				//JPEGȂǂWICœǂ(CXbhœAr̃~bv͓ǂ߂Ȃ̂ŏɑS)
+				if (!fallbackUpload) {
+					fallbackUpload = std::make_unique<ResourceUploadBatch>(m_device);
+					fallbackUpload->Begin();
+				}
+				texture.m_resource = TextureCache::Get().Load(texture.m_fileName, *fallbackUpload);
+				const auto desc = texture.m_resource->GetDesc();
+				item.fullWidth    = static_cast<uint32_t>(desc.Width);
+				item.fullHeight   = desc.Height;
+				item.fullMipCount = desc.MipLevels;
+				++wicFallbacks;
+			}
+
+			texture.m_fullWidth    = item.fullWidth;
+			texture.m_fullHeight   = item.fullHeight;
+			texture.m_fullMipCount = item.fullMipCount;
+
+			if (item.result == ImageDecoder::Result::Ok) {
+				//ʂ̃~bvǂݔ΂̂͋LȂ
+				m_copying.push_back({ item.texture, token, texture.m_maxSize == 0 });
+				item.texture.reset();
+			}
+			else {
+				texture.m_state = StreamedTexture::State::Ready;
+			}
+		}
+		catch (const std::exception&) {
+			OutputDebugString(TEXT("TextureStreamer: failed to load texture.\n"));
+			texture.m_state = StreamedTexture::State::Failed;
+			++failed;
+		}
+	}
+
+	if (fallbackUpload)
+		m_uploads.push_back(fallbackUpload->End(m_commandQueue));
+
+	//Rs[L[ɉ񂵂̂͊ĂꗗO
+	std::lock_guard<std::mutex> lock(m_mutex);
+	for (auto& item : decoded) {
+		if (item.texture)
+			m_pending.erase(PendingKey(item.texture->m_fileName, item.texture->m_maxSize));
+	}
+	m_statistics.wicFallbacks  += wicFallbacks;
+	m_statistics.failed        += failed;
+	m_statistics.bytesUploaded += bytesUploaded;
+}
+
+/**
+	@brief	ǂݍݒ̃eNX`
+*/
+bool TextureStreamer::IsIdle() const
+{
+	std::lock_guard<std::mutex> lock(m_mutex);
+	return m_pending.empty();
+}
+
+TextureStreamer::Statistics TextureStreamer::GetStatistics() const
+{
+	std::lock_guard<std::mutex> lock(m_mutex);
+	return m_statistics;
+}
+
+/**
+	@brief	ǂݍݑÕeNX`̑
+	@note	ŏɌĂ΂ꂽƂɍ
+*/
+ID3D12Resource* TextureStreamer::Placeholder()
+{
+	if (m_placeholder == nullptr) {
+		DecodedImage image;
+		image.levels.push_back({ 1, 1, std::vector<uint8_t>(4, 255) });
+
+		UploadQueue::Token token;
+		m_placeholder = CreateTexture(image, token);
+		UploadQueue::Get().Wait(token);
+	}
+	return m_placeholder.Get();
+}
+
+/**
+	@brief	fR[h(WuVXẽ[J[Ŏs)
+*/
+void TextureStreamer::Decode(const std::shared_ptr<StreamedTexture>& texture)
+{
+	PROFILE_ZONE("Texture::Decode");
+	if (m_quit)
+		return;
+
+	const auto start = std::chrono::steady_clock::now();
+
+	Decoded item{};
+	item.texture = texture;
+
+	//t@CVDDS΂ǂ(kς݁E~bv݁A}bv܂܉͂ăRs[Ȃ)
+	std::wstring baked;
+	if (TextureBaker::FindBaked(texture->FileName(), baked) &&
+		(item.ddsFile = AssetFiles::Get().Open(baked)) &&
+		ReadDdsSize(item.ddsFile, item.fullWidth, item.fullHeight, item.fullMipCount) &&
+		SUCCEEDED(LoadDDSTextureFromMemoryEx(m_device, item.ddsFile.Data(), item.ddsFile.Size(), texture->MaxSize(),
+			D3D12_RESOURCE_FLAG_NONE, DDS_LOADER_DEFAULT, item.baked.GetAddressOf(), item.subresources))) {
+		item.result = ImageDecoder::Result::Ok;
+	}
+	else {
+		item.baked.Reset();
+		item.ddsFile = FileView();
+		item.result = ImageDecoder::DecodeFile(texture->FileName(), item.image);
+		if (item.result == ImageDecoder::Result::Ok) {
+			item.fullWidth    = item.image.Width();
+			item.fullHeight   = item.image.Height();
+			item.fullMipCount = static_cast<uint32_t>(item.image.levels.size());
+
+			//maxSize傫~bv̂Ă(Ō1͎c)
+			const uint32_t maxSize = texture->MaxSize();
+			size_t skip = 0;
+			while (maxSize != 0 && skip + 1 < item.image.levels.size() &&
+				std::max(item.image.levels[skip].width, item.image.levels[skip].height) > maxSize)
+				++skip;
+			item.image.levels.erase(item.image.levels.begin(), item.image.levels.begin() + skip);
+		}
+	}
+
+	const double ms = std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - start).count();
+
+	std::lock_guard<std::mutex> lock(m_mutex);
+	if (item.baked) {
+		++m_statistics.bakedLoads;
+	}
+	else if (item.result == ImageDecoder::Result::Ok) {
+		++m_statistics.decoded;
+		m_statistics.decodeMs += ms;
+	}
+	m_decoded.push_back(std::move(item));
+}
+
+/**
+	@brief	ǂݍݒ̈ꗗ̃L[
+*/
+std::wstring TextureStreamer::PendingKey(const std::wstring& fileName, uint32_t maxSize)
+{
+	return TextureCache::NormalizePath(fileName) + L"|" + std::to_wstring(maxSize);
+}
+
+/**
+	@brief	Abv[h(\ŽvZp)
+*/
+size_t TextureStreamer::Decoded::UploadSize() const
+{
+	if (!baked)
+		return image.SizeInBytes();
+
+	size_t size = 0;
+	for (const auto& subresource : subresources)
+		size += static_cast<size_t>(subresource.SlicePitch);
+	return size;
+}
+
+/**
+	@brief	fR[hς݂̃~bv`F[eNX`
+	@param	token Rs[̊̊mFp
+*/
+ComPtr<ID3D12Resource> TextureStreamer::CreateTexture(const DecodedImage& image, UploadQueue::Token& token)
+{
+	const auto desc = CD3DX12_RESOURCE_DESC::Tex2D(
+		DXGI_FORMAT_R8G8B8A8_UNORM,
+		image.Width(), image.Height(),
+		1, static_cast<UINT16>(image.levels.size())
+	);
+	const CD3DX12_HEAP_PROPERTIES heapProperties(D3D12_HEAP_TYPE_DEFAULT);
+
+	ComPtr<ID3D12Resource> resource;
+	DX::ThrowIfFailed(m_device->CreateCommittedResource(
+		&heapProperties,
+		D3D12_HEAP_FLAG_NONE,
+		&desc,
+		D3D12_RESOURCE_STATE_COMMON,
+		nullptr,
+		IID_PPV_ARGS(resource.GetAddressOf())
+	));
+
+	std::vector<D3D12_SUBRESOURCE_DATA> subresources(image.levels.size());
+	for (size_t i = 0; i < image.levels.size(); ++i) {
+		const auto& level = image.levels[i];
+		subresources[i].pData      = level.pixels.data();
+		subresources[i].RowPitch   = static_cast<LONG_PTR>(level.width) * 4;
+		subresources[i].SlicePitch = subresources[i].RowPitch * level.height;
+	}
+
+	//Rs[L[̌COMMONɖ߂̂ŁA`ŎgƂPIXEL_SHADER_RESOURCEֈÖقɏi
+	token = UploadQueue::Get().UploadTexture(resource.Get(), 0, subresources.data(), static_cast<UINT>(subresources.size()));
+	return resource;
+}
+
+/**
+	@brief	foCX̏(ǂݍݒ̂̂͑SFailedɂĎ)
+	@note	CXbhĂ(StreamedTexturȅԂς邽)AgLoadAssetsň˗
+*/
+void TextureStreamer::OnDeviceLost()
+{
+	if (g_instance == nullptr)
+		return;
+
+	auto& streamer = *g_instance;
+	streamer.m_quit = true;
+	JobSystem::Get().Wait(streamer.m_decoding);
+	for (auto& upload : streamer.m_uploads)
+		upload.wait();
+	streamer.m_uploads.clear();
+
+	auto fail = [](StreamedTexture& texture) {
+		texture.m_resource.Reset();
+		texture.m_state = StreamedTexture::State::Failed;
+	};
+	for (auto& copying : streamer.m_copying)
+		fail(*copying.texture);
+	streamer.m_copying.clear();
+
+	std::lock_guard<std::mutex> lock(streamer.m_mutex);
+	for (auto& item : streamer.m_decoded)
+		fail(*item.texture);
+	streamer.m_decoded.clear();
+	for (auto& pending : streamer.m_pending) {
+		if (pending.second->m_state == StreamedTexture::State::Pending)
+			fail(*pending.second);
+	}
+	streamer.m_pending.clear();
+
+	streamer.m_placeholder.Reset();
+	streamer.m_device       = nullptr;
+	streamer.m_commandQueue = nullptr;
+	streamer.m_quit         = false;
+}
+
+void TextureStreamer::OnDeviceRestored(ID3D12Device* device, ID3D12CommandQueue* commandQueue)
+{
+	if (g_instance == nullptr)
+		return;
+
+	g_instance->m_device       = device;
+	g_instance->m_commandQueue = commandQueue;
+}
+
+/**
+	@brief	Sfʂ̃CX^X
+*/
+TextureStreamer& TextureStreamer::Get()
+{
+	static TextureStreamer instance(DXTK->Device, DXTK->CommandQueue);
+	return instance;
+}
@@ -0,0 +1,181 @@
+/**
+ * @file TextureStreamer.h
+ * @brief eNX`̔񓯊ǂݍ([J[XbhŃfR[h  t[Jnɂ܂Ƃ߂ăRs[L[)
+ * @author hoshi hirofumi
+ * @date 2026/10/19
+ */
+
+#pragma once
+
+/*
+-------------------------------------------------------------------------------------
+	CN[h
+-------------------------------------------------------------------------------------
+*/
+#include "Base/pch.h"
+#include "Base/dxtk.h"
+#include "ImageDecoder.h"
+#include "UploadQueue.h"
+#include "AssetFiles.h"
+#include "JobSystem.h"
+
+#include <atomic>
+#include <deque>
+#include <future>
+#include <mutex>
+#include <unordered_map>
+
+/*
+-------------------------------------------------------------------------------------
+	using
+-------------------------------------------------------------------------------------
+*/
+using Microsoft::WRL::ComPtr;
+using std::unique_ptr;
+using std::make_unique;
+using namespace DirectX;
+
+/*
+-------------------------------------------------------------------------------------
+	StreamedTexture@ǂݍݑ҂̃eNX`
+-------------------------------------------------------------------------------------
+*/
+class StreamedTexture {
+public:
+	enum class State {
+		Pending,	//fR[hEAbv[h
+		Ready,		//g
+		Failed		//ǂݍ߂Ȃ
+	};
+
+	explicit StreamedTexture(const std::wstring& fileName, uint32_t maxSize = 0)
+		: m_fileName(fileName), m_maxSize(maxSize), m_state(State::Pending), m_fullWidth(0), m_fullHeight(0), m_fullMipCount(0) {}
+
+	//Ԃ̓CXbh(TextureStreamer::Update)łς
+	State GetState() const { return m_state; }
+	bool  IsReady() const { return m_state == State::Ready; }
+	bool  IsDone() const { return m_state != State::Pending; }
+
+	ID3D12Resource*     Resource() const { return m_resource.Get(); }
+	const std::wstring& FileName() const { return m_fileName; }
+	uint32_t            MaxSize() const { return m_maxSize; }
+
+	//t@Č̉𑜓x(MaxSizeŏʂ̃~bvǂݔ΂ĂĂ̒l)
+	uint32_t FullWidth() const { return m_fullWidth; }
+	uint32_t FullHeight() const { return m_fullHeight; }
+	uint32_t FullMipCount() const { return m_fullMipCount; }
+
+private:
+	friend class TextureStreamer;
+
+	std::wstring           m_fileName;
+	uint32_t               m_maxSize;
+	ComPtr<ID3D12Resource> m_resource;
+	State                  m_state;
+	uint32_t               m_fullWidth;
+	uint32_t               m_fullHeight;
+	uint32_t               m_fullMipCount;
+};
+
+/*
+-------------------------------------------------------------------------------------
+	TextureStreamerNX@錾
+-------------------------------------------------------------------------------------
+*/
+class TextureStreamer {
+public:
+	//! 1t[ɃAbv[hʂ̖ڈ(͎̃t[)
+	static constexpr size_t UPLOAD_BUDGET = 32 * 1024 * 1024;
+
+	struct Statistics {
+		size_t requests;		//Request̉
+		size_t cacheHits;		//TextureCacheɂ
+		size_t decoded;			//[J[ŃfR[h
+		size_t bakedLoads;		//ĂDDSǂ񂾐(TextureBaker)
+		size_t wicFallbacks;	//[J[ňWICœǂ񂾐(JPEGȂ)
+		size_t failed;			//ǂݍ߂Ȃ
+		size_t bytesUploaded;	//Abv[h~bv̍v
+		double decodeMs;		//[J[̃fR[hԂ̍v
+	};
+
+	TextureStreamer(ID3D12Device* device, ID3D12CommandQueue* commandQueue);
+	virtual ~TextureStreamer();
+
+	TextureStreamer(TextureStreamer&&) = delete;
+	TextureStreamer& operator= (TextureStreamer&&) = delete;
+
+	TextureStreamer(TextureStreamer const&) = delete;
+	TextureStreamer& operator= (TextureStreamer const&) = delete;
+
+	//maxSize傫~bv͓ǂݔ΂(0͑SATextureCacheƋL̂͑Sǂ񂾂̂)
+	std::shared_ptr<StreamedTexture> Request(const std::wstring& fileName, uint32_t maxSize = 0);
+
+	//t[̊JnɃCXbhĂ
+	void Update();
+
+	bool IsIdle() const;
+	Statistics GetStatistics() const;
+
+	//܂ǂݍłȂeNX`̑(1x1̔ACXbh)
+	ID3D12Resource* Placeholder();
+
+	//foCX̏ƍč쐬(GameBase::OnDeviceLostAGet̑OȂ牽Ȃ)
+	static void OnDeviceLost();
+	static void OnDeviceRestored(ID3D12Device* device, ID3D12CommandQueue* commandQueue);
+
+	//VOg
+	static TextureStreamer& Get();
+
+private:
+	struct Decoded {
+		std::shared_ptr<StreamedTexture> texture;
+		DecodedImage                     image;
+		ImageDecoder::Result             result;
+
+		//! ĂDDSꍇ(\[X̓[J[ō쐬ς݁Af[^̃Abv[hUpdate)
+		ComPtr<ID3D12Resource>               baked;
+		FileView                             ddsFile;		//subresourcesw}bvێ
+		std::vector<D3D12_SUBRESOURCE_DATA>  subresources;
+
+		//! ǂݔ΂Ỏ𑜓x
+		uint32_t fullWidth;
+		uint32_t fullHeight;
+		uint32_t fullMipCount;
+
+		size_t UploadSize() const;
+	};
+
+	//! Rs[L[œ]
+	struct Copying {
+		std::shared_ptr<StreamedTexture> texture;
+		UploadQueue::Token               token;
+		bool                             share;		//TextureCacheɓ
+	};
+
+	static std::wstring PendingKey(const std::wstring& fileName, uint32_t maxSize);
+
+	void Decode(const std::shared_ptr<StreamedTexture>& texture);
+	ComPtr<ID3D12Resource> CreateTexture(const DecodedImage& image, UploadQueue::Token& token);
+
+	ID3D12Device*       m_device;
+	ID3D12CommandQueue* m_commandQueue;
+
+	//! fR[h̃Wu(JobSystemBackground)
+	JobCounter                                   m_decoding;
+	std::deque<Decoded>                          m_decoded;
+	std::atomic<bool>                            m_quit;
+
+	//! KpXƍőTCY  ǂݍݒ̃eNX`(̂1񂾂ǂ)
+	std::unordered_map<std::wstring, std::shared_ptr<StreamedTexture>> m_pending;
+
+	//! Rs[L[̊҂(Readyɂ)
+	std::vector<Copying>           m_copying;
+	//! WICœǂ񂾂̂̃Abv[h҂(܂ŃAbv[hq[vłȂ)
+	std::vector<std::future<void>> m_uploads;
+
+	ComPtr<ID3D12Resource> m_placeholder;
+
+	Statistics m_statistics;
+
+	mutable std::mutex      m_mutex;
+};
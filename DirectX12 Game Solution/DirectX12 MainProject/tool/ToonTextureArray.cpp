@@ -0,0 +1,136 @@
+/**
+ * @file ToonTextureArray.cpp
+ * @brief LgD[(toon0`toon10)1̃eNX`zɂ܂Ƃ߂
+ * @author hoshi hirofumi
+ * @date 2026/10/19
+ */
+
+#include "ToonTextureArray.h"
+#include "ImageDecoder.h"
+
+#include <string>
+
+namespace {
+	//! GetōCX^X
+	ToonTextureArray* g_instance = nullptr;
+}
+
+ToonTextureArray::ToonTextureArray(ID3D12Device* device, ID3D12CommandQueue* commandQueue)
+{
+	Create(device, commandQueue);
+	g_instance = this;
+}
+
+ToonTextureArray::~ToonTextureArray()
+{
+	g_instance = nullptr;
+}
+
+/**
+	@brief	SXCXǂݍŃAbv[h
+	@note	킹Ă11 x 4KBȂ̂ōŏ1(ƃfoCX̍č쐬)œǂ
+*/
+void ToonTextureArray::Create(ID3D12Device* device, ID3D12CommandQueue* commandQueue)
+{
+	const auto desc = CD3DX12_RESOURCE_DESC::Tex2D(DXGI_FORMAT_R8G8B8A8_UNORM, RAMP_SIZE, RAMP_SIZE, SLICE_COUNT, 1);
+	const CD3DX12_HEAP_PROPERTIES heapProperties(D3D12_HEAP_TYPE_DEFAULT);
+	DX::ThrowIfFailed(device->CreateCommittedResource(
+		&heapProperties,
+		D3D12_HEAP_FLAG_NONE,
+		&desc,
+		D3D12_RESOURCE_STATE_COPY_DEST,
+		nullptr,
+		IID_PPV_ARGS(m_resource.GetAddressOf())
+	));
+
+	const size_t sliceBytes = RAMP_SIZE * RAMP_SIZE * 4;
+	std::vector<uint8_t> pixels(sliceBytes * SLICE_COUNT, 255);
+	std::vector<D3D12_SUBRESOURCE_DATA> subresources(SLICE_COUNT);
+
+	for (UINT slice = 0; slice < SLICE_COUNT; ++slice) {
+		uint8_t* dest = &pixels[sliceBytes * slice];
+
+		wchar_t fileName[64];
+		if (slice == 0)
+			swprintf_s(fileName, L"Model/toon/toon0.bmp");
+		else
+			swprintf_s(fileName, L"Model/toon/toon%02u.bmp", slice);
+
+		//ǂ߂ȂΔ̂܂(gD[Ɠ)
+		DecodedImage image;
+		if (ImageDecoder::DecodeFile(fileName, image, false) == ImageDecoder::Result::Ok) {
+			const auto& level = image.levels[0];
+			for (UINT y = 0; y < RAMP_SIZE; ++y) {
+				for (UINT x = 0; x < RAMP_SIZE; ++x) {
+					const size_t sx = static_cast<size_t>(x) * level.width / RAMP_SIZE;
+					const size_t sy = static_cast<size_t>(y) * level.height / RAMP_SIZE;
+					memcpy(dest + (y * RAMP_SIZE + x) * 4, &level.pixels[(sy * level.width + sx) * 4], 4);
+				}
+			}
+		}
+		else {
+			OutputDebugStringW((L"ToonTextureArray: missing " + std::wstring(fileName) + L"\n").c_str());
+		}
+
+		subresources[slice].pData      = dest;
+		subresources[slice].RowPitch   = RAMP_SIZE * 4;
+		subresources[slice].SlicePitch = sliceBytes;
+	}
+
+	ResourceUploadBatch resourceUpload(device);
+	resourceUpload.Begin();
+	resourceUpload.Upload(m_resource.Get(), 0, subresources.data(), SLICE_COUNT);
+	resourceUpload.Transition(m_resource.Get(), D3D12_RESOURCE_STATE_COPY_DEST, D3D12_RESOURCE_STATE_PIXEL_SHADER_RESOURCE);
+	resourceUpload.End(commandQueue).wait();
+
+	D3D12_SHADER_RESOURCE_VIEW_DESC srvDesc = {};
+	srvDesc.Format                        = DXGI_FORMAT_R8G8B8A8_UNORM;
+	srvDesc.ViewDimension                 = D3D12_SRV_DIMENSION_TEXTURE2DARRAY;
+	srvDesc.Shader4ComponentMapping       = D3D12_DEFAULT_SHADER_4_COMPONENT_MAPPING;
+	srvDesc.Texture2DArray.MipLevels      = 1;
+	srvDesc.Texture2DArray.ArraySize      = SLICE_COUNT;
+
+	m_descriptor = DescriptorAllocator::Get().Allocate(1);
+	device->CreateShaderResourceView(m_resource.Get(), &srvDesc, m_descriptor.GetCpuHandle(0));
+}
+
+/**
+	@brief	PMX̋LgD[ԍXCXԍ
+	@param	toonTextureIndex 0`9(toon01`toon10)
+	@return	͈͊O0(toon0)
+*/
+UINT ToonTextureArray::SharedToonSlice(int toonTextureIndex)
+{
+	if (toonTextureIndex < 0 || toonTextureIndex + 1 >= static_cast<int>(SLICE_COUNT))
+		return 0;
+	return static_cast<UINT>(toonTextureIndex + 1);
+}
+
+void ToonTextureArray::OnDeviceLost()
+{
+	if (g_instance == nullptr)
+		return;
+
+	g_instance->m_descriptor.Reset();
+	g_instance->m_resource.Reset();
+}
+
+/**
+	@brief	VfoCXō蒼(DescriptorAllocator蒼ɌĂ)
+*/
+void ToonTextureArray::OnDeviceRestored(ID3D12Device* device, ID3D12CommandQueue* commandQueue)
+{
+	if (g_instance == nullptr)
+		return;
+
+	g_instance->Create(device, commandQueue);
+}
+
+/**
+	@brief	Sfʂ̃CX^X
+*/
+ToonTextureArray& ToonTextureArray::Get()
+{
+	static ToonTextureArray instance(DXTK->Device, DXTK->CommandQueue);
+	return instance;
+}
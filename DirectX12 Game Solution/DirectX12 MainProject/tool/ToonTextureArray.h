@@ -0,0 +1,69 @@
+/**
+ * @file ToonTextureArray.h
+ * @brief LgD[(toon0`toon10)1̃eNX`zɂ܂Ƃ߂
+ * @author hoshi hirofumi
+ * @date 2026/10/19
+ */
+
+#pragma once
+
+/*
+-------------------------------------------------------------------------------------
+	CN[h
+-------------------------------------------------------------------------------------
+*/
+#include "Base/pch.h"
+#include "Base/dxtk.h"
+#include "DescriptorAllocator.h"
+
+/*
+-------------------------------------------------------------------------------------
+	using
+-------------------------------------------------------------------------------------
+*/
+using Microsoft::WRL::ComPtr;
+using std::unique_ptr;
+using std::make_unique;
+using namespace DirectX;
+
+/*
+-------------------------------------------------------------------------------------
+	ToonTextureArrayNX@錾
+-------------------------------------------------------------------------------------
+*/
+class ToonTextureArray {
+public:
+	//! XCX0toon0()A1`10toon01`toon10
+	static constexpr UINT SLICE_COUNT = 11;
+	//! LgD[͂ǂ32x32̃Of[V(Ⴄ傫͍̂̂킹)
+	static constexpr UINT RAMP_SIZE = 32;
+
+	ToonTextureArray(ID3D12Device* device, ID3D12CommandQueue* commandQueue);
+	virtual ~ToonTextureArray();
+
+	ToonTextureArray(ToonTextureArray&&) = delete;
+	ToonTextureArray& operator= (ToonTextureArray&&) = delete;
+
+	ToonTextureArray(ToonTextureArray const&) = delete;
+	ToonTextureArray& operator= (ToonTextureArray const&) = delete;
+
+	//PMX̋LgD[ԍ(0`9)XCXԍ
+	static UINT SharedToonSlice(int toonTextureIndex);
+
+	//`掞Ƀ[g̃fXNv^[e[u֓n
+	D3D12_GPU_DESCRIPTOR_HANDLE GetGpuHandle() const { return m_descriptor.GetGpuHandle(0); }
+	ID3D12Resource* Resource() const { return m_resource.Get(); }
+
+	//foCX̏ƍč쐬(GameBase::OnDeviceLostAGet̑OȂ牽Ȃ)
+	static void OnDeviceLost();
+	static void OnDeviceRestored(ID3D12Device* device, ID3D12CommandQueue* commandQueue);
+
+	//VOg
+	static ToonTextureArray& Get();
+
+private:
+	void Create(ID3D12Device* device, ID3D12CommandQueue* commandQueue);
+
+	ComPtr<ID3D12Resource> m_resource;
+	DescriptorRange        m_descriptor;
+};
@@ -0,0 +1,342 @@
+/**
+ * @file UploadQueue.cpp
+ * @brief Rs[L[ł̃Abv[h(Oobt@ɋl߂ăftHgq[vփRs[A̓g[NŊmF)
+ * @author hoshi hirofumi
+ * @date 2026/10/19
+ */
+
+#include "UploadQueue.h"
+
+namespace {
+	//! GetōCX^X
+	UploadQueue* g_instance = nullptr;
+}
+
+UploadQueue::UploadQueue(ID3D12Device* device, size_t stagingSize)
+	: m_device(device), m_stagingMemory(nullptr), m_ring(stagingSize),
+	m_open{}, m_recording(false), m_statistics{}
+{
+	m_event.Attach(CreateEventEx(nullptr, nullptr, 0, EVENT_MODIFY_STATE | SYNCHRONIZE));
+	if (!m_event.IsValid())
+		throw std::exception("CreateEvent");
+
+	m_open.token = 1;
+	CreateDeviceObjects(device);
+	g_instance = this;
+}
+
+UploadQueue::~UploadQueue()
+{
+	g_instance = nullptr;
+	if (m_staging == nullptr)
+		return;
+
+	{
+		std::lock_guard<std::mutex> lock(m_mutex);
+		WaitForFence(SubmitBatch());
+	}
+
+	m_staging->Unmap(0, nullptr);
+}
+
+/**
+	@brief	L[EtFXEOobt@
+	@note	tFX͑Mς݂̍Ō̃g[Nn߂(ÂfoCXŏog[N͊)
+*/
+void UploadQueue::CreateDeviceObjects(ID3D12Device* device)
+{
+	m_device = device;
+
+	D3D12_COMMAND_QUEUE_DESC queueDesc = {};
+	queueDesc.Type  = D3D12_COMMAND_LIST_TYPE_COPY;
+	queueDesc.Flags = D3D12_COMMAND_QUEUE_FLAG_NONE;
+	DX::ThrowIfFailed(device->CreateCommandQueue(&queueDesc, IID_PPV_ARGS(m_queue.GetAddressOf())));
+	m_queue->SetName(L"UploadQueue");
+
+	ComPtr<ID3D12CommandAllocator> allocator;
+	DX::ThrowIfFailed(device->CreateCommandAllocator(D3D12_COMMAND_LIST_TYPE_COPY, IID_PPV_ARGS(allocator.GetAddressOf())));
+	DX::ThrowIfFailed(device->CreateCommandList(0, D3D12_COMMAND_LIST_TYPE_COPY, allocator.Get(), nullptr, IID_PPV_ARGS(m_commandList.GetAddressOf())));
+	DX::ThrowIfFailed(m_commandList->Close());
+	m_freeAllocators.push_back(allocator);
+
+	DX::ThrowIfFailed(device->CreateFence(m_open.token - 1, D3D12_FENCE_FLAG_NONE, IID_PPV_ARGS(m_fence.GetAddressOf())));
+
+	const CD3DX12_HEAP_PROPERTIES heapProperties(D3D12_HEAP_TYPE_UPLOAD);
+	const auto desc = CD3DX12_RESOURCE_DESC::Buffer(m_ring.Capacity());
+	DX::ThrowIfFailed(device->CreateCommittedResource(
+		&heapProperties,
+		D3D12_HEAP_FLAG_NONE,
+		&desc,
+		D3D12_RESOURCE_STATE_GENERIC_READ,
+		nullptr,
+		IID_PPV_ARGS(m_staging.GetAddressOf())
+	));
+	m_staging->SetName(L"UploadQueue staging ring");
+
+	//CPU͏ނ
+	const CD3DX12_RANGE readRange(0, 0);
+	DX::ThrowIfFailed(m_staging->Map(0, &readRange, reinterpret_cast<void**>(&m_stagingMemory)));
+}
+
+/**
+	@brief	obt@ւ̃Abv[h
+	@param	destination ftHgq[ṽobt@(COMMONō쐬)
+	@return	̊mFp
+*/
+UploadQueue::Token UploadQueue::UploadBuffer(ID3D12Resource* destination, const void* data, size_t size, UINT64 destinationOffset)
+{
+	std::lock_guard<std::mutex> lock(m_mutex);
+
+	ID3D12Resource* buffer;
+	UINT64          offset;
+	uint8_t* memory = Stage(size, 16, buffer, offset);
+	memcpy(memory, data, size);
+
+	OpenBatch();
+	m_commandList->CopyBufferRegion(destination, destinationOffset, buffer, offset, size);
+	m_open.resources.push_back(destination);
+
+	++m_statistics.uploads;
+	return m_open.token;
+}
+
+/**
+	@brief	eNX`ւ̃Abv[h
+	@param	destination ftHgq[ṽeNX`(COMMONCOPY_DESTō쐬)
+	@return	̊mFp
+*/
+UploadQueue::Token UploadQueue::UploadTexture(ID3D12Resource* destination, UINT firstSubresource, const D3D12_SUBRESOURCE_DATA* subresources, UINT count)
+{
+	const auto desc = destination->GetDesc();
+	std::vector<D3D12_PLACED_SUBRESOURCE_FOOTPRINT> layouts(count);
+	std::vector<UINT>   rows(count);
+	std::vector<UINT64> rowSizes(count);
+	UINT64 totalBytes = 0;
+	m_device->GetCopyableFootprints(&desc, firstSubresource, count, 0, layouts.data(), rows.data(), rowSizes.data(), &totalBytes);
+
+	std::lock_guard<std::mutex> lock(m_mutex);
+
+	ID3D12Resource* buffer;
+	UINT64          offset;
+	uint8_t* memory = Stage(static_cast<size_t>(totalBytes), D3D12_TEXTURE_DATA_PLACEMENT_ALIGNMENT, buffer, offset);
+	for (UINT i = 0; i < count; ++i) {
+		const D3D12_MEMCPY_DEST dest = {
+			memory + layouts[i].Offset,
+			layouts[i].Footprint.RowPitch,
+			static_cast<SIZE_T>(layouts[i].Footprint.RowPitch) * rows[i]
+		};
+		MemcpySubresource(&dest, &subresources[i], static_cast<SIZE_T>(rowSizes[i]), rows[i], layouts[i].Footprint.Depth);
+	}
+
+	OpenBatch();
+	for (UINT i = 0; i < count; ++i) {
+		layouts[i].Offset += offset;
+		const CD3DX12_TEXTURE_COPY_LOCATION dst(destination, firstSubresource + i);
+		const CD3DX12_TEXTURE_COPY_LOCATION src(buffer, layouts[i]);
+		m_commandList->CopyTextureRegion(&dst, 0, 0, 0, &src, nullptr);
+	}
+	m_open.resources.push_back(destination);
+
+	++m_statistics.uploads;
+	return m_open.token;
+}
+
+/**
+	@brief	L^Rs[𑗐M
+	@return	Mob`(L^΍ŌɑM)̃g[N
+*/
+UploadQueue::Token UploadQueue::Flush()
+{
+	std::lock_guard<std::mutex> lock(m_mutex);
+	Retire();
+	return SubmitBatch();
+}
+
+bool UploadQueue::IsComplete(Token token) const
+{
+	return m_fence->GetCompletedValue() >= token;
+}
+
+/**
+	@brief	܂ő҂(MOȂ瑗M)
+*/
+void UploadQueue::Wait(Token token)
+{
+	std::lock_guard<std::mutex> lock(m_mutex);
+	if (m_recording && token >= m_open.token)
+		SubmitBatch();
+	WaitForFence(token);
+}
+
+UploadQueue::Statistics UploadQueue::GetStatistics() const
+{
+	std::lock_guard<std::mutex> lock(m_mutex);
+	return m_statistics;
+}
+
+/**
+	@brief	Abv[hf[^̒uꏊmۂ
+	@param	buffer Rs[̃obt@
+	@param	offset Rs[̃obt@̈ʒu
+	@return	ݐ
+	@note	Oobt@tȂL^̕𑗐MĈԌÂob`̊҂
+*/
+uint8_t* UploadQueue::Stage(size_t size, size_t alignment, ID3D12Resource*& buffer, UINT64& offset)
+{
+	if (size > m_ring.Capacity()) {
+		//OɓȂ傫͐p̃obt@(Rs[Iob`ƈꏏɉ)
+		const CD3DX12_HEAP_PROPERTIES heapProperties(D3D12_HEAP_TYPE_UPLOAD);
+		const auto desc = CD3DX12_RESOURCE_DESC::Buffer(size);
+		ComPtr<ID3D12Resource> upload;
+		DX::ThrowIfFailed(m_device->CreateCommittedResource(
+			&heapProperties,
+			D3D12_HEAP_FLAG_NONE,
+			&desc,
+			D3D12_RESOURCE_STATE_GENERIC_READ,
+			nullptr,
+			IID_PPV_ARGS(upload.GetAddressOf())
+		));
+
+		void* memory = nullptr;
+		const CD3DX12_RANGE readRange(0, 0);
+		DX::ThrowIfFailed(upload->Map(0, &readRange, &memory));
+
+		buffer = upload.Get();
+		offset = 0;
+		m_open.resources.push_back(upload);
+		++m_statistics.largeUploads;
+		return static_cast<uint8_t*>(memory);
+	}
+
+	for (;;) {
+		m_ring.Retire(m_fence->GetCompletedValue());
+
+		const size_t ringOffset = m_ring.Allocate(size, alignment);
+		if (ringOffset != StagingRing::INVALID_OFFSET) {
+			buffer = m_staging.Get();
+			offset = ringOffset;
+			m_statistics.bytesStaged += size;
+			return m_stagingMemory + ringOffset;
+		}
+
+		++m_statistics.stalls;
+		if (m_ring.HasOpen())
+			SubmitBatch();
+		WaitForFence(m_ring.OldestFence());
+	}
+}
+
+/**
+	@brief	R}hXg̋L^n߂(L^Ȃ牽Ȃ)
+*/
+void UploadQueue::OpenBatch()
+{
+	if (m_recording)
+		return;
+
+	ComPtr<ID3D12CommandAllocator> allocator;
+	if (!m_freeAllocators.empty()) {
+		allocator = std::move(m_freeAllocators.back());
+		m_freeAllocators.pop_back();
+		DX::ThrowIfFailed(allocator->Reset());
+	}
+	else {
+		DX::ThrowIfFailed(m_device->CreateCommandAllocator(D3D12_COMMAND_LIST_TYPE_COPY, IID_PPV_ARGS(allocator.GetAddressOf())));
+	}
+
+	DX::ThrowIfFailed(m_commandList->Reset(allocator.Get(), nullptr));
+	m_open.allocator = std::move(allocator);
+	m_recording = true;
+}
+
+/**
+	@brief	L^̃ob`𑗐M
+*/
+UploadQueue::Token UploadQueue::SubmitBatch()
+{
+	if (!m_recording)
+		return m_open.token - 1;
+
+	DX::ThrowIfFailed(m_commandList->Close());
+	ID3D12CommandList* commandLists[] = { m_commandList.Get() };
+	m_queue->ExecuteCommandLists(1, commandLists);
+	DX::ThrowIfFailed(m_queue->Signal(m_fence.Get(), m_open.token));
+
+	const Token token = m_open.token;
+	m_ring.Close(token);
+	m_inFlight.push_back(std::move(m_open));
+
+	m_open = Batch{};
+	m_open.token = token + 1;
+	m_recording  = false;
+	++m_statistics.batches;
+	return token;
+}
+
+void UploadQueue::WaitForFence(uint64_t value)
+{
+	if (m_fence->GetCompletedValue() < value) {
+		DX::ThrowIfFailed(m_fence->SetEventOnCompletion(value, m_event.Get()));
+		WaitForSingleObjectEx(m_event.Get(), INFINITE, FALSE);
+	}
+	Retire();
+}
+
+/**
+	@brief	ob`̌n(AP[^[̍ėpƃOobt@̕ԋp)
+*/
+void UploadQueue::Retire()
+{
+	const uint64_t completed = m_fence->GetCompletedValue();
+	while (!m_inFlight.empty() && m_inFlight.front().token <= completed) {
+		m_freeAllocators.push_back(std::move(m_inFlight.front().allocator));
+		m_inFlight.pop_front();
+	}
+	m_ring.Retire(completed);
+}
+
+/**
+	@brief	foCX̏(L^E]̃ob`͎̂Ă)
+	@note	̂Ăob`̃g[NA蒼tFXł͊ɂȂ
+*/
+void UploadQueue::OnDeviceLost()
+{
+	if (g_instance == nullptr)
+		return;
+
+	auto& queue = *g_instance;
+	std::lock_guard<std::mutex> lock(queue.m_mutex);
+	if (queue.m_recording) {
+		queue.m_open = Batch{ queue.m_open.token + 1 };
+		queue.m_recording = false;
+	}
+	queue.m_inFlight.clear();
+	queue.m_freeAllocators.clear();
+	queue.m_ring = StagingRing(queue.m_ring.Capacity());
+
+	queue.m_staging->Unmap(0, nullptr);
+	queue.m_staging.Reset();
+	queue.m_stagingMemory = nullptr;
+	queue.m_commandList.Reset();
+	queue.m_fence.Reset();
+	queue.m_queue.Reset();
+	queue.m_device = nullptr;
+}
+
+void UploadQueue::OnDeviceRestored(ID3D12Device* device)
+{
+	if (g_instance == nullptr)
+		return;
+
+	std::lock_guard<std::mutex> lock(g_instance->m_mutex);
+	g_instance->CreateDeviceObjects(device);
+}
+
+/**
+	@brief	Sfʂ̃CX^X
+*/
+UploadQueue& UploadQueue::Get()
+{
+	static UploadQueue instance(DXTK->Device);
+	return instance;
+}
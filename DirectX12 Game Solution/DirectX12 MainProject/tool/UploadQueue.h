@@ -0,0 +1,119 @@
+/**
+ * @file UploadQueue.h
+ * @brief Rs[L[ł̃Abv[h(Oobt@ɋl߂ăftHgq[vփRs[A̓g[NŊmF)
+ * @author hoshi hirofumi
+ * @date 2026/10/19
+ */
+
+#pragma once
+
+/*
+-------------------------------------------------------------------------------------
+	CN[h
+-------------------------------------------------------------------------------------
+*/
+#include "Base/pch.h"
+#include "Base/dxtk.h"
+#include "StagingRing.h"
+
+#include <deque>
+#include <mutex>
+
+/*
+-------------------------------------------------------------------------------------
+	using
+-------------------------------------------------------------------------------------
+*/
+using Microsoft::WRL::ComPtr;
+using std::unique_ptr;
+using std::make_unique;
+using namespace DirectX;
+
+/*
+-------------------------------------------------------------------------------------
+	UploadQueueNX@錾
+-------------------------------------------------------------------------------------
+*/
+class UploadQueue {
+public:
+	//! ̊mFp(Rs[L[̃tFX̒l)
+	typedef uint64_t Token;
+
+	//! Oobt@̑傫(傫̂͐p̃Abv[hobt@)
+	static constexpr size_t STAGING_SIZE = 64 * 1024 * 1024;
+
+	struct Statistics {
+		size_t batches;			//MR}hXg̐
+		size_t uploads;			//UploadBufferEUploadTexturẻ
+		size_t bytesStaged;		//Oobt@ɋl߂
+		size_t largeUploads;	//Oobt@ɓ炸p̃obt@
+		size_t stalls;			//Oobt@󂭂܂ő҂
+	};
+
+	UploadQueue(ID3D12Device* device, size_t stagingSize = STAGING_SIZE);
+	virtual ~UploadQueue();
+
+	UploadQueue(UploadQueue&&) = delete;
+	UploadQueue& operator= (UploadQueue&&) = delete;
+
+	UploadQueue(UploadQueue const&) = delete;
+	UploadQueue& operator= (UploadQueue const&) = delete;
+
+	//Rs[COMMONō쐬(Rs[L[̌COMMONɖ߂A`ŎgƂɈÖقɏi)
+	Token UploadBuffer(ID3D12Resource* destination, const void* data, size_t size, UINT64 destinationOffset = 0);
+	Token UploadTexture(ID3D12Resource* destination, UINT firstSubresource, const D3D12_SUBRESOURCE_DATA* subresources, UINT count);
+
+	//܂ł̃Rs[܂Ƃ߂đM(GameBaset[Ă)
+	Token Flush();
+
+	//҂ɊmF(`摤͂)
+	bool IsComplete(Token token) const;
+	//NȂǑ҂Ă悢Ƃ
+	void Wait(Token token);
+
+	Statistics GetStatistics() const;
+
+	//foCX̏ƍč쐬(GameBase::OnDeviceLostAGet̑OȂ牽Ȃ)
+	static void OnDeviceLost();
+	static void OnDeviceRestored(ID3D12Device* device);
+
+	//VOg
+	static UploadQueue& Get();
+
+private:
+	struct Batch {
+		Token                               token;
+		ComPtr<ID3D12CommandAllocator>      allocator;
+		//! Rs[I܂ŉȂ(Rs[Ep̃Abv[hobt@)
+		std::vector<ComPtr<ID3D12Resource>> resources;
+	};
+
+	void CreateDeviceObjects(ID3D12Device* device);
+	uint8_t* Stage(size_t size, size_t alignment, ID3D12Resource*& buffer, UINT64& offset);
+	void OpenBatch();
+	Token SubmitBatch();
+	void WaitForFence(uint64_t value);
+	void Retire();
+
+	ID3D12Device*                      m_device;
+	ComPtr<ID3D12CommandQueue>         m_queue;
+	ComPtr<ID3D12GraphicsCommandList>  m_commandList;
+	ComPtr<ID3D12Fence>                m_fence;
+	Microsoft::WRL::Wrappers::Event    m_event;
+
+	//! Oobt@(Ƀ}bv܂)
+	ComPtr<ID3D12Resource> m_staging;
+	uint8_t*               m_stagingMemory;
+	StagingRing            m_ring;
+
+	//! L^̃ob`(g[N͑MɃVOil)
+	Batch m_open;
+	bool  m_recording;
+	//! Mς݂Ŋ҂
+	std::deque<Batch>                           m_inFlight;
+	std::vector<ComPtr<ID3D12CommandAllocator>> m_freeAllocators;
+
+	Statistics m_statistics;
+
+	mutable std::mutex m_mutex;
+};
@@ -11,13 +11,32 @@
 ---------------------------------------------------------------------
 */
 #include "VMDLoader.h"
+#include "VmdReader.h"
+#include "AssetFiles.h"
+#include "JobSystem.h"
+#include "Profiler.h"
+#include <algorithm>
 #include <array>
+#include <cmath>
 #include <codecvt>
 
 // Initialize member variables.
-VMDLoader::VMDLoader(): elapsedTime(),motionFPS(30)
+VMDLoader::VMDLoader(): maxFrame(),motionFPS(30),sampleRate(),centerNode(nullptr),rightLegNode(nullptr)
 {
+	//͖(30/60/120HzSetSampleRateőI)
+	SetSampleRate(0);
+}
 
+/**
+ * @brief |[YvZpxݒ肷
+ * @param hz 1b̉(0Ȃ疈)
+*/
+void VMDLoader::SetSampleRate(unsigned int hz)
+{
+	sampleRate = hz;
+	motionTimer.SetFixedTimeStep(hz != 0);
+	if (hz != 0)
+		motionTimer.SetTargetElapsedTicks(DX::StepTimer::TicksPerSecond / hz);
 }
 
 /**
@@ -25,27 +44,17 @@ VMDLoader::VMDLoader(): elapsedTime(),motionFPS(30)
  * @param name t@C
  * @return Aj[Vf[^
 */
-std::unordered_map<std::wstring, std::vector<VMDKeyFrame>> VMDLoader::LoadVMD(const char* name)
+std::unordered_map<NameId, std::vector<VMDKeyFrame>> VMDLoader::LoadVMD(const char* name)
 {
-	FILE* fp;
-
-	fopen_s(&fp, name, "rb");
-	if (fp == nullptr) {
+	// A[JCuɂ΂
+	FileView fp = AssetFiles::Get().Open(name);
+	if (!fp) {
 		OutputDebugString(TEXT("vmd file not find.\n"));
 		DX::ThrowIfFailed(0x80070002);	// FileNotFoundException
 	}
-	fseek(fp, 50, SEEK_SET);
-
-	unsigned int num_of_motion;
-	fread(&num_of_motion,4,1,fp);
-	data.resize(num_of_motion);
-
-	for (auto& motion : data) {
-		char c[15];
-		fread(&c, 15, 1, fp);
-		MultiByteToWideChar(CP_ACP, MB_PRECOMPOSED, c, -1, motion.name, sizeof(motion.name));
-		fread(&motion.frame_no, 96, 1, fp);
+	VmdReader::Read(fp, data);
 
+	for (const auto& motion : data) {
 		motionData[motion.name].emplace_back(
 			VMDKeyFrame(
 				motion.frame_no, XMLoadFloat4(&motion.quaternion),
@@ -57,8 +66,6 @@ std::unordered_map<std::wstring, std::vector<VMDKeyFrame>> VMDLoader::LoadVMD(co
 		maxFrame = motion.frame_no;
 	}
 
-	fclose(fp);
-
 	// [Vf[^̔zt[ԍɃ\[g
 	for (auto& motion : motionData) {
 		std::sort(motion.second.begin(), motion.second.end(),
@@ -75,46 +82,67 @@ std::unordered_map<std::wstring, std::vector<VMDKeyFrame>> VMDLoader::LoadVMD(co
  * @param name t@C
  * @return Aj[Vf[^
 */
-void VMDLoader::Initialize(PmxData data, ComPtr<ID3D12Resource> constantBuffer,const char* name)
+void VMDLoader::Initialize(PmxData data, const char* name)
 {
 	m_pmxData = data;
-	m_constantBuffer = constantBuffer;
 	boneMatrices.resize(data.bones.size());
 	std::fill(boneMatrices.begin(), boneMatrices.end(), XMMatrixIdentity());
 	motionData = LoadVMD(name);
 
-	 //gXtH[s
-	m_constantBuffer->Map(0, nullptr, (void**)&constantBufferPrt);
+	// [Vƃ{[̑Ήt(ȍ~͖OȂ)
+	auto findNode = [this](const wchar_t* boneName) -> PmxData::BoneNode* {
+		auto it = m_pmxData.boneNodeTable.find(NameTable::Get().Find(boneName));
+		return it != m_pmxData.boneNodeTable.end() ? &it->second : nullptr;
+	};
+	// \[X̕R[hɈˑȂ悤GXP[vŏ
+	centerNode   = findNode(L"\u30bb\u30f3\u30bf\u30fc");	//Z^[
+	rightLegNode = findNode(L"\u53f3\u8db3");				//E
+
+	tracks.clear();
+	tracks.reserve(motionData.size());
+	for (const auto& bonemotion : motionData) {
+		auto it = m_pmxData.boneNodeTable.find(bonemotion.first);
+		if (it != m_pmxData.boneNodeTable.end())
+			tracks.push_back({ &it->second, &bonemotion.second });
+	}
 
-	for (auto& bonemotion : motionData) {
-		const auto& node = m_pmxData.boneNodeTable[bonemotion.first];
+	 //gXtH[s
+	for (const auto& track : tracks) {
+		const auto& node = *track.node;
 		const auto& pos = node.startPos;
 		const auto  transform =
 			XMMatrixTranslation(-pos.x, -pos.y, -pos.z)
-			* XMMatrixRotationQuaternion(bonemotion.second[0].quaternion)
+			* XMMatrixRotationQuaternion((*track.keyframes)[0].quaternion)
 			* XMMatrixTranslation(pos.x, pos.y, pos.z);
 		boneMatrices[node.boneIndex] = transform;
 	}
-	MatrixMultiplyChildren(&m_pmxData.boneNodeTable[L"Z^["], SimpleMath::Matrix::Identity);
-
-	CopyMemory(constantBufferPrt + 1, boneMatrices.data(), sizeof(XMMATRIX) * boneMatrices.size());
+	if (centerNode)
+		MatrixMultiplyChildren(centerNode, SimpleMath::Matrix::Identity);
 }
 
-void VMDLoader::Update(float deltaTime)
+bool VMDLoader::Update(float deltaTime)
 {
-	UpdateBoneMatrices(deltaTime);
-	auto& left_node = m_pmxData.boneNodeTable[L"E"];
-	const auto& left_pos = left_node.startPos;
-	const auto  left_transform =
-		XMMatrixTranslation(-left_pos.x, -left_pos.y, -left_pos.z)
-		* XMMatrixRotationX(XMConvertToRadians(0))
-		* XMMatrixTranslation(left_pos.x, left_pos.y, left_pos.z);
-	boneMatrices[left_node.boneIndex] *= left_transform;
-
-	m_constantBuffer->Map(0, nullptr, (void**)&constantBufferPrt);
-
-	MatrixMultiplyChildren(&m_pmxData.boneNodeTable[L"Z^["], SimpleMath::Matrix::Identity);
-	CopyMemory(constantBufferPrt + 1, boneMatrices.data(), sizeof(XMMATRIX) * boneMatrices.size());
+	//Ԋu̓rȂÕ|[Ŷ܂(\Ă[V̌vZ͑Ȃ)
+	bool stepped = false;
+	motionTimer.Advance(DX::StepTimer::SecondsToTicks(std::max(deltaTime, 0.0f)), [&stepped]() { stepped = true; });
+	if (!stepped)
+		return false;
+
+	UpdateBoneMatrices();
+	if (rightLegNode) {
+		const auto& left_node = *rightLegNode;
+		const auto& left_pos = left_node.startPos;
+		const auto  left_transform =
+			XMMatrixTranslation(-left_pos.x, -left_pos.y, -left_pos.z)
+			* XMMatrixRotationX(XMConvertToRadians(0))
+			* XMMatrixTranslation(left_pos.x, left_pos.y, left_pos.z);
+		boneMatrices[left_node.boneIndex] *= left_transform;
+	}
+
+	//݂PmxLoaderŃAbv[hOɍs
+	if (centerNode)
+		MatrixMultiplyChildren(centerNode, SimpleMath::Matrix::Identity);
+	return true;
 }
 
 void VMDLoader::MatrixMultiplyChildren(PmxData::BoneNode* node, const XMMATRIX& matrix)
@@ -125,80 +153,46 @@ void VMDLoader::MatrixMultiplyChildren(PmxData::BoneNode* node, const XMMATRIX&
 	}
 }
 
-void VMDLoader::UpdateBoneMatrices(const float deltaTime)
+/**
+	@note	Œ̊ԊuȂXebv̐狁߂(bɒƒ[ŃL[t[̎OɂȂ)
+*/
+void VMDLoader::UpdateBoneMatrices()
 {
-	elapsedTime += deltaTime;
-
-
-	const float MAX_TIME = maxFrame / motionFPS;
-	if (elapsedTime > MAX_TIME) {
-		elapsedTime -= MAX_TIME;
-	}
+	PROFILE_ZONE("VMD::UpdateBoneMatrices");
 
-	const unsigned int FRAME_NO = static_cast<int>(motionFPS * elapsedTime);
+	double position = sampleRate != 0
+		? static_cast<double>(motionTimer.GetFrameCount()) * motionFPS / sampleRate
+		: motionTimer.GetTotalSeconds() * motionFPS;
+	if (maxFrame > 0)
+		position = std::fmod(position, static_cast<double>(maxFrame));
+	const float FRAME = static_cast<float>(position);
 
 	std::fill(boneMatrices.begin(), boneMatrices.end(), SimpleMath::Matrix::Identity);
-	for (const auto& motion : motionData) {
-		auto& node = m_pmxData.boneNodeTable[motion.first];
-
-		const auto& keyframes = motion.second;
-		auto rit = std::find_if(
-			keyframes.rbegin(), keyframes.rend(),
-			[FRAME_NO](const VMDKeyFrame& keyFrame)
-			{
-				return keyFrame.frame_no <= FRAME_NO;
-			}
-		);
-
-		if (rit == keyframes.rend())
-			continue;
-
-		XMMATRIX rotation;
-		auto it = rit.base();
-		if (it != keyframes.end()) {
-			auto t = static_cast<float>(FRAME_NO - rit->frame_no) /
-				static_cast<float>(it->frame_no - rit->frame_no);
-			t = GetYFromXOnBezier(t, it->p1, it->p2, 12);
-
-			rotation = XMMatrixRotationQuaternion(
-				XMQuaternionSlerp(rit->quaternion, it->quaternion, t)
-			);
-		}
-		else {
-			rotation = XMMatrixRotationQuaternion(rit->quaternion);
-		}
-
-		const auto& pos = node.startPos;
-		const auto  transform =
-			XMMatrixTranslation(-pos.x, -pos.y, -pos.z)
-			* rotation
-			* XMMatrixTranslation(pos.x, pos.y, pos.z);
-		boneMatrices[node.boneIndex] = transform;
-	}
+	//gbNɕʂ̃{[ɏ̂ŁA`NɕĕɌvZ(eq̊|Z͌ł܂Ƃ߂)
+	JobSystem::Get().ParallelFor(tracks.size(), [this, FRAME](size_t begin, size_t end) {
+		for (size_t i = begin; i < end; ++i)
+			UpdateTrack(tracks[i], FRAME);
+	}, TRACK_GRAIN);
 }
 
-float VMDLoader::GetYFromXOnBezier(const float x, const XMFLOAT2& a, const XMFLOAT2& b, const uint8_t n)
+void VMDLoader::UpdateTrack(const BoneTrack& track, const float frame)
 {
-	if (a.x == a.y && b.x == b.y)
-		return x;	//vZsv
-
-	float t = x;
-	const float k0 = 1 + 3 * a.x - 3 * b.x;	//t^3̌W
-	const float k1 = 3 * b.x - 6 * a.x;		//t^2̌W
-	const float k2 = 3 * a.x;				//t  ̌W
-
-	//덷͈͓̔ǂɎgp萔
-	constexpr float epsilon = 0.0005f;
-
-	for (int i = 0; i < n; ++i) {
-		auto ft = k0 * t * t * t + k1 * t * t + k2 * t - x;
-
-		if (ft <= epsilon && ft >= -epsilon)
-			break;
-
-		t -= ft / 2;
-	}
-
-	const auto r = 1 - t;
-	return t * t * t + 3 * t * t * r * b.y + 3 * t * r * r * a.y;
-}
\ No newline at end of file
+	const auto& node = *track.node;
+
+	const auto& keyframes = *track.keyframes;
+	VmdReader::Segment segment;
+	if (!VmdReader::FindSegment(keyframes, frame, segment))
+		return;
+
+	const auto& previous = keyframes[segment.previous];
+	const auto  rotation = segment.next != segment.previous
+		? XMMatrixRotationQuaternion(XMQuaternionSlerp(previous.quaternion, keyframes[segment.next].quaternion, segment.weight))
+		: XMMatrixRotationQuaternion(previous.quaternion);
+
+	const auto& pos = node.startPos;
+	const auto  transform =
+		XMMatrixTranslation(-pos.x, -pos.y, -pos.z)
+		* rotation
+		* XMMatrixTranslation(pos.x, pos.y, pos.z);
+	boneMatrices[node.boneIndex] = transform;
+}
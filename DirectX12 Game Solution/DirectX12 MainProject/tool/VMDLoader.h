@@ -8,6 +8,7 @@
 #pragma once
 
 #include "PmxStructList.h"
+#include "TextDecoder.h"
 
 using Microsoft::WRL::ComPtr;
 using std::unique_ptr;
@@ -26,28 +27,44 @@ public:
 	VMDLoader(VMDLoader const&) = delete;
 	VMDLoader& operator= (VMDLoader const&) = delete;
 
-	std::unordered_map<std::wstring, std::vector<VMDKeyFrame>> LoadVMD(const char*);
-	std::unordered_map<std::wstring, std::vector<VMDKeyFrame>> GetData() { return motionData; }
+	std::unordered_map<NameId, std::vector<VMDKeyFrame>> LoadVMD(const char*);
+	const std::unordered_map<NameId, std::vector<VMDKeyFrame>>& GetData() const { return motionData; }
 	unsigned int GetVMDFrame() { return maxFrame; }
-	void Initialize(PmxData data, ComPtr<ID3D12Resource> constantBuffer, const char* name);
-	void Update(float deltaTime);
+	void Initialize(PmxData data, const char* name);
+	//|[YvZtrue(TvO̊ԊuĂȂΑÕ|[Ŷ܂)
+	bool Update(float deltaTime);
+	//|[YvZpx(30/60/120HzȂǁA\̃t[[gƂ͕)@0Ȃ疈
+	void SetSampleRate(unsigned int hz);
+	unsigned int GetSampleRate() const { return sampleRate; }
+	const std::vector<SimpleMath::Matrix>& GetBoneMatrices() const { return boneMatrices; }
 
 private:
+	//! UpdateBoneMatrices1Wu󂯎gbN̍ŏ(ȂƕԂ̕傫)
+	static constexpr size_t TRACK_GRAIN = 32;
+
+	//! [Vƃ{[̑Ή(Initialize1񂾂O)
+	struct BoneTrack {
+		const PmxData::BoneNode*        node;
+		const std::vector<VMDKeyFrame>* keyframes;
+	};
 
 	void  MatrixMultiplyChildren(PmxData::BoneNode* node, const XMMATRIX& matrix);
-	void  UpdateBoneMatrices(const float deltaTime);
-	float GetYFromXOnBezier(const float x, const XMFLOAT2& a, const XMFLOAT2& b, const uint8_t n);
+	void  UpdateBoneMatrices();
+	void  UpdateTrack(const BoneTrack& track, const float frame);
 
 	unsigned int maxFrame;
-	float elapsedTime;
 	float motionFPS;
+	DX::StepTimer motionTimer;		//TvO̊Ԋu(ŒXebvAUpdatěoߎԂŐi߂)
+	unsigned int sampleRate;
 
 	std::vector<VMDData> data;
-	std::unordered_map<std::wstring, std::vector<VMDKeyFrame>> motionData;
+	std::unordered_map<NameId, std::vector<VMDKeyFrame>> motionData;
+	std::vector<BoneTrack> tracks;		//fɖ{[̃[V͊܂܂Ȃ
+
+	PmxData::BoneNode* centerNode;		//"Z^["(nullptr)
+	PmxData::BoneNode* rightLegNode;	//"E"
 
 	PmxData m_pmxData;
-	ComPtr<ID3D12Resource> m_constantBuffer;
-	XMMATRIX* constantBufferPrt;
 	std::vector<SimpleMath::Matrix> boneMatrices;
 
 };
\ No newline at end of file
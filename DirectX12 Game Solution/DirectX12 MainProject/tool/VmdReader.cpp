@@ -0,0 +1,56 @@
+/**
+ * @file VmdReader.cpp
+ * @brief VMD̉͂ƃL[t[̕ԋȐ(`ɈˑȂ)
+ * @author hoshi hirofumi
+ * @date 2026/10/19
+ */
+
+#include "VmdReader.h"
+#include "TextDecoder.h"
+
+#include <algorithm>
+
+void VmdReader::Read(FileView& fp, std::vector<VMDData>& motions)
+{
+	fp.Seek(50);
+
+	unsigned int num_of_motion;
+	fp.Read(&num_of_motion, 4, 1);
+	// ꂽt@CŋȊmۂȂ悤Ac̑傫ŗ}(1 = O15 + 96oCg)
+	motions.resize(std::min<size_t>(num_of_motion, fp.Remaining() / (15 + 96)));
+
+	for (auto& motion : motions) {
+		// {[Shift-JIS15oCgŒ(P[ɈˑȂ悤ϊ\œǂ)
+		char c[15];
+		fp.Read(&c, 15, 1);
+		motion.name = NameTable::Get().Intern(TextDecoder::FromShiftJis(c, sizeof(c)));
+		// t[ԍԋȐ܂ł96oCg(VMDData̕тƓ)
+		fp.Read(&motion.frame_no, 96, 1);
+	}
+}
+
+float VmdReader::BezierY(const float x, const XMFLOAT2& a, const XMFLOAT2& b, const uint8_t n)
+{
+	if (a.x == a.y && b.x == b.y)
+		return x;	//vZsv
+
+	float t = x;
+	const float k0 = 1 + 3 * a.x - 3 * b.x;	//t^3̌W
+	const float k1 = 3 * b.x - 6 * a.x;		//t^2̌W
+	const float k2 = 3 * a.x;				//t  ̌W
+
+	//덷͈͓̔ǂɎgp萔
+	constexpr float epsilon = 0.0005f;
+
+	for (int i = 0; i < n; ++i) {
+		auto ft = k0 * t * t * t + k1 * t * t + k2 * t - x;
+
+		if (ft <= epsilon && ft >= -epsilon)
+			break;
+
+		t -= ft / 2;
+	}
+
+	const auto r = 1 - t;
+	return t * t * t + 3 * t * t * r * b.y + 3 * t * r * r * a.y;
+}
\ No newline at end of file
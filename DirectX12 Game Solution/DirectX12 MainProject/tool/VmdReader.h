@@ -0,0 +1,68 @@
+/**
+ * @file VmdReader.h
+ * @brief VMD̉͂ƃL[t[̕ԋȐ(`ɈˑȂ)
+ * @author hoshi hirofumi
+ * @date 2026/10/19
+ * @note VMDLoaderLinux̃x`}[N(ModelBench.cpp)œ͂g
+ */
+
+#pragma once
+
+/*
+-------------------------------------------------------------------------------------
+	CN[h
+-------------------------------------------------------------------------------------
+*/
+#include "PmxData.h"
+#include "MappedFile.h"
+
+#include <algorithm>
+#include <cstddef>
+
+/*
+-------------------------------------------------------------------------------------
+	VmdReaderNX@錾
+-------------------------------------------------------------------------------------
+*/
+class VmdReader {
+public:
+	//! frameރL[t[̑g
+	struct Segment {
+		size_t previous;	//frameȑOōŌ̃L[t[
+		size_t next;		//̎(Ō̃L[t[ȂpreviousƓ)
+		float  weight;		//previousnextւ̕ԌW(ԋȐʂl)
+	};
+
+	//{[̃L[t[ǂ(t@C̏̂܂܁AȂt@C͓ǂ߂)
+	static void Read(FileView& fp, std::vector<VMDData>& motions);
+
+	//ԋȐ(_aEb3xWF)xɑ΂y߂(n̓j[g@̍ő̉)
+	static float BezierY(const float x, const XMFLOAT2& a, const XMFLOAT2& b, const uint8_t n);
+
+	/**
+		@brief	frameރL[t[T(VMDLoaderModelBenchŋ)
+		@param	keyframes t[ԍ̔z(frame_noEp1Ep2)
+		@return	ŏ̃L[t[OȂfalse
+	*/
+	template<class KeyFrames>
+	static bool FindSegment(const KeyFrames& keyframes, const float frame, Segment& segment)
+	{
+		auto it = std::upper_bound(std::begin(keyframes), std::end(keyframes), frame,
+			[](float value, const auto& keyFrame) { return value < static_cast<float>(keyFrame.frame_no); });
+		if (it == std::begin(keyframes))
+			return false;
+
+		segment.next     = static_cast<size_t>(it - std::begin(keyframes));
+		segment.previous = segment.next - 1;
+		if (it == std::end(keyframes)) {
+			segment.next   = segment.previous;
+			segment.weight = 0.0f;
+			return true;
+		}
+
+		const auto& previous = *(it - 1);
+		const float t = (frame - static_cast<float>(previous.frame_no)) / static_cast<float>(it->frame_no - previous.frame_no);
+		segment.weight = BezierY(t, it->p1, it->p2, 12);
+		return true;
+	}
+};
@@ -5,6 +5,7 @@
 #include "TextureLoader.h"
 #include "SpriteFont.h"
 #include "SpriteBatch9.h"
+#include "Invalidate.h"
 
 #include "Camera.h"
 #include "Model.h"
@@ -0,0 +1,21 @@
+﻿#pragma once
+
+#include <d3d9.h>
+#include <DirectXMath.h>
+
+namespace DX9
+{
+	// 描画で書き換えたレンダーターゲットの範囲の通知先(rectがnullptrなら全体)
+	typedef void (*InvalidateCallback)(void* context, const RECT* rect);
+
+	void SetInvalidateCallback(InvalidateCallback callback, void* context);
+
+	// 書き換えた範囲を通知する(nullptrは全体、通知先が無ければ何もしない)
+	void Invalidate(const RECT* rect);
+
+	// (left, top)-(right, bottom)をtransformで変換した四隅を囲む範囲を通知する
+	void Invalidate(
+		const DirectX::XMMATRIX& transform,
+		const float left, const float top, const float right, const float bottom
+	);
+};
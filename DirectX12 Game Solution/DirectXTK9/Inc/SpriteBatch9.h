@@ -2,6 +2,7 @@
 
 #include <d3dx9.h>
 #include <DirectXMath.h>
+#include "Invalidate.h"
 #include <wrl/client.h>
 
 #include <memory>
@@ -40,6 +41,7 @@ namespace DX9
             DirectX::XMFLOAT3 const* origin = nullptr
         )
         {
+            InvalidateSimple(texture, sourceRectangle, position, origin);
             m_sprite->Draw(texture, sourceRectangle, (D3DXVECTOR3*)origin, (D3DXVECTOR3*)&position, color);
         }
 
@@ -51,6 +53,7 @@ namespace DX9
             DirectX::XMFLOAT3 const& origin = Float3Zero
         )
         {
+            InvalidateSimple(texture, &sourceRectangle, position, &origin);
             m_sprite->Draw(texture, &sourceRectangle, (D3DXVECTOR3*)&origin, (D3DXVECTOR3*)&position, color);
         }
 
@@ -178,8 +181,23 @@ namespace DX9
         SpriteBatch9& operator= (SpriteBatch9 const&) = delete;
 
 	private:
+        // 描画する範囲をDX9::Invalidateで知らせる(Direct3D12へ写す範囲になる)
+        void InvalidateSprite(
+            DirectX::XMMATRIX const& transform,
+            IDirect3DTexture9* texture,
+            RECT const* sourceRectangle,
+            const float x, const float y
+        ) const;
+        void InvalidateSimple(
+            IDirect3DTexture9* texture,
+            RECT const* sourceRectangle,
+            DirectX::XMFLOAT3 const& position,
+            DirectX::XMFLOAT3 const* origin
+        ) const;
+
         Microsoft::WRL::ComPtr<IDirect3DDevice9> m_device;
         Microsoft::WRL::ComPtr<ID3DXSprite>      m_sprite;
+        bool                                     m_objectSpace = false;
 
         static const DirectX::XMFLOAT2 Float2Zero;
         static const DirectX::XMFLOAT3 Float3Zero;
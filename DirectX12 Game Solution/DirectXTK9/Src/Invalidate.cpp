@@ -0,0 +1,61 @@
+﻿#include "Invalidate.h"
+#include <algorithm>
+#include <cmath>
+
+namespace
+{
+	DX9::InvalidateCallback g_callback = nullptr;
+	void*                   g_context  = nullptr;
+
+	// フィルタリングでにじむ分
+	constexpr float BoundsMargin = 1.0f;
+};
+
+void DX9::SetInvalidateCallback(InvalidateCallback callback, void* context)
+{
+	g_callback = callback;
+	g_context  = context;
+}
+
+void DX9::Invalidate(const RECT* rect)
+{
+	if (g_callback)
+		g_callback(g_context, rect);
+}
+
+void DX9::Invalidate(
+	const DirectX::XMMATRIX& transform,
+	const float left, const float top, const float right, const float bottom
+)
+{
+	if (g_callback == nullptr)
+		return;
+
+	const DirectX::XMVECTOR corners[] = {
+		DirectX::XMVector3Transform(DirectX::XMVectorSet(left,  top,    0.0f, 1.0f), transform),
+		DirectX::XMVector3Transform(DirectX::XMVectorSet(right, top,    0.0f, 1.0f), transform),
+		DirectX::XMVector3Transform(DirectX::XMVectorSet(left,  bottom, 0.0f, 1.0f), transform),
+		DirectX::XMVector3Transform(DirectX::XMVectorSet(right, bottom, 0.0f, 1.0f), transform)
+	};
+	float minX = DirectX::XMVectorGetX(corners[0]), maxX = minX;
+	float minY = DirectX::XMVectorGetY(corners[0]), maxY = minY;
+	for (const auto& corner : corners) {
+		minX = std::min(minX, DirectX::XMVectorGetX(corner));
+		maxX = std::max(maxX, DirectX::XMVectorGetX(corner));
+		minY = std::min(minY, DirectX::XMVectorGetY(corner));
+		maxY = std::max(maxY, DirectX::XMVectorGetY(corner));
+	}
+	if (!std::isfinite(minX) || !std::isfinite(maxX) || !std::isfinite(minY) || !std::isfinite(maxY)) {
+		g_callback(g_context, nullptr);
+		return;
+	}
+
+	// 画面外の大きな値はintに収まる所で切る(画面に切り取るのは通知先)
+	constexpr float Limit = 1048576.0f;
+	RECT rect;
+	rect.left   = static_cast<LONG>(std::floor(std::max(minX - BoundsMargin, -Limit)));
+	rect.top    = static_cast<LONG>(std::floor(std::max(minY - BoundsMargin, -Limit)));
+	rect.right  = static_cast<LONG>(std::ceil (std::min(maxX + BoundsMargin,  Limit)));
+	rect.bottom = static_cast<LONG>(std::ceil (std::min(maxY + BoundsMargin,  Limit)));
+	g_callback(g_context, &rect);
+}
@@ -1,4 +1,5 @@
 #include "Model.h"
+#include "Invalidate.h"
 #include <exception>
 #include <map>
 #include <string>
@@ -28,6 +29,9 @@ DX9::Model::Model(
 
 void DX9::Model::Draw()
 {
+	// 3D̕`͉ʏ͈̔͂߂Ȃ̂őS
+	DX9::Invalidate(nullptr);
+
 	const DirectX::XMMATRIX world = GetWorldTransform();
 	m_device->SetTransform(D3DTS_WORLD, (D3DMATRIX*)&world);
 
@@ -1,4 +1,5 @@
 #include "SkinnedModel.h"
+#include "Invalidate.h"
 #include <exception>
 
 #pragma comment(lib, "d3d9.lib")
@@ -31,6 +32,9 @@ DX9::SkinnedModel::~SkinnedModel()
 
 void DX9::SkinnedModel::Draw()
 {
+	// 3D̕`͉ʏ͈̔͂߂Ȃ̂őS
+	DX9::Invalidate(nullptr);
+
 //	auto world_transform = GetWorldTransform();
 //	D3DXMATRIX world((float*)&world_transform);
 //	UpdateFrameMatrices(m_frameRoot, &world);
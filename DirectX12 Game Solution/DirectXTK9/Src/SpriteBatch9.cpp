@@ -25,6 +25,7 @@ DX9::SpriteBatch9::SpriteBatch9(IDirect3DDevice9* inDevice)
 
 void DX9::SpriteBatch9::Begin(const DWORD sortMode)
 {
+	m_objectSpace = (sortMode & D3DXSPRITE_OBJECTSPACE) != 0;
 	m_sprite->Begin(sortMode);
 	m_sprite->SetTransform((D3DXMATRIX*)&MatrixIdentity);
 
@@ -49,6 +50,10 @@ void DX9::SpriteBatch9::Draw(
 	transform     *= DirectX::XMMatrixRotationZ(rotation);
 	transform.r[3] = DirectX::XMLoadFloat3(&position);
 
+	InvalidateSprite(
+		transform, texture, sourceRectangle,
+		origin ? -origin->x : 0.0f, origin ? -origin->y : 0.0f
+	);
 	m_sprite->SetTransform((D3DXMATRIX*)&transform);
 	m_sprite->Draw(texture, sourceRectangle, (D3DXVECTOR3*)origin, nullptr, color);
 }
@@ -67,6 +72,7 @@ void DX9::SpriteBatch9::Draw(
 	transform     *= DirectX::XMMatrixRotationRollPitchYaw(rotation.x, rotation.y, rotation.z);
 	transform.r[3] = DirectX::XMLoadFloat3(&position);
 
+	InvalidateSprite(transform, texture, sourceRectangle, -origin.x, -origin.y);
 	m_sprite->SetTransform((D3DXMATRIX*)&transform);
 	m_sprite->Draw(texture, sourceRectangle, (D3DXVECTOR3*)&origin, nullptr, color);
 }
@@ -85,7 +91,68 @@ void DX9::SpriteBatch9::DrawString(
 	dest.right  = dest.left + 1;
 	dest.bottom = dest.top  + 1;
 
+	if (m_objectSpace) {
+		Invalidate(nullptr);
+	}
+	else {
+		RECT extent = dest;
+		font->DrawText(m_sprite.Get(), text, -1, &extent, DT_CALCRECT | DT_SINGLELINE, color);
+		Invalidate(
+			transform,
+			static_cast<float>(extent.left),  static_cast<float>(extent.top),
+			static_cast<float>(extent.right), static_cast<float>(extent.bottom)
+		);
+	}
+
 	m_sprite->SetTransform((D3DXMATRIX*)&transform);
 	font->DrawText(m_sprite.Get(), text, -1, &dest, DT_NOCLIP | DT_SINGLELINE, color);
 }
 
+// ワールド座標の描画(D3DXSPRITE_OBJECTSPACE)は画面上の範囲が分からないので全体
+void DX9::SpriteBatch9::InvalidateSprite(
+	DirectX::XMMATRIX const& transform,
+	IDirect3DTexture9* texture,
+	RECT const* sourceRectangle,
+	const float x, const float y
+) const
+{
+	if (m_objectSpace) {
+		Invalidate(nullptr);
+		return;
+	}
+
+	float width, height;
+	if (sourceRectangle) {
+		width  = static_cast<float>(sourceRectangle->right  - sourceRectangle->left);
+		height = static_cast<float>(sourceRectangle->bottom - sourceRectangle->top);
+	}
+	else {
+		D3DSURFACE_DESC desc;
+		if (texture == nullptr || texture->GetLevelDesc(0, &desc) != D3D_OK) {
+			Invalidate(nullptr);
+			return;
+		}
+		width  = static_cast<float>(desc.Width);
+		height = static_cast<float>(desc.Height);
+	}
+	Invalidate(transform, x, y, x + width, y + height);
+}
+
+// DrawSimpleは最後に設定した変換のまま描く
+void DX9::SpriteBatch9::InvalidateSimple(
+	IDirect3DTexture9* texture,
+	RECT const* sourceRectangle,
+	DirectX::XMFLOAT3 const& position,
+	DirectX::XMFLOAT3 const* origin
+) const
+{
+	D3DXMATRIX current;
+	m_sprite->GetTransform(&current);
+	const DirectX::XMMATRIX transform = DirectX::XMLoadFloat4x4((const DirectX::XMFLOAT4X4*)&current);
+
+	InvalidateSprite(
+		transform, texture, sourceRectangle,
+		position.x - (origin ? origin->x : 0.0f), position.y - (origin ? origin->y : 0.0f)
+	);
+}
+